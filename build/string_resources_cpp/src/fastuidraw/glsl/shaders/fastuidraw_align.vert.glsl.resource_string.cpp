@@ -0,0 +1,11 @@
+#include <fastuidraw/util/static_resource.hpp>
+
+namespace { 
+	const uint8_t values[]={ 
+47,42,33,10,32,42,32,92,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,97,108,105,103,110,46,118,101,114,116,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,32,92,98,114,105,101,102,32,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,97,108,105,103,110,46,118,101,114,116,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,10,32,42,32,67,111,112,121,114,105,103,104,116,32,50,48,49,56,32,98,121,32,73,110,116,101,108,46,10,32,42,10,32,42,32,67,111,110,116,97,99,116,58,32,107,101,118,105,110,46,114,111,103,111,118,105,110,64,105,110,116,101,108,46,99,111,109,10,32,42,10,32,42,32,84,104,105,115,32,83,111,117,114,99,101,32,67,111,100,101,32,70,111,114,109,32,105,115,32,115,117,98,106,101,99,116,32,116,111,32,116,104,101,10,32,42,32,116,101,114,109,115,32,111,102,32,116,104,101,32,77,111,122,105,108,108,97,32,80,117,98,108,105,99,32,76,105,99,101,110,115,101,44,32,118,46,32,50,46,48,46,10,32,42,32,73,102,32,97,32,99,111,112,121,32,111,102,32,116,104,101,32,77,80,76,32,119,97,115,32,110,111,116,32,100,105,115,116,114,105,98,117,116,101,100,32,119,105,116,104,10,32,42,32,116,104,105,115,32,102,105,108,101,44,32,89,111,117,32,99,97,110,32,111,98,116,97,105,110,32,111,110,101,32,97,116,10,32,42,32,104,116,116,112,58,47,47,109,111,122,105,108,108,97,46,111,114,103,47,77,80,76,47,50,46,48,47,46,10,32,42,10,32,42,32,92,97,117,116,104,111,114,32,75,101,118,105,110,32,82,111,103,111,118,105,110,32,60,107,101,118,105,110,46,114,111,103,111,118,105,110,64,105,110,116,101,108,46,99,111,109,62,10,32,42,10,32,42,47,10,10,10,118,111,105,100,10,102,97,115,116,117,105,100,114,97,119,95,97,108,105,103,110,95,99,111,109,112,117,116,101,95,81,95,97,100,106,111,105,110,116,95,81,40,105,110,32,118,101,99,51,32,112,99,108,105,112,95,112,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,109,97,116,50,32,81,44,32,111,117,116,32,109,97,116,50,32,97,100,106,81,41,10,123,10,32,32,118,101,99,51,32,99,108,105,112,59,10,32,32,99,108,105,112,32,61,32,118,101,99,51,40,102,97,115,116,117,105,100,114,97,119,95,118,105,101,119,112,111,114,116,95,112,105,120,101,108,115,44,32,49,46,48,41,32,42,32,112,99,108,105,112,95,112,59,10,10,32,32,118,101,99,50,32,99,48,44,32,99,49,59,10,32,32,99,48,46,120,32,61,32,99,108,105,112,46,122,32,42,32,102,97,115,116,117,105,100,114,97,119,95,105,116,101,109,95,109,97,116,114,105,120,91,48,93,46,120,32,45,32,99,108,105,112,46,120,32,42,32,102,97,115,116,117,105,100,114,97,119,95,105,116,101,109,95,109,97,116,114,105,120,91,48,93,46,122,59,10,32,32,99,48,46,121,32,61,32,99,108,105,112,46,122,32,42,32,102,97,115,116,117,105,100,114,97,119,95,105,116,101,109,95,109,97,116,114,105,120,91,48,93,46,121,32,45,32,99,108,105,112,46,121,32,42,32,102,97,115,116,117,105,100,114,97,119,95,105,116,101,109,95,109,97,116,114,105,120,91,48,93,46,122,59,10,32,32,99,49,46,120,32,61,32,99,108,105,112,46,122,32,42,32,102,97,115,116,117,105,100,114,97,119,95,105,116,101,109,95,109,97,116,114,105,120,91,49,93,46,120,32,45,32,99,108,105,112,46,120,32,42,32,102,97,115,116,117,105,100,114,97,119,95,105,116,101,109,95,109,97,116,114,105,120,91,49,93,46,122,59,10,32,32,99,49,46,121,32,61,32,99,108,105,112,46,122,32,42,32,102,97,115,116,117,105,100,114,97,119,95,105,116,101,109,95,109,97,116,114,105,120,91,49,93,46,121,32,45,32,99,108,105,112,46,121,32,42,32,102,97,115,116,117,105,100,114,97,119,95,105,116,101,109,95,109,97,116,114,105,120,91,49,93,46,122,59,10,10,32,32,81,32,61,32,109,97,116,50,40,99,48,44,32,99,49,41,59,10,32,32,97,100,106,81,32,61,32,109,97,116,50,40,32,81,91,49,93,91,49,93,44,32,45,81,91,48,93,91,49,93,44,32,45,81,91,49,93,91,48,93,44,32,81,91,48,93,91,48,93,41,59,10,125,10,10,118,101,99,50,10,102,97,115,116,117,105,100,114,97,119,95,97,108,105,103,110,95,110,111,114,109,97,108,95,116,111,95,115,99,114,101,101,110,40,105,110,32,118,101,99,51,32,99,108,105,112,95,112,44,32,105,110,32,118,101,99,50,32,110,41,10,123,10,32,32,109,97,116,50,32,81,44,32,97,100,106,81,59,10,10,32,32,102,97,115,116,117,105,100,114,97,119,95,97,108,105,103,110,95,99,111,109,112,117,116,101,95,81,95,97,100,106,111,105,110,116,95,81,40,99,108,105,112,95,112,44,32,81,44,32,97,100,106,81,41,59,10,10,32,32,118,101,99,50,32,110,95,115,99,114,101,101,110,44,32,116,95,115,99,114,101,101,110,44,32,116,59,10,10,32,32,116,32,61,32,118,101,99,50,40,45,110,46,121,44,32,110,46,120,41,59,10,32,32,116,95,115,99,114,101,101,110,32,61,32,102,97,115,116,117,105,100,114,97,119,95,118,105,101,119,112,111,114,116,95,112,105,120,101,108,115,32,42,32,40,81,32,42,32,116,41,59,10,32,32,110,95,115,99,114,101,101,110,32,61,32,118,101,99,50,40,116,95,115,99,114,101,101,110,46,121,44,32,45,116,95,115,99,114,101,101,110,46,120,41,59,10,10,32,32,47,42,32,78,79,84,69,33,10,32,32,32,32,32,32,32,87,101,32,100,111,32,78,79,84,32,100,105,118,105,100,101,32,98,121,32,116,104,101,32,100,101,116,32,111,102,32,81,44,32,116,104,105,115,32,105,115,32,98,101,99,97,117,115,101,10,32,32,32,32,32,32,32,119,101,32,111,110,108,121,32,99,97,114,101,32,97,98,111,117,116,32,116,104,101,32,45,100,105,114,101,99,116,105,111,110,45,32,111,102,32,114,101,116,117,114,110,10,32,32,32,32,32,32,32,118,97,108,117,101,44,32,110,111,116,32,116,104,101,32,109,97,103,110,105,116,117,100,101,44,32,116,104,117,115,32,116,104,101,32,97,100,106,111,105,110,116,32,105,115,10,32,32,32,32,32,32,32,103,111,111,100,32,101,110,111,117,103,104,32,91,97,110,100,32,105,116,32,97,118,111,105,100,115,32,117,115,32,110,101,101,100,105,110,103,32,116,111,32,100,101,97,108,10,32,32,32,32,32,32,32,119,105,116,104,32,97,32,116,104,101,32,99,97,115,101,32,105,102,32,116,104,101,32,100,101,116,101,114,109,105,110,97,110,116,32,105,115,32,48,93,46,10,32,32,32,42,47,10,32,32,114,101,116,117,114,110,32,97,100,106,81,32,42,32,40,102,97,115,116,117,105,100,114,97,119,95,118,105,101,119,112,111,114,116,95,114,101,99,105,112,95,112,105,120,101,108,115,32,42,32,110,95,115,99,114,101,101,110,41,59,10,125,10, 0 };
+
+ fastuidraw::static_resource R("fastuidraw_align.vert.glsl.resource_string", fastuidraw::c_array<const uint8_t>(values, sizeof(values)));
+ 
+
+}
+
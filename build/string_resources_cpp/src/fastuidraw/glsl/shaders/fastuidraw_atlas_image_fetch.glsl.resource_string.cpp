@@ -0,0 +1,11 @@
+#include <fastuidraw/util/static_resource.hpp>
+
+namespace { 
+	const uint8_t values[]={ 
+47,42,33,10,32,42,32,92,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,97,116,108,97,115,95,105,109,97,103,101,95,102,101,116,99,104,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,32,92,98,114,105,101,102,32,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,97,116,108,97,115,95,105,109,97,103,101,95,102,101,116,99,104,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,10,32,42,32,67,111,112,121,114,105,103,104,116,32,50,48,49,56,32,98,121,32,73,110,116,101,108,46,10,32,42,10,32,42,32,67,111,110,116,97,99,116,58,32,107,101,118,105,110,46,114,111,103,111,118,105,110,64,105,110,116,101,108,46,99,111,109,10,32,42,10,32,42,32,84,104,105,115,32,83,111,117,114,99,101,32,67,111,100,101,32,70,111,114,109,32,105,115,32,115,117,98,106,101,99,116,32,116,111,32,116,104,101,10,32,42,32,116,101,114,109,115,32,111,102,32,116,104,101,32,77,111,122,105,108,108,97,32,80,117,98,108,105,99,32,76,105,99,101,110,115,101,44,32,118,46,32,50,46,48,46,10,32,42,32,73,102,32,97,32,99,111,112,121,32,111,102,32,116,104,101,32,77,80,76,32,119,97,115,32,110,111,116,32,100,105,115,116,114,105,98,117,116,101,100,32,119,105,116,104,10,32,42,32,116,104,105,115,32,102,105,108,101,44,32,89,111,117,32,99,97,110,32,111,98,116,97,105,110,32,111,110,101,32,97,116,10,32,42,32,104,116,116,112,58,47,47,109,111,122,105,108,108,97,46,111,114,103,47,77,80,76,47,50,46,48,47,46,10,32,42,10,32,42,32,92,97,117,116,104,111,114,32,75,101,118,105,110,32,82,111,103,111,118,105,110,32,60,107,101,118,105,110,46,114,111,103,111,118,105,110,64,105,110,116,101,108,46,99,111,109,62,10,32,42,10,32,42,47,10,10,10,10,10,47,42,10,32,32,77,117,115,116,32,104,97,118,101,32,100,101,102,105,110,101,100,58,10,32,32,32,45,32,70,65,83,84,85,73,68,82,65,87,95,73,78,68,69,88,95,84,73,76,69,95,83,73,90,69,58,32,115,105,122,101,32,111,102,32,105,110,100,101,120,32,116,105,108,101,115,10,32,32,32,45,32,70,65,83,84,85,73,68,82,65,87,95,67,79,76,79,82,95,84,73,76,69,95,83,73,90,69,58,32,115,105,122,101,32,111,102,32,99,111,108,111,114,32,116,105,108,101,115,10,10,32,32,32,45,32,70,65,83,84,85,73,68,82,65,87,95,73,78,68,69,88,95,65,84,76,65,83,58,32,117,115,97,109,112,108,101,114,50,68,65,114,114,97,121,32,115,97,109,112,108,101,114,32,102,111,114,32,116,104,101,32,105,110,100,101,120,32,97,116,108,97,115,10,32,32,32,45,32,70,65,83,84,85,73,68,82,65,87,95,65,84,76,65,83,95,67,79,77,80,85,84,69,95,67,79,79,82,68,58,32,110,97,109,101,32,111,102,32,116,104,101,32,102,117,110,99,116,105,111,110,10,32,42,47,10,10,10,118,111,105,100,10,70,65,83,84,85,73,68,82,65,87,95,65,84,76,65,83,95,67,79,77,80,85,84,69,95,67,79,79,82,68,40,105,110,32,118,101,99,50,32,112,117,110,110,111,114,109,97,108,105,122,101,100,95,105,110,100,101,120,95,116,101,120,95,99,111,111,114,100,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,117,105,110,116,32,112,105,110,100,101,120,95,108,97,121,101,114,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,117,105,110,116,32,112,110,117,109,95,108,101,118,101,108,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,117,105,110,116,32,115,108,97,99,107,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,118,101,99,50,32,114,101,116,117,114,110,95,118,97,108,117,101,95,117,110,110,111,114,109,97,108,105,122,101,100,95,116,101,120,99,111,111,114,100,95,120,121,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,117,105,110,116,32,114,101,116,117,114,110,95,118,97,108,117,101,95,108,97,121,101,114,41,10,123,10,32,32,117,105,110,116,32,105,110,100,101,120,95,108,97,121,101,114,32,61,32,112,105,110,100,101,120,95,108,97,121,101,114,59,10,32,32,118,101,99,50,32,117,110,110,111,114,109,97,108,105,122,101,100,95,105,110,100,101,120,95,116,101,120,95,99,111,111,114,100,32,61,32,112,117,110,110,111,114,109,97,108,105,122,101,100,95,105,110,100,101,120,95,116,101,120,95,99,111,111,114,100,59,10,32,32,117,118,101,99,52,32,116,105,108,101,95,105,100,59,10,32,32,118,101,99,50,32,99,111,108,111,114,95,97,116,108,97,115,95,116,101,120,99,111,111,114,100,95,120,121,59,10,32,32,105,118,101,99,50,32,105,116,101,120,101,108,95,99,111,111,114,100,105,110,97,116,101,59,10,10,10,32,32,105,116,101,120,101,108,95,99,111,111,114,100,105,110,97,116,101,32,61,32,105,118,101,99,50,40,117,110,110,111,114,109,97,108,105,122,101,100,95,105,110,100,101,120,95,116,101,120,95,99,111,111,114,100,41,59,10,32,32,116,105,108,101,95,105,100,32,61,32,116,101,120,101,108,70,101,116,99,104,40,70,65,83,84,85,73,68,82,65,87,95,73,78,68,69,88,95,65,84,76,65,83,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,118,101,99,51,40,105,116,101,120,101,108,95,99,111,111,114,100,105,110,97,116,101,44,32,105,110,100,101,120,95,108,97,121,101,114,41,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,48,41,59,10,32,32,105,110,100,101,120,95,108,97,121,101,114,32,61,32,116,105,108,101,95,105,100,46,122,32,43,32,50,53,54,117,32,42,32,116,105,108,101,95,105,100,46,119,59,10,10,32,32,102,111,114,40,117,105,110,116,32,105,32,61,32,49,117,59,32,105,32,60,32,112,110,117,109,95,108,101,118,101,108,115,59,32,43,43,105,41,10,32,32,32,32,123,10,32,32,32,32,32,32,118,101,99,50,32,105,110,100,101,120,95,116,105,108,101,95,111,102,102,115,101,116,59,10,32,32,32,32,32,32,118,101,99,50,32,116,101,120,101,108,95,99,111,111,114,100,105,110,97,116,101,59,10,10,32,32,32,32,32,32,117,110,110,111,114,109,97,108,105,122,101,100,95,105,110,100,101,120,95,116,101,120,95,99,111,111,114,100,32,45,61,32,118,101,99,50,40,105,116,101,120,101,108,95,99,111,111,114,100,105,110,97,116,101,41,59,10,32,32,32,32,32,32,105,110,100,101,120,95,116,105,108,101,95,111,102,102,115,101,116,32,61,32,117,110,110,111,114,109,97,108,105,122,101,100,95,105,110,100,101,120,95,116,101,120,95,99,111,111,114,100,32,42,32,102,108,111,97,116,40,70,65,83,84,85,73,68,82,65,87,95,73,78,68,69,88,95,84,73,76,69,95,83,73,90,69,41,59,10,32,32,32,32,32,32,116,101,120,101,108,95,99,111,111,114,100,105,110,97,116,101,32,61,32,105,110,100,101,120,95,116,105,108,101,95,111,102,102,115,101,116,10,32,32,32,32,32,32,32,32,43,32,118,101,99,50,40,116,105,108,101,95,105,100,46,120,121,41,32,42,32,102,108,111,97,116,40,70,65,83,84,85,73,68,82,65,87,95,73,78,68,69,88,95,84,73,76,69,95,83,73,90,69,41,59,10,10,32,32,32,32,32,32,105,116,101,120,101,108,95,99,111,111,114,100,105,110,97,116,101,32,61,32,105,118,101,99,50,40,116,101,120,101,108,95,99,111,111,114,100,105,110,97,116,101,41,59,10,32,32,32,32,32,32,116,105,108,101,95,105,100,32,61,32,116,101,120,101,108,70,101,116,99,104,40,70,65,83,84,85,73,68,82,65,87,95,73,78,68,69,88,95,65,84,76,65,83,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,118,101,99,51,40,105,116,101,120,101,108,95,99,111,111,114,100,105,110,97,116,101,44,32,105,110,100,101,120,95,108,97,121,101,114,41,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,48,41,59,10,32,32,32,32,32,32,105,110,100,101,120,95,108,97,121,101,114,32,61,32,116,105,108,101,95,105,100,46,122,32,43,32,50,53,54,117,32,42,32,116,105,108,101,95,105,100,46,119,59,10,10,32,32,32,32,32,32,117,110,110,111,114,109,97,108,105,122,101,100,95,105,110,100,101,120,95,116,101,120,95,99,111,111,114,100,32,61,32,116,101,120,101,108,95,99,111,111,114,100,105,110,97,116,101,59,10,32,32,32,32,125,10,10,32,32,47,42,32,97,116,32,116,104,105,115,32,112,111,105,110,116,32,105,110,100,101,120,95,108,97,121,101,114,32,103,105,118,101,115,10,32,32,32,32,32,116,104,101,32,108,97,121,101,114,32,105,110,116,111,32,99,111,108,111,114,65,116,108,97,115,32,97,110,100,10,32,32,32,32,32,116,105,108,101,95,105,100,32,103,105,118,101,115,32,119,104,105,99,104,32,116,105,108,101,32,105,110,10,32,32,32,32,32,116,104,101,32,99,111,108,111,114,32,97,116,108,97,115,10,32,32,42,47,10,32,32,118,101,99,50,32,116,105,108,101,95,111,102,102,115,101,116,59,10,32,32,117,105,110,116,32,115,117,98,116,105,108,101,95,105,109,97,103,101,95,115,105,122,101,59,10,10,32,32,115,117,98,116,105,108,101,95,105,109,97,103,101,95,115,105,122,101,32,61,32,117,105,110,116,40,70,65,83,84,85,73,68,82,65,87,95,67,79,76,79,82,95,84,73,76,69,95,83,73,90,69,41,59,10,32,32,115,117,98,116,105,108,101,95,105,109,97,103,101,95,115,105,122,101,32,45,61,32,50,117,32,42,32,115,108,97,99,107,59,10,32,32,116,105,108,101,95,111,102,102,115,101,116,32,61,32,40,117,110,110,111,114,109,97,108,105,122,101,100,95,105,110,100,101,120,95,116,101,120,95,99,111,111,114,100,32,45,32,118,101,99,50,40,105,116,101,120,101,108,95,99,111,111,114,100,105,110,97,116,101,41,41,32,42,32,102,108,111,97,116,40,115,117,98,116,105,108,101,95,105,109,97,103,101,95,115,105,122,101,41,59,10,10,32,32,114,101,116,117,114,110,95,118,97,108,117,101,95,117,110,110,111,114,109,97,108,105,122,101,100,95,116,101,120,99,111,111,114,100,95,120,121,32,61,32,116,105,108,101,95,111,102,102,115,101,116,32,47,47,111,102,102,115,101,116,32,105,110,116,111,32,116,105,108,101,10,32,32,32,32,43,32,118,101,99,50,40,102,108,111,97,116,40,115,108,97,99,107,41,41,32,47,47,115,108,97,99,107,32,97,100,100,101,100,10,32,32,32,32,43,32,118,101,99,50,40,116,105,108,101,95,105,100,46,120,121,41,32,42,32,102,108,111,97,116,40,70,65,83,84,85,73,68,82,65,87,95,67,79,76,79,82,95,84,73,76,69,95,83,73,90,69,41,59,32,47,47,108,111,99,97,116,105,111,110,32,111,102,32,116,105,108,101,10,10,32,32,114,101,116,117,114,110,95,118,97,108,117,101,95,108,97,121,101,114,32,61,32,105,110,100,101,120,95,108,97,121,101,114,59,10,125,10, 0 };
+
+ fastuidraw::static_resource R("fastuidraw_atlas_image_fetch.glsl.resource_string", fastuidraw::c_array<const uint8_t>(values, sizeof(values)));
+ 
+
+}
+
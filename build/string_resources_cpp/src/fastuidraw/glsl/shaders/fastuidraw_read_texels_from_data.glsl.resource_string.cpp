@@ -0,0 +1,11 @@
+#include <fastuidraw/util/static_resource.hpp>
+
+namespace { 
+	const uint8_t values[]={ 
+47,42,33,10,32,42,32,92,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,116,101,120,101,108,115,95,102,114,111,109,95,100,97,116,97,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,32,92,98,114,105,101,102,32,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,116,101,120,101,108,115,95,102,114,111,109,95,100,97,116,97,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,10,32,42,32,67,111,112,121,114,105,103,104,116,32,50,48,49,56,32,98,121,32,73,110,116,101,108,46,10,32,42,10,32,42,32,67,111,110,116,97,99,116,58,32,107,101,118,105,110,46,114,111,103,111,118,105,110,64,105,110,116,101,108,46,99,111,109,10,32,42,10,32,42,32,84,104,105,115,32,83,111,117,114,99,101,32,67,111,100,101,32,70,111,114,109,32,105,115,32,115,117,98,106,101,99,116,32,116,111,32,116,104,101,10,32,42,32,116,101,114,109,115,32,111,102,32,116,104,101,32,77,111,122,105,108,108,97,32,80,117,98,108,105,99,32,76,105,99,101,110,115,101,44,32,118,46,32,50,46,48,46,10,32,42,32,73,102,32,97,32,99,111,112,121,32,111,102,32,116,104,101,32,77,80,76,32,119,97,115,32,110,111,116,32,100,105,115,116,114,105,98,117,116,101,100,32,119,105,116,104,10,32,42,32,116,104,105,115,32,102,105,108,101,44,32,89,111,117,32,99,97,110,32,111,98,116,97,105,110,32,111,110,101,32,97,116,10,32,42,32,104,116,116,112,58,47,47,109,111,122,105,108,108,97,46,111,114,103,47,77,80,76,47,50,46,48,47,46,10,32,42,10,32,42,32,92,97,117,116,104,111,114,32,75,101,118,105,110,32,82,111,103,111,118,105,110,32,60,107,101,118,105,110,46,114,111,103,111,118,105,110,64,105,110,116,101,108,46,99,111,109,62,10,32,42,10,32,42,47,10,10,117,105,110,116,10,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,116,101,120,101,108,95,102,114,111,109,95,100,97,116,97,40,105,110,32,105,118,101,99,50,32,99,111,111,114,100,44,32,105,110,32,117,118,101,99,50,32,100,105,109,115,44,32,105,110,32,117,105,110,116,32,108,111,99,97,116,105,111,110,41,10,123,10,32,32,117,105,110,116,32,120,44,32,121,44,32,98,108,111,99,107,95,111,102,102,115,101,116,44,32,98,108,111,99,107,59,10,32,32,117,105,110,116,32,98,105,116,48,120,44,32,98,105,116,48,121,59,10,10,32,32,105,102,32,40,99,111,111,114,100,46,120,32,60,32,48,32,124,124,32,99,111,111,114,100,46,121,32,60,32,48,41,10,32,32,32,32,123,10,32,32,32,32,32,32,114,101,116,117,114,110,32,48,117,59,10,32,32,32,32,125,10,10,32,32,120,32,61,32,117,105,110,116,40,99,111,111,114,100,46,120,41,59,10,32,32,121,32,61,32,117,105,110,116,40,99,111,111,114,100,46,121,41,59,10,10,32,32,105,102,32,40,120,32,62,61,32,100,105,109,115,46,120,32,124,124,32,121,32,62,61,32,100,105,109,115,46,121,41,10,32,32,32,32,123,10,32,32,32,32,32,32,114,101,116,117,114,110,32,48,117,59,10,32,32,32,32,125,10,10,32,32,47,42,32,110,111,116,101,32,116,104,101,32,40,100,105,109,115,46,120,40,41,32,43,32,49,117,41,44,32,116,104,105,115,32,105,115,32,98,101,99,97,117,115,101,32,101,97,99,104,32,98,108,111,99,107,32,105,115,32,50,120,50,10,32,32,32,42,32,116,101,120,101,108,115,32,97,110,100,32,105,102,32,119,32,105,115,32,111,100,100,44,32,116,104,101,32,100,105,109,101,110,115,105,111,110,32,105,115,32,114,111,117,110,100,101,100,32,45,85,80,45,44,10,32,32,32,42,32,116,104,117,115,32,97,100,100,105,110,103,32,49,117,32,98,101,102,111,114,101,32,116,104,101,32,98,105,116,115,104,105,102,116,32,100,111,101,115,32,116,104,101,32,106,111,98,32,111,102,10,32,32,32,42,32,114,111,117,110,100,105,110,103,32,117,112,46,10,32,32,32,42,47,10,32,32,98,108,111,99,107,95,111,102,102,115,101,116,32,61,32,108,111,99,97,116,105,111,110,32,43,32,40,120,32,62,62,32,49,117,41,32,43,32,40,121,32,62,62,32,49,117,41,32,42,32,40,40,100,105,109,115,46,120,32,43,32,49,117,41,32,62,62,32,49,117,41,59,10,32,32,98,108,111,99,107,32,61,32,102,97,115,116,117,105,100,114,97,119,95,102,101,116,99,104,95,103,108,121,112,104,95,100,97,116,97,40,98,108,111,99,107,95,111,102,102,115,101,116,41,59,10,10,32,32,47,42,32,110,111,119,32,114,101,97,100,32,116,104,101,32,99,111,114,114,101,99,116,32,56,45,98,105,116,115,32,102,114,111,109,32,116,104,101,32,98,108,111,99,107,32,42,47,10,32,32,98,105,116,48,120,32,61,32,40,40,120,32,38,32,49,117,41,32,33,61,32,48,117,41,32,63,32,56,117,32,58,32,48,117,59,10,32,32,98,105,116,48,121,32,61,32,40,40,121,32,38,32,49,117,41,32,33,61,32,48,117,41,32,63,32,49,54,117,32,58,32,48,117,59,10,32,32,114,101,116,117,114,110,32,70,65,83,84,85,73,68,82,65,87,95,69,88,84,82,65,67,84,95,66,73,84,83,40,98,105,116,48,120,32,43,32,98,105,116,48,121,44,32,56,117,44,32,98,108,111,99,107,41,59,10,125,10,10,47,42,32,82,101,97,100,115,32,97,32,116,101,120,101,108,32,111,102,32,97,32,71,108,121,112,104,82,101,110,100,101,114,68,97,116,97,77,83,68,70,44,32,119,104,105,99,104,32,115,116,111,114,101,115,10,32,42,32,111,110,101,32,116,101,120,101,108,32,112,101,114,32,51,50,45,98,105,116,32,118,97,108,117,101,32,119,105,116,104,32,116,104,101,32,114,101,100,32,99,104,97,110,110,101,108,32,105,110,32,116,104,101,10,32,42,32,108,111,119,101,115,116,32,56,45,98,105,116,115,46,32,84,104,101,32,99,111,111,114,100,105,110,97,116,101,32,105,115,32,99,108,97,109,112,101,100,32,116,111,32,116,104,101,32,116,101,120,101,108,115,10,32,42,32,111,102,32,116,104,101,32,103,108,121,112,104,59,32,116,104,101,32,103,108,121,112,104,32,105,115,32,100,114,97,119,110,32,111,110,108,121,32,119,105,116,104,105,110,32,105,116,115,32,116,101,120,101,108,115,10,32,42,32,115,111,32,99,108,97,109,112,105,110,103,32,40,105,110,115,116,101,97,100,32,111,102,32,116,114,101,97,116,105,110,103,32,116,101,120,101,108,115,32,98,101,121,111,110,100,32,116,104,101,32,103,108,121,112,104,10,32,42,32,97,115,32,111,117,116,115,105,100,101,41,32,107,101,101,112,115,32,116,104,101,32,100,105,115,116,97,110,99,101,32,118,97,108,117,101,115,32,99,111,114,114,101,99,116,32,110,101,97,114,32,116,104,101,10,32,42,32,115,105,100,101,115,32,111,102,32,116,104,101,32,103,108,121,112,104,46,10,32,42,47,10,118,101,99,52,10,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,109,115,100,102,95,116,101,120,101,108,95,102,114,111,109,95,100,97,116,97,40,105,110,32,105,118,101,99,50,32,99,111,111,114,100,44,32,105,110,32,117,118,101,99,50,32,100,105,109,115,44,32,105,110,32,117,105,110,116,32,108,111,99,97,116,105,111,110,41,10,123,10,32,32,117,105,110,116,32,120,44,32,121,44,32,116,101,120,101,108,59,10,10,32,32,105,102,32,40,100,105,109,115,46,120,32,61,61,32,48,117,32,124,124,32,100,105,109,115,46,121,32,61,61,32,48,117,41,10,32,32,32,32,123,10,32,32,32,32,32,32,114,101,116,117,114,110,32,118,101,99,52,40,48,46,48,41,59,10,32,32,32,32,125,10,10,32,32,120,32,61,32,117,105,110,116,40,99,108,97,109,112,40,99,111,111,114,100,46,120,44,32,48,44,32,105,110,116,40,100,105,109,115,46,120,41,32,45,32,49,41,41,59,10,32,32,121,32,61,32,117,105,110,116,40,99,108,97,109,112,40,99,111,111,114,100,46,121,44,32,48,44,32,105,110,116,40,100,105,109,115,46,121,41,32,45,32,49,41,41,59,10,10,32,32,116,101,120,101,108,32,61,32,102,97,115,116,117,105,100,114,97,119,95,102,101,116,99,104,95,103,108,121,112,104,95,100,97,116,97,40,108,111,99,97,116,105,111,110,32,43,32,120,32,43,32,121,32,42,32,100,105,109,115,46,120,41,59,10,32,32,114,101,116,117,114,110,32,118,101,99,52,40,102,108,111,97,116,40,70,65,83,84,85,73,68,82,65,87,95,69,88,84,82,65,67,84,95,66,73,84,83,40,48,117,44,32,56,117,44,32,116,101,120,101,108,41,41,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,108,111,97,116,40,70,65,83,84,85,73,68,82,65,87,95,69,88,84,82,65,67,84,95,66,73,84,83,40,56,117,44,32,56,117,44,32,116,101,120,101,108,41,41,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,108,111,97,116,40,70,65,83,84,85,73,68,82,65,87,95,69,88,84,82,65,67,84,95,66,73,84,83,40,49,54,117,44,32,56,117,44,32,116,101,120,101,108,41,41,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,108,111,97,116,40,70,65,83,84,85,73,68,82,65,87,95,69,88,84,82,65,67,84,95,66,73,84,83,40,50,52,117,44,32,56,117,44,32,116,101,120,101,108,41,41,41,59,10,125,10, 0 };
+
+ fastuidraw::static_resource R("fastuidraw_read_texels_from_data.glsl.resource_string", fastuidraw::c_array<const uint8_t>(values, sizeof(values)));
+ 
+
+}
+
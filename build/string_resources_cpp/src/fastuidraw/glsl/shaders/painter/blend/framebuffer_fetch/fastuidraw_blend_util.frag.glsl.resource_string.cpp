@@ -0,0 +1,11 @@
+#include <fastuidraw/util/static_resource.hpp>
+
+namespace { 
+	const uint8_t values[]={ 
+47,42,33,10,32,42,32,92,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,98,108,101,110,100,95,117,116,105,108,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,32,92,98,114,105,101,102,32,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,98,108,101,110,100,95,117,116,105,108,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,10,32,42,32,67,111,112,121,114,105,103,104,116,32,50,48,49,56,32,98,121,32,73,110,116,101,108,46,10,32,42,10,32,42,32,67,111,110,116,97,99,116,58,32,107,101,118,105,110,46,114,111,103,111,118,105,110,64,105,110,116,101,108,46,99,111,109,10,32,42,10,32,42,32,84,104,105,115,32,83,111,117,114,99,101,32,67,111,100,101,32,70,111,114,109,32,105,115,32,115,117,98,106,101,99,116,32,116,111,32,116,104,101,10,32,42,32,116,101,114,109,115,32,111,102,32,116,104,101,32,77,111,122,105,108,108,97,32,80,117,98,108,105,99,32,76,105,99,101,110,115,101,44,32,118,46,32,50,46,48,46,10,32,42,32,73,102,32,97,32,99,111,112,121,32,111,102,32,116,104,101,32,77,80,76,32,119,97,115,32,110,111,116,32,100,105,115,116,114,105,98,117,116,101,100,32,119,105,116,104,10,32,42,32,116,104,105,115,32,102,105,108,101,44,32,89,111,117,32,99,97,110,32,111,98,116,97,105,110,32,111,110,101,32,97,116,10,32,42,32,104,116,116,112,58,47,47,109,111,122,105,108,108,97,46,111,114,103,47,77,80,76,47,50,46,48,47,46,10,32,42,10,32,42,32,92,97,117,116,104,111,114,32,75,101,118,105,110,32,82,111,103,111,118,105,110,32,60,107,101,118,105,110,46,114,111,103,111,118,105,110,64,105,110,116,101,108,46,99,111,109,62,10,32,42,10,32,42,47,10,10,102,108,111,97,116,10,102,97,115,116,117,105,100,114,97,119,95,98,108,101,110,100,95,119,51,99,95,115,99,114,101,101,110,40,105,110,32,102,108,111,97,116,32,67,98,44,32,105,110,32,102,108,111,97,116,32,67,115,41,10,123,10,32,32,99,111,110,115,116,32,102,108,111,97,116,32,111,110,101,32,61,32,49,46,48,59,10,32,32,114,101,116,117,114,110,32,111,110,101,32,45,32,40,111,110,101,32,45,32,67,98,41,32,42,32,40,111,110,101,32,45,32,67,115,41,59,10,125,10,10,102,108,111,97,116,10,102,97,115,116,117,105,100,114,97,119,95,98,108,101,110,100,95,119,51,99,95,109,117,108,116,105,112,108,121,40,105,110,32,102,108,111,97,116,32,67,98,44,32,105,110,32,102,108,111,97,116,32,67,115,41,10,123,10,32,32,114,101,116,117,114,110,32,67,98,32,42,32,67,115,59,10,125,10,10,102,108,111,97,116,10,102,97,115,116,117,105,100,114,97,119,95,98,108,101,110,100,95,119,51,99,95,104,97,114,100,108,105,103,104,116,40,105,110,32,102,108,111,97,116,32,67,98,44,32,105,110,32,102,108,111,97,116,32,67,115,41,10,123,10,32,32,114,101,116,117,114,110,32,40,67,115,32,60,61,32,48,46,53,41,32,63,10,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,98,108,101,110,100,95,119,51,99,95,109,117,108,116,105,112,108,121,40,67,98,44,32,50,46,48,32,42,32,67,115,41,32,58,10,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,98,108,101,110,100,95,119,51,99,95,115,99,114,101,101,110,40,67,98,44,32,50,46,48,32,42,32,67,115,32,45,32,49,46,48,41,59,10,125,10,10,102,108,111,97,116,10,102,97,115,116,117,105,100,114,97,119,95,98,108,101,110,100,95,119,51,99,95,111,118,101,114,108,97,121,40,105,110,32,102,108,111,97,116,32,67,98,44,32,105,110,32,102,108,111,97,116,32,67,115,41,10,123,10,32,32,114,101,116,117,114,110,32,102,97,115,116,117,105,100,114,97,119,95,98,108,101,110,100,95,119,51,99,95,104,97,114,100,108,105,103,104,116,40,67,115,44,32,67,98,41,59,10,125,10,10,102,108,111,97,116,10,102,97,115,116,117,105,100,114,97,119,95,98,108,101,110,100,95,119,51,99,95,99,111,108,111,114,95,100,111,100,103,101,40,105,110,32,102,108,111,97,116,32,67,98,44,32,105,110,32,102,108,111,97,116,32,67,115,41,10,123,10,32,32,47,42,42,10,32,32,105,102,32,40,67,98,32,60,61,32,48,46,48,41,10,32,32,32,32,123,10,32,32,32,32,32,32,114,101,116,117,114,110,95,118,97,108,117,101,32,61,32,48,46,48,59,10,32,32,32,32,125,10,32,32,101,108,115,101,32,105,102,32,40,67,115,32,62,61,32,49,46,48,41,10,32,32,32,32,123,10,32,32,32,32,32,32,114,101,116,117,114,110,95,118,97,108,117,101,32,61,32,49,46,48,59,10,32,32,32,32,125,10,32,32,101,108,115,101,10,32,32,32,32,123,10,32,32,32,32,32,32,114,101,116,117,114,110,95,118,97,108,117,101,32,61,32,109,105,110,40,49,46,48,44,32,67,98,32,47,32,40,49,46,48,32,45,32,67,115,41,41,59,10,32,32,32,32,125,10,32,32,42,42,47,10,10,32,32,114,101,116,117,114,110,32,40,67,98,32,60,61,32,48,46,48,41,32,63,32,48,46,48,32,58,10,32,32,32,32,40,67,115,32,62,61,32,49,46,48,41,32,63,32,49,46,48,32,58,10,32,32,32,32,109,105,110,40,49,46,48,44,32,67,98,32,47,32,40,49,46,48,32,45,32,67,115,41,41,59,10,125,10,10,102,108,111,97,116,10,102,97,115,116,117,105,100,114,97,119,95,98,108,101,110,100,95,119,51,99,95,99,111,108,111,114,95,98,117,114,110,40,105,110,32,102,108,111,97,116,32,67,98,44,32,105,110,32,102,108,111,97,116,32,67,115,41,10,123,10,32,32,47,42,42,10,32,32,105,102,40,67,98,32,62,61,32,49,46,48,41,10,32,32,32,32,123,10,32,32,32,32,32,32,114,101,116,117,114,110,95,118,97,108,117,101,32,61,32,49,46,48,59,10,32,32,32,32,125,10,32,32,101,108,115,101,32,105,102,40,67,115,32,60,61,32,48,46,48,41,10,32,32,32,32,123,10,32,32,32,32,32,32,114,101,116,117,114,110,95,118,97,108,117,101,32,61,32,48,46,48,59,10,32,32,32,32,125,10,32,32,101,108,115,101,10,32,32,32,32,123,10,32,32,32,32,32,32,114,101,116,117,114,110,95,118,97,108,117,101,32,61,32,49,46,48,32,45,32,109,105,110,40,49,46,48,44,32,40,49,46,48,32,45,32,67,98,41,32,47,32,67,115,41,59,10,32,32,32,32,125,10,32,32,42,42,47,10,10,32,32,114,101,116,117,114,110,32,40,67,98,32,62,61,32,49,46,48,41,32,63,32,49,46,48,32,58,10,32,32,32,32,40,67,115,32,60,61,32,48,46,48,41,32,63,32,48,46,48,32,58,10,32,32,32,32,49,46,48,32,45,32,109,105,110,40,49,46,48,44,32,40,49,46,48,32,45,32,67,98,41,32,47,32,67,115,41,59,10,125,10,10,102,108,111,97,116,10,102,97,115,116,117,105,100,114,97,119,95,98,108,101,110,100,95,119,51,99,95,115,111,102,116,108,105,103,104,116,40,105,110,32,102,108,111,97,116,32,67,98,44,32,105,110,32,102,108,111,97,116,32,67,115,41,10,123,10,32,32,102,108,111,97,116,32,114,101,116,117,114,110,95,118,97,108,117,101,59,10,10,32,32,105,102,32,40,67,115,32,60,61,32,48,46,53,41,10,32,32,32,32,123,10,32,32,32,32,32,32,114,101,116,117,114,110,95,118,97,108,117,101,32,61,32,67,98,32,45,32,40,49,46,48,32,45,32,50,46,48,32,42,32,67,115,41,32,42,32,67,98,32,42,32,40,49,46,48,32,45,32,67,98,41,59,10,32,32,32,32,125,10,32,32,101,108,115,101,10,32,32,32,32,123,10,32,32,32,32,32,32,102,108,111,97,116,32,68,59,10,10,32,32,32,32,32,32,105,102,40,67,98,32,60,61,32,48,46,50,53,41,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,68,32,61,32,40,40,49,54,46,48,32,42,32,67,98,32,45,32,49,50,46,48,41,32,42,32,67,98,32,43,32,52,46,48,41,32,42,32,67,98,59,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,101,108,115,101,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,68,32,61,32,115,113,114,116,40,67,98,41,59,10,32,32,32,32,32,32,32,32,125,10,10,32,32,32,32,32,32,114,101,116,117,114,110,95,118,97,108,117,101,32,61,32,67,98,32,43,32,40,50,46,48,32,42,32,67,115,32,45,32,49,46,48,41,32,42,32,40,68,32,45,32,67,98,41,59,10,32,32,32,32,125,10,10,32,32,114,101,116,117,114,110,32,114,101,116,117,114,110,95,118,97,108,117,101,59,10,125,10,10,102,108,111,97,116,10,102,97,115,116,117,105,100,114,97,119,95,98,108,101,110,100,95,119,51,99,95,109,105,110,40,105,110,32,118,101,99,51,32,67,41,10,123,10,32,32,114,101,116,117,114,110,32,109,105,110,40,67,46,114,44,32,109,105,110,40,67,46,103,44,32,67,46,98,41,41,59,10,125,10,10,102,108,111,97,116,10,102,97,115,116,117,105,100,114,97,119,95,98,108,101,110,100,95,119,51,99,95,109,97,120,40,105,110,32,118,101,99,51,32,67,41,10,123,10,32,32,114,101,116,117,114,110,32,109,97,120,40,67,46,114,44,32,109,97,120,40,67,46,103,44,32,67,46,98,41,41,59,10,125,10,10,102,108,111,97,116,10,102,97,115,116,117,105,100,114,97,119,95,98,108,101,110,100,95,119,51,99,95,108,117,109,40,105,110,32,118,101,99,51,32,67,41,10,123,10,32,32,114,101,116,117,114,110,32,100,111,116,40,67,44,32,118,101,99,51,40,48,46,51,44,32,48,46,53,57,44,32,48,46,49,49,41,41,59,10,125,10,10,102,108,111,97,116,10,102,97,115,116,117,105,100,114,97,119,95,98,108,101,110,100,95,119,51,99,95,115,97,116,40,105,110,32,118,101,99,51,32,67,41,10,123,10,32,32,114,101,116,117,114,110,32,102,97,115,116,117,105,100,114,97,119,95,98,108,101,110,100,95,119,51,99,95,109,97,120,40,67,41,32,45,32,102,97,115,116,117,105,100,114,97,119,95,98,108,101,110,100,95,119,51,99,95,109,105,110,40,67,41,59,10,125,10,10,118,101,99,51,10,102,97,115,116,117,105,100,114,97,119,95,98,108,101,110,100,95,119,51,99,95,99,108,105,112,99,111,108,111,114,40,105,110,32,118,101,99,51,32,67,41,10,123,10,32,32,102,108,111,97,116,32,108,117,109,67,32,61,32,102,97,115,116,117,105,100,114,97,119,95,98,108,101,110,100,95,119,51,99,95,108,117,109,40,67,41,59,10,32,32,102,108,111,97,116,32,109,105,110,67,32,61,32,102,97,115,116,117,105,100,114,97,119,95,98,108,101,110,100,95,119,51,99,95,109,105,110,40,67,41,59,10,32,32,102,108,111,97,116,32,109,97,120,67,32,61,32,102,97,115,116,117,105,100,114,97,119,95,98,108,101,110,100,95,119,51,99,95,109,97,120,40,67,41,59,10,32,32,118,101,99,51,32,108,117,109,67,118,32,61,32,118,101,99,51,40,108,117,109,67,41,59,10,10,32,32,105,102,32,40,109,105,110,67,32,60,32,48,46,48,41,10,32,32,32,32,123,10,32,32,32,32,32,32,102,108,111,97,116,32,102,97,99,116,111,114,59,10,32,32,32,32,32,32,102,97,99,116,111,114,32,61,32,108,117,109,67,32,47,32,40,108,117,109,67,32,45,32,109,105,110,67,41,59,10,32,32,32,32,32,32,67,32,61,32,108,117,109,67,118,32,43,32,40,67,32,45,32,108,117,109,67,118,41,32,42,32,102,97,99,116,111,114,59,10,32,32,32,32,125,10,32,32,101,108,115,101,32,105,102,32,40,109,97,120,67,32,62,32,49,46,48,41,10,32,32,32,32,123,10,32,32,32,32,32,32,102,108,111,97,116,32,102,97,99,116,111,114,59,10,32,32,32,32,32,32,102,97,99,116,111,114,32,61,32,40,49,46,48,32,45,32,108,117,109,67,41,32,47,32,40,109,97,120,67,32,45,32,108,117,109,67,41,59,10,32,32,32,32,32,32,67,32,61,32,108,117,109,67,118,32,43,32,40,67,32,45,32,108,117,109,67,118,41,32,42,32,102,97,99,116,111,114,59,10,32,32,32,32,125,10,32,32,114,101,116,117,114,110,32,67,59,10,125,10,10,118,101,99,51,10,102,97,115,116,117,105,100,114,97,119,95,98,108,101,110,100,95,119,51,99,95,115,101,116,95,108,117,109,40,105,110,32,118,101,99,51,32,99,66,97,115,101,44,32,105,110,32,118,101,99,51,32,99,76,117,109,41,10,123,10,32,32,102,108,111,97,116,32,108,66,97,115,101,32,61,32,102,97,115,116,117,105,100,114,97,119,95,98,108,101,110,100,95,119,51,99,95,108,117,109,40,99,66,97,115,101,41,59,10,32,32,102,108,111,97,116,32,108,76,117,109,32,61,32,102,97,115,116,117,105,100,114,97,119,95,98,108,101,110,100,95,119,51,99,95,108,117,109,40,99,76,117,109,41,59,10,32,32,102,108,111,97,116,32,108,68,105,102,102,32,61,32,108,76,117,109,32,45,32,108,66,97,115,101,59,10,32,32,114,101,116,117,114,110,32,102,97,115,116,117,105,100,114,97,119,95,98,108,101,110,100,95,119,51,99,95,99,108,105,112,99,111,108,111,114,40,99,66,97,115,101,32,43,32,118,101,99,51,40,108,68,105,102,102,41,41,59,10,125,10,10,118,101,99,51,10,102,97,115,116,117,105,100,114,97,119,95,98,108,101,110,100,95,119,51,99,95,115,101,116,95,108,117,109,95,115,97,116,40,105,110,32,118,101,99,51,32,99,66,97,115,101,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,118,101,99,51,32,99,83,97,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,118,101,99,51,32,99,76,117,109,41,10,123,10,32,32,102,108,111,97,116,32,109,105,110,66,97,115,101,32,61,32,102,97,115,116,117,105,100,114,97,119,95,98,108,101,110,100,95,119,51,99,95,109,105,110,40,99,66,97,115,101,41,59,10,32,32,102,108,111,97,116,32,115,66,97,115,101,32,61,32,102,97,115,116,117,105,100,114,97,119,95,98,108,101,110,100,95,119,51,99,95,115,97,116,40,99,66,97,115,101,41,59,10,32,32,102,108,111,97,116,32,115,83,97,116,32,61,32,102,97,115,116,117,105,100,114,97,119,95,98,108,101,110,100,95,119,51,99,95,115,97,116,40,99,83,97,116,41,59,10,32,32,118,101,99,51,32,99,111,108,111,114,59,10,10,32,32,105,102,32,40,115,66,97,115,101,32,62,32,48,46,48,41,10,32,32,32,32,123,10,32,32,32,32,32,32,99,111,108,111,114,32,61,32,40,99,66,97,115,101,32,45,32,118,101,99,51,40,109,105,110,66,97,115,101,41,41,32,42,32,40,115,83,97,116,32,47,32,115,66,97,115,101,41,59,10,32,32,32,32,125,10,32,32,101,108,115,101,10,32,32,32,32,123,10,32,32,32,32,32,32,99,111,108,111,114,32,61,32,118,101,99,51,40,48,46,48,41,59,10,32,32,32,32,125,10,32,32,114,101,116,117,114,110,32,102,97,115,116,117,105,100,114,97,119,95,98,108,101,110,100,95,119,51,99,95,115,101,116,95,108,117,109,40,99,111,108,111,114,44,32,99,76,117,109,41,59,10,125,10, 0 };
+
+ fastuidraw::static_resource R("fastuidraw_blend_util.frag.glsl.resource_string", fastuidraw::c_array<const uint8_t>(values, sizeof(values)));
+ 
+
+}
+
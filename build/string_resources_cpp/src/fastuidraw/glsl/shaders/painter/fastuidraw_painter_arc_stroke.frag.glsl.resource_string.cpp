@@ -0,0 +1,11 @@
+#include <fastuidraw/util/static_resource.hpp>
+
+namespace { 
+	const uint8_t values[]={ 
+47,42,33,10,32,42,32,92,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,95,97,114,99,95,115,116,114,111,107,101,46,102,114,97,103,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,32,92,98,114,105,101,102,32,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,95,97,114,99,95,115,116,114,111,107,101,46,102,114,97,103,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,10,32,42,32,67,111,112,121,114,105,103,104,116,32,50,48,49,56,32,98,121,32,73,110,116,101,108,46,10,32,42,10,32,42,32,67,111,110,116,97,99,116,58,32,107,101,118,105,110,46,114,111,103,111,118,105,110,64,105,110,116,101,108,46,99,111,109,10,32,42,10,32,42,32,84,104,105,115,32,83,111,117,114,99,101,32,67,111,100,101,32,70,111,114,109,32,105,115,32,115,117,98,106,101,99,116,32,116,111,32,116,104,101,10,32,42,32,116,101,114,109,115,32,111,102,32,116,104,101,32,77,111,122,105,108,108,97,32,80,117,98,108,105,99,32,76,105,99,101,110,115,101,44,32,118,46,32,50,46,48,46,10,32,42,32,73,102,32,97,32,99,111,112,121,32,111,102,32,116,104,101,32,77,80,76,32,119,97,115,32,110,111,116,32,100,105,115,116,114,105,98,117,116,101,100,32,119,105,116,104,10,32,42,32,116,104,105,115,32,102,105,108,101,44,32,89,111,117,32,99,97,110,32,111,98,116,97,105,110,32,111,110,101,32,97,116,10,32,42,32,104,116,116,112,58,47,47,109,111,122,105,108,108,97,46,111,114,103,47,77,80,76,47,50,46,48,47,46,10,32,42,10,32,42,32,92,97,117,116,104,111,114,32,75,101,118,105,110,32,82,111,103,111,118,105,110,32,60,107,101,118,105,110,46,114,111,103,111,118,105,110,64,105,110,116,101,108,46,99,111,109,62,10,32,42,10,32,42,47,10,10,10,118,101,99,52,10,102,97,115,116,117,105,100,114,97,119,95,103,108,95,102,114,97,103,95,109,97,105,110,40,105,110,32,117,105,110,116,32,115,117,98,95,115,104,97,100,101,114,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,117,105,110,116,32,115,104,97,100,101,114,95,100,97,116,97,95,111,102,102,115,101,116,41,10,123,10,32,32,102,108,111,97,116,32,97,108,112,104,97,32,61,32,49,46,48,59,10,32,32,117,105,110,116,32,114,101,110,100,101,114,95,112,97,115,115,44,32,97,97,95,109,101,116,104,111,100,44,32,100,97,115,104,95,115,116,121,108,101,59,10,10,32,32,114,101,110,100,101,114,95,112,97,115,115,32,61,32,70,65,83,84,85,73,68,82,65,87,95,69,88,84,82,65,67,84,95,66,73,84,83,40,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,115,117,98,95,115,104,97,100,101,114,95,114,101,110,100,101,114,95,112,97,115,115,95,98,105,116,48,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,115,117,98,95,115,104,97,100,101,114,95,114,101,110,100,101,114,95,112,97,115,115,95,110,117,109,95,98,105,116,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,115,117,98,95,115,104,97,100,101,114,41,59,10,10,32,32,100,97,115,104,95,115,116,121,108,101,32,61,32,70,65,83,84,85,73,68,82,65,87,95,69,88,84,82,65,67,84,95,66,73,84,83,40,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,115,117,98,95,115,104,97,100,101,114,95,100,97,115,104,95,115,116,121,108,101,95,98,105,116,48,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,115,117,98,95,115,104,97,100,101,114,95,100,97,115,104,95,115,116,121,108,101,95,110,117,109,95,98,105,116,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,115,117,98,95,115,104,97,100,101,114,41,59,10,10,32,32,97,97,95,109,101,116,104,111,100,32,61,32,70,65,83,84,85,73,68,82,65,87,95,69,88,84,82,65,67,84,95,66,73,84,83,40,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,115,117,98,95,115,104,97,100,101,114,95,97,97,95,109,101,116,104,111,100,95,98,105,116,48,44,32,49,117,44,32,115,117,98,95,115,104,97,100,101,114,41,59,10,10,32,32,105,102,32,40,97,97,95,109,101,116,104,111,100,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,99,111,118,101,114,95,116,104,101,110,95,100,114,97,119,32,38,38,32,114,101,110,100,101,114,95,112,97,115,115,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,97,97,95,112,97,115,115,50,41,10,32,32,32,32,123,10,32,32,32,32,32,32,114,101,116,117,114,110,32,118,101,99,52,40,49,46,48,44,32,49,46,48,44,32,49,46,48,44,32,102,97,115,116,117,105,100,114,97,119,95,99,108,101,97,114,95,97,117,120,105,108,105,97,114,121,40,41,41,59,10,32,32,32,32,125,10,10,32,32,102,108,111,97,116,32,114,44,32,100,44,32,113,44,32,113,119,44,32,113,108,44,32,113,108,119,59,10,32,32,102,108,111,97,116,32,83,44,32,82,59,10,10,32,32,114,32,61,32,108,101,110,103,116,104,40,118,101,99,50,40,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,105,110,103,95,114,101,108,97,116,105,118,101,95,116,111,95,99,101,110,116,101,114,95,120,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,105,110,103,95,114,101,108,97,116,105,118,101,95,116,111,95,99,101,110,116,101,114,95,121,41,41,59,10,10,32,32,83,32,61,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,105,110,103,95,115,116,114,111,107,101,95,114,97,100,105,117,115,59,10,32,32,82,32,61,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,105,110,103,95,97,114,99,95,114,97,100,105,117,115,59,10,32,32,105,102,32,40,100,97,115,104,95,115,116,121,108,101,32,33,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,110,111,116,95,100,97,115,104,101,100,41,10,32,32,32,32,123,10,32,32,32,32,32,32,105,102,32,40,40,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,105,110,103,95,100,97,115,104,95,98,105,116,115,32,38,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,101,95,105,110,118,101,114,116,101,100,95,105,110,110,101,114,95,114,101,103,105,111,110,95,109,97,115,107,41,32,33,61,32,48,117,41,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,83,32,61,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,105,110,103,95,115,116,114,111,107,101,95,114,97,100,105,117,115,32,45,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,105,110,103,95,97,114,99,95,114,97,100,105,117,115,59,10,32,32,32,32,32,32,32,32,32,32,82,32,61,32,48,46,48,59,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,125,10,10,32,32,113,32,61,32,83,32,45,32,97,98,115,40,114,32,45,32,82,41,59,10,32,32,113,119,32,61,32,102,119,105,100,116,104,40,113,41,59,10,32,32,100,32,61,32,109,97,120,40,97,98,115,40,113,41,44,32,113,119,41,59,10,10,32,32,113,108,32,61,32,49,46,48,32,45,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,105,110,103,95,114,101,108,97,116,105,118,101,95,116,111,95,99,101,110,116,101,114,95,120,59,10,32,32,113,108,119,32,61,32,102,119,105,100,116,104,40,113,108,41,59,10,10,32,32,105,102,32,40,100,97,115,104,95,115,116,121,108,101,32,33,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,110,111,116,95,100,97,115,104,101,100,41,10,32,32,32,32,123,10,32,32,32,32,32,32,102,108,111,97,116,32,116,104,101,116,97,44,32,116,104,101,116,97,119,44,32,100,105,115,116,44,32,100,105,115,116,119,44,32,98,100,44,32,98,100,119,59,10,10,32,32,32,32,32,32,100,97,115,104,95,115,116,121,108,101,32,61,32,70,65,83,84,85,73,68,82,65,87,95,69,88,84,82,65,67,84,95,66,73,84,83,40,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,115,117,98,95,115,104,97,100,101,114,95,100,97,115,104,95,115,116,121,108,101,95,98,105,116,48,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,115,117,98,95,115,104,97,100,101,114,95,100,97,115,104,95,115,116,121,108,101,95,110,117,109,95,98,105,116,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,115,117,98,95,115,104,97,100,101,114,41,59,10,10,32,32,32,32,32,32,116,104,101,116,97,32,61,32,97,116,97,110,40,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,105,110,103,95,114,101,108,97,116,105,118,101,95,116,111,95,99,101,110,116,101,114,95,121,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,105,110,103,95,114,101,108,97,116,105,118,101,95,116,111,95,99,101,110,116,101,114,95,120,41,59,10,32,32,32,32,32,32,116,104,101,116,97,119,32,61,32,102,119,105,100,116,104,40,116,104,101,116,97,41,59,10,32,32,32,32,32,32,100,105,115,116,32,61,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,105,110,103,95,100,105,115,116,97,110,99,101,59,10,32,32,32,32,32,32,100,105,115,116,119,32,61,32,102,119,105,100,116,104,40,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,105,110,103,95,100,105,115,116,97,110,99,101,41,59,10,10,32,32,32,32,32,32,105,102,32,40,40,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,105,110,103,95,100,97,115,104,95,98,105,116,115,32,38,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,103,97,117,114,97,110,116,101,101,100,95,116,111,95,98,101,95,99,111,118,101,114,101,100,95,109,97,115,107,41,32,61,61,32,48,117,41,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,105,102,32,40,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,105,110,103,95,97,114,99,95,114,97,100,105,117,115,32,62,32,45,48,46,53,41,10,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,102,32,40,40,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,105,110,103,95,100,97,115,104,95,98,105,116,115,32,38,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,101,95,110,101,103,97,116,105,118,101,95,97,114,99,95,97,110,103,108,101,95,109,97,115,107,41,32,33,61,32,48,117,41,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,116,104,101,116,97,32,61,32,45,116,104,101,116,97,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,102,32,40,40,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,105,110,103,95,100,97,115,104,95,98,105,116,115,32,38,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,103,97,117,114,97,110,116,101,101,100,95,116,111,95,98,101,95,99,111,118,101,114,101,100,95,109,97,115,107,41,32,33,61,32,48,117,41,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,116,104,101,116,97,32,61,32,45,116,104,101,116,97,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,108,111,97,116,32,114,101,99,105,112,32,61,32,49,46,48,32,47,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,105,110,103,95,115,116,114,111,107,101,95,114,97,100,105,117,115,59,10,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,100,105,115,116,32,43,61,32,116,104,101,116,97,32,42,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,105,110,103,95,97,114,99,95,114,97,100,105,117,115,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,100,105,115,116,119,32,61,32,116,104,101,116,97,119,32,42,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,105,110,103,95,97,114,99,95,114,97,100,105,117,115,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,98,100,32,61,32,49,46,48,32,45,32,113,32,42,32,114,101,99,105,112,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,98,100,119,32,61,32,113,119,32,42,32,114,101,99,105,112,59,10,32,32,32,32,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,32,32,101,108,115,101,10,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,98,100,32,61,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,105,110,103,95,114,101,108,97,116,105,118,101,95,116,111,95,99,101,110,116,101,114,95,120,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,98,100,119,32,61,32,113,108,119,59,10,32,32,32,32,32,32,32,32,32,32,32,32,125,10,10,32,32,32,32,32,32,32,32,32,32,98,111,111,108,32,100,111,110,116,95,97,110,116,105,95,97,108,105,97,115,95,100,97,115,104,95,98,111,117,110,100,97,114,121,44,32,115,107,105,112,95,108,111,111,107,117,112,59,10,10,32,32,32,32,32,32,32,32,32,32,115,107,105,112,95,108,111,111,107,117,112,32,61,10,32,32,32,32,32,32,32,32,32,32,32,32,40,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,105,110,103,95,100,97,115,104,95,98,105,116,115,32,38,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,115,107,105,112,95,100,97,115,104,95,105,110,116,101,114,118,97,108,95,108,111,111,107,117,112,95,109,97,115,107,41,32,33,61,32,48,117,59,10,10,32,32,32,32,32,32,32,32,32,32,100,111,110,116,95,97,110,116,105,95,97,108,105,97,115,95,100,97,115,104,95,98,111,117,110,100,97,114,121,32,61,32,40,114,101,110,100,101,114,95,112,97,115,115,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,110,111,110,95,97,97,41,10,32,32,32,32,32,32,32,32,32,32,32,32,124,124,32,40,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,105,110,103,95,100,97,115,104,95,98,105,116,115,32,38,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,100,105,115,116,97,110,99,101,95,99,111,110,115,116,97,110,116,41,32,33,61,32,48,117,59,10,10,32,32,32,32,32,32,32,32,32,32,105,102,32,40,100,97,115,104,95,115,116,121,108,101,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,100,97,115,104,101,100,95,102,108,97,116,95,99,97,112,115,41,10,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,97,108,112,104,97,32,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,99,111,109,112,117,116,101,95,100,97,115,104,95,99,111,118,101,114,97,103,101,40,115,104,97,100,101,114,95,100,97,116,97,95,111,102,102,115,101,116,44,32,100,105,115,116,44,32,100,105,115,116,119,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,115,107,105,112,95,108,111,111,107,117,112,44,32,100,111,110,116,95,97,110,116,105,95,97,108,105,97,115,95,100,97,115,104,95,98,111,117,110,100,97,114,121,41,59,10,32,32,32,32,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,32,32,101,108,115,101,10,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,97,108,112,104,97,32,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,99,111,109,112,117,116,101,95,100,97,115,104,95,99,111,118,101,114,97,103,101,40,100,97,115,104,95,115,116,121,108,101,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,100,97,115,104,101,100,95,114,111,117,110,100,101,100,95,99,97,112,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,100,97,115,104,95,115,116,121,108,101,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,100,97,115,104,101,100,95,115,113,117,97,114,101,95,99,97,112,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,115,104,97,100,101,114,95,100,97,116,97,95,111,102,102,115,101,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,100,105,115,116,44,32,100,105,115,116,119,44,32,98,100,44,32,98,100,119,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,105,110,103,95,100,105,115,116,97,110,99,101,95,115,117,98,95,101,100,103,101,95,115,116,97,114,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,105,110,103,95,100,105,115,116,97,110,99,101,95,115,117,98,95,101,100,103,101,95,101,110,100,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,115,107,105,112,95,108,111,111,107,117,112,44,32,100,111,110,116,95,97,110,116,105,95,97,108,105,97,115,95,100,97,115,104,95,98,111,117,110,100,97,114,121,41,59,10,32,32,32,32,32,32,32,32,32,32,32,32,125,10,10,32,32,32,32,32,32,32,32,32,32,105,102,32,40,97,97,95,109,101,116,104,111,100,32,33,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,99,111,118,101,114,95,116,104,101,110,95,100,114,97,119,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,38,38,32,114,101,110,100,101,114,95,112,97,115,115,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,97,97,95,112,97,115,115,49,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,38,38,32,97,108,112,104,97,32,60,32,49,46,48,32,45,32,49,46,48,32,47,32,50,53,53,46,48,41,10,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,97,108,112,104,97,32,61,32,48,46,48,59,10,32,32,32,32,32,32,32,32,32,32,32,32,125,10,10,32,32,32,32,32,32,32,32,32,32,105,102,32,40,114,101,110,100,101,114,95,112,97,115,115,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,110,111,110,95,97,97,41,10,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,102,32,40,97,108,112,104,97,32,60,32,49,46,48,32,45,32,49,46,48,32,47,32,50,53,53,46,48,41,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,70,65,83,84,85,73,68,82,65,87,95,68,73,83,67,65,82,68,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,101,108,115,101,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,97,108,112,104,97,32,61,32,49,46,48,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,125,10,10,32,32,47,42,32,65,32,110,101,103,116,105,118,101,32,97,114,99,95,114,97,100,105,117,115,32,105,110,100,105,99,97,116,101,115,32,116,104,97,116,32,105,116,32,105,115,32,97,32,115,101,103,109,101,110,116,32,42,47,10,32,32,105,102,32,40,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,105,110,103,95,97,114,99,95,114,97,100,105,117,115,32,62,32,45,48,46,53,41,10,32,32,32,32,123,10,32,32,32,32,32,32,105,102,32,40,114,101,110,100,101,114,95,112,97,115,115,32,33,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,110,111,110,95,97,97,41,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,97,108,112,104,97,32,42,61,32,109,97,120,40,48,46,48,44,32,113,32,47,32,100,41,59,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,101,108,115,101,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,105,102,32,40,113,32,60,32,48,46,48,41,10,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,70,65,83,84,85,73,68,82,65,87,95,68,73,83,67,65,82,68,59,10,32,32,32,32,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,32,32,97,108,112,104,97,32,61,32,49,46,48,59,10,32,32,32,32,32,32,32,32,125,10,10,32,32,32,32,125,10,32,32,101,108,115,101,10,32,32,32,32,123,10,32,32,32,32,32,32,105,102,32,40,114,101,110,100,101,114,95,112,97,115,115,32,33,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,110,111,110,95,97,97,41,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,102,108,111,97,116,32,100,100,59,10,32,32,32,32,32,32,32,32,32,32,113,32,61,32,49,46,48,59,10,32,32,32,32,32,32,32,32,32,32,100,100,32,61,32,109,97,120,40,113,108,44,32,113,108,119,41,59,10,32,32,32,32,32,32,32,32,32,32,97,108,112,104,97,32,42,61,32,113,108,32,47,32,100,100,59,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,101,108,115,101,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,97,108,112,104,97,32,61,32,49,46,48,59,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,125,10,10,32,32,105,102,32,40,97,97,95,109,101,116,104,111,100,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,99,111,118,101,114,95,116,104,101,110,95,100,114,97,119,41,10,32,32,32,32,123,10,32,32,32,32,32,32,105,102,32,40,114,101,110,100,101,114,95,112,97,115,115,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,97,97,95,112,97,115,115,49,41,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,109,97,120,95,97,117,120,105,108,105,97,114,121,40,97,108,112,104,97,41,59,10,32,32,32,32,32,32,32,32,32,32,97,108,112,104,97,32,61,32,48,46,48,59,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,125,10,32,32,101,108,115,101,32,105,102,32,40,100,97,115,104,95,115,116,121,108,101,32,33,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,110,111,116,95,100,97,115,104,101,100,41,10,32,32,32,32,123,10,32,32,32,32,32,32,105,102,32,40,114,101,110,100,101,114,95,112,97,115,115,32,33,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,97,97,95,112,97,115,115,50,32,38,38,32,97,108,112,104,97,32,60,32,49,46,48,32,45,32,49,46,48,32,47,32,50,53,53,46,48,41,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,70,65,83,84,85,73,68,82,65,87,95,68,73,83,67,65,82,68,59,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,125,10,32,32,101,108,115,101,10,32,32,32,32,123,10,32,32,32,32,32,32,105,102,32,40,114,101,110,100,101,114,95,112,97,115,115,32,33,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,97,97,95,112,97,115,115,50,32,38,38,32,97,108,112,104,97,32,60,32,49,46,48,32,45,32,49,46,48,32,47,32,50,53,53,46,48,41,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,70,65,83,84,85,73,68,82,65,87,95,68,73,83,67,65,82,68,59,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,125,10,10,32,32,114,101,116,117,114,110,32,118,101,99,52,40,49,46,48,44,32,49,46,48,44,32,49,46,48,44,32,97,108,112,104,97,41,59,10,125,10, 0 };
+
+ fastuidraw::static_resource R("fastuidraw_painter_arc_stroke.frag.glsl.resource_string", fastuidraw::c_array<const uint8_t>(values, sizeof(values)));
+ 
+
+}
+
@@ -0,0 +1,11 @@
+#include <fastuidraw/util/static_resource.hpp>
+
+namespace { 
+	const uint8_t values[]={ 
+47,42,33,10,32,42,32,92,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,95,97,114,99,95,115,116,114,111,107,101,46,118,101,114,116,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,32,92,98,114,105,101,102,32,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,95,97,114,99,95,115,116,114,111,107,101,46,118,101,114,116,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,10,32,42,32,67,111,112,121,114,105,103,104,116,32,50,48,49,56,32,98,121,32,73,110,116,101,108,46,10,32,42,10,32,42,32,67,111,110,116,97,99,116,58,32,107,101,118,105,110,46,114,111,103,111,118,105,110,64,105,110,116,101,108,46,99,111,109,10,32,42,10,32,42,32,84,104,105,115,32,83,111,117,114,99,101,32,67,111,100,101,32,70,111,114,109,32,105,115,32,115,117,98,106,101,99,116,32,116,111,32,116,104,101,10,32,42,32,116,101,114,109,115,32,111,102,32,116,104,101,32,77,111,122,105,108,108,97,32,80,117,98,108,105,99,32,76,105,99,101,110,115,101,44,32,118,46,32,50,46,48,46,10,32,42,32,73,102,32,97,32,99,111,112,121,32,111,102,32,116,104,101,32,77,80,76,32,119,97,115,32,110,111,116,32,100,105,115,116,114,105,98,117,116,101,100,32,119,105,116,104,10,32,42,32,116,104,105,115,32,102,105,108,101,44,32,89,111,117,32,99,97,110,32,111,98,116,97,105,110,32,111,110,101,32,97,116,10,32,42,32,104,116,116,112,58,47,47,109,111,122,105,108,108,97,46,111,114,103,47,77,80,76,47,50,46,48,47,46,10,32,42,10,32,42,32,92,97,117,116,104,111,114,32,75,101,118,105,110,32,82,111,103,111,118,105,110,32,60,107,101,118,105,110,46,114,111,103,111,118,105,110,64,105,110,116,101,108,46,99,111,109,62,10,32,42,10,32,42,47,10,10,118,111,105,100,10,102,97,115,116,117,105,100,114,97,119,95,103,108,95,118,101,114,116,95,109,97,105,110,40,105,110,32,117,105,110,116,32,115,117,98,95,115,104,97,100,101,114,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,117,118,101,99,52,32,105,110,95,97,116,116,114,105,98,48,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,117,118,101,99,52,32,105,110,95,97,116,116,114,105,98,49,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,117,118,101,99,52,32,105,110,95,97,116,116,114,105,98,50,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,117,105,110,116,32,115,104,97,100,101,114,95,100,97,116,97,95,111,102,102,115,101,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,105,110,116,32,122,95,97,100,100,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,118,101,99,50,32,111,117,116,95,98,114,117,115,104,95,112,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,117,116,32,118,101,99,51,32,111,117,116,95,99,108,105,112,95,112,41,10,123,10,32,32,118,101,99,52,32,112,114,105,109,97,114,121,95,97,116,116,114,105,98,44,32,115,101,99,111,110,100,97,114,121,95,97,116,116,114,105,98,59,10,10,32,32,112,114,105,109,97,114,121,95,97,116,116,114,105,98,32,61,32,117,105,110,116,66,105,116,115,84,111,70,108,111,97,116,40,105,110,95,97,116,116,114,105,98,48,41,59,10,32,32,115,101,99,111,110,100,97,114,121,95,97,116,116,114,105,98,32,61,32,117,105,110,116,66,105,116,115,84,111,70,108,111,97,116,40,105,110,95,97,116,116,114,105,98,49,41,59,10,10,32,32,98,111,111,108,32,115,116,114,111,107,101,95,119,105,100,116,104,95,112,105,120,101,108,115,59,10,32,32,117,105,110,116,32,115,116,114,111,107,105,110,103,95,112,97,115,115,59,10,32,32,99,111,110,115,116,32,102,108,111,97,116,32,97,110,116,105,95,97,108,105,97,115,95,116,104,105,99,107,110,101,115,115,32,61,32,49,46,53,59,10,10,32,32,118,101,99,50,32,118,101,99,116,111,114,95,102,114,111,109,95,99,101,110,116,101,114,44,32,112,59,10,32,32,118,101,99,50,32,112,111,115,105,116,105,111,110,44,32,99,101,110,116,101,114,44,32,111,102,102,115,101,116,95,100,105,114,101,99,116,105,111,110,59,10,32,32,102,108,111,97,116,32,115,99,97,108,101,95,102,97,99,116,111,114,44,32,114,97,100,105,117,115,44,32,97,114,99,95,97,110,103,108,101,59,10,10,32,32,102,108,111,97,116,32,100,105,115,116,97,110,99,101,95,102,114,111,109,95,101,100,103,101,95,115,116,97,114,116,44,32,100,105,115,116,97,110,99,101,95,102,114,111,109,95,99,111,110,116,111,117,114,95,115,116,97,114,116,59,10,32,32,102,108,111,97,116,32,116,111,116,97,108,95,101,100,103,101,95,108,101,110,103,116,104,44,32,116,111,116,97,108,95,111,112,101,110,95,99,111,110,116,111,117,114,95,108,101,110,103,116,104,44,32,116,111,116,97,108,95,99,108,111,115,101,100,95,99,111,110,116,111,117,114,95,108,101,110,103,116,104,59,10,32,32,102,108,111,97,116,32,115,116,114,111,107,101,95,114,97,100,105,117,115,95,102,111,114,95,111,117,116,101,114,95,98,111,117,110,100,97,114,121,44,32,97,114,99,95,114,97,100,105,117,115,95,102,111,114,95,111,117,116,101,114,95,98,111,117,110,100,97,114,121,59,10,10,32,32,102,108,111,97,116,32,115,116,114,111,107,101,95,114,97,100,105,117,115,59,10,32,32,117,105,110,116,32,111,110,95,98,111,117,110,100,97,114,121,44,32,111,102,102,115,101,116,95,116,121,112,101,59,10,32,32,117,105,110,116,32,112,111,105,110,116,95,112,97,99,107,101,100,95,100,97,116,97,44,32,100,97,115,104,95,115,116,121,108,101,44,32,97,97,95,109,101,116,104,111,100,59,10,32,32,102,97,115,116,117,105,100,114,97,119,95,100,97,115,104,101,100,95,115,116,114,111,107,105,110,103,95,112,97,114,97,109,115,95,104,101,97,100,101,114,32,100,97,115,104,101,100,95,115,116,114,111,107,101,95,112,97,114,97,109,115,59,10,32,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,105,110,103,95,112,97,114,97,109,115,32,115,116,114,111,107,101,95,112,97,114,97,109,115,59,10,32,32,109,97,116,50,32,114,111,116,97,116,101,95,98,121,32,61,32,109,97,116,50,40,49,46,48,44,32,48,46,48,44,32,48,46,48,44,32,49,46,48,41,59,10,10,32,32,100,97,115,104,95,115,116,121,108,101,32,61,32,70,65,83,84,85,73,68,82,65,87,95,69,88,84,82,65,67,84,95,66,73,84,83,40,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,115,117,98,95,115,104,97,100,101,114,95,100,97,115,104,95,115,116,121,108,101,95,98,105,116,48,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,115,117,98,95,115,104,97,100,101,114,95,100,97,115,104,95,115,116,121,108,101,95,110,117,109,95,98,105,116,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,115,117,98,95,115,104,97,100,101,114,41,59,10,10,32,32,97,97,95,109,101,116,104,111,100,32,61,32,70,65,83,84,85,73,68,82,65,87,95,69,88,84,82,65,67,84,95,66,73,84,83,40,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,115,117,98,95,115,104,97,100,101,114,95,97,97,95,109,101,116,104,111,100,95,98,105,116,48,44,32,49,117,44,32,115,117,98,95,115,104,97,100,101,114,41,59,10,10,32,32,115,116,114,111,107,105,110,103,95,112,97,115,115,32,61,32,70,65,83,84,85,73,68,82,65,87,95,69,88,84,82,65,67,84,95,66,73,84,83,40,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,115,117,98,95,115,104,97,100,101,114,95,114,101,110,100,101,114,95,112,97,115,115,95,98,105,116,48,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,115,117,98,95,115,104,97,100,101,114,95,114,101,110,100,101,114,95,112,97,115,115,95,110,117,109,95,98,105,116,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,115,117,98,95,115,104,97,100,101,114,41,59,10,10,32,32,105,102,32,40,100,97,115,104,95,115,116,121,108,101,32,33,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,110,111,116,95,100,97,115,104,101,100,41,10,32,32,32,32,123,10,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,100,97,115,104,101,100,95,115,116,114,111,107,105,110,103,95,112,97,114,97,109,115,95,104,101,97,100,101,114,40,115,104,97,100,101,114,95,100,97,116,97,95,111,102,102,115,101,116,44,32,100,97,115,104,101,100,95,115,116,114,111,107,101,95,112,97,114,97,109,115,41,59,10,32,32,32,32,32,32,115,116,114,111,107,101,95,119,105,100,116,104,95,112,105,120,101,108,115,32,61,32,40,100,97,115,104,101,100,95,115,116,114,111,107,101,95,112,97,114,97,109,115,46,114,97,100,105,117,115,32,60,32,48,46,48,41,59,10,32,32,32,32,32,32,115,116,114,111,107,101,95,114,97,100,105,117,115,32,61,32,97,98,115,40,100,97,115,104,101,100,95,115,116,114,111,107,101,95,112,97,114,97,109,115,46,114,97,100,105,117,115,41,59,10,32,32,32,32,125,10,32,32,101,108,115,101,10,32,32,32,32,123,10,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,115,116,114,111,107,105,110,103,95,112,97,114,97,109,115,40,115,104,97,100,101,114,95,100,97,116,97,95,111,102,102,115,101,116,44,32,115,116,114,111,107,101,95,112,97,114,97,109,115,41,59,10,32,32,32,32,32,32,115,116,114,111,107,101,95,119,105,100,116,104,95,112,105,120,101,108,115,32,61,32,40,115,116,114,111,107,101,95,112,97,114,97,109,115,46,114,97,100,105,117,115,32,60,32,48,46,48,41,59,10,32,32,32,32,32,32,115,116,114,111,107,101,95,114,97,100,105,117,115,32,61,32,97,98,115,40,115,116,114,111,107,101,95,112,97,114,97,109,115,46,114,97,100,105,117,115,41,59,10,32,32,32,32,125,10,10,32,32,112,111,115,105,116,105,111,110,32,61,32,112,114,105,109,97,114,121,95,97,116,116,114,105,98,46,120,121,59,10,32,32,111,102,102,115,101,116,95,100,105,114,101,99,116,105,111,110,32,61,32,112,114,105,109,97,114,121,95,97,116,116,114,105,98,46,122,119,59,10,32,32,114,97,100,105,117,115,32,61,32,115,101,99,111,110,100,97,114,121,95,97,116,116,114,105,98,46,122,59,10,32,32,97,114,99,95,97,110,103,108,101,32,61,32,115,101,99,111,110,100,97,114,121,95,97,116,116,114,105,98,46,119,59,10,32,32,100,105,115,116,97,110,99,101,95,102,114,111,109,95,101,100,103,101,95,115,116,97,114,116,32,61,32,115,101,99,111,110,100,97,114,121,95,97,116,116,114,105,98,46,120,59,10,32,32,100,105,115,116,97,110,99,101,95,102,114,111,109,95,99,111,110,116,111,117,114,95,115,116,97,114,116,32,61,32,115,101,99,111,110,100,97,114,121,95,97,116,116,114,105,98,46,121,59,10,32,32,116,111,116,97,108,95,101,100,103,101,95,108,101,110,103,116,104,32,61,32,117,105,110,116,66,105,116,115,84,111,70,108,111,97,116,40,105,110,95,97,116,116,114,105,98,50,46,121,41,59,10,32,32,116,111,116,97,108,95,111,112,101,110,95,99,111,110,116,111,117,114,95,108,101,110,103,116,104,32,61,32,117,105,110,116,66,105,116,115,84,111,70,108,111,97,116,40,105,110,95,97,116,116,114,105,98,50,46,122,41,59,10,32,32,116,111,116,97,108,95,99,108,111,115,101,100,95,99,111,110,116,111,117,114,95,108,101,110,103,116,104,32,61,32,117,105,110,116,66,105,116,115,84,111,70,108,111,97,116,40,105,110,95,97,116,116,114,105,98,50,46,119,41,59,10,32,32,112,111,105,110,116,95,112,97,99,107,101,100,95,100,97,116,97,32,61,32,105,110,95,97,116,116,114,105,98,50,46,120,59,10,10,32,32,111,102,102,115,101,116,95,116,121,112,101,32,61,32,70,65,83,84,85,73,68,82,65,87,95,69,88,84,82,65,67,84,95,66,73,84,83,40,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,101,95,111,102,102,115,101,116,95,116,121,112,101,95,98,105,116,48,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,101,95,111,102,102,115,101,116,95,116,121,112,101,95,110,117,109,95,98,105,116,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,112,111,105,110,116,95,112,97,99,107,101,100,95,100,97,116,97,41,59,10,32,32,111,110,95,98,111,117,110,100,97,114,121,32,61,32,70,65,83,84,85,73,68,82,65,87,95,69,88,84,82,65,67,84,95,66,73,84,83,40,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,101,95,98,111,117,110,100,97,114,121,95,98,105,116,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,49,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,112,111,105,110,116,95,112,97,99,107,101,100,95,100,97,116,97,41,59,10,10,32,32,115,99,97,108,101,95,102,97,99,116,111,114,32,61,32,102,108,111,97,116,40,111,110,95,98,111,117,110,100,97,114,121,41,32,42,32,115,116,114,111,107,101,95,114,97,100,105,117,115,59,10,10,32,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,105,110,103,95,115,116,114,111,107,101,95,114,97,100,105,117,115,32,61,32,115,116,114,111,107,101,95,114,97,100,105,117,115,59,10,32,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,105,110,103,95,97,114,99,95,114,97,100,105,117,115,32,61,32,114,97,100,105,117,115,59,10,32,32,99,101,110,116,101,114,32,61,32,112,111,115,105,116,105,111,110,32,45,32,114,97,100,105,117,115,32,42,32,111,102,102,115,101,116,95,100,105,114,101,99,116,105,111,110,59,10,10,32,32,115,116,114,111,107,101,95,114,97,100,105,117,115,95,102,111,114,95,111,117,116,101,114,95,98,111,117,110,100,97,114,121,32,61,32,115,116,114,111,107,101,95,114,97,100,105,117,115,59,10,32,32,97,114,99,95,114,97,100,105,117,115,95,102,111,114,95,111,117,116,101,114,95,98,111,117,110,100,97,114,121,32,61,32,114,97,100,105,117,115,59,10,10,32,32,105,102,32,40,100,97,115,104,95,115,116,121,108,101,32,33,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,110,111,116,95,100,97,115,104,101,100,41,10,32,32,32,32,123,10,32,32,32,32,32,32,102,108,111,97,116,32,101,100,103,101,95,115,116,97,114,116,44,32,101,100,103,101,95,101,110,100,44,32,115,116,114,111,107,101,95,100,105,115,116,97,110,99,101,59,10,32,32,32,32,32,32,98,111,111,108,32,105,115,95,99,111,110,115,116,97,110,116,95,100,105,115,116,97,110,99,101,44,32,105,115,95,101,100,103,101,95,101,110,100,59,10,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,100,97,115,104,101,100,95,115,116,114,117,99,116,95,98,97,115,101,32,98,97,115,101,44,32,98,97,115,101,95,115,116,97,114,116,44,32,98,97,115,101,95,101,110,100,59,10,10,32,32,32,32,32,32,115,116,114,111,107,101,95,100,105,115,116,97,110,99,101,32,61,32,100,105,115,116,97,110,99,101,95,102,114,111,109,95,99,111,110,116,111,117,114,95,115,116,97,114,116,32,43,32,100,97,115,104,101,100,95,115,116,114,111,107,101,95,112,97,114,97,109,115,46,100,97,115,104,95,111,102,102,115,101,116,59,10,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,100,97,115,104,101,100,95,104,101,108,112,101,114,95,118,101,114,116,95,98,97,115,101,40,115,116,114,111,107,101,95,100,105,115,116,97,110,99,101,44,32,115,104,97,100,101,114,95,100,97,116,97,95,111,102,102,115,101,116,44,32,100,97,115,104,101,100,95,115,116,114,111,107,101,95,112,97,114,97,109,115,44,32,98,97,115,101,41,59,10,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,105,110,103,95,100,105,115,116,97,110,99,101,32,61,32,98,97,115,101,46,100,59,10,10,32,32,32,32,32,32,105,102,32,40,100,97,115,104,95,115,116,121,108,101,32,33,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,100,97,115,104,101,100,95,102,108,97,116,95,99,97,112,115,41,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,101,100,103,101,95,115,116,97,114,116,32,61,32,100,105,115,116,97,110,99,101,95,102,114,111,109,95,99,111,110,116,111,117,114,95,115,116,97,114,116,32,45,32,100,105,115,116,97,110,99,101,95,102,114,111,109,95,101,100,103,101,95,115,116,97,114,116,32,43,32,100,97,115,104,101,100,95,115,116,114,111,107,101,95,112,97,114,97,109,115,46,100,97,115,104,95,111,102,102,115,101,116,59,10,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,100,97,115,104,101,100,95,104,101,108,112,101,114,95,118,101,114,116,95,98,97,115,101,40,101,100,103,101,95,115,116,97,114,116,44,32,115,104,97,100,101,114,95,100,97,116,97,95,111,102,102,115,101,116,44,32,100,97,115,104,101,100,95,115,116,114,111,107,101,95,112,97,114,97,109,115,44,32,98,97,115,101,95,115,116,97,114,116,41,59,10,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,105,110,103,95,100,105,115,116,97,110,99,101,95,115,117,98,95,101,100,103,101,95,115,116,97,114,116,32,61,32,40,98,97,115,101,95,115,116,97,114,116,46,115,32,60,32,48,46,48,41,32,63,32,98,97,115,101,95,115,116,97,114,116,46,105,110,116,101,114,118,97,108,95,101,110,100,32,58,32,98,97,115,101,95,115,116,97,114,116,46,105,110,116,101,114,118,97,108,95,98,101,103,105,110,32,45,32,115,116,114,111,107,101,95,114,97,100,105,117,115,59,10,10,32,32,32,32,32,32,32,32,32,32,101,100,103,101,95,101,110,100,32,61,32,101,100,103,101,95,115,116,97,114,116,32,43,32,116,111,116,97,108,95,101,100,103,101,95,108,101,110,103,116,104,59,10,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,100,97,115,104,101,100,95,104,101,108,112,101,114,95,118,101,114,116,95,98,97,115,101,40,101,100,103,101,95,101,110,100,44,32,115,104,97,100,101,114,95,100,97,116,97,95,111,102,102,115,101,116,44,32,100,97,115,104,101,100,95,115,116,114,111,107,101,95,112,97,114,97,109,115,44,32,98,97,115,101,95,101,110,100,41,59,10,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,105,110,103,95,100,105,115,116,97,110,99,101,95,115,117,98,95,101,100,103,101,95,101,110,100,32,61,32,40,98,97,115,101,95,101,110,100,46,115,32,60,32,48,46,48,41,32,63,32,98,97,115,101,95,101,110,100,46,105,110,116,101,114,118,97,108,95,98,101,103,105,110,32,58,32,98,97,115,101,95,101,110,100,46,105,110,116,101,114,118,97,108,95,101,110,100,32,43,32,115,116,114,111,107,101,95,114,97,100,105,117,115,59,10,32,32,32,32,32,32,32,32,125,10,10,32,32,32,32,32,32,105,115,95,101,100,103,101,95,101,110,100,32,61,32,40,112,111,105,110,116,95,112,97,99,107,101,100,95,100,97,116,97,32,38,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,101,95,101,110,100,95,115,101,103,109,101,110,116,95,109,97,115,107,41,32,33,61,32,48,117,59,10,32,32,32,32,32,32,105,115,95,99,111,110,115,116,97,110,116,95,100,105,115,116,97,110,99,101,32,61,32,40,112,111,105,110,116,95,112,97,99,107,101,100,95,100,97,116,97,32,38,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,101,95,100,105,115,116,97,110,99,101,95,99,111,110,115,116,97,110,116,95,111,110,95,112,114,105,109,105,116,105,118,101,95,109,97,115,107,41,32,33,61,32,48,117,59,10,32,32,32,32,32,32,105,102,32,40,111,102,102,115,101,116,95,116,121,112,101,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,101,95,100,97,115,104,101,100,95,99,97,112,112,101,114,41,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,105,110,103,95,100,97,115,104,95,98,105,116,115,32,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,115,107,105,112,95,100,97,115,104,95,105,110,116,101,114,118,97,108,95,108,111,111,107,117,112,95,109,97,115,107,59,10,10,32,32,32,32,32,32,32,32,32,32,105,102,32,40,100,97,115,104,95,115,116,121,108,101,32,33,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,100,97,115,104,101,100,95,102,108,97,116,95,99,97,112,115,41,10,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,105,110,103,95,100,105,115,116,97,110,99,101,32,61,32,40,105,115,95,101,100,103,101,95,101,110,100,41,32,63,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,98,97,115,101,46,105,110,116,101,114,118,97,108,95,98,101,103,105,110,32,45,32,98,97,115,101,46,100,32,58,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,98,97,115,101,46,100,32,45,32,98,97,115,101,46,105,110,116,101,114,118,97,108,95,101,110,100,59,10,32,32,32,32,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,32,32,101,108,115,101,10,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,105,110,103,95,100,105,115,116,97,110,99,101,32,61,32,49,46,48,59,10,32,32,32,32,32,32,32,32,32,32,32,32,125,10,10,32,32,32,32,32,32,32,32,32,32,105,102,32,40,40,112,111,105,110,116,95,112,97,99,107,101,100,95,100,97,116,97,32,38,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,101,95,101,120,116,101,110,100,95,109,97,115,107,41,32,33,61,32,48,117,41,10,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,108,111,97,116,32,100,32,61,32,48,46,48,59,10,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,102,32,40,98,97,115,101,46,115,32,60,32,48,46,48,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,38,38,32,100,97,115,104,95,115,116,121,108,101,32,33,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,100,97,115,104,101,100,95,102,108,97,116,95,99,97,112,115,41,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,102,32,40,105,115,95,101,100,103,101,95,101,110,100,41,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,102,32,40,115,116,114,111,107,101,95,114,97,100,105,117,115,32,43,32,98,97,115,101,46,105,110,116,101,114,118,97,108,95,98,101,103,105,110,32,62,32,98,97,115,101,46,100,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,38,38,32,98,97,115,101,46,105,110,116,101,114,118,97,108,95,98,101,103,105,110,32,62,32,101,100,103,101,95,115,116,97,114,116,41,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,100,32,61,32,115,116,114,111,107,101,95,114,97,100,105,117,115,32,43,32,98,97,115,101,46,105,110,116,101,114,118,97,108,95,98,101,103,105,110,32,45,32,98,97,115,101,46,100,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,105,110,103,95,100,105,115,116,97,110,99,101,32,61,32,45,115,116,114,111,107,101,95,114,97,100,105,117,115,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,101,108,115,101,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,102,32,40,98,97,115,101,46,105,110,116,101,114,118,97,108,95,101,110,100,32,45,32,115,116,114,111,107,101,95,114,97,100,105,117,115,32,60,32,98,97,115,101,46,100,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,38,38,32,98,97,115,101,46,105,110,116,101,114,118,97,108,95,101,110,100,32,60,32,101,100,103,101,95,101,110,100,41,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,100,32,61,32,98,97,115,101,46,100,32,45,32,98,97,115,101,46,105,110,116,101,114,118,97,108,95,101,110,100,32,43,32,115,116,114,111,107,101,95,114,97,100,105,117,115,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,105,110,103,95,100,105,115,116,97,110,99,101,32,61,32,45,115,116,114,111,107,101,95,114,97,100,105,117,115,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,101,108,115,101,32,105,102,32,40,98,97,115,101,46,115,32,62,61,32,48,46,48,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,38,38,32,100,97,115,104,95,115,116,121,108,101,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,100,97,115,104,101,100,95,102,108,97,116,95,99,97,112,115,41,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,118,101,99,51,32,99,108,105,112,95,112,44,32,99,108,105,112,95,100,105,114,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,99,108,105,112,95,112,32,61,32,102,97,115,116,117,105,100,114,97,119,95,105,116,101,109,95,109,97,116,114,105,120,32,42,32,118,101,99,51,40,112,111,115,105,116,105,111,110,44,32,49,46,48,41,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,99,108,105,112,95,100,105,114,32,61,32,102,97,115,116,117,105,100,114,97,119,95,105,116,101,109,95,109,97,116,114,105,120,32,42,32,118,101,99,51,40,115,101,99,111,110,100,97,114,121,95,97,116,116,114,105,98,46,122,119,44,32,48,46,48,41,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,47,42,32,119,104,101,110,32,110,111,116,32,100,114,97,119,105,110,103,32,99,97,112,115,44,32,97,110,100,32,97,110,32,101,110,100,105,110,103,32,111,102,32,97,32,112,97,116,104,45,101,100,103,101,32,105,115,32,118,105,115,105,98,108,101,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,42,32,119,101,32,119,97,110,116,32,116,111,32,97,110,116,105,45,97,108,105,97,115,32,116,104,101,32,101,100,103,101,44,32,119,101,32,100,111,32,116,104,105,115,32,98,121,32,97,100,100,105,110,103,32,97,32,49,45,112,105,120,101,108,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,42,32,115,109,117,100,103,101,32,116,111,32,116,104,101,32,101,110,100,32,111,102,32,116,104,101,32,112,97,116,104,46,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,42,47,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,100,32,61,32,102,97,115,116,117,105,100,114,97,119,95,108,111,99,97,108,95,100,105,115,116,97,110,99,101,95,102,114,111,109,95,112,105,120,101,108,95,100,105,115,116,97,110,99,101,40,49,46,53,44,32,99,108,105,112,95,112,44,32,99,108,105,112,95,100,105,114,41,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,105,110,103,95,100,105,115,116,97,110,99,101,32,61,32,48,46,48,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,125,10,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,112,111,115,105,116,105,111,110,32,43,61,32,100,32,42,32,115,101,99,111,110,100,97,114,121,95,97,116,116,114,105,98,46,122,119,59,10,32,32,32,32,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,101,108,115,101,32,105,102,32,40,105,115,95,99,111,110,115,116,97,110,116,95,100,105,115,116,97,110,99,101,41,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,105,110,103,95,100,97,115,104,95,98,105,116,115,32,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,100,105,115,116,97,110,99,101,95,99,111,110,115,116,97,110,116,59,10,32,32,32,32,32,32,32,32,32,32,105,102,32,40,40,112,111,105,110,116,95,112,97,99,107,101,100,95,100,97,116,97,32,38,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,101,95,106,111,105,110,95,109,97,115,107,41,32,33,61,32,48,117,41,10,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,105,110,103,95,100,97,115,104,95,98,105,116,115,32,124,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,103,97,117,114,97,110,116,101,101,100,95,116,111,95,98,101,95,99,111,118,101,114,101,100,95,109,97,115,107,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,102,32,40,98,97,115,101,46,115,32,60,32,48,46,48,41,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,102,102,115,101,116,95,116,121,112,101,32,61,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,101,95,108,105,110,101,95,115,101,103,109,101,110,116,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,112,111,115,105,116,105,111,110,32,61,32,99,101,110,116,101,114,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,115,99,97,108,101,95,102,97,99,116,111,114,32,61,32,48,46,48,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,101,108,115,101,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,102,108,111,97,116,32,100,101,108,116,97,95,109,97,103,59,10,32,32,32,32,32,32,32,32,32,32,98,111,111,108,32,99,111,108,108,97,112,115,101,59,10,10,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,105,110,103,95,100,97,115,104,95,98,105,116,115,32,61,32,48,117,59,10,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,105,110,103,95,100,105,115,116,97,110,99,101,32,61,32,115,116,114,111,107,101,95,100,105,115,116,97,110,99,101,59,10,32,32,32,32,32,32,32,32,32,32,105,102,32,40,111,102,102,115,101,116,95,116,121,112,101,32,33,61,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,101,95,108,105,110,101,95,115,101,103,109,101,110,116,41,10,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,100,101,108,116,97,95,109,97,103,32,61,32,97,98,115,40,97,114,99,95,97,110,103,108,101,41,32,42,32,114,97,100,105,117,115,59,10,32,32,32,32,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,32,32,101,108,115,101,10,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,100,101,108,116,97,95,109,97,103,32,61,32,108,101,110,103,116,104,40,115,101,99,111,110,100,97,114,121,95,97,116,116,114,105,98,46,122,119,41,59,10,32,32,32,32,32,32,32,32,32,32,32,32,125,10,10,32,32,32,32,32,32,32,32,32,32,105,102,32,40,105,115,95,101,100,103,101,95,101,110,100,41,10,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,99,111,108,108,97,112,115,101,32,61,32,40,98,97,115,101,46,105,110,116,101,114,118,97,108,95,98,101,103,105,110,32,60,32,98,97,115,101,46,100,32,45,32,100,101,108,116,97,95,109,97,103,32,38,38,32,98,97,115,101,46,115,32,60,32,48,46,48,41,59,10,32,32,32,32,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,32,32,101,108,115,101,10,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,99,111,108,108,97,112,115,101,32,61,32,40,98,97,115,101,46,105,110,116,101,114,118,97,108,95,101,110,100,32,62,32,98,97,115,101,46,100,32,43,32,100,101,108,116,97,95,109,97,103,32,38,38,32,98,97,115,101,46,115,32,60,32,48,46,48,41,59,10,32,32,32,32,32,32,32,32,32,32,32,32,125,10,10,32,32,32,32,32,32,32,32,32,32,105,102,32,40,99,111,108,108,97,112,115,101,32,38,38,32,100,97,115,104,95,115,116,121,108,101,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,100,97,115,104,101,100,95,102,108,97,116,95,99,97,112,115,41,10,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,102,32,40,111,102,102,115,101,116,95,116,121,112,101,32,33,61,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,101,95,108,105,110,101,95,115,101,103,109,101,110,116,41,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,102,102,115,101,116,95,116,121,112,101,32,61,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,101,95,108,105,110,101,95,115,101,103,109,101,110,116,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,112,111,115,105,116,105,111,110,32,61,32,99,101,110,116,101,114,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,115,99,97,108,101,95,102,97,99,116,111,114,32,61,32,48,46,48,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,101,108,115,101,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,115,99,97,108,101,95,102,97,99,116,111,114,32,61,32,48,46,48,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,32,32,101,108,115,101,32,105,102,32,40,111,102,102,115,101,116,95,116,121,112,101,32,33,61,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,101,95,108,105,110,101,95,115,101,103,109,101,110,116,41,10,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,102,32,40,97,114,99,95,97,110,103,108,101,32,60,32,48,46,48,41,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,105,110,103,95,100,97,115,104,95,98,105,116,115,32,124,61,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,101,95,110,101,103,97,116,105,118,101,95,97,114,99,95,97,110,103,108,101,95,109,97,115,107,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,125,10,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,102,32,40,105,115,95,101,100,103,101,95,101,110,100,41,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,105,110,103,95,100,105,115,116,97,110,99,101,32,61,32,115,116,114,111,107,101,95,100,105,115,116,97,110,99,101,32,45,32,97,98,115,40,97,114,99,95,97,110,103,108,101,41,32,42,32,114,97,100,105,117,115,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,125,10,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,47,42,32,116,104,101,32,102,114,97,103,109,101,110,116,32,115,104,97,100,101,114,32,106,117,115,116,32,100,111,101,115,32,114,97,100,105,117,115,32,42,32,97,116,97,110,40,41,32,116,111,32,99,111,109,112,117,116,101,32,116,104,101,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,42,32,100,105,115,116,97,110,99,101,32,102,114,111,109,32,116,104,101,32,115,116,97,114,116,32,111,102,32,116,104,101,32,97,114,99,45,101,100,103,101,46,32,65,115,32,115,117,99,104,44,32,119,101,32,110,101,101,100,32,116,111,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,42,32,114,111,116,97,116,101,32,98,97,99,107,32,98,121,32,116,104,101,32,115,116,97,114,116,32,97,110,103,108,101,46,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,42,47,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,114,111,116,97,116,101,95,98,121,32,61,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,109,97,116,50,40,111,102,102,115,101,116,95,100,105,114,101,99,116,105,111,110,46,120,44,32,45,111,102,102,115,101,116,95,100,105,114,101,99,116,105,111,110,46,121,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,102,102,115,101,116,95,100,105,114,101,99,116,105,111,110,46,121,44,32,111,102,102,115,101,116,95,100,105,114,101,99,116,105,111,110,46,120,41,59,10,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,102,32,40,40,112,111,105,110,116,95,112,97,99,107,101,100,95,100,97,116,97,32,38,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,101,95,101,110,100,95,115,101,103,109,101,110,116,95,109,97,115,107,41,32,33,61,32,48,117,41,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,47,42,32,119,101,32,114,111,116,97,116,101,100,32,98,121,32,116,104,101,32,111,102,102,115,101,116,95,100,105,114,101,99,116,105,111,110,44,32,119,104,105,99,104,32,109,101,97,110,115,32,119,101,32,114,111,116,97,116,101,100,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,42,32,98,97,99,107,32,98,121,32,116,104,101,32,101,110,100,45,97,110,103,108,101,44,32,114,111,116,97,116,101,32,102,111,114,119,97,114,100,32,98,121,32,97,114,99,45,97,110,103,108,101,32,116,111,32,103,101,116,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,42,32,97,32,110,101,116,32,114,111,116,97,116,105,111,110,32,111,102,32,98,97,99,107,119,97,114,100,115,32,98,121,32,115,116,97,114,116,32,97,110,103,108,101,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,42,47,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,109,97,116,50,32,116,109,112,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,108,111,97,116,32,99,44,32,115,44,32,118,59,10,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,99,32,61,32,99,111,115,40,97,114,99,95,97,110,103,108,101,41,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,115,32,61,32,115,105,110,40,97,114,99,95,97,110,103,108,101,41,59,10,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,47,42,32,65,32,110,117,109,98,101,114,32,111,102,32,71,80,85,39,115,32,104,97,118,101,32,110,111,116,45,115,111,45,97,99,99,117,114,97,116,101,32,99,111,115,47,115,105,110,32,105,109,112,108,101,109,101,110,116,97,116,105,111,110,115,46,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,42,32,84,104,101,115,101,32,105,110,110,97,99,117,114,97,99,105,101,115,32,97,114,101,32,115,105,103,110,105,102,105,99,97,110,116,32,101,110,111,117,103,104,32,116,111,32,109,97,107,101,32,116,104,101,32,114,111,116,97,116,105,111,110,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,42,32,109,97,116,114,105,120,32,109,97,100,101,32,102,114,111,109,32,97,32,99,111,115,47,115,105,110,32,115,105,103,110,105,102,105,99,97,110,116,108,121,32,102,97,114,32,102,114,111,109,32,98,101,105,110,103,32,111,114,116,104,111,110,111,114,109,97,108,46,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,42,32,84,111,32,99,111,109,98,97,116,32,116,104,105,115,44,32,119,101,32,110,111,114,109,97,108,105,122,101,32,99,32,97,110,100,32,115,32,98,121,32,116,104,101,32,110,111,114,109,32,111,102,32,116,104,101,32,118,101,99,116,111,114,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,42,32,40,99,44,32,115,41,46,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,42,47,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,118,32,61,32,115,113,114,116,40,99,32,42,32,99,32,43,32,115,32,42,32,115,41,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,99,32,47,61,32,118,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,115,32,47,61,32,118,59,10,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,116,109,112,32,61,32,109,97,116,50,40,99,44,32,115,44,32,45,115,44,32,99,41,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,114,111,116,97,116,101,95,98,121,32,61,32,116,109,112,32,42,32,114,111,116,97,116,101,95,98,121,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,125,10,10,32,32,105,102,40,111,102,102,115,101,116,95,116,121,112,101,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,101,95,97,114,99,95,112,111,105,110,116,10,32,32,32,32,32,38,38,32,40,112,111,105,110,116,95,112,97,99,107,101,100,95,100,97,116,97,32,38,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,101,95,109,111,118,101,95,116,111,95,97,114,99,95,99,101,110,116,101,114,95,109,97,115,107,41,32,33,61,32,48,117,41,10,32,32,32,32,123,10,32,32,32,32,32,32,105,102,32,40,115,116,114,111,107,101,95,114,97,100,105,117,115,32,62,32,114,97,100,105,117,115,41,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,112,111,115,105,116,105,111,110,32,61,32,99,101,110,116,101,114,59,10,32,32,32,32,32,32,32,32,32,32,115,99,97,108,101,95,102,97,99,116,111,114,32,61,32,48,46,48,59,10,32,32,32,32,32,32,32,32,32,32,105,102,32,40,40,112,111,105,110,116,95,112,97,99,107,101,100,95,100,97,116,97,32,38,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,101,95,105,110,110,101,114,95,115,116,114,111,107,105,110,103,95,109,97,115,107,41,32,61,61,32,48,117,41,10,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,47,42,32,116,104,105,115,32,112,111,105,110,116,32,105,115,32,117,115,101,100,32,116,111,32,109,97,107,101,32,97,32,116,114,105,97,110,103,108,101,32,119,105,116,104,32,116,104,101,32,105,110,118,101,114,116,101,100,32,105,110,110,101,114,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,42,32,115,116,114,111,107,105,110,103,32,114,101,103,105,111,110,59,32,100,111,32,116,104,101,32,115,97,109,101,32,116,111,32,105,116,32,97,115,32,119,101,32,119,111,117,108,100,32,105,110,110,101,114,32,115,116,114,111,107,105,110,103,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,42,32,98,111,117,110,100,97,114,121,32,112,111,105,110,116,115,46,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,42,47,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,102,32,40,100,97,115,104,95,115,116,121,108,101,32,33,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,110,111,116,95,100,97,115,104,101,100,41,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,114,111,116,97,116,101,95,98,121,32,42,61,32,45,49,46,48,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,105,110,103,95,100,97,115,104,95,98,105,116,115,32,124,61,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,101,95,105,110,118,101,114,116,101,100,95,105,110,110,101,114,95,114,101,103,105,111,110,95,109,97,115,107,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,101,108,115,101,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,105,110,103,95,97,114,99,95,114,97,100,105,117,115,32,61,32,48,46,48,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,105,110,103,95,115,116,114,111,107,101,95,114,97,100,105,117,115,32,61,32,115,116,114,111,107,101,95,114,97,100,105,117,115,32,45,32,114,97,100,105,117,115,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,125,10,10,32,32,105,102,32,40,111,102,102,115,101,116,95,116,121,112,101,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,101,95,97,114,99,95,112,111,105,110,116,10,32,32,32,32,32,32,38,38,32,40,112,111,105,110,116,95,112,97,99,107,101,100,95,100,97,116,97,32,38,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,101,95,105,110,110,101,114,95,115,116,114,111,107,105,110,103,95,109,97,115,107,41,32,33,61,32,48,117,41,10,32,32,32,32,123,10,32,32,32,32,32,32,105,102,32,40,115,116,114,111,107,101,95,114,97,100,105,117,115,32,60,32,114,97,100,105,117,115,41,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,47,42,32,111,102,102,115,101,116,95,118,101,99,116,111,114,32,97,108,119,97,121,115,32,112,111,105,110,116,115,32,102,114,111,109,32,116,104,101,32,97,114,99,45,99,101,110,116,101,114,32,116,111,32,116,104,101,32,97,114,99,59,10,32,32,32,32,32,32,32,32,32,32,32,42,32,72,111,119,101,118,101,114,44,32,102,111,114,32,105,110,110,101,114,32,115,116,114,111,107,105,110,103,44,32,119,101,32,110,101,101,100,32,116,111,32,109,111,118,101,32,116,104,101,32,112,111,105,110,116,32,116,111,10,32,32,32,32,32,32,32,32,32,32,32,42,32,116,104,101,32,99,101,110,116,101,114,46,32,87,101,32,97,99,99,111,109,112,108,105,115,104,32,116,104,105,115,32,98,121,32,110,101,103,97,116,105,110,103,32,115,99,97,108,101,95,102,97,99,116,111,114,46,10,32,32,32,32,32,32,32,32,32,32,32,42,47,10,32,32,32,32,32,32,32,32,32,32,115,99,97,108,101,95,102,97,99,116,111,114,32,61,32,45,115,99,97,108,101,95,102,97,99,116,111,114,59,10,10,32,32,32,32,32,32,32,32,32,32,47,42,32,73,102,32,116,104,101,32,112,111,105,110,116,32,105,115,32,98,101,121,111,110,100,95,105,110,110,101,114,95,115,116,114,111,107,105,110,103,95,98,111,117,110,100,97,114,121,44,32,99,111,108,108,97,112,115,101,32,105,116,10,32,32,32,32,32,32,32,32,32,32,32,42,32,116,111,32,98,101,32,116,104,101,32,115,97,109,101,32,108,111,99,97,116,105,111,110,32,97,115,32,105,110,110,101,114,95,115,116,114,111,107,105,110,103,95,98,111,117,110,100,97,114,121,32,115,105,110,99,101,32,116,104,101,121,10,32,32,32,32,32,32,32,32,32,32,32,42,32,97,114,101,32,111,110,108,121,32,110,101,101,100,101,100,47,117,115,101,100,32,119,104,101,110,32,116,104,101,32,115,116,114,111,107,101,95,114,97,100,105,117,115,32,62,32,114,97,100,105,117,115,46,10,32,32,32,32,32,32,32,32,32,32,32,42,47,10,32,32,32,32,32,32,32,32,32,32,112,111,105,110,116,95,112,97,99,107,101,100,95,100,97,116,97,32,38,61,32,126,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,101,95,98,101,121,111,110,100,95,98,111,117,110,100,97,114,121,95,109,97,115,107,59,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,101,108,115,101,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,47,42,32,99,104,97,110,103,101,32,116,104,101,32,98,101,104,97,118,105,111,114,32,116,111,32,98,101,32,108,105,107,101,32,97,110,32,97,114,99,45,106,111,105,110,32,99,101,110,116,101,114,101,100,32,97,116,32,116,104,101,10,32,32,32,32,32,32,32,32,32,32,32,42,32,115,97,109,101,32,108,111,99,97,116,105,111,110,32,119,105,116,104,32,115,116,114,111,107,105,110,103,32,114,97,100,105,117,115,32,97,115,32,115,116,114,111,107,101,95,114,97,100,105,117,115,32,45,32,114,97,100,105,117,115,46,10,32,32,32,32,32,32,32,32,32,32,32,42,32,78,111,116,101,32,116,104,97,116,32,119,101,32,111,110,108,121,32,109,111,100,105,102,121,32,112,111,115,105,116,105,111,110,44,32,115,99,97,108,101,95,102,97,99,116,111,114,32,97,110,100,32,111,102,102,115,101,116,95,100,105,114,101,99,116,105,111,110,10,32,32,32,32,32,32,32,32,32,32,32,42,32,102,111,114,32,116,104,101,32,112,111,105,110,116,32,78,79,84,32,109,111,118,101,100,32,116,111,32,116,104,101,32,111,114,105,103,105,110,32,115,105,110,99,101,32,116,104,97,116,32,119,97,115,32,104,97,110,100,108,101,100,10,32,32,32,32,32,32,32,32,32,32,32,42,32,98,121,32,116,104,101,32,112,114,101,118,105,111,117,115,32,98,108,111,99,107,32,97,110,100,32,116,104,97,116,32,112,111,105,110,116,32,105,115,32,117,115,101,100,32,116,111,32,102,111,114,109,32,97,32,116,114,105,97,110,103,108,101,10,32,32,32,32,32,32,32,32,32,32,32,42,32,98,101,116,119,101,101,110,32,116,104,101,32,99,101,110,116,101,114,32,97,110,100,32,116,104,101,32,112,97,116,104,44,32,110,111,116,32,116,104,101,32,99,101,110,116,101,114,32,97,110,100,32,116,104,101,32,105,110,118,101,114,101,116,101,100,10,32,32,32,32,32,32,32,32,32,32,32,42,32,105,110,110,101,114,45,115,116,114,111,107,105,110,103,32,114,101,103,105,111,110,46,10,32,32,32,32,32,32,32,32,32,32,32,42,47,10,32,32,32,32,32,32,32,32,32,32,105,102,32,40,40,112,111,105,110,116,95,112,97,99,107,101,100,95,100,97,116,97,32,38,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,101,95,109,111,118,101,95,116,111,95,97,114,99,95,99,101,110,116,101,114,95,109,97,115,107,41,32,61,61,32,48,117,41,10,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,112,111,115,105,116,105,111,110,32,61,32,99,101,110,116,101,114,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,115,99,97,108,101,95,102,97,99,116,111,114,32,61,32,115,116,114,111,107,101,95,114,97,100,105,117,115,32,45,32,114,97,100,105,117,115,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,111,102,102,115,101,116,95,100,105,114,101,99,116,105,111,110,32,61,32,45,111,102,102,115,101,116,95,100,105,114,101,99,116,105,111,110,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,97,114,99,95,114,97,100,105,117,115,95,102,111,114,95,111,117,116,101,114,95,98,111,117,110,100,97,114,121,32,61,32,48,46,48,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,115,116,114,111,107,101,95,114,97,100,105,117,115,95,102,111,114,95,111,117,116,101,114,95,98,111,117,110,100,97,114,121,32,61,32,115,116,114,111,107,101,95,114,97,100,105,117,115,32,45,32,114,97,100,105,117,115,59,10,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,102,32,40,100,97,115,104,95,115,116,121,108,101,32,33,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,110,111,116,95,100,97,115,104,101,100,41,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,47,42,32,98,101,99,97,117,115,101,32,116,104,101,32,105,110,110,101,114,32,115,116,114,111,107,105,110,103,32,105,115,32,105,110,118,101,114,116,101,100,44,32,119,101,32,110,101,101,100,32,116,111,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,42,32,114,111,116,97,116,101,32,98,121,32,49,56,48,32,100,101,103,114,101,101,115,32,116,111,32,109,97,107,101,32,116,104,101,32,97,116,97,110,32,105,110,32,102,114,97,103,45,115,104,97,100,101,114,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,42,32,103,105,118,101,32,116,104,101,32,99,111,114,114,101,99,116,32,114,101,115,117,108,116,115,46,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,42,47,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,114,111,116,97,116,101,95,98,121,32,42,61,32,45,49,46,48,59,10,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,47,42,32,119,101,32,110,101,101,100,32,116,111,32,97,108,108,32,116,101,108,108,32,116,104,101,32,102,114,97,103,109,101,110,116,45,115,104,97,100,101,114,32,116,111,32,114,101,105,110,116,101,114,112,114,101,116,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,42,32,116,104,101,32,118,97,108,117,101,115,32,111,102,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,105,110,103,95,97,114,99,95,114,97,100,105,117,115,32,97,110,100,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,42,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,105,110,103,95,115,116,114,111,107,101,95,114,97,100,105,117,115,32,102,111,114,32,114,97,100,105,97,108,32,105,110,99,108,117,115,105,111,110,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,42,47,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,105,110,103,95,100,97,115,104,95,98,105,116,115,32,124,61,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,101,95,105,110,118,101,114,116,101,100,95,105,110,110,101,114,95,114,101,103,105,111,110,95,109,97,115,107,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,101,108,115,101,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,105,110,103,95,97,114,99,95,114,97,100,105,117,115,32,61,32,97,114,99,95,114,97,100,105,117,115,95,102,111,114,95,111,117,116,101,114,95,98,111,117,110,100,97,114,121,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,105,110,103,95,115,116,114,111,107,101,95,114,97,100,105,117,115,32,61,32,115,116,114,111,107,101,95,114,97,100,105,117,115,95,102,111,114,95,111,117,116,101,114,95,98,111,117,110,100,97,114,121,59,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,125,10,10,32,32,112,32,61,32,112,111,115,105,116,105,111,110,32,43,32,115,99,97,108,101,95,102,97,99,116,111,114,32,42,32,111,102,102,115,101,116,95,100,105,114,101,99,116,105,111,110,59,10,10,32,32,105,102,32,40,111,102,102,115,101,116,95,116,121,112,101,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,101,95,97,114,99,95,112,111,105,110,116,10,32,32,32,32,32,32,38,38,32,40,112,111,105,110,116,95,112,97,99,107,101,100,95,100,97,116,97,32,38,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,101,95,98,101,121,111,110,100,95,98,111,117,110,100,97,114,121,95,109,97,115,107,41,32,33,61,32,48,117,41,10,32,32,32,32,123,10,32,32,32,32,32,32,102,108,111,97,116,32,104,97,108,102,95,97,110,103,108,101,44,32,76,44,32,68,44,32,99,44,32,115,59,10,32,32,32,32,32,32,118,101,99,50,32,118,59,10,10,32,32,32,32,32,32,104,97,108,102,95,97,110,103,108,101,32,61,32,48,46,53,32,42,32,97,114,99,95,97,110,103,108,101,59,10,32,32,32,32,32,32,105,102,32,40,40,112,111,105,110,116,95,112,97,99,107,101,100,95,100,97,116,97,32,38,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,101,95,101,110,100,95,115,101,103,109,101,110,116,95,109,97,115,107,41,32,33,61,32,48,117,41,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,104,97,108,102,95,97,110,103,108,101,32,61,32,45,104,97,108,102,95,97,110,103,108,101,59,10,32,32,32,32,32,32,32,32,125,10,10,32,32,32,32,32,32,99,32,61,32,99,111,115,40,104,97,108,102,95,97,110,103,108,101,41,59,10,32,32,32,32,32,32,115,32,61,32,115,105,110,40,104,97,108,102,95,97,110,103,108,101,41,59,10,32,32,32,32,32,32,118,46,120,32,61,32,99,32,42,32,111,102,102,115,101,116,95,100,105,114,101,99,116,105,111,110,46,120,32,45,32,115,32,42,32,111,102,102,115,101,116,95,100,105,114,101,99,116,105,111,110,46,121,59,10,32,32,32,32,32,32,118,46,121,32,61,32,115,32,42,32,111,102,102,115,101,116,95,100,105,114,101,99,116,105,111,110,46,120,32,43,32,99,32,42,32,111,102,102,115,101,116,95,100,105,114,101,99,116,105,111,110,46,121,59,10,10,32,32,32,32,32,32,76,32,61,32,49,46,48,32,45,32,99,59,10,32,32,32,32,32,32,68,32,61,32,40,115,116,114,111,107,101,95,114,97,100,105,117,115,95,102,111,114,95,111,117,116,101,114,95,98,111,117,110,100,97,114,121,32,43,32,97,114,99,95,114,97,100,105,117,115,95,102,111,114,95,111,117,116,101,114,95,98,111,117,110,100,97,114,121,41,32,42,32,76,59,10,32,32,32,32,32,32,112,32,43,61,32,68,32,42,32,118,59,10,10,32,32,32,32,32,32,47,42,32,109,111,118,101,32,112,32,97,110,32,97,100,100,105,116,105,111,110,97,108,32,97,109,111,117,110,116,32,115,111,32,116,104,97,116,32,116,104,101,32,101,100,103,101,32,102,111,114,109,101,100,10,32,32,32,32,32,32,32,42,32,102,114,111,109,32,116,104,101,32,98,101,121,111,110,100,32,98,111,117,100,110,97,114,121,32,112,111,105,110,116,115,32,105,115,32,97,116,108,101,97,115,116,32,111,110,101,32,112,105,120,101,108,10,32,32,32,32,32,32,32,42,32,102,114,111,109,32,116,104,101,32,115,116,114,111,107,105,110,103,45,97,114,99,32,98,111,117,110,100,97,114,121,46,10,32,32,32,32,32,32,32,42,47,10,32,32,32,32,32,32,118,101,99,51,32,99,108,105,112,95,112,44,32,99,108,105,112,95,100,105,114,101,99,116,105,111,110,59,10,32,32,32,32,32,32,102,108,111,97,116,32,100,59,10,10,32,32,32,32,32,32,99,108,105,112,95,112,32,61,32,102,97,115,116,117,105,100,114,97,119,95,105,116,101,109,95,109,97,116,114,105,120,32,42,32,118,101,99,51,40,112,44,32,49,46,48,41,59,10,32,32,32,32,32,32,99,108,105,112,95,100,105,114,101,99,116,105,111,110,32,61,32,102,97,115,116,117,105,100,114,97,119,95,105,116,101,109,95,109,97,116,114,105,120,32,42,32,118,101,99,51,40,118,44,32,48,41,59,10,32,32,32,32,32,32,100,32,61,32,102,97,115,116,117,105,100,114,97,119,95,108,111,99,97,108,95,100,105,115,116,97,110,99,101,95,102,114,111,109,95,112,105,120,101,108,95,100,105,115,116,97,110,99,101,40,49,46,48,44,32,99,108,105,112,95,112,44,32,99,108,105,112,95,100,105,114,101,99,116,105,111,110,41,59,10,32,32,32,32,32,32,112,32,43,61,32,100,32,47,32,99,32,42,32,118,59,10,32,32,32,32,125,10,10,32,32,118,101,99,116,111,114,95,102,114,111,109,95,99,101,110,116,101,114,32,61,32,112,32,45,32,99,101,110,116,101,114,59,10,32,32,105,102,32,40,100,97,115,104,95,115,116,121,108,101,32,33,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,110,111,116,95,100,97,115,104,101,100,41,10,32,32,32,32,123,10,32,32,32,32,32,32,118,101,99,116,111,114,95,102,114,111,109,95,99,101,110,116,101,114,32,61,32,114,111,116,97,116,101,95,98,121,32,42,32,118,101,99,116,111,114,95,102,114,111,109,95,99,101,110,116,101,114,59,10,32,32,32,32,125,10,10,32,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,105,110,103,95,114,101,108,97,116,105,118,101,95,116,111,95,99,101,110,116,101,114,95,120,32,61,32,118,101,99,116,111,114,95,102,114,111,109,95,99,101,110,116,101,114,46,120,59,10,32,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,105,110,103,95,114,101,108,97,116,105,118,101,95,116,111,95,99,101,110,116,101,114,95,121,32,61,32,118,101,99,116,111,114,95,102,114,111,109,95,99,101,110,116,101,114,46,121,59,10,10,32,32,105,102,32,40,111,102,102,115,101,116,95,116,121,112,101,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,101,95,108,105,110,101,95,115,101,103,109,101,110,116,10,32,32,32,32,32,32,124,124,32,111,102,102,115,101,116,95,116,121,112,101,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,101,95,100,97,115,104,101,100,95,99,97,112,112,101,114,41,10,32,32,32,32,123,10,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,105,110,103,95,97,114,99,95,114,97,100,105,117,115,32,61,32,45,49,46,48,102,59,32,47,47,105,110,100,105,99,97,116,101,32,116,111,32,102,114,97,103,32,115,104,97,100,101,114,32,116,111,32,115,107,105,112,32,97,114,99,45,99,111,118,101,114,97,103,101,10,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,105,110,103,95,114,101,108,97,116,105,118,101,95,116,111,95,99,101,110,116,101,114,95,120,32,61,32,102,108,111,97,116,40,111,110,95,98,111,117,110,100,97,114,121,41,59,10,32,32,32,32,125,10,10,32,32,105,102,32,40,97,97,95,109,101,116,104,111,100,32,61,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,99,111,118,101,114,95,116,104,101,110,95,100,114,97,119,41,10,32,32,32,32,123,10,32,32,32,32,32,32,105,102,32,40,115,116,114,111,107,105,110,103,95,112,97,115,115,32,33,61,32,102,97,115,116,117,105,100,114,97,119,95,115,116,114,111,107,101,95,110,111,110,95,97,97,41,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,122,95,97,100,100,32,61,32,48,59,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,101,108,115,101,10,32,32,32,32,32,32,32,32,123,10,32,32,32,32,32,32,32,32,32,32,122,95,97,100,100,32,61,32,105,110,116,40,70,65,83,84,85,73,68,82,65,87,95,69,88,84,82,65,67,84,95,66,73,84,83,40,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,101,95,100,101,112,116,104,95,98,105,116,48,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,101,95,100,101,112,116,104,95,110,117,109,95,98,105,116,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,112,111,105,110,116,95,112,97,99,107,101,100,95,100,97,116,97,41,41,59,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,125,10,32,32,101,108,115,101,10,32,32,32,32,123,10,32,32,32,32,32,32,122,95,97,100,100,32,61,32,105,110,116,40,70,65,83,84,85,73,68,82,65,87,95,69,88,84,82,65,67,84,95,66,73,84,83,40,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,101,95,100,101,112,116,104,95,98,105,116,48,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,102,97,115,116,117,105,100,114,97,119,95,97,114,99,95,115,116,114,111,107,101,95,100,101,112,116,104,95,110,117,109,95,98,105,116,115,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,112,111,105,110,116,95,112,97,99,107,101,100,95,100,97,116,97,41,41,59,10,32,32,32,32,125,10,10,32,32,111,117,116,95,99,108,105,112,95,112,32,61,32,102,97,115,116,117,105,100,114,97,119,95,105,116,101,109,95,109,97,116,114,105,120,32,42,32,118,101,99,51,40,112,44,32,49,46,48,41,59,10,32,32,111,117,116,95,98,114,117,115,104,95,112,32,61,32,112,59,10,125,10, 0 };
+
+ fastuidraw::static_resource R("fastuidraw_painter_arc_stroke.vert.glsl.resource_string", fastuidraw::c_array<const uint8_t>(values, sizeof(values)));
+ 
+
+}
+
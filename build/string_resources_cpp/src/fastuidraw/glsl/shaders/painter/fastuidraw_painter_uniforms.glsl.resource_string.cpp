@@ -0,0 +1,11 @@
+#include <fastuidraw/util/static_resource.hpp>
+
+namespace { 
+	const uint8_t values[]={ 
+47,42,33,10,32,42,32,92,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,95,117,110,105,102,111,114,109,115,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,32,92,98,114,105,101,102,32,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,95,117,110,105,102,111,114,109,115,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,10,32,42,32,67,111,112,121,114,105,103,104,116,32,50,48,49,56,32,98,121,32,73,110,116,101,108,46,10,32,42,10,32,42,32,67,111,110,116,97,99,116,58,32,107,101,118,105,110,46,114,111,103,111,118,105,110,64,105,110,116,101,108,46,99,111,109,10,32,42,10,32,42,32,84,104,105,115,32,83,111,117,114,99,101,32,67,111,100,101,32,70,111,114,109,32,105,115,32,115,117,98,106,101,99,116,32,116,111,32,116,104,101,10,32,42,32,116,101,114,109,115,32,111,102,32,116,104,101,32,77,111,122,105,108,108,97,32,80,117,98,108,105,99,32,76,105,99,101,110,115,101,44,32,118,46,32,50,46,48,46,10,32,42,32,73,102,32,97,32,99,111,112,121,32,111,102,32,116,104,101,32,77,80,76,32,119,97,115,32,110,111,116,32,100,105,115,116,114,105,98,117,116,101,100,32,119,105,116,104,10,32,42,32,116,104,105,115,32,102,105,108,101,44,32,89,111,117,32,99,97,110,32,111,98,116,97,105,110,32,111,110,101,32,97,116,10,32,42,32,104,116,116,112,58,47,47,109,111,122,105,108,108,97,46,111,114,103,47,77,80,76,47,50,46,48,47,46,10,32,42,10,32,42,32,92,97,117,116,104,111,114,32,75,101,118,105,110,32,82,111,103,111,118,105,110,32,60,107,101,118,105,110,46,114,111,103,111,118,105,110,64,105,110,116,101,108,46,99,111,109,62,10,32,42,10,32,42,47,10,10,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,10,47,47,32,67,111,108,111,114,32,83,116,111,112,32,65,116,108,97,115,10,35,105,102,100,101,102,32,70,65,83,84,85,73,68,82,65,87,95,80,65,73,78,84,69,82,95,67,79,76,79,82,83,84,79,80,95,65,84,76,65,83,95,50,68,95,65,82,82,65,89,10,10,32,32,70,65,83,84,85,73,68,82,65,87,95,76,65,89,79,85,84,95,66,73,78,68,73,78,71,40,70,65,83,84,85,73,68,82,65,87,95,67,79,76,79,82,83,84,79,80,95,65,84,76,65,83,95,66,73,78,68,73,78,71,41,32,117,110,105,102,111,114,109,32,115,97,109,112,108,101,114,50,68,65,114,114,97,121,32,102,97,115,116,117,105,100,114,97,119,95,99,111,108,111,114,83,116,111,112,65,116,108,97,115,59,10,32,32,35,100,101,102,105,110,101,32,102,97,115,116,117,105,100,114,97,119,95,99,111,108,111,114,83,116,111,112,70,101,116,99,104,40,120,44,32,76,41,32,116,101,120,116,117,114,101,76,111,100,40,102,97,115,116,117,105,100,114,97,119,95,99,111,108,111,114,83,116,111,112,65,116,108,97,115,44,32,118,101,99,51,40,102,108,111,97,116,40,120,41,44,32,48,46,48,44,32,102,108,111,97,116,40,76,41,41,44,32,48,46,48,41,10,10,35,101,108,115,101,10,10,32,32,70,65,83,84,85,73,68,82,65,87,95,76,65,89,79,85,84,95,66,73,78,68,73,78,71,40,70,65,83,84,85,73,68,82,65,87,95,67,79,76,79,82,83,84,79,80,95,65,84,76,65,83,95,66,73,78,68,73,78,71,41,32,117,110,105,102,111,114,109,32,115,97,109,112,108,101,114,49,68,65,114,114,97,121,32,102,97,115,116,117,105,100,114,97,119,95,99,111,108,111,114,83,116,111,112,65,116,108,97,115,59,10,32,32,35,100,101,102,105,110,101,32,102,97,115,116,117,105,100,114,97,119,95,99,111,108,111,114,83,116,111,112,70,101,116,99,104,40,120,44,32,76,41,32,116,101,120,116,117,114,101,76,111,100,40,102,97,115,116,117,105,100,114,97,119,95,99,111,108,111,114,83,116,111,112,65,116,108,97,115,44,32,118,101,99,50,40,102,108,111,97,116,40,120,41,44,32,102,108,111,97,116,40,76,41,41,44,32,48,46,48,41,10,10,35,101,110,100,105,102,10,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,10,10,10,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,10,47,47,32,73,109,97,103,101,32,65,116,108,97,115,10,70,65,83,84,85,73,68,82,65,87,95,76,65,89,79,85,84,95,66,73,78,68,73,78,71,40,70,65,83,84,85,73,68,82,65,87,95,67,79,76,79,82,95,84,73,76,69,95,76,73,78,69,65,82,95,66,73,78,68,73,78,71,41,32,117,110,105,102,111,114,109,32,115,97,109,112,108,101,114,50,68,65,114,114,97,121,32,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,65,116,108,97,115,76,105,110,101,97,114,59,10,70,65,83,84,85,73,68,82,65,87,95,76,65,89,79,85,84,95,66,73,78,68,73,78,71,40,70,65,83,84,85,73,68,82,65,87,95,67,79,76,79,82,95,84,73,76,69,95,78,69,65,82,69,83,84,95,66,73,78,68,73,78,71,41,32,117,110,105,102,111,114,109,32,115,97,109,112,108,101,114,50,68,65,114,114,97,121,32,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,65,116,108,97,115,78,101,97,114,101,115,116,59,10,70,65,83,84,85,73,68,82,65,87,95,76,65,89,79,85,84,95,66,73,78,68,73,78,71,40,70,65,83,84,85,73,68,82,65,87,95,73,78,68,69,88,95,84,73,76,69,95,66,73,78,68,73,78,71,41,32,117,110,105,102,111,114,109,32,117,115,97,109,112,108,101,114,50,68,65,114,114,97,121,32,102,97,115,116,117,105,100,114,97,119,95,105,109,97,103,101,73,110,100,101,120,65,116,108,97,115,59,10,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,10,10,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,10,47,47,32,71,108,121,112,104,32,65,116,108,97,115,32,32,83,116,111,114,101,10,35,105,102,100,101,102,32,70,65,83,84,85,73,68,82,65,87,95,71,76,89,80,72,95,68,65,84,65,95,83,84,79,82,69,95,83,83,66,79,10,10,32,32,70,65,83,84,85,73,68,82,65,87,95,76,65,89,79,85,84,95,66,73,78,68,73,78,71,95,65,82,71,83,40,70,65,83,84,85,73,68,82,65,87,95,71,76,89,80,72,95,68,65,84,65,95,83,84,79,82,69,95,66,73,78,68,73,78,71,44,32,115,116,100,52,51,48,41,32,114,101,115,116,114,105,99,116,32,114,101,97,100,111,110,108,121,32,98,117,102,102,101,114,32,102,97,115,116,117,105,100,114,97,119,95,103,108,121,112,104,68,97,116,97,83,116,111,114,101,10,32,32,123,10,32,32,32,32,117,105,110,116,32,102,97,115,116,117,105,100,114,97,119,95,103,108,121,112,104,68,97,116,97,83,116,111,114,101,95,100,97,116,97,91,93,59,10,32,32,125,59,10,32,32,35,100,101,102,105,110,101,32,102,97,115,116,117,105,100,114,97,119,95,102,101,116,99,104,95,103,108,121,112,104,95,100,97,116,97,40,88,41,32,40,102,97,115,116,117,105,100,114,97,119,95,103,108,121,112,104,68,97,116,97,83,116,111,114,101,95,100,97,116,97,91,105,110,116,40,88,41,93,41,10,32,32,35,100,101,102,105,110,101,32,102,97,115,116,117,105,100,114,97,119,95,102,101,116,99,104,95,103,108,121,112,104,95,100,97,116,97,95,102,112,49,54,120,50,40,88,41,32,117,110,112,97,99,107,72,97,108,102,50,120,49,54,40,102,97,115,116,117,105,100,114,97,119,95,103,108,121,112,104,68,97,116,97,83,116,111,114,101,95,100,97,116,97,91,105,110,116,40,88,41,93,41,10,10,35,101,108,105,102,32,100,101,102,105,110,101,100,40,70,65,83,84,85,73,68,82,65,87,95,71,76,89,80,72,95,68,65,84,65,95,83,84,79,82,69,95,84,69,88,84,85,82,69,95,65,82,82,65,89,41,10,10,32,32,47,42,32,84,104,101,32,119,105,100,116,104,32,97,110,100,32,104,101,105,103,104,116,32,111,102,32,102,97,115,116,117,105,100,114,97,119,95,103,108,121,112,104,68,97,116,97,83,116,111,114,101,32,97,114,101,10,32,32,32,42,32,112,111,119,101,114,115,32,111,102,32,50,44,32,116,104,101,32,118,97,108,117,101,115,32,103,105,118,101,110,32,98,121,32,70,65,83,84,85,73,68,82,65,87,95,71,76,89,80,72,95,68,65,84,65,95,87,73,68,84,72,95,76,79,71,50,10,32,32,32,42,32,97,110,100,32,70,65,83,84,85,73,68,82,65,87,95,71,76,89,80,72,95,68,65,84,65,95,72,69,73,71,72,84,95,76,79,71,50,46,32,87,101,32,119,97,110,116,32,116,111,32,117,115,101,10,32,32,32,42,32,98,105,116,32,115,104,105,102,116,115,32,97,110,100,32,109,97,115,107,105,110,103,32,116,111,32,103,101,116,32,116,104,101,32,99,111,114,114,101,99,116,32,108,97,121,101,114,44,32,104,101,105,103,104,116,32,97,110,100,32,115,111,32,111,110,46,10,32,32,32,42,47,10,32,32,70,65,83,84,85,73,68,82,65,87,95,76,65,89,79,85,84,95,66,73,78,68,73,78,71,40,70,65,83,84,85,73,68,82,65,87,95,71,76,89,80,72,95,68,65,84,65,95,83,84,79,82,69,95,66,73,78,68,73,78,71,41,32,117,110,105,102,111,114,109,32,117,115,97,109,112,108,101,114,50,68,65,114,114,97,121,32,102,97,115,116,117,105,100,114,97,119,95,103,108,121,112,104,68,97,116,97,83,116,111,114,101,59,10,32,32,70,65,83,84,85,73,68,82,65,87,95,76,65,89,79,85,84,95,66,73,78,68,73,78,71,40,70,65,83,84,85,73,68,82,65,87,95,71,76,89,80,72,95,68,65,84,65,95,83,84,79,82,69,95,70,80,49,54,88,50,95,66,73,78,68,73,78,71,41,32,117,110,105,102,111,114,109,32,115,97,109,112,108,101,114,50,68,65,114,114,97,121,32,102,97,115,116,117,105,100,114,97,119,95,103,108,121,112,104,68,97,116,97,83,116,111,114,101,95,102,112,49,54,120,50,59,10,32,32,35,100,101,102,105,110,101,32,70,65,83,84,85,73,68,82,65,87,95,71,76,89,80,72,95,68,65,84,65,95,87,73,68,84,72,95,80,76,85,83,95,72,69,73,71,72,84,95,76,79,71,50,32,117,105,110,116,40,70,65,83,84,85,73,68,82,65,87,95,71,76,89,80,72,95,68,65,84,65,95,87,73,68,84,72,95,76,79,71,50,32,43,32,70,65,83,84,85,73,68,82,65,87,95,71,76,89,80,72,95,68,65,84,65,95,72,69,73,71,72,84,95,76,79,71,50,41,10,32,32,35,100,101,102,105,110,101,32,70,65,83,84,85,73,68,82,65,87,95,71,76,89,80,72,95,68,65,84,65,95,76,65,89,69,82,40,84,41,32,40,117,105,110,116,40,84,41,32,62,62,32,70,65,83,84,85,73,68,82,65,87,95,71,76,89,80,72,95,68,65,84,65,95,87,73,68,84,72,95,80,76,85,83,95,72,69,73,71,72,84,95,76,79,71,50,41,10,32,32,35,100,101,102,105,110,101,32,70,65,83,84,85,73,68,82,65,87,95,71,76,89,80,72,95,68,65,84,65,95,89,40,84,41,32,70,65,83,84,85,73,68,82,65,87,95,69,88,84,82,65,67,84,95,66,73,84,83,40,70,65,83,84,85,73,68,82,65,87,95,71,76,89,80,72,95,68,65,84,65,95,87,73,68,84,72,95,76,79,71,50,44,32,70,65,83,84,85,73,68,82,65,87,95,71,76,89,80,72,95,68,65,84,65,95,72,69,73,71,72,84,95,76,79,71,50,44,32,84,41,10,32,32,35,100,101,102,105,110,101,32,70,65,83,84,85,73,68,82,65,87,95,71,76,89,80,72,95,68,65,84,65,95,88,40,84,41,32,70,65,83,84,85,73,68,82,65,87,95,69,88,84,82,65,67,84,95,66,73,84,83,40,48,44,32,70,65,83,84,85,73,68,82,65,87,95,71,76,89,80,72,95,68,65,84,65,95,87,73,68,84,72,95,76,79,71,50,44,32,84,41,10,32,32,35,100,101,102,105,110,101,32,70,65,83,84,85,73,68,82,65,87,95,71,76,89,80,72,95,68,65,84,65,95,67,79,79,82,68,40,118,41,32,105,118,101,99,51,40,70,65,83,84,85,73,68,82,65,87,95,71,76,89,80,72,95,68,65,84,65,95,88,40,118,41,44,32,70,65,83,84,85,73,68,82,65,87,95,71,76,89,80,72,95,68,65,84,65,95,89,40,118,41,44,32,70,65,83,84,85,73,68,82,65,87,95,71,76,89,80,72,95,68,65,84,65,95,76,65,89,69,82,40,118,41,41,10,32,32,35,100,101,102,105,110,101,32,102,97,115,116,117,105,100,114,97,119,95,102,101,116,99,104,95,103,108,121,112,104,95,100,97,116,97,40,88,41,32,40,116,101,120,101,108,70,101,116,99,104,40,102,97,115,116,117,105,100,114,97,119,95,103,108,121,112,104,68,97,116,97,83,116,111,114,101,44,32,70,65,83,84,85,73,68,82,65,87,95,71,76,89,80,72,95,68,65,84,65,95,67,79,79,82,68,40,88,41,44,32,48,41,46,114,41,10,10,32,32,47,42,32,84,79,68,79,58,32,104,97,118,101,32,109,97,99,114,111,32,115,121,115,116,101,109,32,99,104,101,99,107,105,110,103,32,102,111,114,32,116,101,120,116,117,114,101,45,118,105,101,119,59,32,102,111,114,32,119,104,101,110,32,116,101,120,116,117,114,101,45,118,105,101,119,32,105,115,10,32,32,32,42,32,110,111,116,32,115,117,112,112,111,114,116,101,100,44,32,116,104,101,110,32,102,97,108,108,32,98,97,99,107,32,116,111,32,117,115,105,110,103,32,117,110,112,97,99,107,72,97,108,102,50,120,49,54,32,79,82,32,114,101,113,117,105,114,101,32,102,114,111,109,32,67,43,43,10,32,32,32,42,32,99,111,100,101,32,116,104,97,116,32,116,111,32,117,115,101,32,50,100,45,116,101,120,116,117,114,101,45,97,114,114,97,121,32,114,101,113,117,105,114,101,115,32,116,104,97,116,32,116,101,120,116,117,114,101,45,118,105,101,119,32,105,115,32,115,117,112,112,111,114,116,101,100,46,10,32,32,32,42,47,10,32,32,35,100,101,102,105,110,101,32,102,97,115,116,117,105,100,114,97,119,95,102,101,116,99,104,95,103,108,121,112,104,95,100,97,116,97,95,102,112,49,54,120,50,40,88,41,32,40,116,101,120,101,108,70,101,116,99,104,40,102,97,115,116,117,105,100,114,97,119,95,103,108,121,112,104,68,97,116,97,83,116,111,114,101,95,102,112,49,54,120,50,44,32,70,65,83,84,85,73,68,82,65,87,95,71,76,89,80,72,95,68,65,84,65,95,67,79,79,82,68,40,88,41,44,32,48,41,46,114,103,41,10,10,35,101,108,115,101,10,10,32,32,70,65,83,84,85,73,68,82,65,87,95,76,65,89,79,85,84,95,66,73,78,68,73,78,71,40,70,65,83,84,85,73,68,82,65,87,95,71,76,89,80,72,95,68,65,84,65,95,83,84,79,82,69,95,66,73,78,68,73,78,71,41,32,117,110,105,102,111,114,109,32,117,115,97,109,112,108,101,114,66,117,102,102,101,114,32,102,97,115,116,117,105,100,114,97,119,95,103,108,121,112,104,68,97,116,97,83,116,111,114,101,59,10,32,32,70,65,83,84,85,73,68,82,65,87,95,76,65,89,79,85,84,95,66,73,78,68,73,78,71,40,70,65,83,84,85,73,68,82,65,87,95,71,76,89,80,72,95,68,65,84,65,95,83,84,79,82,69,95,70,80,49,54,88,50,95,66,73,78,68,73,78,71,41,32,117,110,105,102,111,114,109,32,115,97,109,112,108,101,114,66,117,102,102,101,114,32,102,97,115,116,117,105,100,114,97,119,95,103,108,121,112,104,68,97,116,97,83,116,111,114,101,95,102,112,49,54,120,50,59,10,32,32,35,100,101,102,105,110,101,32,102,97,115,116,117,105,100,114,97,119,95,102,101,116,99,104,95,103,108,121,112,104,95,100,97,116,97,40,88,41,32,40,116,101,120,101,108,70,101,116,99,104,40,102,97,115,116,117,105,100,114,97,119,95,103,108,121,112,104,68,97,116,97,83,116,111,114,101,44,32,105,110,116,40,88,41,41,46,114,41,10,32,32,35,100,101,102,105,110,101,32,102,97,115,116,117,105,100,114,97,119,95,102,101,116,99,104,95,103,108,121,112,104,95,100,97,116,97,95,102,112,49,54,120,50,40,88,41,32,40,116,101,120,101,108,70,101,116,99,104,40,102,97,115,116,117,105,100,114,97,119,95,103,108,121,112,104,68,97,116,97,83,116,111,114,101,95,102,112,49,54,120,50,44,32,105,110,116,40,88,41,41,46,114,103,41,10,10,35,101,110,100,105,102,10,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,10,10,10,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,47,10,47,47,32,80,97,105,110,116,101,114,32,68,97,116,97,32,83,116,111,114,101,10,35,105,102,100,101,102,32,70,65,83,84,85,73,68,82,65,87,95,80,65,73,78,84,69,82,95,85,83,69,95,68,65,84,65,95,84,66,79,10,10,32,32,70,65,83,84,85,73,68,82,65,87,95,76,65,89,79,85,84,95,66,73,78,68,73,78,71,40,70,65,83,84,85,73,68,82,65,87,95,80,65,73,78,84,69,82,95,83,84,79,82,69,95,66,73,78,68,73,78,71,41,32,117,110,105,102,111,114,109,32,117,115,97,109,112,108,101,114,66,117,102,102,101,114,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,83,116,111,114,101,95,116,98,111,59,10,32,32,35,100,101,102,105,110,101,32,102,97,115,116,117,105,100,114,97,119,95,102,101,116,99,104,95,100,97,116,97,40,98,108,111,99,107,41,32,116,101,120,101,108,70,101,116,99,104,40,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,83,116,111,114,101,95,116,98,111,44,32,105,110,116,40,98,108,111,99,107,41,41,10,10,35,101,108,105,102,32,100,101,102,105,110,101,100,40,70,65,83,84,85,73,68,82,65,87,95,80,65,73,78,84,69,82,95,85,83,69,95,68,65,84,65,95,83,83,66,79,41,10,10,32,32,70,65,83,84,85,73,68,82,65,87,95,76,65,89,79,85,84,95,66,73,78,68,73,78,71,95,65,82,71,83,40,70,65,83,84,85,73,68,82,65,87,95,80,65,73,78,84,69,82,95,83,84,79,82,69,95,66,73,78,68,73,78,71,44,32,115,116,100,52,51,48,41,32,114,101,115,116,114,105,99,116,32,114,101,97,100,111,110,108,121,32,98,117,102,102,101,114,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,83,116,111,114,101,95,115,115,98,111,10,32,32,123,10,32,32,32,32,117,118,101,99,52,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,83,116,111,114,101,91,93,59,10,32,32,125,59,10,32,35,100,101,102,105,110,101,32,102,97,115,116,117,105,100,114,97,119,95,102,101,116,99,104,95,100,97,116,97,40,98,108,111,99,107,41,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,83,116,111,114,101,91,105,110,116,40,98,108,111,99,107,41,93,10,10,35,101,108,105,102,32,100,101,102,105,110,101,100,40,70,65,83,84,85,73,68,82,65,87,95,80,65,73,78,84,69,82,95,85,83,69,95,68,65,84,65,95,85,66,79,41,10,10,32,32,70,65,83,84,85,73,68,82,65,87,95,76,65,89,79,85,84,95,66,73,78,68,73,78,71,95,65,82,71,83,40,70,65,83,84,85,73,68,82,65,87,95,80,65,73,78,84,69,82,95,83,84,79,82,69,95,66,73,78,68,73,78,71,44,32,115,116,100,49,52,48,41,32,117,110,105,102,111,114,109,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,83,116,111,114,101,95,117,98,111,10,32,32,123,10,32,32,32,32,117,118,101,99,52,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,83,116,111,114,101,91,70,65,83,84,85,73,68,82,65,87,95,80,65,73,78,84,69,82,95,68,65,84,65,95,83,84,79,82,69,95,65,82,82,65,89,95,83,73,90,69,93,59,10,32,32,125,59,10,32,32,35,100,101,102,105,110,101,32,102,97,115,116,117,105,100,114,97,119,95,102,101,116,99,104,95,100,97,116,97,40,98,108,111,99,107,41,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,83,116,111,114,101,91,105,110,116,40,98,108,111,99,107,41,93,10,10,35,101,110,100,105,102,10,10,70,65,83,84,85,73,68,82,65,87,95,76,65,89,79,85,84,95,66,73,78,68,73,78,71,40,70,65,83,84,85,73,68,82,65,87,95,80,65,73,78,84,69,82,95,69,88,84,69,82,78,65,76,95,84,69,88,84,85,82,69,95,66,73,78,68,73,78,71,41,32,117,110,105,102,111,114,109,32,115,97,109,112,108,101,114,50,68,32,102,97,115,116,117,105,100,114,97,119,95,101,120,116,101,114,110,97,108,95,116,101,120,116,117,114,101,59,10, 0 };
+
+ fastuidraw::static_resource R("fastuidraw_painter_uniforms.glsl.resource_string", fastuidraw::c_array<const uint8_t>(values, sizeof(values)));
+ 
+
+}
+
@@ -0,0 +1,11 @@
+#include <fastuidraw/util/static_resource.hpp>
+
+namespace { 
+	const uint8_t values[]={ 
+47,42,33,10,32,42,32,92,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,95,103,108,121,112,104,95,109,115,100,102,46,102,114,97,103,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,32,92,98,114,105,101,102,32,102,105,108,101,32,102,97,115,116,117,105,100,114,97,119,95,112,97,105,110,116,101,114,95,103,108,121,112,104,95,109,115,100,102,46,102,114,97,103,46,103,108,115,108,46,114,101,115,111,117,114,99,101,95,115,116,114,105,110,103,10,32,42,10,32,42,32,67,111,112,121,114,105,103,104,116,32,50,48,49,57,32,98,121,32,73,110,116,101,108,46,10,32,42,10,32,42,32,67,111,110,116,97,99,116,58,32,107,101,118,105,110,46,114,111,103,111,118,105,110,64,105,110,116,101,108,46,99,111,109,10,32,42,10,32,42,32,84,104,105,115,32,83,111,117,114,99,101,32,67,111,100,101,32,70,111,114,109,32,105,115,32,115,117,98,106,101,99,116,32,116,111,32,116,104,101,10,32,42,32,116,101,114,109,115,32,111,102,32,116,104,101,32,77,111,122,105,108,108,97,32,80,117,98,108,105,99,32,76,105,99,101,110,115,101,44,32,118,46,32,50,46,48,46,10,32,42,32,73,102,32,97,32,99,111,112,121,32,111,102,32,116,104,101,32,77,80,76,32,119,97,115,32,110,111,116,32,100,105,115,116,114,105,98,117,116,101,100,32,119,105,116,104,10,32,42,32,116,104,105,115,32,102,105,108,101,44,32,89,111,117,32,99,97,110,32,111,98,116,97,105,110,32,111,110,101,32,97,116,10,32,42,32,104,116,116,112,58,47,47,109,111,122,105,108,108,97,46,111,114,103,47,77,80,76,47,50,46,48,47,46,10,32,42,10,32,42,32,92,97,117,116,104,111,114,32,75,101,118,105,110,32,82,111,103,111,118,105,110,32,60,107,101,118,105,110,46,114,111,103,111,118,105,110,64,105,110,116,101,108,46,99,111,109,62,10,32,42,10,32,42,47,10,10,10,118,101,99,52,10,102,97,115,116,117,105,100,114,97,119,95,103,108,95,102,114,97,103,95,109,97,105,110,40,105,110,32,117,105,110,116,32,115,117,98,95,115,104,97,100,101,114,44,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,105,110,32,117,105,110,116,32,115,104,97,100,101,114,95,100,97,116,97,95,111,102,102,115,101,116,41,10,123,10,32,32,102,108,111,97,116,32,116,101,120,101,108,44,32,100,105,115,116,44,32,99,111,118,101,114,97,103,101,59,10,32,32,105,118,101,99,50,32,99,111,111,114,100,48,48,44,32,99,111,111,114,100,48,49,44,32,99,111,111,114,100,49,48,44,32,99,111,111,114,100,49,49,59,10,32,32,118,101,99,50,32,109,105,120,101,114,59,10,32,32,118,101,99,52,32,102,48,48,44,32,102,49,48,44,32,102,48,49,44,32,102,49,49,59,10,32,32,118,101,99,52,32,102,48,44,32,102,49,44,32,102,59,10,32,32,117,118,101,99,50,32,100,105,109,115,32,61,32,117,118,101,99,50,40,102,97,115,116,117,105,100,114,97,119,95,103,108,121,112,104,95,119,105,100,116,104,44,32,102,97,115,116,117,105,100,114,97,119,95,103,108,121,112,104,95,104,101,105,103,104,116,41,59,10,32,32,118,101,99,50,32,116,97,117,32,61,32,118,101,99,50,40,102,97,115,116,117,105,100,114,97,119,95,103,108,121,112,104,95,99,111,111,114,100,95,120,44,32,102,97,115,116,117,105,100,114,97,119,95,103,108,121,112,104,95,99,111,111,114,100,95,121,41,59,10,32,32,118,101,99,50,32,116,97,117,95,112,108,117,115,95,104,97,108,102,32,61,32,116,97,117,32,43,32,118,101,99,50,40,48,46,53,44,32,48,46,53,41,59,10,10,32,32,99,111,111,114,100,48,48,32,61,32,105,118,101,99,50,40,116,97,117,95,112,108,117,115,95,104,97,108,102,41,32,45,32,105,118,101,99,50,40,49,44,32,49,41,59,10,32,32,99,111,111,114,100,49,48,32,61,32,99,111,111,114,100,48,48,32,43,32,105,118,101,99,50,40,49,44,32,48,41,59,10,32,32,99,111,111,114,100,48,49,32,61,32,99,111,111,114,100,48,48,32,43,32,105,118,101,99,50,40,48,44,32,49,41,59,10,32,32,99,111,111,114,100,49,49,32,61,32,99,111,111,114,100,48,48,32,43,32,105,118,101,99,50,40,49,44,32,49,41,59,10,32,32,109,105,120,101,114,32,61,32,116,97,117,95,112,108,117,115,95,104,97,108,102,32,45,32,118,101,99,50,40,105,118,101,99,50,40,116,97,117,95,112,108,117,115,95,104,97,108,102,41,41,59,10,10,32,32,102,48,48,32,61,32,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,109,115,100,102,95,116,101,120,101,108,95,102,114,111,109,95,100,97,116,97,40,99,111,111,114,100,48,48,44,32,100,105,109,115,44,32,102,97,115,116,117,105,100,114,97,119,95,103,108,121,112,104,95,100,97,116,97,95,108,111,99,97,116,105,111,110,41,59,10,32,32,102,48,49,32,61,32,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,109,115,100,102,95,116,101,120,101,108,95,102,114,111,109,95,100,97,116,97,40,99,111,111,114,100,48,49,44,32,100,105,109,115,44,32,102,97,115,116,117,105,100,114,97,119,95,103,108,121,112,104,95,100,97,116,97,95,108,111,99,97,116,105,111,110,41,59,10,32,32,102,49,48,32,61,32,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,109,115,100,102,95,116,101,120,101,108,95,102,114,111,109,95,100,97,116,97,40,99,111,111,114,100,49,48,44,32,100,105,109,115,44,32,102,97,115,116,117,105,100,114,97,119,95,103,108,121,112,104,95,100,97,116,97,95,108,111,99,97,116,105,111,110,41,59,10,32,32,102,49,49,32,61,32,102,97,115,116,117,105,100,114,97,119,95,114,101,97,100,95,109,115,100,102,95,116,101,120,101,108,95,102,114,111,109,95,100,97,116,97,40,99,111,111,114,100,49,49,44,32,100,105,109,115,44,32,102,97,115,116,117,105,100,114,97,119,95,103,108,121,112,104,95,100,97,116,97,95,108,111,99,97,116,105,111,110,41,59,10,10,32,32,47,42,32,102,105,108,116,101,114,32,101,97,99,104,32,99,104,97,110,110,101,108,32,97,110,100,32,116,104,101,110,32,116,97,107,101,32,116,104,101,32,109,101,100,105,97,110,32,111,102,32,116,104,101,10,32,32,32,42,32,102,105,114,115,116,32,116,104,114,101,101,32,99,104,97,110,110,101,108,115,59,32,116,104,101,32,109,101,100,105,97,110,32,111,102,32,116,104,101,32,105,110,116,101,114,112,111,108,97,116,101,100,10,32,32,32,42,32,99,104,97,110,110,101,108,115,32,105,115,32,119,104,97,116,32,107,101,101,112,115,32,116,104,101,32,99,111,114,110,101,114,115,32,111,102,32,116,104,101,32,103,108,121,112,104,32,115,104,97,114,112,46,10,32,32,32,42,47,10,32,32,102,48,32,61,32,109,105,120,40,102,48,48,44,32,102,48,49,44,32,109,105,120,101,114,46,121,41,59,10,32,32,102,49,32,61,32,109,105,120,40,102,49,48,44,32,102,49,49,44,32,109,105,120,101,114,46,121,41,59,10,32,32,102,32,61,32,109,105,120,40,102,48,44,32,102,49,44,32,109,105,120,101,114,46,120,41,59,10,32,32,116,101,120,101,108,32,61,32,109,97,120,40,109,105,110,40,102,46,114,44,32,102,46,103,41,44,32,109,105,110,40,109,97,120,40,102,46,114,44,32,102,46,103,41,44,32,102,46,98,41,41,32,47,32,50,53,53,46,48,59,10,10,32,32,100,105,115,116,32,61,32,50,46,48,32,42,32,116,101,120,101,108,32,45,32,49,46,48,59,10,32,32,99,111,118,101,114,97,103,101,32,61,32,102,97,115,116,117,105,100,114,97,119,95,97,110,105,115,111,116,114,111,112,105,99,95,99,111,118,101,114,97,103,101,40,100,105,115,116,44,32,100,70,100,120,40,100,105,115,116,41,44,32,100,70,100,121,40,100,105,115,116,41,41,59,10,32,32,114,101,116,117,114,110,32,118,101,99,52,40,49,46,48,44,32,49,46,48,44,32,49,46,48,44,32,99,111,118,101,114,97,103,101,41,59,10,125,10, 0 };
+
+ fastuidraw::static_resource R("fastuidraw_painter_glyph_msdf.frag.glsl.resource_string", fastuidraw::c_array<const uint8_t>(values, sizeof(values)));
+ 
+
+}
+
@@ -31,6 +31,12 @@ include $(dir)/Rules.mk
 dir := $(d)/painter_simple_test
 include $(dir)/Rules.mk
 
+dir := $(d)/glyph_generation_benchmark
+include $(dir)/Rules.mk
+
+dir := $(d)/hash_index_benchmark
+include $(dir)/Rules.mk
+
 
 
 # Begin standard footer
@@ -119,7 +119,7 @@ namespace
       m_mutex.lock();
       if (!m_buffer)
         {
-          m_buffer = FASTUIDRAWnew fastuidraw::DataBuffer(m_filename.c_str());
+          m_buffer = FASTUIDRAWnew fastuidraw::MappedDataBuffer(m_filename.c_str());
         }
       R = m_buffer;
       m_mutex.unlock();
@@ -521,6 +521,59 @@ add_fonts_from_path(const std::string &filename,
   closedir(dir);
 }
 
+static
+void
+add_files_to_index(const std::string &filename,
+                   fastuidraw::FontFileIndex &index)
+{
+  DIR *dir;
+  struct dirent *entry;
+
+  dir = opendir(filename.c_str());
+  if (!dir)
+    {
+      index.add_file(filename.c_str());
+      return;
+    }
+
+  for(entry = readdir(dir); entry != nullptr; entry = readdir(dir))
+    {
+      std::string file;
+      file = entry->d_name;
+      if (file != ".." && file != ".")
+        {
+          if (filename.empty() || filename.back() != '/')
+            {
+              add_files_to_index(filename + "/" + file, index);
+            }
+          else
+            {
+              add_files_to_index(filename + file, index);
+            }
+        }
+    }
+  closedir(dir);
+}
+
+void
+add_fonts_from_path(const std::string &path,
+                    const std::string &index_file,
+                    fastuidraw::reference_counted_ptr<fastuidraw::FreeTypeLib> lib,
+                    fastuidraw::reference_counted_ptr<fastuidraw::FontDatabase> font_database)
+{
+  fastuidraw::reference_counted_ptr<fastuidraw::FontFileIndex> index;
+
+  index = FASTUIDRAWnew fastuidraw::FontFileIndex(lib);
+  index->load(index_file.c_str());
+  add_files_to_index(path, *index);
+  index->add_to_database(*font_database);
+
+  if (index->modified() && index->save(index_file.c_str()) != fastuidraw::routine_success)
+    {
+      std::cout << "Warning: unable to save font index to " << index_file << "\n";
+    }
+}
+
 fastuidraw::c_string
 default_font(void)
 {
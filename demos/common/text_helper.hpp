@@ -12,6 +12,7 @@
 #include <fastuidraw/text/font_database.hpp>
 #include <fastuidraw/text/glyph_cache.hpp>
 #include <fastuidraw/text/font_freetype.hpp>
+#include <fastuidraw/text/font_file_index.hpp>
 #include <fastuidraw/painter/painter.hpp>
 #include <fastuidraw/painter/glyph_sequence.hpp>
 
@@ -101,6 +102,22 @@ add_fonts_from_path(const std::string &path,
                     fastuidraw::reference_counted_ptr<fastuidraw::FreeTypeLib> lib,
                     fastuidraw::reference_counted_ptr<fastuidraw::FontDatabase> font_database);
 
+/*
+ * Add the fonts of a path to a FontDatabase using a FontFileIndex
+ * stored in a file; the file is read before scanning the path so
+ * that unchanged font files are not opened and is written back if
+ * any font file needed to be read.
+ * \param path file or directory from which to add fonts
+ * \param index_file file from which to load and to which to save the index
+ * \param lib FreeTypeLib used to read font files
+ * \param font_database FontDatabase to which to add the fonts
+ */
+void
+add_fonts_from_path(const std::string &path,
+                    const std::string &index_file,
+                    fastuidraw::reference_counted_ptr<fastuidraw::FreeTypeLib> lib,
+                    fastuidraw::reference_counted_ptr<fastuidraw::FontDatabase> font_database);
+
 void
 add_fonts_from_font_config(fastuidraw::reference_counted_ptr<fastuidraw::FreeTypeLib> lib,
                            fastuidraw::reference_counted_ptr<fastuidraw::FontDatabase> font_database);
@@ -0,0 +1,198 @@
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <fastuidraw/text/glyph_cache.hpp>
+#include <fastuidraw/text/glyph_atlas.hpp>
+#include <fastuidraw/text/glyph_generate_params.hpp>
+#include <fastuidraw/text/font_freetype.hpp>
+
+#include "generic_command_line.hpp"
+#include "simple_time.hpp"
+#include "cast_c_array.hpp"
+
+using namespace fastuidraw;
+
+/* The benchmark never uploads to the atlas, but a GlyphCache
+ * (from which the GlyphMetrics are fetched) requires one.
+ */
+class NullBackingStore:public GlyphAtlasBackingStoreBase
+{
+public:
+  NullBackingStore(void):
+    GlyphAtlasBackingStoreBase(1024, true)
+  {}
+
+  virtual
+  void
+  set_values(unsigned int, c_array<const generic_data>)
+  {}
+
+  virtual
+  void
+  flush(void)
+  {}
+
+protected:
+  virtual
+  void
+  resize_implement(unsigned int)
+  {}
+};
+
+class glyph_generation_benchmark:public command_line_register
+{
+public:
+  glyph_generation_benchmark(void);
+
+  int
+  main(int argc, char **argv);
+
+private:
+  /* generate the rendering data of every glyph of the font
+   * once; returns the time taken in microseconds.
+   */
+  int64_t
+  run_pass(const FontBase *font, GlyphRenderer render,
+           c_array<const GlyphMetrics> metrics,
+           uint64_t *total_bytes);
+
+  command_line_argument_value<std::string> m_font_file;
+  command_line_argument_value<int> m_font_index;
+  command_line_argument_value<int> m_num_passes;
+  command_line_argument_value<int> m_max_glyphs;
+  enumerated_command_line_argument_value<enum glyph_type> m_renderer;
+  command_line_argument_value<int> m_restricted_rays_threads;
+};
+
+glyph_generation_benchmark::
+glyph_generation_benchmark(void):
+  m_font_file("", "font_file", "Font file from which to generate glyphs", *this),
+  m_font_index(0, "font_index", "Face index of the font within font_file", *this),
+  m_num_passes(3, "num_passes",
+               "Number of times to generate every glyph of the font, the fastest "
+               "pass is reported", *this),
+  m_max_glyphs(0, "max_glyphs",
+               "If positive, only generate the first max_glyphs glyphs of the font", *this),
+  m_renderer(banded_rays_glyph,
+             enumerated_string_type<enum glyph_type>()
+             .add_entry("banded_rays", banded_rays_glyph, "GlyphRenderDataBandedRays")
+             .add_entry("restricted_rays", restricted_rays_glyph, "GlyphRenderDataRestrictedRays"),
+             "renderer", "Glyph rendering data to generate", *this),
+  m_restricted_rays_threads(GlyphGenerateParams::restricted_rays_number_threads(),
+                            "restricted_rays_threads",
+                            "Value for GlyphGenerateParams::restricted_rays_number_threads(), "
+                            "i.e. number of threads used to build the hierarchy of "
+                            "a restricted-rays glyph", *this)
+{
+  std::cout << std::boolalpha;
+}
+
+int64_t
+glyph_generation_benchmark::
+run_pass(const FontBase *font, GlyphRenderer render,
+         c_array<const GlyphMetrics> metrics,
+         uint64_t *total_bytes)
+{
+  simple_time timer;
+
+  *total_bytes = 0;
+  for (GlyphMetrics M : metrics)
+    {
+      GlyphRenderData *data;
+      Path path;
+      vec2 render_size;
+
+      data = font->compute_rendering_data(render, M, path, render_size);
+      *total_bytes += data->serialized_size();
+      FASTUIDRAWdelete(data);
+    }
+  return timer.elapsed_us();
+}
+
+int
+glyph_generation_benchmark::
+main(int argc, char **argv)
+{
+  if (argc == 2 && (argv[1] == std::string("-help")
+                    || argv[1] == std::string("--help")
+                    || argv[1] == std::string("-h")))
+    {
+      std::cout << "\n\nUsage: " << argv[0];
+      print_help(std::cout);
+      print_detailed_help(std::cout);
+      return 0;
+    }
+
+  std::cout << "\n\nRunning: \"";
+  for(int i = 0; i < argc; ++i)
+    {
+      std::cout << argv[i] << " ";
+    }
+  parse_command_line(argc, argv);
+  std::cout << "\n\n" << std::flush;
+
+  reference_counted_ptr<FreeTypeFace::GeneratorBase> gen;
+  reference_counted_ptr<const FontBase> font;
+
+  gen = FASTUIDRAWnew FreeTypeFace::GeneratorFile(m_font_file.value().c_str(),
+                                                  m_font_index.value());
+  if (gen->check_creation() == routine_fail)
+    {
+      std::cerr << "Unable to load font \"" << m_font_file.value() << "\"\n";
+      return -1;
+    }
+  font = FASTUIDRAWnew FontFreeType(gen);
+
+  reference_counted_ptr<GlyphAtlas> atlas;
+  reference_counted_ptr<GlyphCache> cache;
+  std::vector<GlyphMetrics> metrics;
+  unsigned int num_glyphs;
+
+  atlas = FASTUIDRAWnew GlyphAtlas(FASTUIDRAWnew NullBackingStore());
+  cache = FASTUIDRAWnew GlyphCache(atlas);
+
+  num_glyphs = font->number_glyphs();
+  if (m_max_glyphs.value() > 0)
+    {
+      num_glyphs = t_min(num_glyphs, static_cast<unsigned int>(m_max_glyphs.value()));
+    }
+
+  metrics.reserve(num_glyphs);
+  for (unsigned int i = 0; i < num_glyphs; ++i)
+    {
+      metrics.push_back(cache->fetch_glyph_metrics(font.get(), i));
+    }
+
+  GlyphGenerateParams::restricted_rays_number_threads(t_max(0, m_restricted_rays_threads.value()));
+
+  GlyphRenderer render(m_renderer.value());
+  int64_t best_us(-1);
+  uint64_t total_bytes(0);
+
+  for (int pass = 0; pass < t_max(1, m_num_passes.value()); ++pass)
+    {
+      int64_t us;
+
+      us = run_pass(font.get(), render, cast_c_array(metrics), &total_bytes);
+      std::cout << "Pass #" << pass << ": " << us / 1000 << " ms\n";
+      best_us = (best_us < 0) ? us : std::min(best_us, us);
+    }
+
+  best_us = std::max(best_us, int64_t(1));
+  std::cout << "\nGenerated " << num_glyphs << " glyphs, fastest pass took "
+            << best_us / 1000 << " ms\n"
+            << "\tmicroseconds per glyph: "
+            << static_cast<double>(best_us) / static_cast<double>(std::max(num_glyphs, 1u)) << "\n"
+            << "\tglyphs per second: "
+            << static_cast<double>(num_glyphs) * 1.0e6 / static_cast<double>(best_us) << "\n"
+            << "\tserialized bytes of all glyphs: " << total_bytes << "\n";
+
+  return 0;
+}
+
+int
+main(int argc, char **argv)
+{
+  glyph_generation_benchmark G;
+  return G.main(argc, argv);
+}
@@ -0,0 +1,276 @@
+#include <iostream>
+#include <vector>
+#include <map>
+#include <random>
+#include <algorithm>
+
+#include "generic_command_line.hpp"
+#include "simple_time.hpp"
+
+/* FlatHashIndex is internal to FastUIDraw, it is header only */
+#include "../../src/fastuidraw/private/flat_hash_index.hpp"
+
+/* Mirrors the key used by GlyphCache to look up glyphs:
+ * font, glyph code and renderer.
+ */
+class glyph_key
+{
+public:
+  glyph_key(void):
+    m_font(0),
+    m_glyph_code(0),
+    m_type(0),
+    m_pixel_size(0)
+  {}
+
+  glyph_key(uintptr_t font, uint32_t glyph_code,
+            uint32_t type, uint32_t pixel_size):
+    m_font(font),
+    m_glyph_code(glyph_code),
+    m_type(type),
+    m_pixel_size(pixel_size)
+  {}
+
+  bool
+  operator==(const glyph_key &rhs) const
+  {
+    return m_font == rhs.m_font
+      && m_glyph_code == rhs.m_glyph_code
+      && m_type == rhs.m_type
+      && m_pixel_size == rhs.m_pixel_size;
+  }
+
+  bool
+  operator<(const glyph_key &rhs) const
+  {
+    if (m_font != rhs.m_font)
+      {
+        return m_font < rhs.m_font;
+      }
+    if (m_glyph_code != rhs.m_glyph_code)
+      {
+        return m_glyph_code < rhs.m_glyph_code;
+      }
+    if (m_type != rhs.m_type)
+      {
+        return m_type < rhs.m_type;
+      }
+    return m_pixel_size < rhs.m_pixel_size;
+  }
+
+  uint64_t
+  hash(void) const
+  {
+    uint64_t r;
+
+    r = m_type | (static_cast<uint64_t>(m_pixel_size) << 32u);
+    return fastuidraw::detail::hash_mix(m_font)
+      ^ fastuidraw::detail::hash_mix(r + m_glyph_code);
+  }
+
+  uintptr_t m_font;
+  uint32_t m_glyph_code, m_type, m_pixel_size;
+};
+
+class MapIndex
+{
+public:
+  const unsigned int*
+  find(const glyph_key &key) const
+  {
+    std::map<glyph_key, unsigned int>::const_iterator iter;
+
+    iter = m_map.find(key);
+    return (iter != m_map.end()) ? &iter->second : nullptr;
+  }
+
+  bool
+  insert(const glyph_key &key, unsigned int value)
+  {
+    return m_map.insert(std::make_pair(key, value)).second;
+  }
+
+  bool
+  erase(const glyph_key &key)
+  {
+    return m_map.erase(key) != 0;
+  }
+
+private:
+  std::map<glyph_key, unsigned int> m_map;
+};
+
+class FlatIndex
+{
+public:
+  const unsigned int*
+  find(const glyph_key &key) const
+  {
+    return m_index.find(key);
+  }
+
+  bool
+  insert(const glyph_key &key, unsigned int value)
+  {
+    return m_index.insert(key, value);
+  }
+
+  bool
+  erase(const glyph_key &key)
+  {
+    return m_index.erase(key);
+  }
+
+private:
+  fastuidraw::detail::FlatHashIndex<glyph_key> m_index;
+};
+
+class hash_index_benchmark:public command_line_register
+{
+public:
+  hash_index_benchmark(void);
+
+  int
+  main(int argc, char **argv);
+
+private:
+  template<typename Index>
+  void
+  run(const char *label);
+
+  command_line_argument_value<int> m_num_keys;
+  command_line_argument_value<int> m_num_fonts;
+  command_line_argument_value<int> m_num_lookups;
+  command_line_argument_value<int> m_num_passes;
+
+  /* m_keys are inserted, m_lookups are looked up after
+   * inserting and m_misses are not present.
+   */
+  std::vector<glyph_key> m_keys, m_lookups, m_misses;
+};
+
+hash_index_benchmark::
+hash_index_benchmark(void):
+  m_num_keys(4000, "num_keys", "Number of keys inserted into the index", *this),
+  m_num_fonts(4, "num_fonts", "Number of distinct font values of the keys", *this),
+  m_num_lookups(1000000, "num_lookups", "Number of lookups of present keys", *this),
+  m_num_passes(3, "num_passes", "Number of passes, the fastest pass is reported", *this)
+{}
+
+template<typename Index>
+void
+hash_index_benchmark::
+run(const char *label)
+{
+  int64_t best_insert(-1), best_hit(-1), best_miss(-1), best_churn(-1);
+  unsigned int checksum(0);
+
+  for (int pass = 0; pass < std::max(1, m_num_passes.value()); ++pass)
+    {
+      Index index;
+      simple_time timer;
+      int64_t us;
+
+      for (unsigned int i = 0; i < m_keys.size(); ++i)
+        {
+          index.insert(m_keys[i], i);
+        }
+      us = timer.restart_us();
+      best_insert = (best_insert < 0) ? us : std::min(best_insert, us);
+
+      checksum = 0;
+      for (const glyph_key &k : m_lookups)
+        {
+          const unsigned int *p;
+
+          p = index.find(k);
+          checksum += (p) ? *p : 0u;
+        }
+      us = timer.restart_us();
+      best_hit = (best_hit < 0) ? us : std::min(best_hit, us);
+
+      for (const glyph_key &k : m_misses)
+        {
+          checksum += (index.find(k)) ? 1u : 0u;
+        }
+      us = timer.restart_us();
+      best_miss = (best_miss < 0) ? us : std::min(best_miss, us);
+
+      /* as glyphs are evicted and fetched again */
+      for (unsigned int i = 0; i < m_keys.size(); ++i)
+        {
+          index.erase(m_keys[i]);
+          index.insert(m_misses[i], i);
+        }
+      us = timer.restart_us();
+      best_churn = (best_churn < 0) ? us : std::min(best_churn, us);
+    }
+
+  std::cout << label << ":\n"
+            << "\tinsert " << m_keys.size() << " keys: " << best_insert << " us\n"
+            << "\tlookup " << m_lookups.size() << " present keys: " << best_hit << " us\n"
+            << "\tlookup " << m_misses.size() << " absent keys: " << best_miss << " us\n"
+            << "\terase and insert " << m_keys.size() << " keys: " << best_churn << " us\n"
+            << "\tchecksum: " << checksum << "\n";
+}
+
+int
+hash_index_benchmark::
+main(int argc, char **argv)
+{
+  if (argc == 2 && (argv[1] == std::string("-help")
+                    || argv[1] == std::string("--help")
+                    || argv[1] == std::string("-h")))
+    {
+      std::cout << "\n\nUsage: " << argv[0];
+      print_help(std::cout);
+      print_detailed_help(std::cout);
+      return 0;
+    }
+
+  std::cout << "\n\nRunning: \"";
+  for(int i = 0; i < argc; ++i)
+    {
+      std::cout << argv[i] << " ";
+    }
+  parse_command_line(argc, argv);
+  std::cout << "\n\n" << std::flush;
+
+  std::mt19937 rng(1234u);
+  unsigned int num_keys(std::max(1, m_num_keys.value()));
+  unsigned int num_fonts(std::max(1, m_num_fonts.value()));
+  std::vector<uint64_t> fonts(num_fonts);
+
+  /* values that look like heap pointers */
+  for (uint64_t &f : fonts)
+    {
+      f = 0x7f0000000000ull + 64u * (rng() & 0xffffu);
+    }
+
+  for (unsigned int i = 0; i < num_keys; ++i)
+    {
+      uintptr_t f(fonts[i % num_fonts]);
+      uint32_t glyph_code(i / num_fonts);
+
+      m_keys.push_back(glyph_key(f, glyph_code, 4, 0));
+      m_misses.push_back(glyph_key(f, glyph_code, 3, 0));
+    }
+
+  std::uniform_int_distribution<unsigned int> pick(0, num_keys - 1);
+  for (int i = 0; i < m_num_lookups.value(); ++i)
+    {
+      m_lookups.push_back(m_keys[pick(rng)]);
+    }
+
+  run<MapIndex>("std::map");
+  run<FlatIndex>("FlatHashIndex");
+
+  return 0;
+}
+
+int
+main(int argc, char **argv)
+{
+  hash_index_benchmark H;
+  return H.main(argc, argv);
+}
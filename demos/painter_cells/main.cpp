@@ -142,6 +142,7 @@ painter_cells(void):
 	     enumerated_string_type<enum glyph_type>()
 	     .add_entry("distance_field", distance_field_glyph, "Distance field rendering")
 	     .add_entry("restricted_rays", restricted_rays_glyph, "Restricted Rays rendering")
+	     .add_entry("msdf", msdf_glyph, "Multi-channel distance field rendering")
 	     .add_entry("adaptive", adaptive_rendering, "Adaptive rendering"),
 	     "glyph_render",
 	     "Specifies how to render glyphs",
@@ -47,6 +47,10 @@ operator<<(std::ostream &str, GlyphRenderer R)
           str << "BandedRays";
           break;
 
+        case msdf_glyph:
+          str << "MSDF";
+          break;
+
         default:
           str << "Unknown";
         }
@@ -172,6 +176,7 @@ private:
       draw_glyph_distance,
       draw_glyph_restricted_rays,
       draw_glyph_banded_rays,
+      draw_glyph_msdf,
 
       draw_glyph_auto
     };
@@ -203,6 +208,7 @@ private:
   item_coordinates(ivec2 src);
 
   command_line_argument_value<std::string> m_font_path;
+  command_line_argument_value<std::string> m_font_index;
   command_line_argument_value<std::string> m_font_foundry, m_font_style, m_font_family;
   command_line_argument_value<bool> m_font_bold, m_font_italic;
   command_line_argument_value<bool> m_font_ignore_style, m_font_ignore_bold_italic;
@@ -479,6 +485,8 @@ draw_glyphs(GlyphRenderer render,
 painter_glyph_test::
 painter_glyph_test(void):
   m_font_path(default_font_path(), "font_path", "Specifies path in which to search for fonts", *this),
+  m_font_index("", "font_index", "If non-empty, file in which to store an index of the fonts "
+               "found in font_path so that later runs do not need to open every font file", *this),
   m_font_foundry("", "font_foundry", "Specifies the font foundry", *this),
   m_font_style("Book", "font_style", "Specifies the font style", *this),
   m_font_family("DejaVu Sans", "font_family", "Specifies the font family name", *this),
@@ -612,6 +620,10 @@ create_and_add_font(void)
     {
       add_fonts_from_font_config(m_ft_lib, m_font_database);
     }
+  else if (!m_font_index.value().empty())
+    {
+      add_fonts_from_path(m_font_path.value(), m_font_index.value(), m_ft_lib, m_font_database);
+    }
   else
     {
       add_fonts_from_path(m_font_path.value(), m_ft_lib, m_font_database);
@@ -762,6 +774,7 @@ ready_glyph_data(int w, int h)
   m_draws[draw_glyph_distance] = GlyphRenderer(distance_field_glyph);
   m_draws[draw_glyph_restricted_rays] = GlyphRenderer(restricted_rays_glyph);
   m_draws[draw_glyph_banded_rays] = GlyphRenderer(banded_rays_glyph);
+  m_draws[draw_glyph_msdf] = GlyphRenderer(msdf_glyph);
   m_draws[draw_glyph_coverage] = GlyphRenderer(m_coverage_pixel_size.value());
 
   if (m_draw_glyph_set.value())
@@ -862,7 +875,7 @@ stroke_glyph(const PainterData &d, GlyphMetrics M, GlyphRenderer R)
   aa_mode = (m_anti_alias_path_stroking) ?
     Painter::shader_anti_alias_auto :
     Painter::shader_anti_alias_none;
-  m_painter->stroke_path(d, G.path(),
+  m_painter->stroke_path(d, *G.path(),
                          StrokingStyle()
                          .join_style(static_cast<enum Painter::join_style>(m_join_style)),
                          aa_mode);
@@ -876,7 +889,7 @@ fill_glyph(const PainterData &d, GlyphMetrics M, GlyphRenderer R)
 
   FASTUIDRAWassert(R.valid());
   G = m_glyph_cache->fetch_glyph(R, M.font().get(), M.glyph_code());
-  m_painter->fill_path(d, G.path(),
+  m_painter->fill_path(d, *G.path(),
                        Painter::nonzero_fill_rule,
                        (m_anti_alias_path_filling) ?
                        Painter::shader_anti_alias_auto :
@@ -1067,8 +1080,8 @@ draw_glyphs(float us)
               float rad;
 
               G = m_glyph_cache->fetch_glyph(render, metrics.font().get(), metrics.glyph_code());
-              extract_path_info(G.path(), &pts, &ctl_pts, &arc_center_pts, &descr);
-              G.path().approximate_bounding_box(&R);
+              extract_path_info(*G.path(), &pts, &ctl_pts, &arc_center_pts, &descr);
+              G.path()->approximate_bounding_box(&R);
               sz_bb = R.size();
 
               m_painter->save();
@@ -1533,11 +1533,11 @@ construct_paths(int w, int h)
 
       glyph_code = m_font->glyph_code(character_code);
       g = m_glyph_cache->fetch_glyph(renderer, m_font.get(), glyph_code);
-      if (g.valid() && g.path().number_contours() > 0)
+      if (g.valid() && g.path()->number_contours() > 0)
         {
           std::ostringstream str;
           str << "character code:" << character_code;
-          m_paths.push_back(PerPath(g.path(), str.str(), w, h, true));
+          m_paths.push_back(PerPath(*g.path(), str.str(), w, h, true));
         }
     }
 
@@ -112,6 +112,42 @@ namespace gl
       params&
       delayed(bool v);
 
+      /*!
+       * If true and the backing store is a texture buffer object
+       * or a shader storage buffer object, the buffer is created as
+       * a sparse buffer (GL_ARB_sparse_buffer) whose pages are
+       * committed as the store grows. Growing the store then neither
+       * copies the glyph data nor needs memory for a second copy of
+       * it, see GlyphAtlasBackingStoreBase::page_size(). The value is
+       * ignored if the GL context current when the GlyphAtlasGL is
+       * created does not support sparse buffers. Initial value is
+       * false.
+       */
+      bool
+      sparse_store(void) const;
+
+      /*!
+       * Set the value for sparse_store(void) const
+       */
+      params&
+      sparse_store(bool v);
+
+      /*!
+       * The number of floats beyond which a sparse store cannot grow
+       * (if the GL implementation limits the size of a texture buffer
+       * or a shader storage buffer further, the GL limit is used);
+       * the size is only reserved in the address space of the buffer.
+       * Initial value is 64 * 1024 * 1024.
+       */
+      unsigned int
+      sparse_store_max_floats(void) const;
+
+      /*!
+       * Set the value for sparse_store_max_floats(void) const
+       */
+      params&
+      sparse_store_max_floats(unsigned int v);
+
       /*!
        * Returns what kind of GL object is used to back
        * the glyph data. Default value is
@@ -167,7 +203,8 @@ namespace gl
       /*!
        * Query the GL context to decide what is the optimal settings
        * to back the GlyphAtlasBackingStoreBase returned by
-       * GlyphAtlas::store(). A GL context must be current
+       * GlyphAtlas::store(), including whether to use a sparse
+       * store, see sparse_store(). A GL context must be current
        * so that GL capabilities may be queried.
        */
       params&
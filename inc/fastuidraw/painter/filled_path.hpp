@@ -49,7 +49,7 @@ class Path;
  * the fill rule.
  */
 class FilledPath:
-    public reference_counted<FilledPath>::non_concurrent
+    public reference_counted<FilledPath>::default_base
 {
 public:
   /*!
@@ -39,15 +39,34 @@ namespace fastuidraw
    * A GlyphRun provides an interface to grab the glyph-codes realized
    * as different renderers for the purpose of rendering text in response
    * to the transformation that a Painter currently has. In contrast to
-   * a \ref GlyphSequence, a GlyphRun does NOT maintain a hierarchy
-   * to perform culling. However, it does provide an interface to select
-   * continuous subsets of the glyphs for the purporse of rendering.
-   * In addition, since it does not carry a hierarchy for culling, it
-   * is also a lighter wieght object than \ref GlyphSequence.
+   * a \ref GlyphSequence, a GlyphRun does NOT sort its glyphs spatially;
+   * instead it provides an interface to select continuous subsets of
+   * the glyphs for the purporse of rendering. The glyphs are grouped,
+   * in the order they are added, into blocks of 64 glyphs; a GlyphRun
+   * keeps the bounding box of each block in an implicit binary tree so
+   * that the blocks of a continuous subset that are outside of a clipping
+   * region can be culled. The attribute data of a block is only packed
+   * (and the \ref Glyph values of a block only fetched) when the block
+   * is first drawn. Since it does not carry a spatial hierarchy, it is
+   * also a lighter wieght object than \ref GlyphSequence.
    */
   class GlyphRun:fastuidraw::noncopyable
   {
   public:
+    /*!
+     * Opaque object to hold work room needed for functions
+     * of GlyphRun that require scratch space.
+     */
+    class ScratchSpace:fastuidraw::noncopyable
+    {
+    public:
+      ScratchSpace(void);
+      ~ScratchSpace();
+    private:
+      friend class GlyphRun;
+      void *m_d;
+    };
+
     /*!
      * Ctor.
      * \param pixel_size pixel size at which glyphs added via
@@ -175,6 +194,27 @@ namespace fastuidraw
     const PainterAttributeWriter&
     subsequence(GlyphRenderer renderer, unsigned int begin, unsigned int count) const;
 
+    /*!
+     * Returns a const-reference to \ref PainterAttributeWriter
+     * object for rendering those glyphs of a named range that
+     * are in blocks that intersect a region specified by clip
+     * equations, for a specified \ref GlyphRenderer. The returned
+     * object is valid in value until this GlyphRun is destroyed
+     * or one of add_glyph(), add_glyphs(), subsequence() is called.
+     * \param renderer how to render the glyphs
+     * \param begin index to select which is the first glyph
+     * \param count number of glyphs to take starting at begin
+     * \param scratch_space scratch space for computations
+     * \param clip_equations array of clip equations
+     * \param clip_matrix_local 3x3 transformation from local (x, y, 1)
+     *                          coordinates to clip coordinates.
+     */
+    const PainterAttributeWriter&
+    subsequence(GlyphRenderer renderer, unsigned int begin, unsigned int count,
+                ScratchSpace &scratch_space,
+                c_array<const vec3> clip_equations,
+                const float3x3 &clip_matrix_local) const;
+
     /*!
      * Returns a const-reference to \ref PainterAttributeWriter
      * object for rendering all glyphs from a starting point
@@ -142,6 +142,15 @@ namespace fastuidraw
 
     /*!
      * Add \ref GlyphSource values and positions; values are -copied-.
+     * Adding glyphs only modifies the \ref Subset objects in which
+     * the glyphs land (and their ancestors); the attribute and index
+     * data of such a Subset is extended with the added glyphs when
+     * next requested instead of being regenerated, unless the Subset
+     * is split because it holds too many glyphs. Glyphs added beyond
+     * the bounding box of all previous glyphs, such as new lines of
+     * text, get new Subset objects instead of being placed in an
+     * existing one; the ID values of existing Subset objects do not
+     * change.
      * \param glyph_sources specifies what glyphs to add
      * \param positions specifies the positions of each glyph added
      */
@@ -149,6 +158,20 @@ namespace fastuidraw
     add_glyphs(c_array<const GlyphSource> glyph_sources,
                c_array<const vec2> positions);
 
+    /*!
+     * Remove the trailing glyphs so that number_glyphs() becomes
+     * a given value; if the value is not less than number_glyphs(),
+     * nothing is done. Only the \ref Subset objects that hold
+     * removed glyphs (and their ancestors) are modified; the
+     * attribute and index data of a modified Subset is truncated
+     * instead of regenerated. A Subset whose glyphs are all removed
+     * remains (and has no glyphs) and the ID values of the Subset
+     * objects do not change.
+     * \param N number of glyphs to keep
+     */
+    void
+    truncate(unsigned int N);
+
     /*!
      * Add a single \ref GlyphSource and position
      * \param glyph_source specifies what glyph to add
@@ -50,7 +50,7 @@ class PainterAttributeData;
  * of how one strokes the original path for drawing.
  */
 class StrokedPath:
-    public reference_counted<StrokedPath>::non_concurrent
+    public reference_counted<StrokedPath>::default_base
 {
 public:
   /*!
@@ -0,0 +1,225 @@
+/*!
+ * \file text_run_cache.hpp
+ * \brief file text_run_cache.hpp
+ *
+ * Copyright 2019 by Intel.
+ *
+ * Contact: kevin.rogovin@intel.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@intel.com>
+ *
+ */
+
+
+#pragma once
+
+#include <fastuidraw/util/rect.hpp>
+#include <fastuidraw/text/font_database.hpp>
+#include <fastuidraw/text/glyph_cache.hpp>
+#include <fastuidraw/painter/glyph_run.hpp>
+
+namespace fastuidraw
+{
+/*!\addtogroup Painter
+ * @{
+ */
+
+  /*!
+   * \brief
+   * A TextRunCache maps a string of character codes together with
+   * a font (or a \ref FontDatabase::FontGroup), a pixel size, a
+   * screen orientation and a layout direction to a \ref GlyphRun
+   * holding the glyphs of the string layed out on a single line,
+   * together with the metrics of the line. Strings that are drawn
+   * repeatedly, such as the labels of a user interface, are then
+   * layed out only once. The runs are kept in least recently used
+   * order and the least recently used runs are released when the
+   * estimated memory of the runs exceeds a memory budget. Looking
+   * up a run that is already present in the cache only takes a
+   * lock for reading, so that many threads can look up runs
+   * concurrently. Drawing the \ref GlyphRun of a \ref Run is not
+   * thread safe, as is the case for any \ref GlyphRun.
+   */
+  class TextRunCache:public reference_counted<TextRunCache>::default_base
+  {
+  public:
+    /*!
+     * \brief
+     * A Run holds a \ref GlyphRun of a string layed out on a single
+     * line. A Run remains valid as long as a reference to it is held,
+     * even after it is released from the TextRunCache that made it.
+     */
+    class Run:public reference_counted<Run>::default_base
+    {
+    public:
+      ~Run();
+
+      /*!
+       * The \ref GlyphRun holding the glyphs of the string; the
+       * pen position of the first glyph is (0, 0).
+       */
+      const GlyphRun&
+      glyph_run(void) const;
+
+      /*!
+       * The position of the pen after the last glyph, i.e. the
+       * amount by which to move the pen to place text after the
+       * string.
+       */
+      const vec2&
+      advance(void) const;
+
+      /*!
+       * The bounding box of the glyphs of the string; if the
+       * string has no glyph that is drawn, the rect is empty
+       * with both corners at (0, 0).
+       */
+      const Rect&
+      bounding_box(void) const;
+
+      /*!
+       * An estimate of the number of bytes used by the Run,
+       * including the attribute and index data for one
+       * \ref GlyphRenderer.
+       */
+      unsigned int
+      memory_size(void) const;
+
+    private:
+      friend class TextRunCache;
+
+      Run(c_array<const GlyphSource> glyph_sources,
+          float pixel_size,
+          enum PainterEnums::screen_orientation orientation,
+          const reference_counted_ptr<GlyphCache> &cache,
+          enum PainterEnums::glyph_layout_type layout);
+
+      void *m_d;
+    };
+
+    /*!
+     * Ctor.
+     * \param glyph_cache \ref GlyphCache used to fetch the glyphs
+     * \param font_database \ref FontDatabase used to choose the
+     *                      glyph of each character code; a null
+     *                      value indicates to take the glyphs from
+     *                      the font passed to fetch() without font
+     *                      merging
+     * \param memory_budget number of bytes the runs of the TextRunCache
+     *                      may use, as estimated by Run::memory_size()
+     */
+    TextRunCache(const reference_counted_ptr<GlyphCache> &glyph_cache,
+                 const reference_counted_ptr<FontDatabase> &font_database,
+                 uint64_t memory_budget);
+
+    ~TextRunCache();
+
+    /*!
+     * Fetch, and if necessary create, the Run of a string.
+     * \param font font from which to take the glyphs; if the
+     *             TextRunCache has a \ref FontDatabase, glyphs
+     *             not present in the font are taken from fonts
+     *             of similiar properties
+     * \param character_codes character codes of the string
+     * \param pixel_size pixel size at which to format the glyphs
+     * \param orientation screen orientation at which to format
+     *                    the glyphs
+     * \param layout if the glyphs are layed out horizontally or
+     *               vertically
+     * \param selection_strategy bit-wise or of values of
+     *                           \ref FontDatabase::selection_bits_t
+     *                           passed to FontDatabase::fetch_glyph()
+     */
+    reference_counted_ptr<const Run>
+    fetch(const FontBase *font,
+          c_array<const uint32_t> character_codes,
+          float pixel_size,
+          enum PainterEnums::screen_orientation orientation,
+          enum PainterEnums::glyph_layout_type layout
+          = PainterEnums::glyph_layout_horizontal,
+          uint32_t selection_strategy = 0u);
+
+    /*!
+     * Fetch, and if necessary create, the Run of a string whose
+     * glyphs are chosen from a \ref FontDatabase::FontGroup; it
+     * is an error to call this if the TextRunCache does not
+     * have a \ref FontDatabase.
+     * \param group FontGroup from which to choose the glyphs
+     * \param character_codes character codes of the string
+     * \param pixel_size pixel size at which to format the glyphs
+     * \param orientation screen orientation at which to format
+     *                    the glyphs
+     * \param layout if the glyphs are layed out horizontally or
+     *               vertically
+     * \param selection_strategy bit-wise or of values of
+     *                           \ref FontDatabase::selection_bits_t
+     *                           passed to FontDatabase::fetch_glyph()
+     */
+    reference_counted_ptr<const Run>
+    fetch(FontDatabase::FontGroup group,
+          c_array<const uint32_t> character_codes,
+          float pixel_size,
+          enum PainterEnums::screen_orientation orientation,
+          enum PainterEnums::glyph_layout_type layout
+          = PainterEnums::glyph_layout_horizontal,
+          uint32_t selection_strategy = 0u);
+
+    /*!
+     * Returns the memory budget of the TextRunCache.
+     */
+    uint64_t
+    memory_budget(void) const;
+
+    /*!
+     * Set the memory budget of the TextRunCache; if the runs
+     * use more than the new budget, runs are released.
+     * \param v number of bytes the runs of the TextRunCache may use
+     */
+    void
+    memory_budget(uint64_t v);
+
+    /*!
+     * Returns the sum of Run::memory_size() over the runs
+     * held by the TextRunCache.
+     */
+    uint64_t
+    memory_used(void) const;
+
+    /*!
+     * Returns the number of runs held by the TextRunCache.
+     */
+    unsigned int
+    number_runs(void) const;
+
+    /*!
+     * Returns the number of times fetch() found the run
+     * in the TextRunCache.
+     */
+    uint64_t
+    number_hits(void) const;
+
+    /*!
+     * Returns the number of times fetch() had to create
+     * the run.
+     */
+    uint64_t
+    number_misses(void) const;
+
+    /*!
+     * Release all runs of the TextRunCache.
+     */
+    void
+    clear(void);
+
+  private:
+    void *m_d;
+  };
+
+/*! @} */
+}
@@ -27,10 +27,18 @@
 #include <fastuidraw/util/reference_counted.hpp>
 #include <fastuidraw/path_enums.hpp>
 #include <fastuidraw/tessellated_path.hpp>
+#include <fastuidraw/path_contour_registry.hpp>
 #include <fastuidraw/painter/shader_filled_path.hpp>
 
 namespace fastuidraw  {
 
+///@cond
+namespace detail
+{
+  class PathContourEdges;
+}
+///@endcond
+
 /*!\addtogroup Paths
  * @{
  */
@@ -44,9 +52,16 @@ namespace fastuidraw  {
  * close_generic() and close_arc()) means to specify
  * the edge from the last point of the PathContour
  * to the first point.
+ *
+ * The edges made by to_point(), to_arc(), close() and
+ * close_arc() are stored compactly as the points of
+ * the edges; their \ref interpolator_base objects are
+ * only made the first time that interpolator() or
+ * prev_interpolator() is called, or when an edge is
+ * added with to_generic() or close_generic().
  */
 class PathContour:
-    public reference_counted<PathContour>::non_concurrent
+    public reference_counted<PathContour>::default_base
 {
 public:
   /*!
@@ -91,7 +106,7 @@ public:
    * the shape of an edge.
    */
   class interpolator_base:
-    public reference_counted<interpolator_base>::non_concurrent
+    public reference_counted<interpolator_base>::default_base
   {
   public:
     /*!
@@ -390,6 +405,21 @@ public:
                reference_counted_ptr<tessellated_region> *out_regionA,
                reference_counted_ptr<tessellated_region> *out_regionB,
                vec2 *out_p) const;
+
+    /*!
+     * Implements produce_tessellation() to tessellate the curve
+     * as interpolator_generic::produce_tessellation() does, but
+     * without creating a tessellated_region for each split.
+     * In addition, the curve is not split deeper than the level
+     * at which, from a bound on its flatness, line segments are
+     * within TessellatedPath::TessellationParams::m_max_distance.
+     */
+    virtual
+    reference_counted_ptr<tessellation_state>
+    produce_tessellation(const TessellatedPath::TessellationParams &tess_params,
+                         TessellatedPath::SegmentStorage *out_data,
+                         float *out_max_distance) const;
+
     virtual
     void
     approximate_bounding_box(Rect *out_bb) const;
@@ -610,6 +640,8 @@ public:
    * interpolator from the last point to the first
    * point. When closed() is false, if I has value
    * number_points() - 1, then returns a null reference.
+   * The first call makes the \ref interpolator_base
+   * objects of all the edges.
    */
   const reference_counted_ptr<const interpolator_base>&
   interpolator(unsigned int I) const;
@@ -632,6 +664,18 @@ public:
   bool
   is_flat(void) const;
 
+  /*!
+   * Returns a TessellatedPath of just this PathContour made
+   * with the default value of TessellatedPath::TessellationParams.
+   * The TessellatedPath is constructed lazily and only once;
+   * Path::tessellation() assembles its starting tessellation
+   * from these so that changing or adding a contour of a Path
+   * only tessellates that contour again. It is an error to
+   * call this if closed() is false.
+   */
+  const reference_counted_ptr<const TessellatedPath>&
+  tessellation(void) const;
+
   /*!
    * Create a deep copy of this PathContour.
    */
@@ -639,6 +683,14 @@ public:
   deep_copy(void);
 
 private:
+  friend class detail::PathContourEdges;
+
+  void
+  make_interpolators(void) const;
+
+  void
+  mark_closed(void);
+
   void *m_d;
 };
 
@@ -1021,7 +1073,10 @@ public:
 
   /*!
    * Adds a PathContour to this Path. The current contour remains
-   * as the current contour though.
+   * as the current contour though. If a PathContourRegistry is
+   * set with contour_registry(const reference_counted_ptr<PathContourRegistry>&),
+   * a closed contour is replaced by the value of
+   * PathContourRegistry::intern() for it.
    * \param contour PathContour to add to the Path
    */
   Path&
@@ -1029,11 +1084,31 @@ public:
 
   /*!
    * Add all the \ref PathContour objects of a Path into this Path.
+   * As in add_contour(), the closed contours are passed through
+   * the PathContourRegistry of this Path if it has one.
    * \param path Path to add
    */
   Path&
   add_contours(const Path &path);
 
+  /*!
+   * Set the PathContourRegistry used by add_contour() and
+   * add_contours() so that this Path shares its closed contours,
+   * and their tessellations, with other Path objects that
+   * use the same PathContourRegistry. A copy of a Path uses
+   * the same PathContourRegistry. Default value is a null
+   * reference, i.e. no registry.
+   */
+  Path&
+  contour_registry(const reference_counted_ptr<PathContourRegistry> &v);
+
+  /*!
+   * Returns the value set by
+   * contour_registry(const reference_counted_ptr<PathContourRegistry>&).
+   */
+  const reference_counted_ptr<PathContourRegistry>&
+  contour_registry(void) const;
+
   /*!
    * Returns the number of contours of the Path.
    */
@@ -1067,7 +1142,11 @@ public:
    * level of detail. The TessellatedPath is constructed
    * lazily. Additionally, if this Path changes its geometry,
    * then a new TessellatedPath will be contructed on the
-   * next call to tessellation().
+   * next call to tessellation(). It is safe to call tessellation()
+   * (and the other const methods) of the same Path from several
+   * threads at once, as long as no thread changes the Path;
+   * a thread making a finer tessellation does not block
+   * threads fetching tessellations already made.
    * \param thresh the returned tessellated path will be so that
    *               TessellatedPath::max_distance() is no more than
    *               thresh. A non-positive value will return the
@@ -0,0 +1,133 @@
+/*!
+ * \file path_contour_registry.hpp
+ * \brief file path_contour_registry.hpp
+ *
+ * Copyright 2019 by Intel.
+ *
+ * Contact: kevin.rogovin@intel.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@intel.com>
+ *
+ */
+
+
+#pragma once
+
+#include <fastuidraw/util/reference_counted.hpp>
+
+namespace fastuidraw  {
+
+///@cond
+class PathContour;
+///@endcond
+
+/*!\addtogroup Paths
+ * @{
+ */
+
+/*!
+ * \brief
+ * A PathContourRegistry maps the contents of closed \ref
+ * PathContour objects to a single \ref PathContour object
+ * for each distinct contents. Since a closed \ref PathContour
+ * cannot be changed, \ref Path objects can share it and with
+ * it its tessellation (see PathContour::tessellation()); thus
+ * a scene with many repeated contours (for example icons
+ * or glyph outlines) tessellates each distinct contour only
+ * once and stores its tessellation only once (the tessellation
+ * of a \ref Path references the segments of the tessellations
+ * of its closed contours instead of copying them). A \ref Path uses
+ * a PathContourRegistry in Path::add_contour() and
+ * Path::add_contours() if one is set with
+ * Path::contour_registry(const reference_counted_ptr<PathContourRegistry>&).
+ *
+ * Only contours whose interpolators are all exactly of the
+ * types \ref PathContour::flat, \ref PathContour::bezier and
+ * \ref PathContour::arc are registered; two contours match
+ * when they have the same starting point and the same
+ * interpolators with the same points, edge types and angles.
+ * A PathContourRegistry holds at most max_contours() \ref
+ * PathContour objects; when full, registering a contour
+ * releases the least recently used one. The methods of
+ * PathContourRegistry are thread safe.
+ */
+class PathContourRegistry:
+    public reference_counted<PathContourRegistry>::default_base
+{
+public:
+  enum
+    {
+      /*!
+       * Default value for max_contours().
+       */
+      default_max_contours = 4096
+    };
+
+  /*!
+   * Ctor.
+   */
+  PathContourRegistry(void);
+
+  ~PathContourRegistry();
+
+  /*!
+   * Returns the \ref PathContour registered with the same
+   * contents as a given \ref PathContour, registering the
+   * given \ref PathContour if there is none. If the passed
+   * \ref PathContour is not closed or has an interpolator
+   * whose type is not supported, returns the passed value.
+   * \param contour \ref PathContour to look up
+   */
+  reference_counted_ptr<const PathContour>
+  intern(const reference_counted_ptr<const PathContour> &contour);
+
+  /*!
+   * Returns the number of \ref PathContour objects
+   * registered.
+   */
+  unsigned int
+  number_contours(void) const;
+
+  /*!
+   * Set the maximum number of \ref PathContour objects
+   * registered; if more are registered, the least recently
+   * used (by intern()) are released. A value of 0 indicates
+   * to register no \ref PathContour objects. Default value
+   * is \ref default_max_contours.
+   */
+  void
+  max_contours(unsigned int v);
+
+  /*!
+   * Returns the value set by max_contours(unsigned int).
+   */
+  unsigned int
+  max_contours(void) const;
+
+  /*!
+   * Returns the number of times intern() returned a \ref
+   * PathContour registered before instead of the passed one.
+   */
+  unsigned int
+  number_hits(void) const;
+
+  /*!
+   * Release all the \ref PathContour objects registered;
+   * \ref Path objects that use them keep them.
+   */
+  void
+  clear(void);
+
+private:
+  void *m_d;
+};
+
+/*! @} */
+
+}
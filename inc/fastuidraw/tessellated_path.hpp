@@ -31,6 +31,7 @@ namespace fastuidraw  {
 
 ///@cond
 class Path;
+class PathContour;
 class StrokedPath;
 class FilledPath;
 ///@endcond
@@ -58,7 +59,7 @@ class FilledPath;
  * is the last edge.
  */
 class TessellatedPath:
-    public reference_counted<TessellatedPath>::non_concurrent
+    public reference_counted<TessellatedPath>::default_base
 {
 public:
   /*!
@@ -311,7 +312,9 @@ public:
   /*!
    * Ctor. Construct a TessellatedPath from a Path
    * \param input source path to tessellate
-   * \param P parameters on how to tessellate the source Path
+   * \param P parameters on how to tessellate the source Path;
+   *          if P is the default value, the tessellation of each
+   *          closed contour is taken from PathContour::tessellation()
    * \param ref if non-NULL, construct a Refiner object and return
    *            the value via upading the value of ref.
    */
@@ -447,6 +450,9 @@ public:
    * no arcs, returns this object. If a non-positive value
    * is passed, returns a linearization where arc-segments
    * are tessellated into very few line segments.
+   * The linearizations are constructed lazily and it is
+   * safe to call linearization(), stroked() and filled()
+   * from several threads at once.
    * \param thresh threshhold at which to linearize
    *               arc-segments.
    */
@@ -495,9 +501,14 @@ public:
   filled(void) const;
 
 private:
+  friend class PathContour;
+
   TessellatedPath(Refiner *p, float threshhold,
                   unsigned int additional_recursion_count);
 
+  explicit
+  TessellatedPath(const PathContour &contour);
+
   TessellatedPath(const TessellatedPath &with_arcs,
                   float thresh);
 
@@ -0,0 +1,101 @@
+/*!
+ * \file character_coverage.hpp
+ * \brief file character_coverage.hpp
+ *
+ * Copyright 2019 by Intel.
+ *
+ * Contact: kevin.rogovin@intel.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@intel.com>
+ *
+ */
+
+
+#pragma once
+
+#include <fastuidraw/util/util.hpp>
+#include <fastuidraw/util/c_array.hpp>
+#include <fastuidraw/util/reference_counted.hpp>
+
+namespace fastuidraw
+{
+/*!\addtogroup Text
+ * @{
+ */
+
+  /*!
+   * \brief
+   * A CharacterCoverage is a set of character codes, typically
+   * the character codes for which a font has a glyph. The set
+   * is stored as a sorted list of pages of 256 character codes
+   * where each page is a bitmap; only pages that have at least
+   * one character code are stored.
+   */
+  class CharacterCoverage:
+    public reference_counted<CharacterCoverage>::default_base
+  {
+  public:
+    /*!
+     * Ctor, initializes the set as empty.
+     */
+    CharacterCoverage(void);
+
+    ~CharacterCoverage();
+
+    /*!
+     * Add a character code to the set; adding character
+     * codes in increasing order is the fastest.
+     * \param character_code character code to add
+     */
+    void
+    add(uint32_t character_code);
+
+    /*!
+     * Returns true if a character code is in the set.
+     * \param character_code character code to query
+     */
+    bool
+    contains(uint32_t character_code) const;
+
+    /*!
+     * Returns the number of character codes in the set.
+     */
+    unsigned int
+    number_character_codes(void) const;
+
+    /*!
+     * Returns the number of bytes needed to serialize
+     * the set with serialize().
+     */
+    unsigned int
+    serialized_size(void) const;
+
+    /*!
+     * Serialize the set; the values are written in the
+     * byte order of the machine.
+     * \param dst location to which to write, must be
+     *            exactly serialized_size() bytes
+     */
+    enum return_code
+    serialize(c_array<uint8_t> dst) const;
+
+    /*!
+     * Set the contents of this CharacterCoverage from data
+     * written by serialize(). On failure, the object is
+     * left unchanged.
+     * \param src data as written by serialize()
+     */
+    enum return_code
+    deserialize(c_array<const uint8_t> src);
+
+  private:
+    void *m_d;
+  };
+/*! @} */
+}
@@ -25,6 +25,7 @@
 #include <fastuidraw/path.hpp>
 #include <fastuidraw/text/character_encoding.hpp>
 #include <fastuidraw/text/font_properties.hpp>
+#include <fastuidraw/text/character_coverage.hpp>
 #include <fastuidraw/text/glyph_render_data.hpp>
 #include <fastuidraw/text/glyph_metrics.hpp>
 #include <fastuidraw/text/glyph_metrics_value.hpp>
@@ -177,6 +178,65 @@ namespace fastuidraw
     compute_rendering_data(GlyphRenderer render, GlyphMetrics glyph_metrics,
 			   Path &path, vec2 &render_size) const = 0;
 
+    /*!
+     * To be optionally implemented by a derived class to compute
+     * only the Path of a glyph, i.e. the Path that compute_rendering_data()
+     * writes, without generating the rendering data. Default
+     * implementation returns false.
+     * \param render specifies the GlyphRenderer for which to compute
+     *               the path, it is guaranteed by the caller that
+     *               can_create_rendering_data() returns true on render.type()
+     * \param glyph_metrics GlyphMetrics values as computed by compute_metrics()
+     * \param[out] path location to which to write the Path of the glyph
+     * \returns true if and only if the Path was written
+     */
+    virtual
+    bool
+    compute_path(GlyphRenderer render, GlyphMetrics glyph_metrics,
+                 Path &path) const
+    {
+      FASTUIDRAWunused(render);
+      FASTUIDRAWunused(glyph_metrics);
+      FASTUIDRAWunused(path);
+      return false;
+    }
+
+    /*!
+     * To be optionally implemented by a derived class to
+     * provide a hash value of the data from which the font
+     * generates its glyphs. Fonts that have the same hash value
+     * are assumed to produce identical glyph rendering data; the
+     * value is used as part of the key of the on-disk cache of
+     * a GlyphCache (see GlyphCache::disk_cache_directory()).
+     * Default implementation returns false.
+     * \param[out] out_hash location to which to write the hash value
+     * \returns true if and only if a hash value was written
+     */
+    virtual
+    bool
+    content_hash(uint64_t *out_hash) const
+    {
+      FASTUIDRAWunused(out_hash);
+      return false;
+    }
+
+    /*!
+     * To be optionally implemented by a derived class to
+     * return the set of Unicode character codes for which
+     * glyph_code() returns a non-zero value; FontDatabase
+     * uses the value to select the font for a character
+     * without querying the fonts one by one. The same
+     * object must be returned on each call. Default
+     * implementation returns a null pointer, indicating
+     * that the coverage is not known.
+     */
+    virtual
+    reference_counted_ptr<const CharacterCoverage>
+    character_coverage(void) const
+    {
+      return reference_counted_ptr<const CharacterCoverage>();
+    }
+
   private:
     void *m_d;
   };
@@ -32,7 +32,18 @@ namespace fastuidraw
    * A FontDatabase performs the act of font selection and glyph
    * selection. It uses the values of \ref FontProperties (except
    * for FontProperties::source_label()) to select suitable font
-   * or fonts.
+   * or fonts. When a font does not have a glyph for a
+   * character, the fonts of a FontGroup are tried in the
+   * order they were added; fonts that have been generated
+   * are tried before those that have not. To avoid querying
+   * the fonts one by one, each FontGroup keeps an index of
+   * the first font that may have each character, built from
+   * the \ref CharacterCoverage of the fonts, see
+   * FontBase::character_coverage() and
+   * FontGeneratorBase::character_coverage(). Fetching
+   * fonts and glyphs from several threads at once does
+   * not serialize the threads; adding a font waits until
+   * the fetches in progress are done.
    */
   class FontDatabase:public reference_counted<FontDatabase>::default_base
   {
@@ -61,6 +72,23 @@ namespace fastuidraw
       virtual
       const FontProperties&
       font_properties(void) const = 0;
+
+      /*!
+       * To be optionally implemented by a derived class to
+       * return the FontBase::character_coverage() of the font
+       * that would be generated by generate_font(). Providing
+       * the coverage allows a FontDatabase to skip the font
+       * when selecting a font for a character without the
+       * need to generate the font. Default implementation
+       * returns a null pointer, indicating that the coverage
+       * is not known.
+       */
+      virtual
+      reference_counted_ptr<const CharacterCoverage>
+      character_coverage(void) const
+      {
+        return reference_counted_ptr<const CharacterCoverage>();
+      }
     };
 
     /*!
@@ -80,6 +108,7 @@ namespace fastuidraw
 
     private:
       friend class FontDatabase;
+      friend class TextRunCache;
       void *m_d;
     };
 
@@ -0,0 +1,159 @@
+/*!
+ * \file font_file_index.hpp
+ * \brief file font_file_index.hpp
+ *
+ * Copyright 2019 by Intel.
+ *
+ * Contact: kevin.rogovin@intel.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@intel.com>
+ *
+ */
+
+
+#pragma once
+
+#include <fastuidraw/text/font_properties.hpp>
+#include <fastuidraw/text/font_database.hpp>
+#include <fastuidraw/text/freetype_lib.hpp>
+#include <fastuidraw/text/character_coverage.hpp>
+
+namespace fastuidraw
+{
+/*!\addtogroup Text
+ * @{
+ */
+
+  /*!
+   * \brief
+   * A FontFileIndex records, for each face of a set of font
+   * files, the \ref FontProperties and the \ref CharacterCoverage
+   * of the face. The index can be saved to and loaded from a file
+   * so that an application does not need to open every font file
+   * at startup to build a \ref FontDatabase; a loaded entry is
+   * reused as long as the size and modification time of its font
+   * file are unchanged. The fonts are added to a FontDatabase
+   * with FontDatabase::FontGeneratorBase objects so that a font
+   * file is only opened when a font of it is first needed. The
+   * fonts are opened with libfreetype. The methods of a
+   * FontFileIndex are not thread safe.
+   */
+  class FontFileIndex:public reference_counted<FontFileIndex>::default_base
+  {
+  public:
+    /*!
+     * Ctor.
+     * \param lib the FreeTypeLib used to read font files and to
+     *            create the FontFreeType objects of the fonts; a
+     *            null value indicates to use a private FreeTypeLib
+     *            object
+     */
+    explicit
+    FontFileIndex(const reference_counted_ptr<FreeTypeLib> &lib = reference_counted_ptr<FreeTypeLib>());
+
+    ~FontFileIndex();
+
+    /*!
+     * Load an index saved with save(). The loaded entries are
+     * not fonts of the FontFileIndex until the files are added
+     * with add_file(); they are used by add_file() to avoid
+     * reading the font file. Returns \ref routine_fail if the
+     * file could not be read or if it is not an index written
+     * by save() with the same version of FastUIDraw on a
+     * machine of the same byte order.
+     * \param filename name of file from which to load
+     */
+    enum return_code
+    load(c_string filename);
+
+    /*!
+     * Save the entries of all the files added with add_file()
+     * to a file. The file is written to a temporary file first
+     * that is then renamed, so that a concurrent reader never
+     * sees a partially written index.
+     * \param filename name of file to which to save
+     */
+    enum return_code
+    save(c_string filename) const;
+
+    /*!
+     * Returns true if add_file() had to read a font file
+     * because there was no loaded entry for it or because
+     * the loaded entry was stale, i.e. returns true if
+     * save() would write an index different from the one
+     * loaded.
+     */
+    bool
+    modified(void) const;
+
+    /*!
+     * Add the scalable faces of a font file. If a loaded entry
+     * for the file exists whose size and modification time
+     * match the file, the entry is used and the file is not
+     * opened. Otherwise the file is opened and each face is
+     * read to compute its FontProperties and CharacterCoverage.
+     * Files that cannot be read or that do not hold scalable
+     * faces are recorded as well, so that they are not read
+     * again. Returns the number of fonts added; adding the
+     * same file again adds no fonts.
+     * \param filename name of font file
+     */
+    unsigned int
+    add_file(c_string filename);
+
+    /*!
+     * Returns the number of fonts, i.e. the number of faces
+     * of the files added with add_file().
+     */
+    unsigned int
+    number_fonts(void) const;
+
+    /*!
+     * Returns the FontProperties of a font; the value of
+     * FontProperties::source_label() is set as the file
+     * name and face index of the font.
+     * \param I which font with 0 <= I < number_fonts()
+     */
+    const FontProperties&
+    font_properties(unsigned int I) const;
+
+    /*!
+     * Returns the CharacterCoverage of a font with respect
+     * to the Unicode character map of the font; if the font
+     * has no Unicode character map, the default character
+     * map of the font is used.
+     * \param I which font with 0 <= I < number_fonts()
+     */
+    const reference_counted_ptr<const CharacterCoverage>&
+    character_coverage(unsigned int I) const;
+
+    /*!
+     * Returns a FontDatabase::FontGeneratorBase that creates the
+     * FontFreeType of a font. The font file is not opened until
+     * FontDatabase::FontGeneratorBase::generate_font() is called;
+     * it is then memory mapped, see \ref MappedDataBuffer.
+     * \param I which font with 0 <= I < number_fonts()
+     */
+    const reference_counted_ptr<const FontDatabase::FontGeneratorBase>&
+    font_generator(unsigned int I) const;
+
+    /*!
+     * Add all fonts to a FontDatabase via
+     * FontDatabase::add_font_generator(). Returns the number
+     * of fonts that the FontDatabase accepted.
+     * \param database FontDatabase to which to add the fonts
+     */
+    unsigned int
+    add_to_database(FontDatabase &database) const;
+
+  private:
+    void *m_d;
+  };
+/*! @} */
+}
@@ -43,9 +43,12 @@ namespace fastuidraw
      *                        used by the FontFreeType object.
      * \param plib the FreeTypeLib of the FreeTypeFace created by the FontFreeType,
      *             a null values indicates to use a private FreeTypeLib object
-     * \param num_faces number of underlying faces for the FontFreeType to possess,
-     *                  this is the number of simumtaneous requests the FontFreeType
-     *                  can handle
+     * \param num_faces maximum number of underlying faces for the FontFreeType
+     *                  to possess, this is the number of simumtaneous requests
+     *                  the FontFreeType can handle. The faces are created on
+     *                  demand, i.e. a new face is only created when all existing
+     *                  faces are in use, and the number of faces is also capped
+     *                  by the number of hardware threads.
      */
     FontFreeType(const reference_counted_ptr<FreeTypeFace::GeneratorBase> &pface_generator,
                  const reference_counted_ptr<FreeTypeLib> &plib = reference_counted_ptr<FreeTypeLib>(),
@@ -58,9 +61,12 @@ namespace fastuidraw
      * \param props FontProperties with which to endow the created FontFreeType object
      * \param plib the FreeTypeLib of the FreeTypeFace created by the FontFreeType,
      *             a null values indicates to use a private FreeTypeLib object
-     * \param num_faces number of underlying faces for the FontFreeType to possess,
-     *                  this is the number of simumtaneous requests the FontFreeType
-     *                  can handle
+     * \param num_faces maximum number of underlying faces for the FontFreeType
+     *                  to possess, this is the number of simumtaneous requests
+     *                  the FontFreeType can handle. The faces are created on
+     *                  demand, i.e. a new face is only created when all existing
+     *                  faces are in use, and the number of faces is also capped
+     *                  by the number of hardware threads.
      */
     FontFreeType(const reference_counted_ptr<FreeTypeFace::GeneratorBase> &pface_generator,
                  const FontProperties &props,
@@ -107,6 +113,18 @@ namespace fastuidraw
     FontProperties
     compute_font_properties_from_face(const reference_counted_ptr<FreeTypeFace> &in_face);
 
+    /*!
+     * Compute the CharacterCoverage of an FT_Face with respect
+     * to the Unicode character map of the face; if the face has
+     * no Unicode character map, the character map that is selected
+     * in the face is used. Beware that the selected character map
+     * of the face is changed to the Unicode character map if the
+     * face has one.
+     */
+    static
+    reference_counted_ptr<CharacterCoverage>
+    compute_character_coverage_from_face(FT_Face in_face);
+
     virtual
     void
     glyph_codes(enum CharacterEncoding::encoding_value_t encoding,
@@ -117,6 +135,27 @@ namespace fastuidraw
     unsigned int
     number_glyphs(void) const;
 
+    /*!
+     * Implements FontBase::content_hash() by hashing the
+     * bytes of the font file (or memory) from which the
+     * faces are created, together with the face index and
+     * the FreeType version. The hash is computed on the
+     * first call and then remembered.
+     */
+    virtual
+    bool
+    content_hash(uint64_t *out_hash) const;
+
+    /*!
+     * Implements FontBase::character_coverage() by walking
+     * the Unicode character map of the font, see
+     * compute_character_coverage_from_face(). The coverage
+     * is computed on the first call and then remembered.
+     */
+    virtual
+    reference_counted_ptr<const CharacterCoverage>
+    character_coverage(void) const;
+
   private:
     virtual
     bool
@@ -131,6 +170,11 @@ namespace fastuidraw
     compute_rendering_data(GlyphRenderer render, GlyphMetrics glyph_metrics,
 			   Path &path, vec2 &render_size) const;
 
+    virtual
+    bool
+    compute_path(GlyphRenderer render, GlyphMetrics glyph_metrics,
+                 Path &path) const;
+
     void *m_d;
   };
 /*! @} */
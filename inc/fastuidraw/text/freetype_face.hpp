@@ -137,8 +137,10 @@ namespace fastuidraw
                       int face_index);
 
       /*!
-       * Ctor. Provided as a convenience, a DataBuffer object is created
-       *        from the named file and used as the memory source.
+       * Ctor. Provided as a convenience, a MappedDataBuffer object is
+       *        created from the named file and used as the memory source;
+       *        if the file cannot be mapped into memory, a DataBuffer
+       *        holding a copy of the file is used instead.
        * \param filename name of file from which to source the created
        *                 FT_Face objects
        * \param face_index face index of file
@@ -38,6 +38,17 @@ namespace fastuidraw
 
   class GlyphCache;
 
+  /*!
+   * \brief
+   * A GlyphPath is a \ref Path that is reference counted;
+   * it is the type of the path of a \ref Glyph (see
+   * Glyph::path()).
+   */
+  class GlyphPath:
+    public reference_counted<GlyphPath>::default_base,
+    public Path
+  {};
+
   /*!
    * \brief
    * A Glyph is essentially an opaque pointer to
@@ -149,8 +160,12 @@ namespace fastuidraw
      * example by Painter::shear(1.0, -1.0)) if the
      * glyphs are rendered with data packed by
      * pack_glyph() with PainterEnums::y_increases_downwards.
+     * If the path was released because of GlyphCache::cpu_byte_budget(),
+     * it is recreated and the glyph is marked as used; the
+     * returned path stays valid for as long as a reference
+     * to it is held, even if the glyph releases it again.
      */
-    const Path&
+    reference_counted_ptr<const GlyphPath>
     path(void) const;
 
     /*!
@@ -51,6 +51,26 @@ namespace fastuidraw
      */
     GlyphAtlasBackingStoreBase(unsigned int psize, bool presizable);
 
+    /*!
+     * Ctor for a paged store. The size of a paged store is always
+     * a multiple of a page size and resizing a paged store only adds
+     * pages, i.e. resize_implement() must not move or copy the data
+     * already in the store. Because growing a paged store is cheap,
+     * \ref GlyphAtlas grows a paged store by only the pages needed
+     * by an allocation instead of doubling its size.
+     * \param psize initial number of generic_data elements that the
+     *              GlyphAtlasBackingStoreBase backs, rounded up to a
+     *              multiple of ppage_size
+     * \param ppage_size number of generic_data elements of a page,
+     *                   must be positive
+     * \param pmax_size number of generic_data elements beyond which
+     *                  the store cannot grow, rounded down to a
+     *                  multiple of ppage_size
+     */
+    GlyphAtlasBackingStoreBase(unsigned int psize,
+                               unsigned int ppage_size,
+                               unsigned int pmax_size);
+
     virtual
     ~GlyphAtlasBackingStoreBase();
 
@@ -58,7 +78,7 @@ namespace fastuidraw
      * Returns the number of \ref generic_data backed by the store.
      */
     unsigned int
-    size(void);
+    size(void) const;
 
     /*!
      * To be implemented by a derived class to load
@@ -70,6 +90,22 @@ namespace fastuidraw
     void
     set_values(unsigned int location, c_array<const generic_data> pdata) = 0;
 
+    /*!
+     * To be optionally implemented by a derived class to copy
+     * data already in the store to another location of the
+     * store; the source and destination ranges do not overlap.
+     * The copy must be ordered after the previous calls to
+     * set_values(). Default implementation returns ef
+     * routine_fail to indicate that the store cannot copy.
+     * \param dst_location location to which to copy the data
+     * \param src_location location from which to copy the data
+     * \param count number of generic_data elements to copy
+     */
+    virtual
+    enum return_code
+    copy_values(unsigned int dst_location, unsigned int src_location,
+                unsigned int count);
+
     /*!
      * To be implemented by a derived class to flush contents
      * to the backing store.
@@ -85,9 +121,25 @@ namespace fastuidraw
     bool
     resizeable(void) const;
 
+    /*!
+     * Returns the page size of a paged store, returns 0
+     * if the store is not paged.
+     */
+    unsigned int
+    page_size(void) const;
+
+    /*!
+     * Returns the number of \ref generic_data elements
+     * beyond which the store cannot be resized.
+     */
+    unsigned int
+    max_size(void) const;
+
     /*!
      * Resize the object to a larger size. The routine resizeable()
-     * must return true, if not the function FASTUIDRAWasserts.
+     * must return true, if not the function FASTUIDRAWasserts. For
+     * a paged store, the new size must be a multiple of page_size()
+     * and no more than max_size().
      * \param new_size new number of \ref generic_data for the store to back
      */
     void
@@ -136,6 +188,71 @@ namespace fastuidraw
     int
     allocate_data(c_array<const generic_data> pdata);
 
+    /*!
+     * Allocate data at the lowest location of the store at which
+     * it fits, provided the data then ends at or before a bound;
+     * the store is not grown. Used to move data toward the start
+     * of the store (see GlyphCache::compact_atlas()). Negative
+     * return value indicates failure.
+     * \param pdata data to allocate and set
+     * \param bound location the end of the allocated data may
+     *              not exceed
+     */
+    int
+    allocate_data_below(c_array<const generic_data> pdata, int bound);
+
+    /*!
+     * Allocate, as allocate_data_below() does, room for count
+     * elements and copy to it the data at a location of the
+     * store with GlyphAtlasBackingStoreBase::copy_values(). Used
+     * to move data without uploading it again. Negative return
+     * value indicates failure, which includes the case that the
+     * store cannot copy data.
+     * \param location location of the data to copy
+     * \param count number of generic_data elements to copy
+     * \param bound location the end of the allocated data may
+     *              not exceed
+     */
+    int
+    copy_data_below(int location, int count, int bound);
+
+    /*!
+     * Returns the lowest location at which count elements can
+     * be allocated without growing the store, returns a negative
+     * value if there is no free block of count elements.
+     * \param count number of generic_data elements
+     */
+    int
+    lowest_free_location(unsigned int count);
+
+    /*!
+     * Returns the number of elements of the largest block that
+     * can be allocated without growing the store. When this is
+     * much less than the free room of the store (GlyphAtlasBackingStoreBase::size()
+     * minus data_allocated()), the free room is fragmented.
+     */
+    unsigned int
+    largest_free_block(void);
+
+    /*!
+     * Returns the number of blocks into which the free room
+     * of the store (GlyphAtlasBackingStoreBase::size() minus
+     * data_allocated()) is split.
+     */
+    unsigned int
+    number_free_blocks(void);
+
+    /*!
+     * Returns a measure of how fragmented the free room of
+     * the store is: one minus the ratio of largest_free_block()
+     * to the free room. Thus the value is 0 when the free room
+     * is a single block (or when there is no free room) and
+     * approaches 1 as the free room is split into many small
+     * blocks (see also GlyphCache::compact_atlas()).
+     */
+    float
+    fragmentation(void);
+
     /*!
      * Deallocate data
      */
@@ -148,6 +265,14 @@ namespace fastuidraw
     unsigned int
     data_allocated(void);
 
+    /*!
+     * Returns how much of data_allocated() has been passed
+     * to deallocate_data() but is not yet freed because the
+     * deallocation is delayed (see lock_resources()).
+     */
+    unsigned int
+    data_delayed_deallocated(void);
+
     /*!
      * Frees all allocated regions of this GlyphAtlas;
      */
@@ -194,6 +319,14 @@ namespace fastuidraw
     void
     unlock_resources(void);
 
+    /*!
+     * Returns true if there have been more calls to
+     * lock_resources() than to unlock_resources(), i.e.
+     * if clear() and deallocate_data() are delayed.
+     */
+    bool
+    resources_locked(void) const;
+
   private:
     void *m_d;
   };
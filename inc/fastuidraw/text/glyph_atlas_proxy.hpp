@@ -49,6 +49,21 @@ namespace fastuidraw
     unsigned int
     total_allocated(void) const;
 
+    /*!
+     * Mark an attribute as holding, in the low bits of each of
+     * the values of its GlyphAttribute::m_data, a location returned
+     * by allocate_data(), with any other bits of the values above
+     * those of the location. Then GlyphCache::compact_atlas() moves
+     * the data of the glyph by copying it within the GlyphAtlas and
+     * adjusting the attribute, instead of uploading the glyph again.
+     * A GlyphRenderData should mark each attribute that holds a
+     * location.
+     * \param attribute index of the attribute
+     * \param location value returned by allocate_data()
+     */
+    void
+    relocatable_attribute(unsigned int attribute, int location);
+
   private:
     friend class Glyph;
     friend class GlyphCache;
@@ -37,7 +37,11 @@ namespace fastuidraw
    * A GlyphCache represents a cache of glyphs and manages the uploading
    * of the data to a GlyphAtlas. The methods of GlyphAtlas are thread
    * safe because it maintains an internal mutex lock for the durations
-   * of its methods.
+   * of its methods. The generation of glyph rendering data (i.e.
+   * FontBase::compute_rendering_data()) is performed without holding
+   * that lock; thus several threads can generate different glyphs
+   * concurrently and a thread requesting a glyph that another thread
+   * is generating only waits on that glyph.
    */
   class GlyphCache:public reference_counted<GlyphCache>::default_base
   {
@@ -83,6 +87,155 @@ namespace fastuidraw
       unsigned int m_location, m_size;
     };
 
+    /*!
+     * A PrefetchHandle tracks the progress of the glyph
+     * generation queued by GlyphCache::prefetch(). A
+     * PrefetchHandle can outlive the GlyphCache that made
+     * it; if the GlyphCache is destroyed before all of the
+     * glyphs are generated, the remaining glyphs are not
+     * generated and the PrefetchHandle becomes ready. The
+     * methods of PrefetchHandle are thread safe.
+     */
+    class PrefetchHandle:public reference_counted<PrefetchHandle>::default_base
+    {
+    public:
+      ~PrefetchHandle();
+
+      /*!
+       * Returns the number of glyph codes passed to
+       * GlyphCache::prefetch().
+       */
+      unsigned int
+      number_glyphs(void) const;
+
+      /*!
+       * Returns the number of glyphs of the prefetch
+       * that are done; the value only increases and
+       * reaches number_glyphs() once ready() is true.
+       */
+      unsigned int
+      number_glyphs_done(void) const;
+
+      /*!
+       * Returns true if all of the glyphs of the
+       * prefetch are done; does not block.
+       */
+      bool
+      ready(void) const;
+
+      /*!
+       * Block until ready() is true.
+       */
+      void
+      wait(void) const;
+
+    private:
+      friend class GlyphCache;
+
+      explicit
+      PrefetchHandle(unsigned int number_glyphs);
+
+      void *m_d;
+    };
+
+    /*!
+     * \brief
+     * A Statistics holds values describing the glyphs of a
+     * GlyphCache and the memory they use, see statistics().
+     */
+    class Statistics
+    {
+    public:
+      Statistics(void);
+
+      /*!
+       * Number of glyphs held by the GlyphCache, indexed
+       * by \ref glyph_type.
+       */
+      vecN<unsigned int, msdf_glyph + 1> m_number_glyphs;
+
+      /*!
+       * Number of glyphs whose data is on the GlyphAtlas.
+       */
+      unsigned int m_number_glyphs_uploaded;
+
+      /*!
+       * Number of glyphs whose GlyphRenderData and Path
+       * are released because of cpu_byte_budget().
+       */
+      unsigned int m_number_glyphs_released;
+
+      /*!
+       * Number of bytes of the GlyphRenderData objects held
+       * by the glyphs, as given by GlyphRenderData::serialized_size().
+       * The GlyphRenderData of a glyph is held until the glyph
+       * is uploaded to the GlyphAtlas.
+       */
+      uint64_t m_render_data_bytes;
+
+      /*!
+       * Estimate of the number of bytes of the curves of the
+       * Path objects of the glyphs (see Glyph::path()); does
+       * not include tessellations cached by the Path objects.
+       */
+      uint64_t m_path_bytes;
+
+      /*!
+       * Number of bytes of glyph data on the GlyphAtlas,
+       * i.e. GlyphAtlas::data_allocated() in bytes.
+       */
+      uint64_t m_atlas_bytes;
+
+      /*!
+       * Size in bytes of the backing store of the GlyphAtlas.
+       */
+      uint64_t m_atlas_store_bytes;
+
+      /*!
+       * Size in bytes of GlyphAtlas::largest_free_block().
+       */
+      uint64_t m_atlas_largest_free_block_bytes;
+
+      /*!
+       * Value of GlyphAtlas::number_free_blocks().
+       */
+      unsigned int m_atlas_number_free_blocks;
+
+      /*!
+       * Value of GlyphAtlas::fragmentation().
+       */
+      float m_atlas_fragmentation;
+
+      /*!
+       * Number of times a fetched glyph was already
+       * present in the GlyphCache.
+       */
+      uint64_t m_number_hits;
+
+      /*!
+       * Number of times a fetched glyph was not present
+       * in the GlyphCache and thus had to be generated.
+       */
+      uint64_t m_number_misses;
+
+      /*!
+       * Number of times the rendering data of a glyph was
+       * generated (or read from the on-disk cache, see
+       * disk_cache_directory(c_string)); this includes
+       * regenerating the data of glyphs that were evicted
+       * from the GlyphAtlas, moved by compact_atlas() or
+       * released because of cpu_byte_budget().
+       */
+      uint64_t m_number_generated;
+
+      /*!
+       * Total time, in microseconds, spent generating the
+       * rendering data counted by m_number_generated,
+       * summed across all threads.
+       */
+      uint64_t m_generation_time_us;
+    };
+
     /*!
      * Ctor
      * \param patlas GlyphAtlas to store glyph data
@@ -173,6 +326,9 @@ namespace fastuidraw
      * Fetch, and if necessay create and store, a sequence of
      * glyphs given a sequence of \ref GlyphMetrics values and
      * a \ref GlyphRenderer specifying how to render the glyph.
+     * The glyphs not yet present in the GlyphCache are generated
+     * as one batch, in parallel if number_generation_threads()
+     * is non-zero, and then uploaded to the GlyphAtlas in one pass.
      * \param render renderer of fetched Glyph
      * \param glyph_metrics sequence of \ref GlyphMetrics values
      * \param[out] out_glyphs location to which to write the glyphs;
@@ -185,6 +341,28 @@ namespace fastuidraw
                  c_array<Glyph> out_glyphs,
                  bool upload_to_atlas = true);
 
+    /*!
+     * Queue the generation of a sequence of glyphs on background
+     * threads and return immediately. The glyphs are generated
+     * by the threads of number_generation_threads() if non-zero
+     * and otherwise by a process-wide set of worker threads;
+     * they are not uploaded to the GlyphAtlas. A later call to
+     * fetch_glyph() or fetch_glyphs() returns a prefetched glyph
+     * without generating it; a glyph that is queued but whose
+     * generation has not yet started is generated by the calling
+     * thread of fetch_glyphs() and a glyph whose generation is
+     * in progress is waited on. Thus an application can warm the
+     * GlyphCache with the glyphs it is about to need without
+     * stalling the thread that fetches glyphs.
+     * \param render renderer of the glyphs
+     * \param font font from which to take the glyphs
+     * \param glyph_codes sequence of glyph codes; the values
+     *                    are copied before prefetch() returns
+     */
+    reference_counted_ptr<const PrefetchHandle>
+    prefetch(GlyphRenderer render, const FontBase *font,
+             c_array<const uint32_t> glyph_codes);
+
     /*!
      * Add a Glyph created with Glyph::create_glyph() to
      * this GlyphCache. Will fail if a Glyph with the
@@ -224,11 +402,218 @@ namespace fastuidraw
     /*!
      * Returns the number of times that this GlyphCache cleared
      * its GlyphAtlas (i.e. the number of times clear_atlas() or
-     * clear_cache() have been called).
+     * clear_cache() have been called) plus the number of times
+     * glyphs were evicted from the GlyphAtlas (see
+     * number_eviction_passes()) or moved within the GlyphAtlas
+     * (see number_compaction_passes()). A change in the value indicates
+     * that the GlyphAttribute values of previously fetched
+     * \ref Glyph values may no longer be valid.
      */
     unsigned int
     number_times_atlas_cleared(void);
 
+    /*!
+     * Advance the use epoch of the GlyphCache. When the data of
+     * a glyph fails to fit in the GlyphAtlas (or would exceed
+     * atlas_byte_budget()), the least recently used glyphs are
+     * evicted from the GlyphAtlas to make room. Glyphs fetched
+     * since the last call to advance_epoch() are never evicted;
+     * thus an application should call advance_epoch() once per
+     * frame, before any glyphs for the frame are fetched. While
+     * the resources of the GlyphAtlas are locked (see
+     * GlyphAtlas::lock_resources()), the data of evicted glyphs
+     * is freed only when they are unlocked, so an upload that
+     * does not fit fails; advance_epoch() uploads such glyphs
+     * again, which changes number_times_atlas_cleared().
+     */
+    void
+    advance_epoch(void);
+
+    /*!
+     * Returns the number of times advance_epoch() has been called.
+     */
+    unsigned int
+    epoch(void) const;
+
+    /*!
+     * Mark glyphs as used in the current epoch (see advance_epoch())
+     * without fetching them. Users that keep the attributes of
+     * fetched glyphs and draw them again without fetching the
+     * glyphs again (such as \ref GlyphRun and \ref GlyphSequence)
+     * call this once per epoch so that the glyphs they draw are
+     * not evicted first. Glyphs that are not valid or that are not
+     * on this GlyphCache are ignored.
+     * \param glyphs glyphs to mark as used
+     */
+    void
+    mark_glyphs_used(c_array<const Glyph> glyphs);
+
+    /*!
+     * Set the budget, in bytes, for the data of the glyphs
+     * on the GlyphAtlas. When uploading a glyph would exceed
+     * the budget, least recently used glyphs are evicted
+     * first (see advance_epoch()). The budget is soft: if not
+     * enough glyphs can be evicted, the upload proceeds. A
+     * value of 0 indicates no budget. Default value is 0.
+     */
+    void
+    atlas_byte_budget(unsigned int v);
+
+    /*!
+     * Returns the value set by atlas_byte_budget(unsigned int).
+     */
+    unsigned int
+    atlas_byte_budget(void) const;
+
+    /*!
+     * Returns the total number of glyphs that have been evicted
+     * from the GlyphAtlas. An evicted glyph remains in the
+     * GlyphCache, but is re-uploaded the next time it is fetched
+     * (see also Glyph::upload_to_atlas()).
+     */
+    unsigned int
+    number_glyphs_evicted(void) const;
+
+    /*!
+     * Returns the number of times that glyphs have been
+     * evicted from the GlyphAtlas.
+     */
+    unsigned int
+    number_eviction_passes(void) const;
+
+    /*!
+     * Perform a step of compacting the GlyphAtlas: the data of
+     * the glyphs at the highest locations of the GlyphAtlas is
+     * moved to the lowest free locations that can take it, thus
+     * merging the free room of the GlyphAtlas into larger blocks
+     * without clearing it. Because the GlyphAttribute values of
+     * a glyph encode the location of its data, the attributes of
+     * a moved glyph are rewritten in place. The data of a glyph
+     * is copied within the GlyphAtlas when the glyph marked its
+     * attributes holding locations (see
+     * GlyphAtlasProxy::relocatable_attribute()) and the store can
+     * copy (see GlyphAtlasBackingStoreBase::copy_values());
+     * otherwise its rendering data is regenerated (or read from
+     * the on-disk cache, see disk_cache_directory(c_string)) and
+     * uploaded again. The old data of the moved
+     * glyphs is kept on the GlyphAtlas, so that attributes packed
+     * before the move remain valid, until the batch of moves ends:
+     * when a call moves no glyph, when the old data kept reaches
+     * an eighth of GlyphAtlas::data_allocated() or when the room
+     * is needed to upload a glyph. Then the old data is freed and
+     * number_times_atlas_cleared() changes once for the whole
+     * batch so that \ref GlyphSequence and \ref GlyphRun values
+     * repack their attributes. An
+     * application should call compact_atlas() once per frame
+     * with a small max_count when GlyphAtlas::largest_free_block()
+     * is much smaller than the free room of the GlyphAtlas. Data
+     * allocated with allocate_data() is not moved. Returns the
+     * number of generic_data values moved.
+     * \param max_count number of generic_data values after which
+     *                  to stop moving glyphs; the step may move
+     *                  up to one glyph more than max_count
+     */
+    unsigned int
+    compact_atlas(unsigned int max_count);
+
+    /*!
+     * Returns the number of batches of glyphs moved by
+     * compact_atlas() whose old data was freed.
+     */
+    unsigned int
+    number_compaction_passes(void) const;
+
+    /*!
+     * Set the budget, in bytes, of the memory used on the CPU
+     * by the glyphs of the GlyphCache, i.e. the sum of
+     * Statistics::m_render_data_bytes and Statistics::m_path_bytes.
+     * When the budget is exceeded, the GlyphRenderData and Path
+     * of glyphs that are uploaded to the GlyphAtlas and were
+     * not used since the last call to advance_epoch() are
+     * released, least recently used first. The Path of such a
+     * glyph is recreated by Glyph::path() and its rendering
+     * data is regenerated if it needs to be uploaded again.
+     * The budget is soft: glyphs used in the current epoch and
+     * glyphs not uploaded are never released. A value of 0
+     * indicates no budget. Default value is 0.
+     */
+    void
+    cpu_byte_budget(unsigned int v);
+
+    /*!
+     * Returns the value set by cpu_byte_budget(unsigned int).
+     */
+    unsigned int
+    cpu_byte_budget(void) const;
+
+    /*!
+     * Returns the current Statistics of the GlyphCache; the
+     * cost is linear in the number of glyphs of the GlyphCache.
+     */
+    Statistics
+    statistics(void) const;
+
+    /*!
+     * Set the number of worker threads that fetch_glyphs() uses
+     * to generate, in parallel, the rendering data of the glyphs
+     * missing from the GlyphCache; the calling thread of
+     * fetch_glyphs() also generates glyphs. A value of 0 indicates
+     * that glyphs are only generated by the calling thread.
+     * Default value is 0.
+     */
+    void
+    number_generation_threads(unsigned int v);
+
+    /*!
+     * Returns the value set by number_generation_threads(unsigned int).
+     */
+    unsigned int
+    number_generation_threads(void) const;
+
+    /*!
+     * Returns a reasonable value to pass to number_generation_threads(unsigned int),
+     * which is one less than the number of hardware threads.
+     */
+    static
+    unsigned int
+    default_number_generation_threads(void);
+
+    /*!
+     * Set the directory of an on-disk cache of the rendering
+     * data of glyphs. When set, the rendering data of a glyph
+     * is first looked for in the directory (by memory-mapping
+     * the file of the glyph) and is only generated by the font
+     * if it is not present there; generated rendering data is
+     * then written to the directory. A glyph is keyed by
+     * FontBase::content_hash() of its font, its glyph code, its
+     * GlyphRenderer and the \ref GlyphGenerateParams values that
+     * affect it; glyphs of fonts that do not provide a content
+     * hash are not cached. The directory must already exist and
+     * can be shared between several GlyphCache objects and
+     * processes. A value of nullptr or an empty string disables
+     * the on-disk cache, which is the default.
+     * \param directory directory of the on-disk cache
+     */
+    void
+    disk_cache_directory(c_string directory);
+
+    /*!
+     * Returns the directory set by disk_cache_directory(c_string),
+     * returns nullptr if there is no on-disk cache. The returned
+     * string is valid until the next call to
+     * disk_cache_directory(c_string).
+     */
+    c_string
+    disk_cache_directory(void) const;
+
+    /*!
+     * Returns the number of glyphs whose rendering data was
+     * read from the on-disk cache since the last call to
+     * disk_cache_directory(c_string).
+     */
+    unsigned int
+    number_disk_cache_hits(void) const;
+
     /*!
      * Clear this GlyphCache and the GlyphAtlas backing the glyphs.
      * Thus all previous \ref Glyph and \ref GlyphMetrics values
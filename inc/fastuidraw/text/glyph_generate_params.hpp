@@ -129,6 +129,29 @@ namespace fastuidraw
     enum return_code
     restricted_rays_max_recursion(int v);
 
+    /*!
+     * When generating restricted rays glyph data see (\ref
+     * GlyphRenderDataRestrictedRays), specifies the number
+     * of worker threads (in addition to the thread generating
+     * the glyph) across which the hierarchy of boxes of a
+     * single glyph with many curves is built. The generated
+     * data does not depend on this value. A value of 0
+     * indicates that the glyph is computed by the generating
+     * thread only.
+     */
+    unsigned int
+    restricted_rays_number_threads(void);
+
+    /*!
+     * Set the value returned by
+     * restricted_rays_number_threads(void) const,
+     * initial value is 0. Returns \ref routine_success
+     * if value is successfully changed.
+     * \param v value
+     */
+    enum return_code
+    restricted_rays_number_threads(unsigned int v);
+
     /*!
      * When generating banded rays glyphs see (\ref
      * GlyphRenderDataBandedRays), specifies the
@@ -169,5 +192,62 @@ namespace fastuidraw
      */
     enum return_code
     banded_rays_average_number_curves_thresh(float v);
+
+    /*!
+     * When generating distance field glyphs (and multi-channel
+     * distance field glyphs), specifies the
+     * number of worker threads (in addition to the thread
+     * generating the glyph) across which the texels of a
+     * single glyph are computed. The generated data does
+     * not depend on this value. A value of 0 indicates
+     * that the glyph is computed by the generating thread
+     * only.
+     */
+    unsigned int
+    distance_field_number_threads(void);
+
+    /*!
+     * Set the value returned by
+     * distance_field_number_threads(void) const,
+     * initial value is 0. Returns \ref routine_success
+     * if value is successfully changed.
+     * \param v value
+     */
+    enum return_code
+    distance_field_number_threads(unsigned int v);
+
+    /*!
+     * Pixel size at which to generate multi-channel signed
+     * distance field glyphs (see \ref GlyphRenderDataMSDF).
+     */
+    unsigned int
+    msdf_pixel_size(void);
+
+    /*!
+     * Set the value returned by msdf_pixel_size(void) const,
+     * initial value is 32. Return \ref routine_success if
+     * value is successfully changed.
+     * \param v value
+     */
+    enum return_code
+    msdf_pixel_size(unsigned int v);
+
+    /*!
+     * When creating multi-channel signed distance field data,
+     * the distances are normalized and clamped to [-1, 1]. This
+     * value provides the normalization, i.e. the maximum distance
+     * recorded in the texels. The units are in pixels.
+     */
+    float
+    msdf_max_distance(void);
+
+    /*!
+     * Set the value returned by msdf_max_distance(void) const,
+     * initial value is 4.0, i.e. 4 pixels. Return \ref
+     * routine_success if value is successfully changed.
+     * \param v value
+     */
+    enum return_code
+    msdf_max_distance(float v);
   }
 }
@@ -101,6 +101,36 @@ namespace fastuidraw
                     GlyphAttribute::Array &attributes,
                     c_array<float> render_costs) const = 0;
 
+    /*!
+     * To be optionally implemented by a derived class to return
+     * the number of bytes serialize() writes. A return value of
+     * zero indicates that the GlyphRenderData does not support
+     * serialization. Default implementation returns 0.
+     */
+    virtual
+    unsigned int
+    serialized_size(void) const
+    {
+      return 0;
+    }
+
+    /*!
+     * To be optionally implemented by a derived class to write
+     * the data of the GlyphRenderData so that an equivalent
+     * object can be recreated later (see for example
+     * GlyphCache::disk_cache_directory()); the format of the
+     * data is specific to the derived class. Default
+     * implementation returns \ref routine_fail.
+     * \param dst location to which to write the data, must
+     *            be of size serialized_size()
+     */
+    virtual
+    enum fastuidraw::return_code
+    serialize(c_array<uint8_t> dst) const
+    {
+      FASTUIDRAWunused(dst);
+      return routine_fail;
+    }
   };
 /*! @} */
 }
@@ -310,6 +310,16 @@ namespace fastuidraw
     enum return_code
     query(query_info *out_info) const;
 
+    /*!
+     * Set the data of this object from data written by
+     * serialize(). On success, the object is finalized
+     * and no further data can be added. On failure, the
+     * object is left unchanged.
+     * \param src data as written by serialize()
+     */
+    enum return_code
+    deserialize(c_array<const uint8_t> src);
+
     virtual
     c_array<const c_string>
     render_info_labels(void) const;
@@ -320,6 +330,18 @@ namespace fastuidraw
                     GlyphAttribute::Array &attributes,
                     c_array<float> render_costs) const;
 
+    /*!
+     * Returns the number of bytes serialize() writes;
+     * returns 0 if finalize() has not yet been called.
+     */
+    virtual
+    unsigned int
+    serialized_size(void) const;
+
+    virtual
+    enum fastuidraw::return_code
+    serialize(c_array<uint8_t> dst) const;
+
   private:
     void *m_d;
   };
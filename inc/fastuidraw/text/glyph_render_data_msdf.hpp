@@ -0,0 +1,147 @@
+/*!
+ * \file glyph_render_data_msdf.hpp
+ * \brief file glyph_render_data_msdf.hpp
+ *
+ * Copyright 2019 by Intel.
+ *
+ * Contact: kevin.rogovin@intel.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@intel.com>
+ *
+ */
+
+
+#pragma once
+
+#include <fastuidraw/text/glyph_render_data.hpp>
+
+namespace fastuidraw
+{
+/*!\addtogroup Text
+ * @{
+ */
+
+  /*!
+   * \brief
+   * A GlyphRenderDataMSDF holds the texel data of a
+   * multi-channel signed distance field (MSDF) for
+   * rendering a glyph. Each texel has four 8-bit
+   * channels. The first three channels are signed
+   * pseudo-distances each computed against a subset
+   * of the edges of the glyph; the edges are assigned
+   * to the channels so that the median of the three
+   * values keeps the corners of the glyph sharp under
+   * magnification. The fourth channel is the true
+   * signed distance. In each channel, a value of 128
+   * or more indicates inside of the glyph.
+   */
+  class GlyphRenderDataMSDF:public GlyphRenderData
+  {
+  public:
+    /*!
+     * Enumeration to name the channels of a texel
+     */
+    enum channel_t
+      {
+        /*!
+         * First pseudo-distance channel
+         */
+        red_channel,
+
+        /*!
+         * Second pseudo-distance channel
+         */
+        green_channel,
+
+        /*!
+         * Third pseudo-distance channel
+         */
+        blue_channel,
+
+        /*!
+         * True signed distance channel
+         */
+        alpha_channel,
+
+        /*!
+         * Number of channels of a texel
+         */
+        number_channels
+      };
+
+    /*!
+     * Ctor, initialized the resolution as (0,0).
+     */
+    GlyphRenderDataMSDF(void);
+
+    ~GlyphRenderDataMSDF();
+
+    /*!
+     * Returns the resolution of the glyph.
+     */
+    ivec2
+    resolution(void) const;
+
+    /*!
+     * Returns the texel data for rendering. The
+     * channel C of the texel (x,y) is located at I
+     * where I is given by
+     * I = C + number_channels * (x + y * resolution().x()).
+     */
+    c_array<const uint8_t>
+    texel_data(void) const;
+
+    /*!
+     * Returns the texel data for rendering. The
+     * channel C of the texel (x,y) is located at I
+     * where I is given by
+     * I = C + number_channels * (x + y * resolution().x()).
+     */
+    c_array<uint8_t>
+    texel_data(void);
+
+    /*!
+     * Change the resolution
+     * \param sz new resolution
+     */
+    void
+    resize(ivec2 sz);
+
+    /*!
+     * Set the resolution and texel data from data written
+     * by serialize(). On failure, the object is left
+     * unchanged.
+     * \param src data as written by serialize()
+     */
+    enum fastuidraw::return_code
+    deserialize(c_array<const uint8_t> src);
+
+    virtual
+    c_array<const c_string>
+    render_info_labels(void) const;
+
+    virtual
+    enum fastuidraw::return_code
+    upload_to_atlas(GlyphAtlasProxy &atlas_proxy,
+                    GlyphAttribute::Array &attributes,
+                    c_array<float> render_costs) const;
+
+    virtual
+    unsigned int
+    serialized_size(void) const;
+
+    virtual
+    enum fastuidraw::return_code
+    serialize(c_array<uint8_t> dst) const;
+
+  private:
+    void *m_d;
+  };
+/*! @} */
+}
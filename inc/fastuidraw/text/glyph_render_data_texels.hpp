@@ -74,6 +74,15 @@ namespace fastuidraw
     void
     resize(ivec2 sz);
 
+    /*!
+     * Set the resolution and texel data from data written
+     * by serialize(). On failure, the object is left
+     * unchanged.
+     * \param src data as written by serialize()
+     */
+    enum fastuidraw::return_code
+    deserialize(c_array<const uint8_t> src);
+
     virtual
     c_array<const c_string>
     render_info_labels(void) const;
@@ -84,6 +93,14 @@ namespace fastuidraw
                     GlyphAttribute::Array &attributes,
                     c_array<float> render_costs) const;
 
+    virtual
+    unsigned int
+    serialized_size(void) const;
+
+    virtual
+    enum fastuidraw::return_code
+    serialize(c_array<uint8_t> dst) const;
+
   private:
     void *m_d;
   };
@@ -108,5 +108,64 @@ namespace fastuidraw {
     {}
   };
 
+  /*!
+   * \brief
+   * Represents the contents of a file mapped read-only
+   * into memory (via mmap). The pages of the file are
+   * read on demand by the operating system from its page
+   * cache; several processes mapping the same file share
+   * the same physical memory.
+   */
+  class MappedFileBackingStore
+  {
+  public:
+    /*!
+     * Ctor. Maps a file into memory; if the file cannot
+     * be opened or mapped, or if it is empty, data()
+     * returns an empty array.
+     * \param filename name of file to map
+     */
+    explicit
+    MappedFileBackingStore(c_string filename);
+
+    ~MappedFileBackingStore();
+
+    /*!
+     * Return the mapped contents of the file. Modifying the
+     * file while it is mapped changes the returned contents,
+     * truncating the file makes accessing the pages past the
+     * new end of the file crash.
+     */
+    c_array<const uint8_t>
+    data(void) const;
+
+  private:
+    void *m_d;
+  };
+
+  /*!
+   * \brief
+   * MappedDataBuffer is an implementation of DataBufferBase
+   * where the data is the contents of a file mapped read-only
+   * into memory, see \ref MappedFileBackingStore. As such,
+   * DataBufferBase::data_rw() returns an empty array.
+   */
+  class MappedDataBuffer:
+    private MappedFileBackingStore,
+    public DataBufferBase
+  {
+  public:
+    /*!
+     * Ctor. Initialize the MappedDataBuffer to be backed by
+     * the contents of a file mapped into memory.
+     * \param filename name of file to map
+     */
+    explicit
+    MappedDataBuffer(c_string filename):
+      MappedFileBackingStore(filename),
+      DataBufferBase(data(), c_array<uint8_t>())
+    {}
+  };
+
 /*! @} */
 } //namespace fastuidraw
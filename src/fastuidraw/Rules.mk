@@ -5,7 +5,8 @@ d		:= $(dir)
 # End standard header
 
 FASTUIDRAW_SOURCES += $(call filelist, image.cpp colorstop.cpp \
-	colorstop_atlas.cpp path.cpp tessellated_path.cpp)
+	colorstop_atlas.cpp path.cpp tessellated_path.cpp \
+	path_contour_registry.cpp)
 
 dir := $(d)/ngl_generator
 include $(dir)/Rules.mk
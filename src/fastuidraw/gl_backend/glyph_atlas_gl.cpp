@@ -23,6 +23,7 @@
 
 #include "private/texture_gl.hpp"
 #include "private/buffer_object_gl.hpp"
+#include "private/sparse_buffer_gl.hpp"
 #include "private/tex_buffer.hpp"
 #include "private/texture_view.hpp"
 #include "../private/util_private.hpp"
@@ -42,6 +43,17 @@ namespace
     {
     }
 
+    /* ctor for a paged store */
+    StoreGL(unsigned int number, unsigned int page_size, unsigned int max_size,
+	    GLenum pbinding_point, const fastuidraw::ivec2 &log2_dims,
+	    bool binding_point_is_texture_unit):
+      fastuidraw::GlyphAtlasBackingStoreBase(number, page_size, max_size),
+      m_binding_point(pbinding_point),
+      m_log2_dims(log2_dims),
+      m_binding_point_is_texture_unit(binding_point_is_texture_unit)
+    {
+    }
+
     virtual
     GLuint
     gl_backing(enum fastuidraw::gl::GlyphAtlasGL::backing_fmt_t fmt) const = 0;
@@ -55,17 +67,30 @@ namespace
     bool m_binding_point_is_texture_unit;
   };
 
+  /* BufferType is either BufferGL, whose resizing creates a new
+   * buffer object to which the old contents are copied, or
+   * SparseBufferGL, whose resizing only commits pages; in the
+   * latter case the store is paged.
+   */
+  template<typename BufferType>
   class StoreGL_StorageBuffer:public StoreGL
   {
   public:
-    explicit
     StoreGL_StorageBuffer(unsigned int number, bool delayed);
 
+    StoreGL_StorageBuffer(unsigned int number, unsigned int page_size,
+                          unsigned int max_size, bool delayed);
+
     virtual
     void
     set_values(unsigned int location,
                fastuidraw::c_array<const fastuidraw::generic_data> pdata);
 
+    virtual
+    enum fastuidraw::return_code
+    copy_values(unsigned int dst_location, unsigned int src_location,
+                unsigned int count);
+
     virtual
     void
     flush(void);
@@ -81,17 +106,18 @@ namespace
     resize_implement(unsigned int new_size);
 
   private:
-
-    typedef fastuidraw::gl::detail::BufferGL<GL_SHADER_STORAGE_BUFFER, GL_STATIC_DRAW> BufferGL;
-    BufferGL m_backing_store;
+    BufferType m_backing_store;
   };
 
+  template<typename BufferType>
   class StoreGL_TextureBuffer:public StoreGL
   {
   public:
-    explicit
     StoreGL_TextureBuffer(unsigned int number, bool delayed);
 
+    StoreGL_TextureBuffer(unsigned int number, unsigned int page_size,
+                          unsigned int max_size, bool delayed);
+
     ~StoreGL_TextureBuffer();
 
     virtual
@@ -99,6 +125,11 @@ namespace
     set_values(unsigned int location,
                fastuidraw::c_array<const fastuidraw::generic_data> pdata);
 
+    virtual
+    enum fastuidraw::return_code
+    copy_values(unsigned int dst_location, unsigned int src_location,
+                unsigned int count);
+
     virtual
     void
     flush(void);
@@ -114,9 +145,7 @@ namespace
     resize_implement(unsigned int new_size);
 
   private:
-
-    typedef fastuidraw::gl::detail::BufferGL<GL_TEXTURE_BUFFER, GL_STATIC_DRAW> BufferGL;
-    BufferGL m_backing_store;
+    BufferType m_backing_store;
     mutable GLuint m_texture, m_texture_fp16;
     mutable bool m_tbo_dirty;
   };
@@ -173,13 +202,17 @@ namespace
       m_number_floats(1024 * 1024),
       m_delayed(false),
       m_type(fastuidraw::glsl::PainterShaderRegistrarGLSL::glyph_data_tbo),
-      m_log2_dims_store(-1, -1)
+      m_log2_dims_store(-1, -1),
+      m_sparse_store(false),
+      m_sparse_store_max_floats(64u << 20u)
     {}
 
     unsigned int m_number_floats;
     bool m_delayed;
     enum fastuidraw::glsl::PainterShaderRegistrarGLSL::glyph_data_backing_t m_type;
     fastuidraw::ivec2 m_log2_dims_store;
+    bool m_sparse_store;
+    unsigned int m_sparse_store_max_floats;
   };
 
   class GlyphAtlasGLPrivate
@@ -324,7 +357,8 @@ set_values(unsigned int location,
 
 ///////////////////////////////////////////////
 // StoreGL_TextureBuffer methods
-StoreGL_TextureBuffer::
+template<typename BufferType>
+StoreGL_TextureBuffer<BufferType>::
 StoreGL_TextureBuffer(unsigned int number, bool delayed):
   StoreGL(number, GL_TEXTURE_BUFFER,
 	  fastuidraw::ivec2(-1, -1), true),
@@ -335,7 +369,23 @@ StoreGL_TextureBuffer(unsigned int number, bool delayed):
 {
 }
 
-StoreGL_TextureBuffer::
+template<typename BufferType>
+StoreGL_TextureBuffer<BufferType>::
+StoreGL_TextureBuffer(unsigned int number, unsigned int page_size,
+                      unsigned int max_size, bool delayed):
+  StoreGL(number, page_size, max_size, GL_TEXTURE_BUFFER,
+	  fastuidraw::ivec2(-1, -1), true),
+  m_backing_store(size() * sizeof(float),
+                  GLsizeiptr(this->max_size()) * sizeof(float),
+                  delayed),
+  m_texture(0),
+  m_texture_fp16(0),
+  m_tbo_dirty(true)
+{
+}
+
+template<typename BufferType>
+StoreGL_TextureBuffer<BufferType>::
 ~StoreGL_TextureBuffer()
 {
   if (m_texture)
@@ -346,8 +396,9 @@ StoreGL_TextureBuffer::
     }
 }
 
+template<typename BufferType>
 void
-StoreGL_TextureBuffer::
+StoreGL_TextureBuffer<BufferType>::
 set_values(unsigned int location,
            fastuidraw::c_array<const fastuidraw::generic_data> pdata)
 {
@@ -355,23 +406,38 @@ set_values(unsigned int location,
                            pdata.reinterpret_pointer<const uint8_t>());
 }
 
+template<typename BufferType>
+enum fastuidraw::return_code
+StoreGL_TextureBuffer<BufferType>::
+copy_values(unsigned int dst_location, unsigned int src_location,
+            unsigned int count)
+{
+  m_backing_store.copy_data(dst_location * sizeof(float),
+                            src_location * sizeof(float),
+                            count * sizeof(float));
+  return fastuidraw::routine_success;
+}
+
+template<typename BufferType>
 void
-StoreGL_TextureBuffer::
+StoreGL_TextureBuffer<BufferType>::
 flush(void)
 {
   m_backing_store.flush();
 }
 
+template<typename BufferType>
 void
-StoreGL_TextureBuffer::
+StoreGL_TextureBuffer<BufferType>::
 resize_implement(unsigned int new_size)
 {
   m_backing_store.resize(new_size * sizeof(float));
   m_tbo_dirty = true;
 }
 
+template<typename BufferType>
 GLuint
-StoreGL_TextureBuffer::
+StoreGL_TextureBuffer<BufferType>::
 gl_backing(enum fastuidraw::gl::GlyphAtlasGL::backing_fmt_t fmt) const
 {
   if (m_texture == 0)
@@ -405,7 +471,8 @@ gl_backing(enum fastuidraw::gl::GlyphAtlasGL::backing_fmt_t fmt) const
 
 ///////////////////////////////////////////////
 // StoreGL_StorageBuffer methods
-StoreGL_StorageBuffer::
+template<typename BufferType>
+StoreGL_StorageBuffer<BufferType>::
 StoreGL_StorageBuffer(unsigned int number, bool delayed):
   StoreGL(number, GL_SHADER_STORAGE_BUFFER,
                   fastuidraw::ivec2(-1, -1), false),
@@ -413,8 +480,21 @@ StoreGL_StorageBuffer(unsigned int number, bool delayed):
 {
 }
 
+template<typename BufferType>
+StoreGL_StorageBuffer<BufferType>::
+StoreGL_StorageBuffer(unsigned int number, unsigned int page_size,
+                      unsigned int max_size, bool delayed):
+  StoreGL(number, page_size, max_size, GL_SHADER_STORAGE_BUFFER,
+          fastuidraw::ivec2(-1, -1), false),
+  m_backing_store(size() * sizeof(float),
+                  GLsizeiptr(this->max_size()) * sizeof(float),
+                  delayed)
+{
+}
+
+template<typename BufferType>
 void
-StoreGL_StorageBuffer::
+StoreGL_StorageBuffer<BufferType>::
 set_values(unsigned int location,
            fastuidraw::c_array<const fastuidraw::generic_data> pdata)
 {
@@ -422,22 +502,37 @@ set_values(unsigned int location,
                            pdata.reinterpret_pointer<const uint8_t>());
 }
 
+template<typename BufferType>
+enum fastuidraw::return_code
+StoreGL_StorageBuffer<BufferType>::
+copy_values(unsigned int dst_location, unsigned int src_location,
+            unsigned int count)
+{
+  m_backing_store.copy_data(dst_location * sizeof(float),
+                            src_location * sizeof(float),
+                            count * sizeof(float));
+  return fastuidraw::routine_success;
+}
+
+template<typename BufferType>
 void
-StoreGL_StorageBuffer::
+StoreGL_StorageBuffer<BufferType>::
 flush(void)
 {
   m_backing_store.flush();
 }
 
+template<typename BufferType>
 void
-StoreGL_StorageBuffer::
+StoreGL_StorageBuffer<BufferType>::
 resize_implement(unsigned int new_size)
 {
   m_backing_store.resize(new_size * sizeof(float));
 }
 
+template<typename BufferType>
 GLuint
-StoreGL_StorageBuffer::
+StoreGL_StorageBuffer<BufferType>::
 gl_backing(enum fastuidraw::gl::GlyphAtlasGL::backing_fmt_t) const
 {
   return m_backing_store.buffer();
@@ -449,21 +544,53 @@ fastuidraw::reference_counted_ptr<fastuidraw::GlyphAtlasBackingStoreBase>
 StoreGL::
 create(const fastuidraw::gl::GlyphAtlasGL::params &P)
 {
-  unsigned int number;
+  using namespace fastuidraw::gl::detail;
+
+  typedef StoreGL_TextureBuffer<BufferGL<GL_TEXTURE_BUFFER, GL_STATIC_DRAW> > TextureBufferStore;
+  typedef StoreGL_TextureBuffer<SparseBufferGL<GL_TEXTURE_BUFFER> > SparseTextureBufferStore;
+  typedef StoreGL_StorageBuffer<BufferGL<GL_SHADER_STORAGE_BUFFER, GL_STATIC_DRAW> > StorageBufferStore;
+  typedef StoreGL_StorageBuffer<SparseBufferGL<GL_SHADER_STORAGE_BUFFER> > SparseStorageBufferStore;
+
+  unsigned int number, page_size(0), max_size(0);
   StoreGL *p(nullptr);
   bool delayed;
 
   number = P.number_floats();
   delayed = P.delayed();
 
+  if (P.sparse_store()
+      && P.glyph_data_backing_store_type() != fastuidraw::glsl::PainterShaderRegistrarGLSL::glyph_data_texture_array)
+    {
+      GLint page_bytes, max_floats;
+
+      page_bytes = sparse_buffer_page_size();
+      max_floats = (P.glyph_data_backing_store_type() == fastuidraw::glsl::PainterShaderRegistrarGLSL::glyph_data_tbo) ?
+        fastuidraw::gl::context_get<GLint>(GL_MAX_TEXTURE_BUFFER_SIZE) :
+        fastuidraw::gl::context_get<GLint>(GL_MAX_SHADER_STORAGE_BLOCK_SIZE) / sizeof(float);
+
+      if (page_bytes > 0 && page_bytes % sizeof(float) == 0)
+        {
+          page_size = page_bytes / sizeof(float);
+          max_size = fastuidraw::t_min(static_cast<unsigned int>(max_floats), P.sparse_store_max_floats());
+          if (max_size < page_size)
+            {
+              page_size = 0;
+            }
+        }
+    }
+
   switch(P.glyph_data_backing_store_type())
     {
     case fastuidraw::glsl::PainterShaderRegistrarGLSL::glyph_data_tbo:
-      p = FASTUIDRAWnew StoreGL_TextureBuffer(number, delayed);
+      p = (page_size != 0) ?
+        static_cast<StoreGL*>(FASTUIDRAWnew SparseTextureBufferStore(number, page_size, max_size, delayed)) :
+        static_cast<StoreGL*>(FASTUIDRAWnew TextureBufferStore(number, delayed));
       break;
 
     case fastuidraw::glsl::PainterShaderRegistrarGLSL::glyph_data_ssbo:
-      p = FASTUIDRAWnew StoreGL_StorageBuffer(number, delayed);
+      p = (page_size != 0) ?
+        static_cast<StoreGL*>(FASTUIDRAWnew SparseStorageBufferStore(number, page_size, max_size, delayed)) :
+        static_cast<StoreGL*>(FASTUIDRAWnew StorageBufferStore(number, delayed));
       break;
 
     case fastuidraw::glsl::PainterShaderRegistrarGLSL::glyph_data_texture_array:
@@ -572,12 +699,14 @@ use_optimal_store_backing(void)
     {
       d->m_type = glsl::PainterShaderRegistrarGLSL::glyph_data_ssbo;
       d->m_log2_dims_store = ivec2(-1, -1);
+      d->m_sparse_store = (detail::sparse_buffer_page_size() > 0);
     }
   else if (detail::compute_tex_buffer_support() != detail::tex_buffer_not_supported
            && context_get<int>(GL_MAX_TEXTURE_BUFFER_SIZE) >= required_max_size)
     {
       d->m_type = glsl::PainterShaderRegistrarGLSL::glyph_data_tbo;
       d->m_log2_dims_store = ivec2(-1, -1);
+      d->m_sparse_store = (detail::sparse_buffer_page_size() > 0);
     }
   else
     {
@@ -614,6 +743,12 @@ setget_implement(fastuidraw::gl::GlyphAtlasGL::params,
 setget_implement(fastuidraw::gl::GlyphAtlasGL::params,
                  GlyphAtlasGLParamsPrivate,
                  bool, delayed);
+setget_implement(fastuidraw::gl::GlyphAtlasGL::params,
+                 GlyphAtlasGLParamsPrivate,
+                 bool, sparse_store);
+setget_implement(fastuidraw::gl::GlyphAtlasGL::params,
+                 GlyphAtlasGLParamsPrivate,
+                 unsigned int, sparse_store_max_floats);
 
 //////////////////////////////////////////////////////////////////
 // fastuidraw::gl::GlyphAtlasGL methods
@@ -27,8 +27,37 @@ namespace fastuidraw { namespace gl { namespace detail {
 class BufferGLEntryLocation
 {
 public:
+  BufferGLEntryLocation(void):
+    m_location(0),
+    m_copy_location(-1),
+    m_copy_size(0)
+  {}
+
+  /* Execute the entry on the buffer bound to binding_point */
+  void
+  execute(GLenum binding_point) const
+  {
+    if (m_copy_location >= 0)
+      {
+        FASTUIDRAWassert(m_copy_size > 0);
+        fastuidraw_glCopyBufferSubData(binding_point, binding_point,
+                                       m_copy_location, m_location, m_copy_size);
+      }
+    else
+      {
+        FASTUIDRAWassert(!m_data.empty());
+        fastuidraw_glBufferSubData(binding_point, m_location, m_data.size(), &m_data[0]);
+      }
+  }
+
   int m_location;
   std::vector<uint8_t> m_data;
+
+  /* if non-negative, the entry copies m_copy_size bytes
+   * of the buffer from m_copy_location to m_location
+   * instead of setting m_data.
+   */
+  int m_copy_location, m_copy_size;
 };
 
 /*!\class BufferGL
@@ -109,6 +138,29 @@ public:
       }
   }
 
+  /* Copy data within the buffer, the source and
+   * destination ranges may not overlap.
+   */
+  void
+  copy_data(int dst_offset, int src_offset, int size)
+  {
+    FASTUIDRAWassert(size > 0);
+    if (m_delayed)
+      {
+        m_unflushed_commands.push_back(BufferGLEntryLocation());
+        m_unflushed_commands.back().m_location = dst_offset;
+        m_unflushed_commands.back().m_copy_location = src_offset;
+        m_unflushed_commands.back().m_copy_size = size;
+      }
+    else
+      {
+        flush_size_change();
+        fastuidraw_glBindBuffer(binding_point, m_buffer);
+        fastuidraw_glCopyBufferSubData(binding_point, binding_point,
+                                       src_offset, dst_offset, size);
+      }
+  }
+
   void
   flush(void)
   {
@@ -121,10 +173,9 @@ public:
     if (!m_unflushed_commands.empty())
       {
         fastuidraw_glBindBuffer(binding_point, m_buffer);
-        for(BufferGLEntryLocation &B : m_unflushed_commands)
+        for(const BufferGLEntryLocation &B : m_unflushed_commands)
           {
-            FASTUIDRAWassert(!B.m_data.empty());
-            fastuidraw_glBufferSubData(binding_point, B.m_location, B.m_data.size(), &B.m_data[0]);
+            B.execute(binding_point);
           }
         m_unflushed_commands.clear();
       }
@@ -0,0 +1,228 @@
+/*!
+ * \file sparse_buffer_gl.hpp
+ * \brief file sparse_buffer_gl.hpp
+ *
+ * Copyright 2019 by Intel.
+ *
+ * Contact: kevin.rogovin@intel.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@intel.com>
+ *
+ */
+
+#pragma once
+
+#include <list>
+#include <vector>
+#include <fastuidraw/gl_backend/ngl_header.hpp>
+#include <fastuidraw/gl_backend/gl_get.hpp>
+#include <fastuidraw/gl_backend/gl_context_properties.hpp>
+#include "buffer_object_gl.hpp"
+
+namespace fastuidraw { namespace gl { namespace detail {
+
+/* Returns the page size in bytes of sparse buffers (GL_ARB_sparse_buffer)
+ * or 0 if sparse buffers are not supported; a GL context must be current.
+ */
+inline
+GLint
+sparse_buffer_page_size(void)
+{
+  #ifdef FASTUIDRAW_GL_USE_GLES
+    {
+      return 0;
+    }
+  #else
+    {
+      ContextProperties ctx;
+
+      if (!ctx.has_extension("GL_ARB_sparse_buffer")
+          || (ctx.version() < ivec2(4, 4) && !ctx.has_extension("GL_ARB_buffer_storage")))
+        {
+          return 0;
+        }
+      return context_get<GLint>(GL_SPARSE_BUFFER_PAGE_SIZE_ARB);
+    }
+  #endif
+}
+
+/*!\class SparseBufferGL
+ * A SparseBufferGL has the same interface as BufferGL, but its
+ * buffer object is created with GL_SPARSE_STORAGE_BIT_ARB with a
+ * fixed virtual size; resizing commits the pages of the added range
+ * instead of creating a new buffer object and copying the contents
+ * to it. Thus growing the buffer is cheap, does not move the data
+ * and does not need memory for two copies of the data. The sizes
+ * passed to the ctor and resize() must be multiples of the page
+ * size given by sparse_buffer_page_size().
+ * \tparam binding_point GL binding point (ala glBindBuffer) to use for GL
+ *                       operations
+ */
+template<GLenum binding_point>
+class SparseBufferGL
+{
+public:
+  SparseBufferGL(GLsizei psize, GLsizeiptr preserved_size, bool delayed):
+    m_size(psize),
+    m_committed_size(0),
+    m_reserved_size(preserved_size),
+    m_delayed(delayed),
+    m_buffer(0)
+  {
+    FASTUIDRAWassert(m_size > 0);
+    FASTUIDRAWassert(m_size <= m_reserved_size);
+    if (!m_delayed)
+      {
+        create_buffer();
+        commit_pages();
+      }
+  }
+
+  ~SparseBufferGL()
+  {
+    if (m_buffer != 0)
+      {
+        fastuidraw_glBindBuffer(binding_point, 0);
+        fastuidraw_glDeleteBuffers(1, &m_buffer);
+        m_buffer = 0;
+      }
+  }
+
+  void
+  set_data(int offset, c_array<const uint8_t> data)
+  {
+    FASTUIDRAWassert(!data.empty());
+    FASTUIDRAWassert(offset + data.size() <= static_cast<unsigned int>(m_size));
+    if (m_delayed)
+      {
+        m_unflushed_commands.push_back(BufferGLEntryLocation());
+        m_unflushed_commands.back().m_location = offset;
+        m_unflushed_commands.back().m_data.resize(data.size());
+        std::copy(data.begin(), data.end(), m_unflushed_commands.back().m_data.begin());
+      }
+    else
+      {
+        commit_pages();
+        fastuidraw_glBindBuffer(binding_point, m_buffer);
+        fastuidraw_glBufferSubData(binding_point, offset, data.size(), &data[0]);
+      }
+  }
+
+  /* Copy data within the buffer, the source and
+   * destination ranges may not overlap.
+   */
+  void
+  copy_data(int dst_offset, int src_offset, int size)
+  {
+    FASTUIDRAWassert(size > 0);
+    FASTUIDRAWassert(dst_offset + size <= m_size);
+    FASTUIDRAWassert(src_offset + size <= m_size);
+    if (m_delayed)
+      {
+        m_unflushed_commands.push_back(BufferGLEntryLocation());
+        m_unflushed_commands.back().m_location = dst_offset;
+        m_unflushed_commands.back().m_copy_location = src_offset;
+        m_unflushed_commands.back().m_copy_size = size;
+      }
+    else
+      {
+        commit_pages();
+        fastuidraw_glBindBuffer(binding_point, m_buffer);
+        fastuidraw_glCopyBufferSubData(binding_point, binding_point,
+                                       src_offset, dst_offset, size);
+      }
+  }
+
+  void
+  flush(void)
+  {
+    if (m_buffer == 0)
+      {
+        create_buffer();
+      }
+    commit_pages();
+
+    if (!m_unflushed_commands.empty())
+      {
+        fastuidraw_glBindBuffer(binding_point, m_buffer);
+        for(const BufferGLEntryLocation &B : m_unflushed_commands)
+          {
+            B.execute(binding_point);
+          }
+        m_unflushed_commands.clear();
+      }
+  }
+
+  GLuint
+  buffer(void) const
+  {
+    FASTUIDRAWassert(m_buffer != 0);
+    return m_buffer;
+  }
+
+  GLsizei
+  size(void) const
+  {
+    return m_size;
+  }
+
+  void
+  resize(GLsizei new_size)
+  {
+    FASTUIDRAWassert(new_size <= m_reserved_size);
+    m_size = new_size;
+  }
+
+private:
+  void
+  create_buffer(void)
+  {
+    #ifndef FASTUIDRAW_GL_USE_GLES
+      {
+        FASTUIDRAWassert(m_buffer == 0);
+        fastuidraw_glGenBuffers(1, &m_buffer);
+        FASTUIDRAWassert(m_buffer != 0);
+        fastuidraw_glBindBuffer(binding_point, m_buffer);
+        fastuidraw_glBufferStorage(binding_point, m_reserved_size, nullptr,
+                                   GL_DYNAMIC_STORAGE_BIT | GL_SPARSE_STORAGE_BIT_ARB);
+        m_committed_size = 0;
+      }
+    #else
+      {
+        FASTUIDRAWassert(!"SparseBufferGL not supported in GLES");
+      }
+    #endif
+  }
+
+  void
+  commit_pages(void)
+  {
+    #ifndef FASTUIDRAW_GL_USE_GLES
+      {
+        if (m_committed_size < m_size)
+          {
+            fastuidraw_glBindBuffer(binding_point, m_buffer);
+            fastuidraw_glBufferPageCommitmentARB(binding_point, m_committed_size,
+                                                 m_size - m_committed_size, GL_TRUE);
+            m_committed_size = m_size;
+          }
+      }
+    #endif
+  }
+
+  GLsizei m_size, m_committed_size;
+  GLsizeiptr m_reserved_size;
+  bool m_delayed;
+  GLuint m_buffer;
+  std::list<BufferGLEntryLocation> m_unflushed_commands;
+};
+
+} //namespace detail
+} //namespace gl
+} //namespace fastuidraw
@@ -679,6 +679,12 @@ create_glyph_shader(void)
                                      "fastuidraw_painter_glyph_banded_rays.frag.glsl.resource_string",
                                      banded_rays_varyings));
 
+  return_value
+    .shader(msdf_glyph,
+            create_glyph_item_shader("fastuidraw_painter_glyph_coverage_distance_field.vert.glsl.resource_string",
+                                     "fastuidraw_painter_glyph_msdf.frag.glsl.resource_string",
+                                     distance_varyings));
+
   return return_value;
 }
 
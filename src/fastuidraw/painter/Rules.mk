@@ -25,6 +25,7 @@ FASTUIDRAW_SOURCES += $(call filelist, fill_rule.cpp \
 	stroked_caps_joins.cpp stroked_point.cpp \
 	stroked_path.cpp filled_path.cpp \
 	glyph_sequence.cpp glyph_run.cpp \
+	text_run_cache.cpp \
 	arc_stroked_point.cpp \
 	shader_filled_path.cpp)
 
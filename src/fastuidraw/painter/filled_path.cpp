@@ -1299,20 +1299,20 @@ copy_contour(SubContour &dst,
 {
   for(unsigned int e = 0, ende = src.number_edges(C); e < ende; ++e)
     {
-      fastuidraw::range_type<unsigned int> R;
+      fastuidraw::c_array<const fastuidraw::TessellatedPath::segment> segs;
       uint32_t flags;
 
-      R = src.edge_range(C, e);
+      segs = src.edge_segment_data(C, e);
       flags = (src.edge_type(C, e) == fastuidraw::PathEnums::starts_new_edge) ?
         uint32_t(SubContourPoint::is_path_join) :
         0u;
 
-      FASTUIDRAWassert(src.segment_data()[R.m_begin].m_type == fastuidraw::TessellatedPath::line_segment);
-      dst.push_back(SubContourPoint(src.segment_data()[R.m_begin].m_start_pt, flags));
-      for(unsigned int v = R.m_begin + 1; v < R.m_end; ++v)
+      FASTUIDRAWassert(segs.front().m_type == fastuidraw::TessellatedPath::line_segment);
+      dst.push_back(SubContourPoint(segs.front().m_start_pt, flags));
+      for(unsigned int v = 1; v < segs.size(); ++v)
         {
-          FASTUIDRAWassert(src.segment_data()[v].m_type == fastuidraw::TessellatedPath::line_segment);
-          SubContourPoint pt(src.segment_data()[v].m_start_pt, 0u);
+          FASTUIDRAWassert(segs[v].m_type == fastuidraw::TessellatedPath::line_segment);
+          SubContourPoint pt(segs[v].m_start_pt, 0u);
           dst.push_back(pt);
         }
     }
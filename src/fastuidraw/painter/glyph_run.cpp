@@ -21,27 +21,72 @@
 #include <map>
 #include <algorithm>
 #include "../private/util_private.hpp"
+#include "../private/bounding_box.hpp"
+#include "../private/clip.hpp"
 
 namespace
 {
+  enum
+    {
+      /* number of glyphs of a block; a block is the unit
+       * of culling and of packing attribute data.
+       */
+      glyphs_per_block_log2 = 6,
+      glyphs_per_block = 1u << glyphs_per_block_log2,
+    };
+
+  class ScratchSpacePrivate
+  {
+  public:
+    std::vector<fastuidraw::vec3> m_adjusted_clip_eqs;
+    std::vector<fastuidraw::vec2> m_clipped_rect;
+
+    fastuidraw::vecN<std::vector<fastuidraw::vec2>, 2> m_clip_scratch_vec2s;
+  };
+
   class GlyphRunPrivate;
 
   class PerGlyphRender
   {
   public:
+    PerGlyphRender(void):
+      m_number_blocks_ready(0),
+      m_use_epoch(~0u)
+    {}
+
+    /* make ready the attribute and index data of those
+     * blocks that intersect any of the glyph ranges; the
+     * glyphs of all such blocks are fetched in one batch.
+     */
     void
-    set_values(GlyphRunPrivate *p,
-               fastuidraw::GlyphRenderer renderer);
+    ready_blocks(GlyphRunPrivate *p,
+                 fastuidraw::GlyphRenderer renderer,
+                 fastuidraw::c_array<const fastuidraw::range_type<unsigned int> > glyph_ranges);
 
     std::vector<fastuidraw::PainterAttribute> m_attribs;
     std::vector<fastuidraw::PainterIndex> m_indices;
+
+    /* m_block_ready[B] is true if the attribute and
+     * index data of the glyphs of block B is packed.
+     */
+    std::vector<bool> m_block_ready;
+    unsigned int m_number_blocks_ready;
+
+    /* the glyphs of the blocks that are packed; they are
+     * marked as used (see GlyphCache::mark_glyphs_used())
+     * once per epoch of the GlyphCache, m_use_epoch is the
+     * value of GlyphCache::epoch() when last marked.
+     */
+    std::vector<fastuidraw::Glyph> m_glyphs;
+    unsigned int m_use_epoch;
   };
 
   class SubSequence:public fastuidraw::PainterAttributeWriter
   {
   public:
+    /* each range of m_ranges is an attribute and index chunk */
     void
-    set_src(const PerGlyphRender *data, unsigned int begin, unsigned int cnt);
+    set_src(const PerGlyphRender *data);
 
     virtual
     unsigned int
@@ -74,9 +119,11 @@ namespace
     write_attributes(fastuidraw::c_array<fastuidraw::PainterAttribute> dst,
                      unsigned int attribute_chunk) const;
 
+    /* ranges of glyphs to write, in increasing order */
+    std::vector<fastuidraw::range_type<unsigned int> > m_ranges;
+
   private:
-    fastuidraw::c_array<const fastuidraw::PainterIndex> m_indices;
-    fastuidraw::c_array<const fastuidraw::PainterAttribute> m_attributes;
+    const PerGlyphRender *m_data;
   };
 
   class GlyphLocation
@@ -98,6 +145,7 @@ namespace
       m_orientation(orientation),
       m_layout(layout),
       m_cache(cache),
+      m_block_tree_ready(true),
       m_atlas_clear_count(0)
     {
       FASTUIDRAWassert(cache);
@@ -142,9 +190,28 @@ namespace
                fastuidraw::c_array<const T> sources,
                fastuidraw::c_array<const fastuidraw::vec2> positions);
 
+    /* returns the render data of a renderer with the blocks
+     * intersecting m_subsequence.m_ranges made ready.
+     */
     const PerGlyphRender*
     fetch_render_data(const fastuidraw::GlyphRenderer &renderer);
 
+    /* set m_subsequence.m_ranges as the glyphs of the
+     * range [begin, end) that are in blocks that intersect
+     * the region of the clip equations.
+     */
+    void
+    select_ranges(ScratchSpacePrivate &scratch,
+                  fastuidraw::c_array<const fastuidraw::vec3> clip_equations,
+                  const fastuidraw::float3x3 &clip_matrix_local,
+                  unsigned int begin, unsigned int end);
+
+    unsigned int
+    number_blocks(void) const
+    {
+      return m_block_tree.empty() ? 0u : m_block_tree[0].size();
+    }
+
     float m_pixel_size;
     enum fastuidraw::PainterEnums::screen_orientation m_orientation;
     enum fastuidraw::PainterEnums::glyph_layout_type m_layout;
@@ -154,7 +221,29 @@ namespace
     std::vector<GlyphLocation> m_glyph_locations;
     std::vector<fastuidraw::GlyphMetrics> m_glyphs;
     std::map<fastuidraw::GlyphRenderer, PerGlyphRender> m_data;
+
+    /* Implicit tree of bounding boxes: m_block_tree[0][B] is
+     * the bounding box of the glyphs of block B and
+     * m_block_tree[L][I] is the union of m_block_tree[L - 1][2 * I]
+     * and m_block_tree[L - 1][2 * I + 1]. The levels L > 0 are
+     * rebuilt lazily when m_block_tree_ready is false.
+     */
+    std::vector<std::vector<fastuidraw::BoundingBox<float> > > m_block_tree;
+    bool m_block_tree_ready;
+
     unsigned int m_atlas_clear_count;
+
+  private:
+    void
+    build_block_tree(void);
+
+    void
+    add_range(unsigned int begin, unsigned int end);
+
+    void
+    select_implement(ScratchSpacePrivate &scratch,
+                     unsigned int level, unsigned int node,
+                     unsigned int begin, unsigned int end);
   };
 
 }
@@ -163,93 +252,153 @@ namespace
 // SubSequence methods
 void
 SubSequence::
-set_src(const PerGlyphRender *data, unsigned int begin, unsigned int cnt)
+set_src(const PerGlyphRender *data)
 {
-  m_indices = fastuidraw::make_c_array(data->m_indices).sub_array(6 * begin, 6 * cnt);
-  m_attributes = fastuidraw::make_c_array(data->m_attribs).sub_array(4 * begin, 4 * cnt);
+  m_data = data;
 }
 
 unsigned int
 SubSequence::
 number_attribute_chunks(void) const
 {
-  return 1;
+  return m_ranges.size();
 }
 
 unsigned int
 SubSequence::
-number_attributes(unsigned int) const
+number_attributes(unsigned int chunk) const
 {
-  return m_attributes.size();
+  return 4 * m_ranges[chunk].difference();
 }
 
 unsigned int
 SubSequence::
 number_index_chunks(void) const
 {
-  return 1;
+  return m_ranges.size();
 }
 
 unsigned int
 SubSequence::
-number_indices(unsigned int) const
+number_indices(unsigned int chunk) const
 {
-  return m_indices.size();
+  return 6 * m_ranges[chunk].difference();
 }
 
 unsigned int
 SubSequence::
-attribute_chunk_selection(unsigned int) const
+attribute_chunk_selection(unsigned int chunk) const
 {
-  return 0;
+  return chunk;
 }
 
 void
 SubSequence::
 write_indices(fastuidraw::c_array<fastuidraw::PainterIndex> dst,
               unsigned int index_offset_value,
-              unsigned int) const
+              unsigned int chunk) const
 {
+  fastuidraw::c_array<const fastuidraw::PainterIndex> src;
+  unsigned int begin(m_ranges[chunk].m_begin);
+
+  /* the index values of the glyphs are relative to the
+   * start of all of the attributes, but the chunk starts
+   * at the attributes of its first glyph.
+   */
+  src = fastuidraw::make_c_array(m_data->m_indices).sub_array(6 * begin, dst.size());
+  index_offset_value -= 4 * begin;
   for (unsigned int i = 0; i < dst.size(); ++i)
     {
-      dst[i] = index_offset_value + m_indices[i];
+      dst[i] = index_offset_value + src[i];
     }
 }
 
 void
 SubSequence::
 write_attributes(fastuidraw::c_array<fastuidraw::PainterAttribute> dst,
-                 unsigned int) const
+                 unsigned int chunk) const
 {
-  std::copy(m_attributes.begin(), m_attributes.end(), dst.begin());
+  fastuidraw::c_array<const fastuidraw::PainterAttribute> src;
+
+  src = fastuidraw::make_c_array(m_data->m_attribs).sub_array(4 * m_ranges[chunk].m_begin, dst.size());
+  std::copy(src.begin(), src.end(), dst.begin());
 }
 
 //////////////////////////////////////////
 // PerGlyphRender methods
 void
 PerGlyphRender::
-set_values(GlyphRunPrivate *p,
-           fastuidraw::GlyphRenderer renderer)
+ready_blocks(GlyphRunPrivate *p,
+             fastuidraw::GlyphRenderer renderer,
+             fastuidraw::c_array<const fastuidraw::range_type<unsigned int> > glyph_ranges)
 {
   using namespace fastuidraw;
 
   unsigned int num(p->m_glyph_locations.size());
-  std::vector<Glyph> tmp_glyphs(num);
-  c_array<const GlyphMetrics> glyph_metrics(make_c_array(p->m_glyphs));
-  c_array<Glyph> glyphs(make_c_array(tmp_glyphs));
+  unsigned int num_blocks(p->number_blocks());
+  std::vector<range_type<unsigned int> > to_pack;
+  std::vector<GlyphMetrics> tmp_metrics;
+  std::vector<Glyph> tmp_glyphs;
+  unsigned int g;
+
+  if (m_block_ready.size() != num_blocks)
+    {
+      m_attribs.resize(4 * num);
+      m_indices.resize(6 * num);
+      m_glyphs.resize(num);
+      m_block_ready.resize(num_blocks, false);
+    }
+
+  if (m_number_blocks_ready == num_blocks)
+    {
+      return;
+    }
+
+  for (const range_type<unsigned int> &R : glyph_ranges)
+    {
+      unsigned int b, e;
 
-  m_attribs.resize(4 * num);
-  m_indices.resize(6 * num);
-  p->m_cache->fetch_glyphs(renderer, glyph_metrics, glyphs, true);
+      b = R.m_begin >> glyphs_per_block_log2;
+      e = (R.m_end + glyphs_per_block - 1u) >> glyphs_per_block_log2;
+      for (unsigned int B = b; B < e; ++B)
+        {
+          if (!m_block_ready[B])
+            {
+              m_block_ready[B] = true;
+              ++m_number_blocks_ready;
+              to_pack.push_back(range_type<unsigned int>(B * glyphs_per_block,
+                                                         t_min(num, (B + 1u) * glyphs_per_block)));
+              for (unsigned int i = to_pack.back().m_begin; i < to_pack.back().m_end; ++i)
+                {
+                  tmp_metrics.push_back(p->m_glyphs[i]);
+                }
+            }
+        }
+    }
+
+  if (to_pack.empty())
+    {
+      return;
+    }
+
+  c_array<const GlyphMetrics> metrics(make_c_array(tmp_metrics));
+
+  tmp_glyphs.resize(tmp_metrics.size());
+  p->m_cache->fetch_glyphs(renderer, metrics, make_c_array(tmp_glyphs), true);
 
-  for (unsigned int g = 0; g < num; ++g)
+  g = 0;
+  for (const range_type<unsigned int> &R : to_pack)
     {
-      glyphs[g].pack_glyph(4 * g, fastuidraw::make_c_array(m_attribs),
-                           6 * g, fastuidraw::make_c_array(m_indices),
-                           p->m_glyph_locations[g].m_position,
-                           p->m_glyph_locations[g].m_scale,
-                           p->m_orientation,
-                           p->m_layout);
+      for (unsigned int i = R.m_begin; i < R.m_end; ++i, ++g)
+        {
+          m_glyphs[i] = tmp_glyphs[g];
+          tmp_glyphs[g].pack_glyph(4 * i, make_c_array(m_attribs),
+                                   6 * i, make_c_array(m_indices),
+                                   p->m_glyph_locations[i].m_position,
+                                   p->m_glyph_locations[i].m_scale,
+                                   p->m_orientation,
+                                   p->m_layout);
+        }
     }
 }
 
@@ -271,6 +420,13 @@ add_glyphs(const fastuidraw::FontBase *font,
   dst_glyphs = fastuidraw::make_c_array(m_glyphs).sub_array(old_sz);
   this->grab_metrics(font, sources, dst_glyphs);
 
+  if (m_block_tree.empty())
+    {
+      m_block_tree.resize(1);
+    }
+  m_block_tree[0].resize((m_glyphs.size() + glyphs_per_block - 1u) >> glyphs_per_block_log2);
+  m_block_tree_ready = false;
+
   for (unsigned int i = 0; i < positions.size(); ++i)
     {
       GlyphLocation L;
@@ -278,7 +434,32 @@ add_glyphs(const fastuidraw::FontBase *font,
       L.m_position = positions[i];
       if (dst_glyphs[i].valid())
         {
-          L.m_scale = m_pixel_size / dst_glyphs[i].units_per_EM();
+          fastuidraw::GlyphMetrics M(dst_glyphs[i]);
+          fastuidraw::vec2 p_bl, p_tr, lo, glyph_size;
+
+          L.m_scale = m_pixel_size / M.units_per_EM();
+          glyph_size = L.m_scale * M.size();
+          lo = (m_layout == fastuidraw::PainterEnums::glyph_layout_horizontal) ?
+            M.horizontal_layout_offset() :
+            M.vertical_layout_offset();
+
+          if (m_orientation == fastuidraw::PainterEnums::y_increases_downwards)
+            {
+              p_bl.x() = L.m_scale * lo.x();
+              p_tr.x() = p_bl.x() + glyph_size.x();
+
+              p_bl.y() = -L.m_scale * lo.y();
+              p_tr.y() = p_bl.y() - glyph_size.y();
+            }
+          else
+            {
+              p_bl = L.m_scale * lo;
+              p_tr = p_bl + glyph_size;
+            }
+
+          fastuidraw::BoundingBox<float> &bb(m_block_tree[0][(old_sz + i) >> glyphs_per_block_log2]);
+          bb.union_point(positions[i] + p_bl);
+          bb.union_point(positions[i] + p_tr);
         }
       else
         {
@@ -289,33 +470,176 @@ add_glyphs(const fastuidraw::FontBase *font,
   m_data.clear();
 }
 
-const PerGlyphRender*
+void
 GlyphRunPrivate::
-fetch_render_data(const fastuidraw::GlyphRenderer &renderer)
+build_block_tree(void)
+{
+  if (m_block_tree_ready)
+    {
+      return;
+    }
+
+  m_block_tree.resize(1);
+  while (m_block_tree.back().size() > 1)
+    {
+      unsigned int L(m_block_tree.size());
+      unsigned int sz(m_block_tree[L - 1].size());
+
+      m_block_tree.push_back(std::vector<fastuidraw::BoundingBox<float> >((sz + 1u) / 2u));
+      for (unsigned int i = 0; i < sz; ++i)
+        {
+          m_block_tree[L][i / 2u].union_box(m_block_tree[L - 1][i]);
+        }
+    }
+  m_block_tree_ready = true;
+}
+
+void
+GlyphRunPrivate::
+add_range(unsigned int begin, unsigned int end)
+{
+  std::vector<fastuidraw::range_type<unsigned int> > &ranges(m_subsequence.m_ranges);
+
+  if (begin >= end)
+    {
+      return;
+    }
+
+  if (!ranges.empty() && ranges.back().m_end == begin)
+    {
+      ranges.back().m_end = end;
+    }
+  else
+    {
+      ranges.push_back(fastuidraw::range_type<unsigned int>(begin, end));
+    }
+}
+
+void
+GlyphRunPrivate::
+select_ranges(ScratchSpacePrivate &scratch,
+              fastuidraw::c_array<const fastuidraw::vec3> clip_equations,
+              const fastuidraw::float3x3 &clip_matrix_local,
+              unsigned int begin, unsigned int end)
+{
+  m_subsequence.m_ranges.clear();
+  if (begin >= end)
+    {
+      return;
+    }
+
+  build_block_tree();
+  scratch.m_adjusted_clip_eqs.resize(clip_equations.size());
+  for(unsigned int i = 0; i < clip_equations.size(); ++i)
+    {
+      /* transform clip equations from clip coordinates to
+       * local coordinates.
+       */
+      scratch.m_adjusted_clip_eqs[i] = clip_equations[i] * clip_matrix_local;
+    }
+  select_implement(scratch, m_block_tree.size() - 1u, 0u, begin, end);
+}
+
+void
+GlyphRunPrivate::
+select_implement(ScratchSpacePrivate &scratch,
+                 unsigned int level, unsigned int node,
+                 unsigned int begin, unsigned int end)
 {
-  const PerGlyphRender *data;
-  std::map<fastuidraw::GlyphRenderer, PerGlyphRender>::const_iterator iter;
+  using namespace fastuidraw;
+  using namespace fastuidraw::detail;
+
+  const BoundingBox<float> &box(m_block_tree[level][node]);
+  unsigned int shift(level + glyphs_per_block_log2);
+  unsigned int node_begin, node_end;
+  vecN<vec2, 4> bb;
+  bool unclipped;
+
+  node_begin = t_max(begin, node << shift);
+  node_end = t_min(end, (node + 1u) << shift);
+  if (node_begin >= node_end || box.empty())
+    {
+      return;
+    }
+
+  box.inflated_polygon(bb, 0.0f);
+  unclipped = clip_against_planes(make_c_array(scratch.m_adjusted_clip_eqs),
+                                  bb, scratch.m_clipped_rect,
+                                  scratch.m_clip_scratch_vec2s);
+
+  //completely clipped
+  if (scratch.m_clipped_rect.empty())
+    {
+      return;
+    }
+
+  if (unclipped || level == 0)
+    {
+      add_range(node_begin, node_end);
+      return;
+    }
 
-  if (!m_data.empty() && m_atlas_clear_count != m_cache->number_times_atlas_cleared())
+  for (unsigned int c = 2u * node, ce = t_min(c + 2u, unsigned(m_block_tree[level - 1].size())); c < ce; ++c)
     {
-      m_atlas_clear_count = m_cache->number_times_atlas_cleared();
-      m_data.clear();
+      select_implement(scratch, level - 1, c, begin, end);
     }
+}
+
+const PerGlyphRender*
+GlyphRunPrivate::
+fetch_render_data(const fastuidraw::GlyphRenderer &renderer)
+{
+  PerGlyphRender *data;
 
-  iter = m_data.find(renderer);
-  if (iter == m_data.end())
+  /* packing blocks can evict from the atlas the glyphs of
+   * blocks packed by an earlier call, which makes the data
+   * of all blocks stale; in that case repack.
+   */
+  do
     {
+      if (m_atlas_clear_count != m_cache->number_times_atlas_cleared())
+        {
+          m_atlas_clear_count = m_cache->number_times_atlas_cleared();
+          m_data.clear();
+        }
+
       PerGlyphRender &p(m_data[renderer]);
-      p.set_values(this, renderer);
+      p.ready_blocks(this, renderer, make_c_array(m_subsequence.m_ranges));
       data = &p;
     }
-  else
+  while (m_atlas_clear_count != m_cache->number_times_atlas_cleared());
+
+  /* the glyphs of blocks packed in an earlier epoch are
+   * drawn without being fetched, thus mark them as used
+   * so that they are not evicted first.
+   */
+  if (data->m_use_epoch != m_cache->epoch())
     {
-      data = &iter->second;
+      data->m_use_epoch = m_cache->epoch();
+      m_cache->mark_glyphs_used(make_c_array(data->m_glyphs));
     }
+
+  m_subsequence.set_src(data);
   return data;
 }
 
+////////////////////////////////////////////////
+// fastuidraw::GlyphRun::ScratchSpace methods
+fastuidraw::GlyphRun::ScratchSpace::
+ScratchSpace(void)
+{
+  m_d = FASTUIDRAWnew ScratchSpacePrivate();
+}
+
+fastuidraw::GlyphRun::ScratchSpace::
+~ScratchSpace()
+{
+  ScratchSpacePrivate *d;
+  d = static_cast<ScratchSpacePrivate*>(m_d);
+  FASTUIDRAWdelete(d);
+  m_d = nullptr;
+}
+
 ////////////////////////////////
 // fastuidraw::GlyphRun methods
 fastuidraw::GlyphRun::
@@ -448,9 +772,32 @@ subsequence(GlyphRenderer renderer, unsigned int begin, unsigned int cnt) const
       cnt = t_min(cnt, max_v - begin);
     }
 
-  const PerGlyphRender *data;
-  data = d->fetch_render_data(renderer);
-  d->m_subsequence.set_src(data, begin, cnt);
+  d->m_subsequence.m_ranges.clear();
+  if (cnt > 0)
+    {
+      d->m_subsequence.m_ranges.push_back(range_type<unsigned int>(begin, begin + cnt));
+    }
+  d->fetch_render_data(renderer);
+
+  return d->m_subsequence;
+}
+
+const fastuidraw::PainterAttributeWriter&
+fastuidraw::GlyphRun::
+subsequence(GlyphRenderer renderer, unsigned int begin, unsigned int cnt,
+            ScratchSpace &scratch_space,
+            c_array<const vec3> clip_equations,
+            const float3x3 &clip_matrix_local) const
+{
+  GlyphRunPrivate *d;
+  d = static_cast<GlyphRunPrivate*>(m_d);
+
+  begin = t_min(begin, number_glyphs());
+  cnt = t_min(cnt, number_glyphs() - begin);
+  d->select_ranges(*static_cast<ScratchSpacePrivate*>(scratch_space.m_d),
+                   clip_equations, clip_matrix_local,
+                   begin, begin + cnt);
+  d->fetch_render_data(renderer);
 
   return d->m_subsequence;
 }
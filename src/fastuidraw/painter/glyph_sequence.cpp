@@ -45,22 +45,51 @@ namespace
   class GlyphAttributesIndices
   {
   public:
-    GlyphAttributesIndices(void)
+    GlyphAttributesIndices(void):
+      m_packed_prefix(1, 0u),
+      m_use_epoch(~0u)
     {}
 
-    GlyphAttributesIndices(const GlyphAttributesIndices &obj)
+    GlyphAttributesIndices(const GlyphAttributesIndices &obj):
+      m_packed_prefix(1, 0u),
+      m_use_epoch(~0u)
     {
       FASTUIDRAWunused(obj);
       FASTUIDRAWassert(m_attribs.empty());
       FASTUIDRAWassert(m_indices.empty());
     }
 
+    /* append the attributes and indices of glyphs that
+     * follow those already packed.
+     */
     void
-    set_values(fastuidraw::c_array<const fastuidraw::Glyph> glyphs,
-	       fastuidraw::c_array<const fastuidraw::vec2> positions,
-	       float render_pixel_size,
-	       enum fastuidraw::PainterEnums::screen_orientation orientation,
-	       enum fastuidraw::PainterEnums::glyph_layout_type layout);
+    add_values(fastuidraw::c_array<const fastuidraw::Glyph> glyphs,
+               fastuidraw::c_array<const fastuidraw::vec2> positions,
+               float render_pixel_size,
+               enum fastuidraw::PainterEnums::screen_orientation orientation,
+               enum fastuidraw::PainterEnums::glyph_layout_type layout);
+
+    /* number of glyphs passed to add_values() */
+    unsigned int
+    number_glyphs(void) const
+    {
+      return m_packed_prefix.size() - 1u;
+    }
+
+    /* keep only the data of the first N glyphs passed
+     * to add_values().
+     */
+    void
+    truncate(unsigned int N)
+    {
+      if (N < number_glyphs())
+        {
+          m_packed_prefix.resize(N + 1u);
+          m_glyphs.resize(N);
+          m_attribs.resize(4u * m_packed_prefix.back());
+          m_indices.resize(6u * m_packed_prefix.back());
+        }
+    }
 
     fastuidraw::c_array<const fastuidraw::PainterAttribute>
     attributes(void) const
@@ -74,9 +103,35 @@ namespace
       return fastuidraw::make_c_array(m_indices);
     }
 
+    /* mark the glyphs passed to add_values() as used, at
+     * most once per epoch of the GlyphCache, since they
+     * are drawn again without being fetched.
+     */
+    void
+    mark_glyphs_used(fastuidraw::GlyphCache &cache)
+    {
+      if (m_use_epoch != cache.epoch())
+        {
+          m_use_epoch = cache.epoch();
+          cache.mark_glyphs_used(fastuidraw::make_c_array(m_glyphs));
+        }
+    }
+
   private:
     std::vector<fastuidraw::PainterAttribute> m_attribs;
     std::vector<fastuidraw::PainterIndex> m_indices;
+
+    /* m_packed_prefix[i] is the number of glyphs amongst
+     * the first i glyphs passed to add_values() that have
+     * attribute data (empty glyphs are skipped).
+     */
+    std::vector<unsigned int> m_packed_prefix;
+
+    /* the glyphs passed to add_values() and the value of
+     * GlyphCache::epoch() when they were last marked as used.
+     */
+    std::vector<fastuidraw::Glyph> m_glyphs;
+    unsigned int m_use_epoch;
   };
 
   class PerAddedGlyph
@@ -109,6 +164,11 @@ namespace
       m_splitting_coordinate(does_not_split)
     {}
 
+    Splitter(enum split_type_t c, float v):
+      m_splitting_coordinate(c),
+      m_splitting_value(v)
+    {}
+
     /* out_values indexed by place_element_t */
     enum split_type_t
     split(const std::vector<unsigned int> &input,
@@ -135,6 +195,16 @@ namespace
     explicit
     GlyphSubsetPrivate(GlyphSequencePrivate *p);
 
+    /* Ctor for a new root of a tree whose old root is
+     * old_root; the new root is split along the coordinate c
+     * at the side of old_root's bounding box given by after
+     * and its other child is an empty subset that covers
+     * region.
+     */
+    GlyphSubsetPrivate(GlyphSubsetPrivate *old_root,
+                       enum Splitter::split_type_t c, bool after,
+                       const fastuidraw::BoundingBox<float> &region);
+
     ~GlyphSubsetPrivate();
 
     bool
@@ -154,6 +224,12 @@ namespace
     void
     add_glyph(const PerAddedGlyph &G);
 
+    /* remove the glyphs whose index is atleast N; only
+     * the subsets that have such glyphs are modified.
+     */
+    void
+    truncate(unsigned int N);
+
     unsigned int
     select(ScratchSpacePrivate &scratch,
 	   fastuidraw::c_array<const fastuidraw::vec3> clip_equations,
@@ -195,6 +271,12 @@ namespace
     void
     add_glyph_when_not_split(const PerAddedGlyph &G);
 
+    /* recompute m_bounding_box and m_end_glyph from the
+     * glyphs of m_glyph_list and the children.
+     */
+    void
+    recompute_bounds(void);
+
     void
     select_implement(ScratchSpacePrivate &scratch,
 		     fastuidraw::c_array<unsigned int> dst,
@@ -204,6 +286,11 @@ namespace
     unsigned int m_gen, m_ID;
     std::vector<unsigned int> m_glyph_list;
     fastuidraw::BoundingBox<float> m_bounding_box;
+
+    /* one more than the largest glyph index of this subset
+     * and its descendants, 0 if there are no glyphs.
+     */
+    unsigned int m_end_glyph;
     std::map<fastuidraw::GlyphRenderer, GlyphAttributesIndices> m_data;
     fastuidraw::Path *m_path;
 
@@ -279,6 +366,9 @@ namespace
     add_glyphs(fastuidraw::c_array<const fastuidraw::GlyphSource> sources,
                fastuidraw::c_array<const fastuidraw::vec2> positions);
 
+    void
+    truncate(unsigned int N);
+
     unsigned int
     give_subset_ID(GlyphSubsetPrivate *p)
     {
@@ -316,10 +406,31 @@ namespace
       return m_root;
     }
 
+    /* Generate, as one batch through GlyphCache::fetch_glyphs(),
+     * the glyphs for the renderer of all added glyphs not yet
+     * generated for the renderer; this way the glyph generation
+     * of a GlyphSequence happens in one (possibly parallel) batch
+     * instead of one subset at a time.
+     */
+    void
+    prepare_glyphs(fastuidraw::GlyphRenderer R);
+
   private:
     void
     make_subsets_ready(void);
 
+    /* add a glyph to the tree of subsets rooted at m_root;
+     * if the glyph is entirely beyond the root along a
+     * coordinate, as when lines of text are appended, the
+     * tree is grown by a new root whose children are the
+     * old root and a subset for a region as large as the
+     * old root beyond it. This keeps appended glyphs from
+     * all landing in one deep leaf and the depth of the tree
+     * logarithmic in the number of appends.
+     */
+    void
+    add_glyph_to_tree(const PerAddedGlyph &G);
+
     float m_pixel_size;
     enum fastuidraw::PainterEnums::screen_orientation m_orientation;
     enum fastuidraw::PainterEnums::glyph_layout_type m_layout;
@@ -328,6 +439,11 @@ namespace
     std::vector<PerAddedGlyph> m_added_glyphs;
     GlyphSubsetPrivate *m_root;
     std::vector<GlyphSubsetPrivate*> m_subsets;
+
+    /* for each renderer, the number of elements of m_added_glyphs
+     * that have been passed to prepare_glyphs()
+     */
+    std::map<fastuidraw::GlyphRenderer, unsigned int> m_number_prepared;
   };
 }
 
@@ -335,7 +451,7 @@ namespace
 // GlyphAttributesIndices methods
 void
 GlyphAttributesIndices::
-set_values(fastuidraw::c_array<const fastuidraw::Glyph> glyphs,
+add_values(fastuidraw::c_array<const fastuidraw::Glyph> glyphs,
            fastuidraw::c_array<const fastuidraw::vec2> positions,
            float render_pixel_size,
            enum fastuidraw::PainterEnums::screen_orientation orientation,
@@ -343,7 +459,7 @@ set_values(fastuidraw::c_array<const fastuidraw::Glyph> glyphs,
 {
   using namespace fastuidraw;
 
-  unsigned int num_attrs(0), num_indices(0);
+  unsigned int num_attrs(m_attribs.size()), num_indices(m_indices.size());
 
   for (Glyph G : glyphs)
     {
@@ -356,10 +472,14 @@ set_values(fastuidraw::c_array<const fastuidraw::Glyph> glyphs,
         }
     }
 
+  unsigned int attr(m_attribs.size()), idx(m_indices.size());
+
   m_attribs.resize(num_attrs);
   m_indices.resize(num_indices);
+  m_packed_prefix.reserve(m_packed_prefix.size() + positions.size());
+  m_glyphs.insert(m_glyphs.end(), glyphs.begin(), glyphs.begin() + positions.size());
 
-  for (unsigned int g = 0, attr = 0, idx = 0; g < positions.size(); ++g)
+  for (unsigned int g = 0; g < positions.size(); ++g)
     {
       Glyph G(glyphs[g]);
 
@@ -378,6 +498,7 @@ set_values(fastuidraw::c_array<const fastuidraw::Glyph> glyphs,
           attr += 4;
           idx += 6;
         }
+      m_packed_prefix.push_back(attr / 4u);
     }
 }
 
@@ -499,6 +620,7 @@ GlyphSubsetPrivate(GlyphSequencePrivate *p):
   m_gen(0),
   m_ID(m_owner->give_subset_ID(this)),
   m_glyph_list(p->number_added_glyphs()),
+  m_end_glyph(p->number_added_glyphs()),
   m_path(nullptr),
   m_child(nullptr, nullptr),
   m_glyph_atlas_clear_count(0)
@@ -523,6 +645,7 @@ GlyphSubsetPrivate(GlyphSubsetPrivate *parent,
   m_gen(1 + parent->m_gen),
   m_ID(m_owner->give_subset_ID(this)),
   m_bounding_box(bb),
+  m_end_glyph(glyph_list.empty() ? 0u : glyph_list.back() + 1u),
   m_path(nullptr),
   m_child(nullptr, nullptr),
   m_glyph_atlas_clear_count(0)
@@ -535,6 +658,31 @@ GlyphSubsetPrivate(GlyphSubsetPrivate *parent,
 }
 
 
+GlyphSubsetPrivate::
+GlyphSubsetPrivate(GlyphSubsetPrivate *old_root,
+                   enum Splitter::split_type_t c, bool after,
+                   const fastuidraw::BoundingBox<float> &region):
+  m_owner(old_root->m_owner),
+  m_gen(0),
+  m_ID(m_owner->give_subset_ID(this)),
+  m_bounding_box(old_root->m_bounding_box),
+  m_end_glyph(old_root->m_end_glyph),
+  m_path(nullptr),
+  m_splitter(c, after ?
+             old_root->m_bounding_box.max_point()[c] :
+             old_root->m_bounding_box.min_point()[c]),
+  m_child(nullptr, nullptr),
+  m_glyph_atlas_clear_count(0)
+{
+  std::vector<unsigned int> empty_list;
+  GlyphSubsetPrivate *s;
+
+  s = FASTUIDRAWnew GlyphSubsetPrivate(this, empty_list, region);
+  m_child[after ? 0 : 1] = old_root;
+  m_child[after ? 1 : 0] = s;
+  m_bounding_box.union_box(region);
+}
+
 GlyphSubsetPrivate::
 ~GlyphSubsetPrivate()
 {
@@ -581,10 +729,14 @@ add_glyph(const PerAddedGlyph &G)
       return;
     }
 
-  if (m_bounding_box.union_box(G.m_bounding_box) && !m_path)
+  if (m_bounding_box.union_box(G.m_bounding_box) && m_path)
     {
       FASTUIDRAWdelete(m_path);
+      m_path = nullptr;
     }
+
+  FASTUIDRAWassert(G.m_index >= m_end_glyph);
+  m_end_glyph = G.m_index + 1u;
   if (is_split())
     {
       add_glyph_when_split(G);
@@ -605,7 +757,10 @@ add_glyph_when_split(const PerAddedGlyph &G)
   P = m_splitter.place_element(G);
   if (P == Splitter::place_in_parent)
     {
-      m_data.clear();
+      /* the glyph is appended to m_glyph_list, thus the
+       * cached attribute data remains valid and the glyph
+       * is packed after the others when next needed.
+       */
       m_glyph_list.push_back(G.m_index);
     }
   else
@@ -620,7 +775,6 @@ add_glyph_when_not_split(const PerAddedGlyph &G)
 {
   FASTUIDRAWassert(!is_split());
 
-  m_data.clear();
   m_glyph_list.push_back(G.m_index);
   if (m_gen < MaxDepth && m_glyph_list.size() > SplittingSize)
     {
@@ -628,6 +782,69 @@ add_glyph_when_not_split(const PerAddedGlyph &G)
     }
 }
 
+void
+GlyphSubsetPrivate::
+truncate(unsigned int N)
+{
+  std::vector<unsigned int>::iterator iter;
+
+  if (m_end_glyph <= N)
+    {
+      return;
+    }
+
+  /* m_glyph_list is sorted, so the removed glyphs are
+   * at its end as are their attributes and indices.
+   */
+  iter = std::lower_bound(m_glyph_list.begin(), m_glyph_list.end(), N);
+  if (iter != m_glyph_list.end())
+    {
+      unsigned int K(iter - m_glyph_list.begin());
+
+      m_glyph_list.resize(K);
+      for (auto &e : m_data)
+        {
+          e.second.truncate(K);
+        }
+    }
+
+  if (is_split())
+    {
+      m_child[0]->truncate(N);
+      m_child[1]->truncate(N);
+    }
+  recompute_bounds();
+}
+
+void
+GlyphSubsetPrivate::
+recompute_bounds(void)
+{
+  fastuidraw::BoundingBox<float> bb;
+
+  m_end_glyph = (m_glyph_list.empty()) ? 0u : m_glyph_list.back() + 1u;
+  for (unsigned int I : m_glyph_list)
+    {
+      bb.union_box(m_owner->added_glyph(I).m_bounding_box);
+    }
+
+  if (is_split())
+    {
+      for (GlyphSubsetPrivate *c : m_child)
+        {
+          bb.union_box(c->m_bounding_box);
+          m_end_glyph = fastuidraw::t_max(m_end_glyph, c->m_end_glyph);
+        }
+    }
+
+  if (m_path)
+    {
+      FASTUIDRAWdelete(m_path);
+      m_path = nullptr;
+    }
+  m_bounding_box = bb;
+}
+
 void
 GlyphSubsetPrivate::
 split(void)
@@ -701,6 +918,12 @@ select_implement(ScratchSpacePrivate &scratch,
   vecN<vec2, 4> bb;
   bool unclipped;
 
+  /* a subset whose glyphs were all removed by truncate() */
+  if (m_bounding_box.empty())
+    {
+      return;
+    }
+
   m_bounding_box.inflated_polygon(bb, 0.0f);
   unclipped = clip_against_planes(make_c_array(scratch.m_adjusted_clip_eqs),
                                   bb, scratch.m_clipped_rect,
@@ -759,46 +982,61 @@ attributes_indices(fastuidraw::GlyphRenderer R)
 {
   using namespace fastuidraw;
 
-  std::map<GlyphRenderer, GlyphAttributesIndices>::const_iterator iter;
-  if (!m_data.empty() && m_glyph_atlas_clear_count != m_owner->cache()->number_times_atlas_cleared())
-    {
-      m_glyph_atlas_clear_count = m_owner->cache()->number_times_atlas_cleared();
-      m_data.clear();
-    }
+  GlyphAttributesIndices *dst;
+  unsigned int begin;
 
-  iter = m_data.find(R);
-  if (iter != m_data.end())
+  do
     {
-      return iter->second;
-    }
+      if (!m_data.empty() && m_glyph_atlas_clear_count != m_owner->cache()->number_times_atlas_cleared())
+        {
+          m_glyph_atlas_clear_count = m_owner->cache()->number_times_atlas_cleared();
+          m_data.clear();
+        }
 
-  GlyphAttributesIndices &dst(m_data[R]);
+      /* glyphs appended to m_glyph_list since the data was
+       * last made are packed after the glyphs already packed.
+       */
+      dst = &m_data[R];
+      begin = dst->number_glyphs();
+      if (begin == m_glyph_list.size())
+        {
+          break;
+        }
 
-  std::vector<GlyphMetrics> tmp_metrics_store(m_glyph_list.size());
-  c_array<GlyphMetrics> tmp_metrics(make_c_array(tmp_metrics_store));
-  std::vector<vec2> tmp_positions_store(m_glyph_list.size());
-  c_array<vec2> tmp_positions(make_c_array(tmp_positions_store));
+      m_owner->prepare_glyphs(R);
 
-  for (unsigned int i = 0, endi = m_glyph_list.size(); i < endi; ++i)
-    {
-      unsigned int I;
+      unsigned int num(m_glyph_list.size() - begin);
+      std::vector<GlyphMetrics> tmp_metrics_store(num);
+      c_array<GlyphMetrics> tmp_metrics(make_c_array(tmp_metrics_store));
+      std::vector<vec2> tmp_positions_store(num);
+      c_array<vec2> tmp_positions(make_c_array(tmp_positions_store));
 
-      I = m_glyph_list[i];
-      tmp_metrics[i] = m_owner->added_glyph(I).m_metrics;
-      tmp_positions[i] = m_owner->added_glyph(I).m_position;
-    }
+      for (unsigned int i = 0; i < num; ++i)
+        {
+          unsigned int I;
 
-  std::vector<Glyph> tmp_glyphs_store(m_glyph_list.size());
-  c_array<Glyph> tmp_glyphs(make_c_array(tmp_glyphs_store));
-  m_owner->cache()->fetch_glyphs(R, c_array<const GlyphMetrics>(tmp_metrics), tmp_glyphs, true);
+          I = m_glyph_list[i + begin];
+          tmp_metrics[i] = m_owner->added_glyph(I).m_metrics;
+          tmp_positions[i] = m_owner->added_glyph(I).m_position;
+        }
 
-  dst.set_values(tmp_glyphs,
-		 tmp_positions,
-		 m_owner->pixel_size(),
-		 m_owner->orientation(),
-		 m_owner->layout());
+      std::vector<Glyph> tmp_glyphs_store(num);
+      c_array<Glyph> tmp_glyphs(make_c_array(tmp_glyphs_store));
+      m_owner->cache()->fetch_glyphs(R, c_array<const GlyphMetrics>(tmp_metrics), tmp_glyphs, true);
+
+      dst->add_values(tmp_glyphs,
+                      tmp_positions,
+                      m_owner->pixel_size(),
+                      m_owner->orientation(),
+                      m_owner->layout());
+    }
+  /* uploading the appended glyphs can evict from the atlas
+   * the glyphs packed before, in that case pack all again.
+   */
+  while (begin > 0 && m_glyph_atlas_clear_count != m_owner->cache()->number_times_atlas_cleared());
 
-  return dst;
+  dst->mark_glyphs_used(*m_owner->cache());
+  return *dst;
 }
 
 /////////////////////////////////
@@ -858,12 +1096,109 @@ add_glyphs(fastuidraw::c_array<const fastuidraw::GlyphSource> sources,
 	  m_added_glyphs[i + old_sz].m_bounding_box.union_point(positions[i] + p_tr);
 	  if (m_root)
 	    {
-	      m_root->add_glyph(m_added_glyphs[i + old_sz]);
+	      add_glyph_to_tree(m_added_glyphs[i + old_sz]);
 	    }
 	}
     }
 }
 
+void
+GlyphSequencePrivate::
+add_glyph_to_tree(const PerAddedGlyph &G)
+{
+  using namespace fastuidraw;
+
+  const BoundingBox<float> &bb(m_root->bounding_box());
+  if (m_root->is_split() && !bb.empty() && !G.m_bounding_box.empty())
+    {
+      /* check the y-coordinate first since lines of text
+       * are appended along it.
+       */
+      for (int c = 1; c >= 0; --c)
+        {
+          bool after, before;
+
+          after = G.m_bounding_box.min_point()[c] >= bb.max_point()[c];
+          before = G.m_bounding_box.max_point()[c] <= bb.min_point()[c];
+          if (after || before)
+            {
+              BoundingBox<float> region;
+              vec2 p(bb.min_point()), q(bb.max_point());
+              float extent(q[c] - p[c]);
+
+              if (after)
+                {
+                  p[c] = q[c];
+                  q[c] += extent;
+                }
+              else
+                {
+                  q[c] = p[c];
+                  p[c] -= extent;
+                }
+              region.union_point(p);
+              region.union_point(q);
+              region.union_box(G.m_bounding_box);
+              m_root = FASTUIDRAWnew GlyphSubsetPrivate(m_root, static_cast<enum Splitter::split_type_t>(c),
+                                                        after, region);
+              break;
+            }
+        }
+    }
+  m_root->add_glyph(G);
+}
+
+void
+GlyphSequencePrivate::
+truncate(unsigned int N)
+{
+  if (N >= m_added_glyphs.size())
+    {
+      return;
+    }
+
+  if (m_root)
+    {
+      m_root->truncate(N);
+    }
+  m_added_glyphs.resize(N);
+
+  for (auto &e : m_number_prepared)
+    {
+      e.second = fastuidraw::t_min(e.second, N);
+    }
+}
+
+void
+GlyphSequencePrivate::
+prepare_glyphs(fastuidraw::GlyphRenderer R)
+{
+  using namespace fastuidraw;
+
+  unsigned int &num_prepared(m_number_prepared[R]);
+  unsigned int num(m_added_glyphs.size() - num_prepared);
+
+  if (num == 0)
+    {
+      return;
+    }
+
+  std::vector<GlyphMetrics> tmp_metrics(num);
+  std::vector<Glyph> tmp_glyphs(num);
+
+  for (unsigned int i = 0; i < num; ++i)
+    {
+      tmp_metrics[i] = m_added_glyphs[i + num_prepared].m_metrics;
+    }
+
+  /* only generate, the uploading is done by the subsets
+   * as their attribute data is needed.
+   */
+  m_cache->fetch_glyphs(R, c_array<const GlyphMetrics>(make_c_array(tmp_metrics)),
+                        make_c_array(tmp_glyphs), false);
+  num_prepared = m_added_glyphs.size();
+}
+
 void
 GlyphSequencePrivate::
 make_subsets_ready(void)
@@ -1020,6 +1355,15 @@ add_glyphs(c_array<const GlyphSource> sources,
   d->add_glyphs(sources, positions);
 }
 
+void
+fastuidraw::GlyphSequence::
+truncate(unsigned int N)
+{
+  GlyphSequencePrivate *d;
+  d = static_cast<GlyphSequencePrivate*>(m_d);
+  d->truncate(N);
+}
+
 unsigned int
 fastuidraw::GlyphSequence::
 number_glyphs(void) const
@@ -1153,6 +1153,7 @@ namespace
   {
   public:
     fastuidraw::GlyphSequence::ScratchSpace m_scratch;
+    fastuidraw::GlyphRun::ScratchSpace m_run_scratch;
     std::vector<unsigned int> m_subsets;
     std::vector<fastuidraw::c_array<const fastuidraw::PainterAttribute> > m_attribs;
     std::vector<fastuidraw::c_array<const fastuidraw::PainterIndex> > m_indices;
@@ -4903,7 +4904,10 @@ draw_glyphs(const PainterGlyphShader &shader, const PainterData &draw,
 
   d->draw_generic(shader.shader(renderer.m_type),
                   draw,
-                  glyph_run.subsequence(renderer, begin, count),
+                  glyph_run.subsequence(renderer, begin, count,
+                                        d->m_work_room.m_glyph.m_run_scratch,
+                                        d->m_clip_store.current(),
+                                        d->m_clip_rect_state.item_matrix()),
                   d->m_current_z);
 
   return renderer;
@@ -186,8 +186,7 @@ namespace
     SubPath(bool phas_arcs);
 
     void
-    process_edge(const fastuidraw::TessellatedPath &P,
-                 fastuidraw::range_type<unsigned int> R,
+    process_edge(fastuidraw::c_array<const fastuidraw::TessellatedPath::segment> src_segments,
                  const SingleSubEdge *prev,
                  std::vector<SingleSubEdge> &dst);
 
@@ -727,42 +726,37 @@ SubPath(const fastuidraw::TessellatedPath &P):
       for(unsigned int e = 0, ende = P.number_edges(o); e < ende; ++e)
         {
           const SingleSubEdge *prev(nullptr);
-          fastuidraw::range_type<unsigned int> R;
 
-          R = P.edge_range(o, e);
           if (e != 0 && P.edge_type(o, e) != PathEnums::starts_new_edge)
             {
               prev = &m_edges.back();
             }
 
-          process_edge(P, R, prev, m_edges);
+          process_edge(P.edge_segment_data(o, e), prev, m_edges);
         }
     }
 }
 
 void
 SubPath::
-process_edge(const fastuidraw::TessellatedPath &P,
-             fastuidraw::range_type<unsigned int> R,
+process_edge(fastuidraw::c_array<const fastuidraw::TessellatedPath::segment> src_segments,
              const SingleSubEdge *prev,
              std::vector<SingleSubEdge> &dst)
 {
   using namespace fastuidraw;
 
-  c_array<const TessellatedPath::segment> src_segments(P.segment_data());
-  bool has_arcs(P.has_arcs());
+  bool has_arcs(m_has_arcs);
 
-  FASTUIDRAWassert(R.m_end >= R.m_begin);
-  for(unsigned int i = R.m_begin; i < R.m_end; ++i)
+  for(unsigned int i = 0, endi = src_segments.size(); i < endi; ++i)
     {
       uint32_t flags;
 
       flags = 0u;
-      if (has_arcs && i == R.m_begin)
+      if (has_arcs && i == 0)
         {
           flags |= SingleSubEdge::first_segment_of_edge;
         }
-      if (has_arcs && i + 1 == R.m_end)
+      if (has_arcs && i + 1 == endi)
         {
           flags |= SingleSubEdge::last_segment_of_edge;
         }
@@ -1933,7 +1927,7 @@ StrokedPathPrivate(const fastuidraw::TessellatedPath &P,
   m_caps_joins(b),
   m_root(nullptr)
 {
-  if (!P.segment_data().empty())
+  if (P.number_contours() > 0)
     {
       m_root = SubsetPrivate::create_root_subset(P, m_subsets);
     }
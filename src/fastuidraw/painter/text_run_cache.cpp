@@ -0,0 +1,606 @@
+/*!
+ * \file text_run_cache.cpp
+ * \brief file text_run_cache.cpp
+ *
+ * Copyright 2019 by Intel.
+ *
+ * Contact: kevin.rogovin@intel.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@intel.com>
+ *
+ */
+
+
+#include <vector>
+#include <mutex>
+#include <atomic>
+#include <algorithm>
+#include <fastuidraw/painter/text_run_cache.hpp>
+#include "../private/util_private.hpp"
+#include "../private/bounding_box.hpp"
+#include "../private/hash_util.hpp"
+#include "../private/flat_hash_index.hpp"
+#include "../private/read_write_mutex.hpp"
+
+namespace
+{
+  class RunPrivate
+  {
+  public:
+    RunPrivate(float pixel_size,
+               enum fastuidraw::PainterEnums::screen_orientation orientation,
+               const fastuidraw::reference_counted_ptr<fastuidraw::GlyphCache> &cache,
+               enum fastuidraw::PainterEnums::glyph_layout_type layout):
+      m_glyph_run(pixel_size, orientation, cache, layout),
+      m_advance(0.0f, 0.0f),
+      m_memory_size(0)
+    {}
+
+    void
+    layout_glyphs(fastuidraw::c_array<const fastuidraw::GlyphSource> glyph_sources);
+
+    fastuidraw::GlyphRun m_glyph_run;
+    fastuidraw::vec2 m_advance;
+    fastuidraw::Rect m_bounding_box;
+    unsigned int m_memory_size;
+  };
+
+  /* key of a run; the character codes of a key held by the
+   * cache point into the CacheEntry of the run, the character
+   * codes of a key passed to a lookup point to the caller's
+   * array.
+   */
+  class run_key
+  {
+  public:
+    enum
+      {
+        font_group_bit = 1u,
+        orientation_shift = 1u,
+        layout_shift = 2u,
+      };
+
+    run_key(void):
+      m_font(nullptr),
+      m_pixel_size(0.0f),
+      m_flags(0u),
+      m_selection_strategy(0u),
+      m_hash(0u)
+    {}
+
+    run_key(const void *font, bool is_font_group,
+            fastuidraw::c_array<const uint32_t> character_codes,
+            float pixel_size,
+            enum fastuidraw::PainterEnums::screen_orientation orientation,
+            enum fastuidraw::PainterEnums::glyph_layout_type layout,
+            uint32_t selection_strategy):
+      m_font(font),
+      m_character_codes(character_codes),
+      m_pixel_size(pixel_size),
+      m_flags((is_font_group ? uint32_t(font_group_bit) : 0u)
+              | (uint32_t(orientation) << orientation_shift)
+              | (uint32_t(layout) << layout_shift)),
+      m_selection_strategy(selection_strategy)
+    {
+      fastuidraw::detail::FNV1aHash H;
+
+      H.add(m_character_codes)
+        .add(reinterpret_cast<uintptr_t>(m_font))
+        .add(m_pixel_size)
+        .add(m_flags)
+        .add(m_selection_strategy);
+      m_hash = fastuidraw::detail::hash_mix(H.value());
+    }
+
+    bool
+    operator==(const run_key &rhs) const
+    {
+      return m_hash == rhs.m_hash
+        && m_font == rhs.m_font
+        && m_pixel_size == rhs.m_pixel_size
+        && m_flags == rhs.m_flags
+        && m_selection_strategy == rhs.m_selection_strategy
+        && m_character_codes.size() == rhs.m_character_codes.size()
+        && std::equal(m_character_codes.begin(), m_character_codes.end(),
+                      rhs.m_character_codes.begin());
+    }
+
+    uint64_t
+    hash(void) const
+    {
+      return m_hash;
+    }
+
+    const void *m_font;
+    fastuidraw::c_array<const uint32_t> m_character_codes;
+    float m_pixel_size;
+    uint32_t m_flags, m_selection_strategy;
+    uint64_t m_hash;
+  };
+
+  class CacheEntry:fastuidraw::noncopyable
+  {
+  public:
+    CacheEntry(const run_key &key,
+               const fastuidraw::FontBase *font,
+               const fastuidraw::reference_counted_ptr<const fastuidraw::TextRunCache::Run> &run,
+               uint64_t stamp):
+      m_character_codes(key.m_character_codes.begin(), key.m_character_codes.end()),
+      m_key(key),
+      m_font(font),
+      m_run(run),
+      m_last_used(stamp)
+    {
+      m_key.m_character_codes = fastuidraw::make_c_array(m_character_codes);
+    }
+
+    std::vector<uint32_t> m_character_codes;
+    run_key m_key;
+
+    /* holding a reference to the font keeps its address from
+     * being reused by another font while the entry exists.
+     */
+    fastuidraw::reference_counted_ptr<const fastuidraw::FontBase> m_font;
+    fastuidraw::reference_counted_ptr<const fastuidraw::TextRunCache::Run> m_run;
+
+    /* value of TextRunCachePrivate::m_clock when the
+     * entry was last returned by a lookup.
+     */
+    std::atomic<uint64_t> m_last_used;
+  };
+
+  class TextRunCachePrivate:fastuidraw::noncopyable
+  {
+  public:
+    TextRunCachePrivate(const fastuidraw::reference_counted_ptr<fastuidraw::GlyphCache> &glyph_cache,
+                        const fastuidraw::reference_counted_ptr<fastuidraw::FontDatabase> &font_database,
+                        uint64_t memory_budget):
+      m_glyph_cache(glyph_cache),
+      m_font_database(font_database),
+      m_memory_budget(memory_budget),
+      m_memory_used(0u),
+      m_clock(0u),
+      m_hits(0u),
+      m_misses(0u)
+    {}
+
+    ~TextRunCachePrivate()
+    {
+      clear();
+    }
+
+    /* Returns the run of a key, or a null value if the
+     * key is not in the cache; only takes a read lock.
+     */
+    fastuidraw::reference_counted_ptr<const fastuidraw::TextRunCache::Run>
+    find(const run_key &key);
+
+    /* Insert a run made by the caller; if another thread
+     * inserted a run for the same key while the run was being
+     * made, returns that run instead.
+     */
+    fastuidraw::reference_counted_ptr<const fastuidraw::TextRunCache::Run>
+    insert(const run_key &key, const fastuidraw::FontBase *font,
+           const fastuidraw::reference_counted_ptr<const fastuidraw::TextRunCache::Run> &run);
+
+    /* Release runs, least recently used first, until the runs
+     * use no more than the budget; to amortize the cost of the
+     * sorting, runs are released until they use at most 7/8 of
+     * the budget. Must be called with m_mutex locked for writing.
+     */
+    void
+    evict(uint64_t budget);
+
+    void
+    clear(void);
+
+    fastuidraw::reference_counted_ptr<fastuidraw::GlyphCache> m_glyph_cache;
+    fastuidraw::reference_counted_ptr<fastuidraw::FontDatabase> m_font_database;
+
+    mutable fastuidraw::detail::ReadWriteMutex m_mutex;
+    fastuidraw::detail::FlatHashIndex<run_key> m_index;
+    std::vector<CacheEntry*> m_entries;
+    uint64_t m_memory_budget, m_memory_used;
+
+    std::atomic<uint64_t> m_clock, m_hits, m_misses;
+  };
+}
+
+//////////////////////////////////
+// RunPrivate methods
+void
+RunPrivate::
+layout_glyphs(fastuidraw::c_array<const fastuidraw::GlyphSource> glyph_sources)
+{
+  using namespace fastuidraw;
+
+  std::vector<GlyphMetrics> metrics(glyph_sources.size());
+  std::vector<GlyphMetrics> added_metrics;
+  std::vector<vec2> positions;
+  BoundingBox<float> bb;
+  float pixel_size(m_glyph_run.pixel_size());
+  bool y_down(m_glyph_run.orientation() == PainterEnums::y_increases_downwards);
+  bool horizontal(m_glyph_run.layout() == PainterEnums::glyph_layout_horizontal);
+  vec2 pen(0.0f, 0.0f);
+
+  m_glyph_run.glyph_cache()->fetch_glyph_metrics(glyph_sources, make_c_array(metrics));
+  added_metrics.reserve(metrics.size());
+  positions.reserve(metrics.size());
+
+  for (const GlyphMetrics &M : metrics)
+    {
+      if (!M.valid())
+        {
+          continue;
+        }
+
+      float ratio;
+      vec2 glyph_size, lo, p_bl, p_tr;
+
+      ratio = pixel_size / M.units_per_EM();
+      glyph_size = ratio * M.size();
+      lo = (horizontal) ?
+        M.horizontal_layout_offset() :
+        M.vertical_layout_offset();
+
+      if (y_down)
+        {
+          p_bl.x() = ratio * lo.x();
+          p_tr.x() = p_bl.x() + glyph_size.x();
+
+          p_bl.y() = -ratio * lo.y();
+          p_tr.y() = p_bl.y() - glyph_size.y();
+        }
+      else
+        {
+          p_bl = ratio * lo;
+          p_tr = p_bl + glyph_size;
+        }
+
+      if (glyph_size.x() > 0.0f && glyph_size.y() > 0.0f)
+        {
+          bb.union_point(pen + p_bl);
+          bb.union_point(pen + p_tr);
+        }
+
+      added_metrics.push_back(M);
+      positions.push_back(pen);
+
+      if (horizontal)
+        {
+          pen.x() += ratio * M.advance().x();
+        }
+      else
+        {
+          pen.y() += (y_down ? ratio : -ratio) * M.advance().y();
+        }
+    }
+
+  m_glyph_run.add_glyphs(c_array<const GlyphMetrics>(make_c_array(added_metrics)),
+                         c_array<const vec2>(make_c_array(positions)));
+  m_advance = pen;
+  if (!bb.empty())
+    {
+      m_bounding_box
+        .min_point(bb.min_point())
+        .max_point(bb.max_point());
+    }
+
+  /* the glyphs as stored by the GlyphRun, the attribute and
+   * index data of a glyph for one GlyphRenderer and the
+   * character code of the key.
+   */
+  m_memory_size = sizeof(RunPrivate) + sizeof(fastuidraw::TextRunCache::Run) + sizeof(CacheEntry)
+    + glyph_sources.size() * sizeof(uint32_t)
+    + added_metrics.size() * (sizeof(GlyphMetrics) + sizeof(vec2)
+                              + 4u * sizeof(PainterAttribute)
+                              + 6u * sizeof(PainterIndex));
+}
+
+///////////////////////////////////////
+// TextRunCachePrivate methods
+fastuidraw::reference_counted_ptr<const fastuidraw::TextRunCache::Run>
+TextRunCachePrivate::
+find(const run_key &key)
+{
+  fastuidraw::detail::SharedLockGuard lock(m_mutex);
+  const unsigned int *p;
+
+  p = m_index.find(key);
+  if (!p)
+    {
+      return nullptr;
+    }
+
+  CacheEntry *e(m_entries[*p]);
+  e->m_last_used.store(++m_clock, std::memory_order_relaxed);
+  ++m_hits;
+  return e->m_run;
+}
+
+fastuidraw::reference_counted_ptr<const fastuidraw::TextRunCache::Run>
+TextRunCachePrivate::
+insert(const run_key &key, const fastuidraw::FontBase *font,
+       const fastuidraw::reference_counted_ptr<const fastuidraw::TextRunCache::Run> &run)
+{
+  std::lock_guard<fastuidraw::detail::ReadWriteMutex> lock(m_mutex);
+  const unsigned int *p;
+
+  p = m_index.find(key);
+  if (p)
+    {
+      CacheEntry *e(m_entries[*p]);
+      e->m_last_used.store(++m_clock, std::memory_order_relaxed);
+      ++m_hits;
+      return e->m_run;
+    }
+
+  CacheEntry *e;
+
+  e = FASTUIDRAWnew CacheEntry(key, font, run, ++m_clock);
+  m_index.insert(e->m_key, m_entries.size());
+  m_entries.push_back(e);
+  m_memory_used += run->memory_size();
+  ++m_misses;
+
+  evict(m_memory_budget);
+  return run;
+}
+
+void
+TextRunCachePrivate::
+evict(uint64_t budget)
+{
+  if (m_memory_used <= budget)
+    {
+      return;
+    }
+
+  uint64_t target(budget - budget / 8u);
+  std::vector<CacheEntry*> sorted(m_entries);
+
+  std::sort(sorted.begin(), sorted.end(),
+            [](const CacheEntry *a, const CacheEntry *b)
+            {
+              return a->m_last_used.load(std::memory_order_relaxed)
+                < b->m_last_used.load(std::memory_order_relaxed);
+            });
+
+  unsigned int num_evicted(0);
+  for (; num_evicted < sorted.size() && m_memory_used > target; ++num_evicted)
+    {
+      m_memory_used -= sorted[num_evicted]->m_run->memory_size();
+      FASTUIDRAWdelete(sorted[num_evicted]);
+    }
+
+  /* rebuild the index over the remaining entries, keeping
+   * them in least recently used order.
+   */
+  m_entries.assign(sorted.begin() + num_evicted, sorted.end());
+  m_index.clear();
+  for (unsigned int i = 0; i < m_entries.size(); ++i)
+    {
+      m_index.insert(m_entries[i]->m_key, i);
+    }
+}
+
+void
+TextRunCachePrivate::
+clear(void)
+{
+  for (CacheEntry *e : m_entries)
+    {
+      FASTUIDRAWdelete(e);
+    }
+  m_entries.clear();
+  m_index.clear();
+  m_memory_used = 0u;
+}
+
+//////////////////////////////////////////////
+// fastuidraw::TextRunCache::Run methods
+fastuidraw::TextRunCache::Run::
+Run(c_array<const GlyphSource> glyph_sources,
+    float pixel_size,
+    enum PainterEnums::screen_orientation orientation,
+    const reference_counted_ptr<GlyphCache> &cache,
+    enum PainterEnums::glyph_layout_type layout)
+{
+  RunPrivate *d;
+
+  d = FASTUIDRAWnew RunPrivate(pixel_size, orientation, cache, layout);
+  d->layout_glyphs(glyph_sources);
+  m_d = d;
+}
+
+fastuidraw::TextRunCache::Run::
+~Run()
+{
+  RunPrivate *d;
+  d = static_cast<RunPrivate*>(m_d);
+  FASTUIDRAWdelete(d);
+  m_d = nullptr;
+}
+
+get_implement(fastuidraw::TextRunCache::Run, RunPrivate,
+              const fastuidraw::GlyphRun&, glyph_run)
+get_implement(fastuidraw::TextRunCache::Run, RunPrivate,
+              const fastuidraw::vec2&, advance)
+get_implement(fastuidraw::TextRunCache::Run, RunPrivate,
+              const fastuidraw::Rect&, bounding_box)
+get_implement(fastuidraw::TextRunCache::Run, RunPrivate,
+              unsigned int, memory_size)
+
+//////////////////////////////////////////
+// fastuidraw::TextRunCache methods
+fastuidraw::TextRunCache::
+TextRunCache(const reference_counted_ptr<GlyphCache> &glyph_cache,
+             const reference_counted_ptr<FontDatabase> &font_database,
+             uint64_t memory_budget)
+{
+  m_d = FASTUIDRAWnew TextRunCachePrivate(glyph_cache, font_database, memory_budget);
+}
+
+fastuidraw::TextRunCache::
+~TextRunCache()
+{
+  TextRunCachePrivate *d;
+  d = static_cast<TextRunCachePrivate*>(m_d);
+  FASTUIDRAWdelete(d);
+  m_d = nullptr;
+}
+
+fastuidraw::reference_counted_ptr<const fastuidraw::TextRunCache::Run>
+fastuidraw::TextRunCache::
+fetch(const FontBase *font,
+      c_array<const uint32_t> character_codes,
+      float pixel_size,
+      enum PainterEnums::screen_orientation orientation,
+      enum PainterEnums::glyph_layout_type layout,
+      uint32_t selection_strategy)
+{
+  TextRunCachePrivate *d;
+  d = static_cast<TextRunCachePrivate*>(m_d);
+
+  run_key key(font, false, character_codes, pixel_size,
+              orientation, layout, selection_strategy);
+  reference_counted_ptr<const Run> return_value;
+
+  return_value = d->find(key);
+  if (!return_value)
+    {
+      std::vector<GlyphSource> glyph_sources(character_codes.size());
+
+      if (d->m_font_database)
+        {
+          d->m_font_database->create_glyph_sequence(font, character_codes.begin(), character_codes.end(),
+                                                    glyph_sources.begin(), selection_strategy);
+        }
+      else if (font)
+        {
+          for (unsigned int i = 0; i < character_codes.size(); ++i)
+            {
+              glyph_sources[i] = GlyphSource(font, font->glyph_code(character_codes[i]));
+            }
+        }
+
+      /* the run is made without holding the lock so that
+       * lookups by other threads are not blocked by it.
+       */
+      return_value = FASTUIDRAWnew Run(make_c_array(glyph_sources), pixel_size,
+                                       orientation, d->m_glyph_cache, layout);
+      return_value = d->insert(key, font, return_value);
+    }
+  return return_value;
+}
+
+fastuidraw::reference_counted_ptr<const fastuidraw::TextRunCache::Run>
+fastuidraw::TextRunCache::
+fetch(FontDatabase::FontGroup group,
+      c_array<const uint32_t> character_codes,
+      float pixel_size,
+      enum PainterEnums::screen_orientation orientation,
+      enum PainterEnums::glyph_layout_type layout,
+      uint32_t selection_strategy)
+{
+  TextRunCachePrivate *d;
+  d = static_cast<TextRunCachePrivate*>(m_d);
+
+  FASTUIDRAWassert(d->m_font_database);
+  run_key key(group.m_d, true, character_codes, pixel_size,
+              orientation, layout, selection_strategy);
+  reference_counted_ptr<const Run> return_value;
+
+  return_value = d->find(key);
+  if (!return_value)
+    {
+      std::vector<GlyphSource> glyph_sources(character_codes.size());
+
+      d->m_font_database->create_glyph_sequence(group, character_codes.begin(), character_codes.end(),
+                                                glyph_sources.begin(), selection_strategy);
+      return_value = FASTUIDRAWnew Run(make_c_array(glyph_sources), pixel_size,
+                                       orientation, d->m_glyph_cache, layout);
+      return_value = d->insert(key, nullptr, return_value);
+    }
+  return return_value;
+}
+
+uint64_t
+fastuidraw::TextRunCache::
+memory_budget(void) const
+{
+  TextRunCachePrivate *d;
+  d = static_cast<TextRunCachePrivate*>(m_d);
+
+  detail::SharedLockGuard lock(d->m_mutex);
+  return d->m_memory_budget;
+}
+
+void
+fastuidraw::TextRunCache::
+memory_budget(uint64_t v)
+{
+  TextRunCachePrivate *d;
+  d = static_cast<TextRunCachePrivate*>(m_d);
+
+  std::lock_guard<detail::ReadWriteMutex> lock(d->m_mutex);
+  d->m_memory_budget = v;
+  d->evict(v);
+}
+
+uint64_t
+fastuidraw::TextRunCache::
+memory_used(void) const
+{
+  TextRunCachePrivate *d;
+  d = static_cast<TextRunCachePrivate*>(m_d);
+
+  detail::SharedLockGuard lock(d->m_mutex);
+  return d->m_memory_used;
+}
+
+unsigned int
+fastuidraw::TextRunCache::
+number_runs(void) const
+{
+  TextRunCachePrivate *d;
+  d = static_cast<TextRunCachePrivate*>(m_d);
+
+  detail::SharedLockGuard lock(d->m_mutex);
+  return d->m_entries.size();
+}
+
+uint64_t
+fastuidraw::TextRunCache::
+number_hits(void) const
+{
+  TextRunCachePrivate *d;
+  d = static_cast<TextRunCachePrivate*>(m_d);
+  return d->m_hits.load();
+}
+
+uint64_t
+fastuidraw::TextRunCache::
+number_misses(void) const
+{
+  TextRunCachePrivate *d;
+  d = static_cast<TextRunCachePrivate*>(m_d);
+  return d->m_misses.load();
+}
+
+void
+fastuidraw::TextRunCache::
+clear(void)
+{
+  TextRunCachePrivate *d;
+  d = static_cast<TextRunCachePrivate*>(m_d);
+
+  std::lock_guard<detail::ReadWriteMutex> lock(d->m_mutex);
+  d->clear();
+}
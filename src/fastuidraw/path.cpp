@@ -20,6 +20,8 @@
 #include <algorithm>
 #include <cmath>
 #include <vector>
+#include <deque>
+#include <mutex>
 #include <fastuidraw/path.hpp>
 #include <fastuidraw/tessellated_path.hpp>
 #include "private/util_private.hpp"
@@ -27,6 +29,8 @@
 #include "private/path_util_private.hpp"
 #include "private/bounding_box.hpp"
 #include "private/bezier_util.hpp"
+#include "private/bezier_eval.hpp"
+#include "private/path_contour_edges.hpp"
 
 namespace
 {
@@ -169,6 +173,79 @@ namespace
     unsigned int m_minimum_tessellation_recursion;
   };
 
+  /* A BezierTessellationState tessellates a Bezier curve into
+   * the same pieces as TessellationState does, i.e. a piece is
+   * split in half until it is close enough to the arc (or pair
+   * of line segments) through its end points and its middle,
+   * but without the BezierTessRegion objects of bezier::tessellate();
+   * instead the points of a piece used to measure its distance
+   * are evaluated together by detail::evaluate_bezier(). In
+   * addition, the depth at which the line segments of every
+   * piece are within the tolerance is computed up front from
+   * the flatness bound detail::bezier_chord_distance_bound();
+   * pieces are never split below that depth and a piece whose
+   * arc is further than its line segments uses the line segments.
+   */
+  class BezierTessellationState:public fastuidraw::PathContour::tessellation_state
+  {
+  public:
+    explicit
+    BezierTessellationState(const fastuidraw::PathContour::bezier *h);
+
+    virtual
+    unsigned int
+    recursion_depth(void) const
+    {
+      return m_recursion_depth;
+    }
+
+    virtual
+    void
+    resume_tessellation(const fastuidraw::TessellatedPath::TessellationParams &tess_params,
+                        fastuidraw::TessellatedPath::SegmentStorage *out_data,
+                        float *out_max_distance);
+
+  private:
+    class Piece
+    {
+    public:
+      /* the piece covers the times [m_t0, m_t0 + 1 / 2^m_depth] */
+      float m_t0;
+      unsigned int m_depth;
+
+      fastuidraw::vec2 m_start, m_mid, m_end;
+      ArcSegment m_arc;
+      bool m_use_lines;
+      float m_distance;
+    };
+
+    Piece
+    create_piece(float t0, unsigned int depth,
+                 const fastuidraw::vec2 &start,
+                 const fastuidraw::vec2 &end);
+
+    void
+    refine_piece(const Piece &piece,
+                 const fastuidraw::TessellatedPath::TessellationParams &tess_params,
+                 unsigned int line_depth,
+                 std::vector<Piece> *dst);
+
+    fastuidraw::reference_counted_ptr<const fastuidraw::PathContour::bezier> m_h;
+    fastuidraw::c_array<const fastuidraw::vec2> m_pts;
+    unsigned int m_min_depth;
+    float m_chord_bound;
+
+    /* The distance of a piece to its arc is measured at the
+     * points halfway between its 2^m_sample_depth sub-pieces,
+     * as done by BezierTessRegion::distance_to_arc().
+     */
+    unsigned int m_sample_depth;
+    std::vector<fastuidraw::vec2> m_samples;
+
+    std::vector<Piece> m_pieces;
+    unsigned int m_recursion_depth;
+  };
+
   /*
    * A FakeInterpolator is used only for the fake interpolator
    * that starts a contour; it never gets used in a final
@@ -236,10 +313,7 @@ namespace
     BezierTessRegion(const BezierTessRegion *parent, bool is_region_start);
 
     explicit
-    BezierTessRegion(fastuidraw::BoundingBox<float> &bb,
-                     const fastuidraw::vec2 &start,
-                     fastuidraw::c_array<const fastuidraw::vec2> ct,
-                     const fastuidraw::vec2 &end);
+    BezierTessRegion(fastuidraw::c_array<const fastuidraw::vec2> pts);
 
     virtual
     float
@@ -303,33 +377,149 @@ namespace
   class BezierPrivate
   {
   public:
+    BezierPrivate(const fastuidraw::vec2 &start,
+                  fastuidraw::c_array<const fastuidraw::vec2> ct,
+                  const fastuidraw::vec2 &end);
+
+    BezierPrivate(const BezierPrivate &obj):
+      m_pts(obj.m_pts),
+      m_bb(obj.m_bb)
+    {}
+
+    /* the BezierTessRegion is only needed by bezier::tessellate(),
+     * so it is made on first use.
+     */
+    const fastuidraw::reference_counted_ptr<BezierTessRegion>&
+    start_region(void);
+
+    std::vector<fastuidraw::vec2> m_pts;
     fastuidraw::BoundingBox<float> m_bb;
+
+  private:
+    std::once_flag m_start_region_once;
     fastuidraw::reference_counted_ptr<BezierTessRegion> m_start_region;
   };
 
   class ArcPrivate
   {
   public:
+    ArcPrivate(const fastuidraw::vec2 &start,
+               const fastuidraw::vec2 &end,
+               float angle);
+
     float m_radius, m_angle_speed;
     float m_start_angle;
     fastuidraw::vec2 m_center;
     fastuidraw::BoundingBox<float> m_bb;
   };
 
+  /* A PathContourPrivate stores the edges of a contour compactly:
+   * m_pts holds the start point of the contour followed by, for
+   * each edge, the control points and then the end point of
+   * the edge; an Edge gives what kind of edge it is and where its
+   * end point is in m_pts. The interpolator objects, which link
+   * to each other, are only made when they are asked for (by
+   * PathContour::interpolator() or PathContour::prev_interpolator());
+   * from then on, each edge added also makes its interpolator.
+   */
   class PathContourPrivate
   {
   public:
+    enum verb_t
+      {
+        flat_verb = fastuidraw::detail::PathContourEdges::flat_verb,
+        bezier_verb = fastuidraw::detail::PathContourEdges::bezier_verb,
+        arc_verb = fastuidraw::detail::PathContourEdges::arc_verb,
+        generic_verb = fastuidraw::detail::PathContourEdges::generic_verb
+      };
+
+    class Edge
+    {
+    public:
+      uint8_t m_verb;
+      uint8_t m_edge_type;
+
+      /* index into m_pts of the end point of the edge */
+      uint32_t m_end;
+
+      union
+      {
+        /* angle for arc_verb */
+        float m_angle;
+
+        /* index into m_generic for generic_verb */
+        uint32_t m_generic;
+      };
+    };
+
     PathContourPrivate(void):
-      m_is_flat(true)
+      m_closed(false),
+      m_is_flat(true),
+      m_has_interpolators(false)
     {}
 
-    fastuidraw::vec2 m_start_pt;
+    /* the points of the edge I, i.e. its start point,
+     * control points and end point.
+     */
+    fastuidraw::c_array<const fastuidraw::vec2>
+    edge_pts(unsigned int I) const
+    {
+      unsigned int begin;
+
+      begin = (I == 0) ? 0 : m_edges[I - 1].m_end;
+      return fastuidraw::make_c_array(m_pts).sub_array(begin, m_edges[I].m_end - begin + 1);
+    }
+
+    /* add an edge ending at pt whose control points are
+     * m_current_control_points.
+     */
+    void
+    add_edge(enum verb_t verb, enum fastuidraw::PathEnums::edge_type_t etp,
+             const fastuidraw::vec2 &pt, float angle = 0.0f);
+
+    void
+    add_generic_edge(const fastuidraw::reference_counted_ptr<const fastuidraw::PathContour::interpolator_base> &p);
+
+    fastuidraw::reference_counted_ptr<const fastuidraw::PathContour::interpolator_base>
+    create_interpolator(unsigned int I,
+                        const fastuidraw::reference_counted_ptr<const fastuidraw::PathContour::interpolator_base> &prev) const;
+
+    /* add the interpolator of the last edge added to m_interpolators */
+    void
+    add_last_interpolator(void);
+
+    /* make p, the interpolator of the closing edge, the
+     * interpolator that ends at the start point; first is
+     * the InterpolatorBasePrivate of m_interpolators[1].
+     */
+    void
+    set_end_to_start(const fastuidraw::reference_counted_ptr<const fastuidraw::PathContour::interpolator_base> &p,
+                     InterpolatorBasePrivate *first);
+
+    std::vector<fastuidraw::vec2> m_pts;
+    std::vector<Edge> m_edges;
+    std::vector<fastuidraw::reference_counted_ptr<const fastuidraw::PathContour::interpolator_base> > m_generic;
     std::vector<fastuidraw::vec2> m_current_control_points;
-    fastuidraw::reference_counted_ptr<const fastuidraw::PathContour::interpolator_base> m_end_to_start;
-    std::vector<fastuidraw::reference_counted_ptr<const fastuidraw::PathContour::interpolator_base> > m_interpolators;
+    bool m_closed;
 
     fastuidraw::BoundingBox<float> m_bb;
     bool m_is_flat;
+
+    /* m_interpolators[I + 1] is the interpolator of the edge I
+     * and m_interpolators[0] is either a FakeInterpolator for
+     * the start point or, once closed, m_end_to_start. They
+     * are made once by PathContour::make_interpolators().
+     */
+    std::once_flag m_interpolators_once;
+    bool m_has_interpolators;
+    fastuidraw::reference_counted_ptr<const fastuidraw::PathContour::interpolator_base> m_end_to_start;
+    std::vector<fastuidraw::reference_counted_ptr<const fastuidraw::PathContour::interpolator_base> > m_interpolators;
+
+    /* tessellation of a closed contour, made once
+     * by PathContour::tessellation().
+     */
+    std::once_flag m_tessellation_once;
+    fastuidraw::reference_counted_ptr<const fastuidraw::TessellatedPath> m_tessellation;
   };
 
   class PathPrivate;
@@ -346,6 +536,12 @@ namespace
       m_done(false)
     {}
 
+    /* copies the tessellations, but not the Refiner
+     * since a Refiner cannot be used by two lists
+     * from different threads.
+     */
+    TessellatedPathList(const TessellatedPathList &obj);
+
     const TessellatedPathRef&
     tessellation(const fastuidraw::Path &path, float max_distance);
 
@@ -358,9 +554,37 @@ namespace
     }
 
   private:
+    /* Returns the tessellation to use for max_distance or
+     * nullptr if the tessellation needs to be refined first;
+     * m_data_mutex must be locked.
+     */
+    const TessellatedPathRef*
+    find(const fastuidraw::Path &path, float max_distance) const;
+
+    /* Create or refine tessellations until there is one
+     * for max_distance; m_refine_mutex must be locked.
+     */
+    void
+    refine(const fastuidraw::Path &path, float max_distance);
+
+    void
+    add(const TessellatedPathRef &ref, bool done);
+
+    /* m_refine_mutex serializes the creation and refinement
+     * of tessellations, i.e. the use of m_refiner; m_data_mutex
+     * is held only to read or append to m_data and to read or
+     * write m_done. Thus readers of tessellations already made
+     * are not blocked while a finer tessellation is made.
+     * Elements are only appended to m_data, and a std::deque
+     * does not move its elements when appended to, so the
+     * references returned by tessellation() stay valid until
+     * clear() is called.
+     */
+    std::mutex m_refine_mutex;
+    mutable std::mutex m_data_mutex;
     bool m_done;
     fastuidraw::reference_counted_ptr<TessellatedPath::Refiner> m_refiner;
-    std::vector<TessellatedPathRef> m_data;
+    std::deque<TessellatedPathRef> m_data;
   };
 
   class PathPrivate:fastuidraw::noncopyable
@@ -383,6 +607,11 @@ namespace
     void
     start_contour_if_necessary(void);
 
+    /* protects the lazily computed m_start_check_bb,
+     * m_bb and m_shader_filled_path.
+     */
+    mutable std::mutex m_mutex;
+
     std::vector<fastuidraw::reference_counted_ptr<fastuidraw::PathContour> > m_contours;
     enum fastuidraw::PathEnums::edge_type_t m_next_edge_type;
 
@@ -395,6 +624,7 @@ namespace
     fastuidraw::BoundingBox<float> m_bb;
     bool m_is_flat;
     fastuidraw::reference_counted_ptr<const fastuidraw::ShaderFilledPath> m_shader_filled_path;
+    fastuidraw::reference_counted_ptr<fastuidraw::PathContourRegistry> m_contour_registry;
     fastuidraw::Path *m_p;
   };
 }
@@ -628,6 +858,150 @@ resume_tessellation_worker(const ArcTessellatorStateNode &node,
     }
 }
 
+/////////////////////////////////
+// BezierTessellationState methods
+BezierTessellationState::
+BezierTessellationState(const fastuidraw::PathContour::bezier *h):
+  m_h(h),
+  m_pts(h->pts()),
+  m_min_depth(h->minimum_tessellation_recursion()),
+  m_chord_bound(fastuidraw::detail::bezier_chord_distance_bound(m_pts)),
+  m_sample_depth(fastuidraw::uint32_log2(m_pts.size())),
+  m_samples((2u << m_sample_depth) + 1u),
+  m_recursion_depth(0)
+{}
+
+BezierTessellationState::Piece
+BezierTessellationState::
+create_piece(float t0, unsigned int depth,
+             const fastuidraw::vec2 &start,
+             const fastuidraw::vec2 &end)
+{
+  using namespace fastuidraw;
+
+  Piece return_value;
+  float h, line_distance, distance(0.0f);
+  unsigned int last(m_samples.size() - 1), mid(last / 2);
+  c_array<vec2> samples(make_c_array(m_samples));
+
+  h = 1.0f / static_cast<float>(1u << depth);
+  detail::evaluate_bezier(m_pts, t0, h / static_cast<float>(last), samples);
+
+  /* take the end points as given so that the pieces connect */
+  samples.front() = start;
+  samples.back() = end;
+
+  return_value.m_t0 = t0;
+  return_value.m_depth = depth;
+  return_value.m_start = start;
+  return_value.m_mid = samples[mid];
+  return_value.m_end = end;
+  return_value.m_arc = ArcSegment(start, samples[mid], end);
+
+  /* the two line segments of the piece are within
+   * m_chord_bound * (h / 2)^2 of the piece.
+   */
+  line_distance = 0.25f * h * h * m_chord_bound;
+  if (!return_value.m_arc.m_too_flat)
+    {
+      for (unsigned int k = 1; k < last; k += 2)
+        {
+          distance = t_max(distance, return_value.m_arc.distance(samples[k]));
+        }
+    }
+
+  return_value.m_use_lines = return_value.m_arc.m_too_flat || line_distance < distance;
+  return_value.m_distance = (return_value.m_use_lines) ? line_distance : distance;
+
+  return return_value;
+}
+
+void
+BezierTessellationState::
+refine_piece(const Piece &piece,
+             const fastuidraw::TessellatedPath::TessellationParams &tess_params,
+             unsigned int line_depth,
+             std::vector<Piece> *dst)
+{
+  if (piece.m_depth < m_min_depth
+      || (tess_params.m_max_distance > 0.0f
+          && piece.m_depth <= tess_params.m_max_recursion
+          && piece.m_depth < line_depth
+          && piece.m_distance > tess_params.m_max_distance))
+    {
+      float h;
+
+      h = 1.0f / static_cast<float>(2u << piece.m_depth);
+      refine_piece(create_piece(piece.m_t0, piece.m_depth + 1, piece.m_start, piece.m_mid),
+                   tess_params, line_depth, dst);
+      refine_piece(create_piece(piece.m_t0 + h, piece.m_depth + 1, piece.m_mid, piece.m_end),
+                   tess_params, line_depth, dst);
+    }
+  else
+    {
+      dst->push_back(piece);
+    }
+}
+
+void
+BezierTessellationState::
+resume_tessellation(const fastuidraw::TessellatedPath::TessellationParams &tess_params,
+                    fastuidraw::TessellatedPath::SegmentStorage *out_data,
+                    float *out_max_distance)
+{
+  using namespace fastuidraw;
+
+  std::vector<Piece> new_pieces;
+  unsigned int line_depth(0);
+
+  if (tess_params.m_max_distance > 0.0f)
+    {
+      /* the depth at which the line segments of every
+       * piece are within the tolerance.
+       */
+      for (float bound = 0.25f * m_chord_bound;
+           bound > tess_params.m_max_distance; bound *= 0.25f)
+        {
+          ++line_depth;
+        }
+    }
+
+  if (m_pieces.empty())
+    {
+      refine_piece(create_piece(0.0f, 0, m_pts.front(), m_pts.back()),
+                   tess_params, line_depth, &new_pieces);
+    }
+  else
+    {
+      new_pieces.reserve(m_pieces.size());
+      for (const Piece &piece : m_pieces)
+        {
+          refine_piece(piece, tess_params, line_depth, &new_pieces);
+        }
+    }
+
+  std::swap(new_pieces, m_pieces);
+  *out_max_distance = 0.0f;
+  m_recursion_depth = 0;
+  for (const Piece &piece : m_pieces)
+    {
+      if (piece.m_use_lines)
+        {
+          out_data->add_line_segment(piece.m_start, piece.m_mid);
+          out_data->add_line_segment(piece.m_mid, piece.m_end);
+        }
+      else
+        {
+          out_data->add_arc_segment(piece.m_start, piece.m_end,
+                                    piece.m_arc.m_center,
+                                    piece.m_arc.m_radius,
+                                    piece.m_arc.m_angle);
+        }
+      m_recursion_depth = t_max(m_recursion_depth, piece.m_depth);
+      *out_max_distance = t_max(*out_max_distance, piece.m_distance);
+    }
+}
+
 ////////////////////////////////////////////
 // fastuidraw::PathContour::interpolator_base methods
 fastuidraw::PathContour::interpolator_base::
@@ -740,27 +1114,12 @@ BezierTessRegion(const BezierTessRegion *parent, bool is_region_start):
 }
 
 BezierTessRegion::
-BezierTessRegion(fastuidraw::BoundingBox<float> &bb,
-                 const fastuidraw::vec2 &start,
-                 fastuidraw::c_array<const fastuidraw::vec2> ct,
-                 const fastuidraw::vec2 &end):
+BezierTessRegion(fastuidraw::c_array<const fastuidraw::vec2> pts):
+  m_pts(pts.begin(), pts.end()),
   m_start(0.0f),
-  m_end(1.0f)
-{
-  m_pts.reserve(ct.size() + 2);
-  m_pts.push_back(start);
-  for (const auto &pt : ct)
-    {
-      m_pts.push_back(pt);
-    }
-  m_pts.push_back(end);
-  m_arc_distance_depth = fastuidraw::uint32_log2(m_pts.size());
-
-  for(const fastuidraw::vec2 &pt : m_pts)
-    {
-      bb.union_point(pt);
-    }
-}
+  m_end(1.0f),
+  m_arc_distance_depth(fastuidraw::uint32_log2(pts.size()))
+{}
 
 void
 BezierTessRegion::
@@ -887,6 +1246,35 @@ distance_to_arc_raw(unsigned int depth, const ArcSegment &A) const
     }
 }
 
+////////////////////////////////////
+// BezierPrivate methods
+BezierPrivate::
+BezierPrivate(const fastuidraw::vec2 &start,
+              fastuidraw::c_array<const fastuidraw::vec2> ct,
+              const fastuidraw::vec2 &end)
+{
+  m_pts.reserve(ct.size() + 2);
+  m_pts.push_back(start);
+  m_pts.insert(m_pts.end(), ct.begin(), ct.end());
+  m_pts.push_back(end);
+
+  for(const fastuidraw::vec2 &pt : m_pts)
+    {
+      m_bb.union_point(pt);
+    }
+}
+
+const fastuidraw::reference_counted_ptr<BezierTessRegion>&
+BezierPrivate::
+start_region(void)
+{
+  std::call_once(m_start_region_once, [this]()
+                 {
+                   m_start_region = FASTUIDRAWnew BezierTessRegion(fastuidraw::make_c_array(m_pts));
+                 });
+  return m_start_region;
+}
+
 ////////////////////////////////////
 // fastuidraw::PathContour::bezier methods
 fastuidraw::PathContour::bezier::
@@ -894,12 +1282,8 @@ bezier(const reference_counted_ptr<const interpolator_base> &start,
        const vec2 &ct, const vec2 &end, enum PathEnums::edge_type_t tp):
   interpolator_generic(start, end, tp)
 {
-  BezierPrivate *d;
   vecN<vec2, 1> ctl(ct);
-
-  d = FASTUIDRAWnew BezierPrivate();
-  d->m_start_region = FASTUIDRAWnew BezierTessRegion(d->m_bb, start_pt(), ctl, end_pt());
-  m_d = d;
+  m_d = FASTUIDRAWnew BezierPrivate(start_pt(), ctl, end_pt());
 }
 
 fastuidraw::PathContour::bezier::
@@ -907,12 +1291,8 @@ bezier(const reference_counted_ptr<const interpolator_base> &start, const vec2 &
        const vec2 &ct2, const vec2 &end, enum PathEnums::edge_type_t tp):
   interpolator_generic(start, end, tp)
 {
-  BezierPrivate *d;
   vecN<vec2, 2> ctl(ct1, ct2);
-
-  d = FASTUIDRAWnew BezierPrivate();
-  d->m_start_region = FASTUIDRAWnew BezierTessRegion(d->m_bb, start_pt(), ctl, end_pt());
-  m_d = d;
+  m_d = FASTUIDRAWnew BezierPrivate(start_pt(), ctl, end_pt());
 }
 
 fastuidraw::PathContour::bezier::
@@ -921,11 +1301,7 @@ bezier(const reference_counted_ptr<const interpolator_base> &start,
        const vec2 &end, enum PathEnums::edge_type_t tp):
   interpolator_generic(start, end, tp)
 {
-  BezierPrivate *d;
-
-  d = FASTUIDRAWnew BezierPrivate();
-  d->m_start_region = FASTUIDRAWnew BezierTessRegion(d->m_bb, start_pt(), ctl, end_pt());
-  m_d = d;
+  m_d = FASTUIDRAWnew BezierPrivate(start_pt(), ctl, end_pt());
 }
 
 fastuidraw::PathContour::bezier::
@@ -952,7 +1328,7 @@ is_flat(void) const
 {
   BezierPrivate *d;
   d = static_cast<BezierPrivate*>(m_d);
-  return d->m_start_region->pts().size() <= 2;
+  return d->m_pts.size() <= 2;
 }
 
 fastuidraw::c_array<const fastuidraw::vec2>
@@ -961,7 +1337,7 @@ pts(void) const
 {
   BezierPrivate *d;
   d = static_cast<BezierPrivate*>(m_d);
-  return make_c_array(d->m_start_region->pts());
+  return make_c_array(d->m_pts);
 }
 
 void
@@ -986,7 +1362,7 @@ tessellate(reference_counted_ptr<tessellated_region> in_region,
 
   if (!in_region)
     {
-      in_region = d->m_start_region;
+      in_region = d->start_region();
     }
 
   BezierTessRegion *in_region_casted;
@@ -998,6 +1374,19 @@ tessellate(reference_counted_ptr<tessellated_region> in_region,
   *out_p = in_region_casted->left_child()->back();
 }
 
+fastuidraw::reference_counted_ptr<fastuidraw::PathContour::tessellation_state>
+fastuidraw::PathContour::bezier::
+produce_tessellation(const TessellatedPath::TessellationParams &tess_params,
+                     TessellatedPath::SegmentStorage *out_data,
+                     float *out_max_distance) const
+{
+  reference_counted_ptr<tessellation_state> return_value;
+
+  return_value = FASTUIDRAWnew BezierTessellationState(this);
+  return_value->resume_tessellation(tess_params, out_data, out_max_distance);
+  return return_value;
+}
+
 fastuidraw::PathContour::interpolator_base*
 fastuidraw::PathContour::bezier::
 deep_copy(const reference_counted_ptr<const interpolator_base> &prev) const
@@ -1012,7 +1401,7 @@ minimum_tessellation_recursion(void) const
   BezierPrivate *d;
   d = static_cast<BezierPrivate*>(m_d);
 
-  return 1 + uint32_log2(d->m_start_region->pts().size());
+  return 1 + uint32_log2(d->m_pts.size());
 }
 
 enum fastuidraw::return_code
@@ -1092,15 +1481,13 @@ add_to_builder(ShaderFilledPath::Builder *B, float) const
 }
 
 //////////////////////////////////////
-// fastuidraw::PathContour::arc methods
-fastuidraw::PathContour::arc::
-arc(const reference_counted_ptr<const interpolator_base> &start,
-    float angle, const vec2 &end, enum PathEnums::edge_type_t tp):
-  fastuidraw::PathContour::interpolator_base(start, end, tp)
+// ArcPrivate methods
+ArcPrivate::
+ArcPrivate(const fastuidraw::vec2 &start,
+           const fastuidraw::vec2 &end,
+           float angle)
 {
-  ArcPrivate *d;
-  d = FASTUIDRAWnew ArcPrivate();
-  m_d = d;
+  using namespace fastuidraw;
 
   float angle_coeff_dir;
   vec2 end_start, mid, n;
@@ -1114,8 +1501,8 @@ arc(const reference_counted_ptr<const interpolator_base> &start,
    * { t*n + mid | t real }
    */
   angle = fastuidraw::t_abs(angle);
-  end_start = end_pt() - start_pt();
-  mid = (end_pt() + start_pt()) * 0.5f;
+  end_start = end - start;
+  mid = (end + start) * 0.5f;
   n = vec2(-end_start.y(), end_start.x());
   s = fastuidraw::t_sin(angle * 0.5f);
   c = fastuidraw::t_cos(angle * 0.5f);
@@ -1129,18 +1516,28 @@ arc(const reference_counted_ptr<const interpolator_base> &start,
    *   |t| = 0.5/tan(angle/2) = 0.5 * c / s
    */
   t = angle_coeff_dir * 0.5f * c / s;
-  d->m_center = mid + (t * n);
+  m_center = mid + (t * n);
 
-  vec2 start_center(start_pt() - d->m_center);
+  vec2 start_center(start - m_center);
 
-  d->m_radius = start_center.magnitude();
-  d->m_start_angle = start_center.atan();
-  d->m_angle_speed = angle_coeff_dir * angle;
+  m_radius = start_center.magnitude();
+  m_start_angle = start_center.atan();
+  m_angle_speed = angle_coeff_dir * angle;
 
-  detail::bouding_box_union_arc(d->m_center, d->m_radius,
-                                d->m_start_angle,
-                                d->m_start_angle + d->m_angle_speed,
-                                &d->m_bb);
+  detail::bouding_box_union_arc(m_center, m_radius,
+                                m_start_angle,
+                                m_start_angle + m_angle_speed,
+                                &m_bb);
+}
+
+////////////////////////////////////
+// fastuidraw::PathContour::arc methods
+fastuidraw::PathContour::arc::
+arc(const reference_counted_ptr<const interpolator_base> &start,
+    float angle, const vec2 &end, enum PathEnums::edge_type_t tp):
+  fastuidraw::PathContour::interpolator_base(start, end, tp)
+{
+  m_d = FASTUIDRAWnew ArcPrivate(start_pt(), end_pt(), angle);
 }
 
 fastuidraw::PathContour::arc::
@@ -1238,6 +1635,210 @@ add_to_builder(ShaderFilledPath::Builder *builder, float tol) const
 }
 
 ///////////////////////////////////
+// PathContourPrivate methods
+void
+PathContourPrivate::
+add_edge(enum verb_t verb, enum fastuidraw::PathEnums::edge_type_t etp,
+         const fastuidraw::vec2 &pt, float angle)
+{
+  using namespace fastuidraw;
+
+  FASTUIDRAWassert(!m_pts.empty());
+  FASTUIDRAWassert(!m_closed);
+  FASTUIDRAWassert(verb != generic_verb);
+  FASTUIDRAWassert(verb == bezier_verb || m_current_control_points.empty());
+
+  Edge E;
+  vec2 start(m_pts.back());
+
+  /* the first edge of a contour always starts a new edge */
+  E.m_verb = verb;
+  E.m_edge_type = m_edges.empty() ? PathEnums::starts_new_edge : etp;
+  E.m_angle = angle;
+
+  m_pts.insert(m_pts.end(), m_current_control_points.begin(), m_current_control_points.end());
+  m_pts.push_back(pt);
+  E.m_end = m_pts.size() - 1;
+  m_edges.push_back(E);
+  m_current_control_points.clear();
+
+  switch (verb)
+    {
+    case flat_verb:
+      m_bb.union_point(start);
+      m_bb.union_point(pt);
+      break;
+
+    case bezier_verb:
+      {
+        c_array<const vec2> pts(edge_pts(m_edges.size() - 1));
+        m_bb.union_points(pts.begin(), pts.end());
+        m_is_flat = m_is_flat && pts.size() <= 2;
+      }
+      break;
+
+    case arc_verb:
+      {
+        ArcPrivate A(start, pt, angle);
+        m_bb.union_box(A.m_bb);
+        m_is_flat = false;
+      }
+      break;
+
+    default:
+      FASTUIDRAWassert(!"Bad verb");
+    }
+}
+
+void
+PathContourPrivate::
+add_generic_edge(const fastuidraw::reference_counted_ptr<const fastuidraw::PathContour::interpolator_base> &p)
+{
+  using namespace fastuidraw;
+
+  FASTUIDRAWassert(!m_closed);
+  FASTUIDRAWassert(m_current_control_points.empty());
+
+  Edge E;
+  Rect R;
+
+  E.m_verb = generic_verb;
+  E.m_edge_type = p->edge_type();
+  E.m_generic = m_generic.size();
+  m_generic.push_back(p);
+
+  m_pts.push_back(p->end_pt());
+  E.m_end = m_pts.size() - 1;
+  m_edges.push_back(E);
+
+  p->approximate_bounding_box(&R);
+  m_bb.union_point(R.m_min_point);
+  m_bb.union_point(R.m_max_point);
+  m_is_flat = m_is_flat && p->is_flat();
+}
+
+fastuidraw::reference_counted_ptr<const fastuidraw::PathContour::interpolator_base>
+PathContourPrivate::
+create_interpolator(unsigned int I,
+                    const fastuidraw::reference_counted_ptr<const fastuidraw::PathContour::interpolator_base> &prev) const
+{
+  using namespace fastuidraw;
+
+  const Edge &E(m_edges[I]);
+  const vec2 &end(m_pts[E.m_end]);
+  enum PathEnums::edge_type_t etp;
+
+  etp = static_cast<enum PathEnums::edge_type_t>(E.m_edge_type);
+  switch (E.m_verb)
+    {
+    case flat_verb:
+      return FASTUIDRAWnew PathContour::flat(prev, end, etp);
+
+    case bezier_verb:
+      {
+        c_array<const vec2> pts(edge_pts(I));
+        return FASTUIDRAWnew PathContour::bezier(prev, pts.sub_array(1, pts.size() - 2), end, etp);
+      }
+
+    case arc_verb:
+      return FASTUIDRAWnew PathContour::arc(prev, E.m_angle, end, etp);
+
+    default:
+      FASTUIDRAWassert(E.m_verb == generic_verb);
+      FASTUIDRAWassert(m_generic[E.m_generic]->prev_interpolator() == prev);
+      return m_generic[E.m_generic];
+    }
+}
+
+void
+PathContourPrivate::
+add_last_interpolator(void)
+{
+  FASTUIDRAWassert(m_has_interpolators);
+  m_interpolators.push_back(create_interpolator(m_edges.size() - 1, m_interpolators.back()));
+}
+
+void
+PathContourPrivate::
+set_end_to_start(const fastuidraw::reference_counted_ptr<const fastuidraw::PathContour::interpolator_base> &p,
+                 InterpolatorBasePrivate *first)
+{
+  /* hack-evil: we are going to replace m_interpolator[0]
+   * with p, we also need to change m_interpolator[1]->m_prev
+   * as well to p.
+   */
+  FASTUIDRAWassert(m_interpolators.size() > 1);
+  first->m_prev = p.get();
+  FASTUIDRAWassert(first->m_type == fastuidraw::PathEnums::starts_new_edge);
+
+  m_interpolators[0] = p;
+  m_end_to_start = p;
+}
+
+////////////////////////////////////////////
+// fastuidraw::detail::PathContourEdges methods
+fastuidraw::detail::PathContourEdges::
+PathContourEdges(const PathContour &contour):
+  m_d(contour.m_d)
+{}
+
+unsigned int
+fastuidraw::detail::PathContourEdges::
+number_edges(void) const
+{
+  const PathContourPrivate *d;
+  d = static_cast<const PathContourPrivate*>(m_d);
+  return d->m_edges.size();
+}
+
+enum fastuidraw::detail::PathContourEdges::verb_t
+fastuidraw::detail::PathContourEdges::
+verb(unsigned int I) const
+{
+  const PathContourPrivate *d;
+  d = static_cast<const PathContourPrivate*>(m_d);
+  return static_cast<enum verb_t>(d->m_edges[I].m_verb);
+}
+
+enum fastuidraw::PathEnums::edge_type_t
+fastuidraw::detail::PathContourEdges::
+edge_type(unsigned int I) const
+{
+  const PathContourPrivate *d;
+  d = static_cast<const PathContourPrivate*>(m_d);
+  return static_cast<enum PathEnums::edge_type_t>(d->m_edges[I].m_edge_type);
+}
+
+fastuidraw::c_array<const fastuidraw::vec2>
+fastuidraw::detail::PathContourEdges::
+points(unsigned int I) const
+{
+  const PathContourPrivate *d;
+  d = static_cast<const PathContourPrivate*>(m_d);
+  return d->edge_pts(I);
+}
+
+float
+fastuidraw::detail::PathContourEdges::
+angle(unsigned int I) const
+{
+  const PathContourPrivate *d;
+  d = static_cast<const PathContourPrivate*>(m_d);
+  FASTUIDRAWassert(d->m_edges[I].m_verb == PathContourPrivate::arc_verb);
+  return d->m_edges[I].m_angle;
+}
+
+const fastuidraw::reference_counted_ptr<const fastuidraw::PathContour::interpolator_base>&
+fastuidraw::detail::PathContourEdges::
+generic(unsigned int I) const
+{
+  const PathContourPrivate *d;
+  d = static_cast<const PathContourPrivate*>(m_d);
+  FASTUIDRAWassert(d->m_edges[I].m_verb == PathContourPrivate::generic_verb);
+  return d->m_generic[d->m_edges[I].m_generic];
+}
+
+/////////////////////////////////
 // fastuidraw::PathContour methods
 fastuidraw::PathContour::
 PathContour(void)
@@ -1256,22 +1857,65 @@ fastuidraw::PathContour::
 
 void
 fastuidraw::PathContour::
-start(const vec2 &start_pt)
+make_interpolators(void) const
 {
   PathContourPrivate *d;
   d = static_cast<PathContourPrivate*>(m_d);
 
-  FASTUIDRAWassert(d->m_interpolators.empty());
-  FASTUIDRAWassert(!d->m_end_to_start);
+  std::call_once(d->m_interpolators_once, [d]()
+                 {
+                   unsigned int n;
 
-  d->m_start_pt = start_pt;
+                   FASTUIDRAWassert(!d->m_pts.empty());
 
-  /* m_interpolators[0] is an "empty" interpolator whose only purpose
-   * it to provide a "previous" for the first interpolator added.
-   */
-  reference_counted_ptr<const interpolator_base> h;
-  h = FASTUIDRAWnew FakeInterpolator(d->m_start_pt);
-  d->m_interpolators.push_back(h);
+                   /* m_interpolators[0] is an "empty" interpolator whose only purpose
+                    * it to provide a "previous" for the first interpolator added.
+                    */
+                   d->m_interpolators.reserve(d->m_edges.size() + 1);
+                   d->m_interpolators.push_back(FASTUIDRAWnew FakeInterpolator(d->m_pts.front()));
+
+                   n = (d->m_closed) ? d->m_edges.size() - 1 : d->m_edges.size();
+                   for (unsigned int i = 0; i < n; ++i)
+                     {
+                       d->m_interpolators.push_back(d->create_interpolator(i, d->m_interpolators.back()));
+                     }
+
+                   if (d->m_closed)
+                     {
+                       d->set_end_to_start(d->create_interpolator(n, d->m_interpolators.back()),
+                                           static_cast<InterpolatorBasePrivate*>(d->m_interpolators[1]->m_d));
+                     }
+                   d->m_has_interpolators = true;
+                 });
+}
+
+void
+fastuidraw::PathContour::
+mark_closed(void)
+{
+  PathContourPrivate *d;
+  d = static_cast<PathContourPrivate*>(m_d);
+
+  FASTUIDRAWassert(!d->m_closed);
+  FASTUIDRAWassert(d->m_edges.size() > 1);
+
+  d->m_closed = true;
+  if (d->m_has_interpolators)
+    {
+      d->set_end_to_start(d->create_interpolator(d->m_edges.size() - 1, d->m_interpolators.back()),
+                          static_cast<InterpolatorBasePrivate*>(d->m_interpolators[1]->m_d));
+    }
+}
+
+void
+fastuidraw::PathContour::
+start(const vec2 &start_pt)
+{
+  PathContourPrivate *d;
+  d = static_cast<PathContourPrivate*>(m_d);
+
+  FASTUIDRAWassert(d->m_pts.empty());
+  d->m_pts.push_back(start_pt);
 }
 
 void
@@ -1281,7 +1925,7 @@ add_control_point(const fastuidraw::vec2 &pt)
   PathContourPrivate *d;
   d = static_cast<PathContourPrivate*>(m_d);
 
-  FASTUIDRAWassert(!d->m_end_to_start);
+  FASTUIDRAWassert(!d->m_closed);
   d->m_current_control_points.push_back(pt);
 }
 
@@ -1301,29 +1945,28 @@ to_point(const fastuidraw::vec2 &pt, enum PathEnums::edge_type_t etp)
   PathContourPrivate *d;
   d = static_cast<PathContourPrivate*>(m_d);
 
-  reference_counted_ptr<const interpolator_base> h;
-
-  if (d->m_current_control_points.empty())
-    {
-      h = FASTUIDRAWnew flat(prev_interpolator(), pt, etp);
-    }
-  else
+  d->add_edge(d->m_current_control_points.empty() ?
+              PathContourPrivate::flat_verb :
+              PathContourPrivate::bezier_verb,
+              etp, pt);
+  if (d->m_has_interpolators)
     {
-      h = FASTUIDRAWnew bezier(prev_interpolator(),
-                               make_c_array(d->m_current_control_points),
-                               pt, etp);
+      d->add_last_interpolator();
     }
-  d->m_current_control_points.clear();
-  to_generic(h);
 }
 
 void
 fastuidraw::PathContour::
 to_arc(float angle, const vec2 &pt, enum PathEnums::edge_type_t etp)
 {
-  reference_counted_ptr<const interpolator_base> h;
-  h = FASTUIDRAWnew arc(prev_interpolator(), angle, pt, etp);
-  to_generic(h);
+  PathContourPrivate *d;
+  d = static_cast<PathContourPrivate*>(m_d);
+
+  d->add_edge(PathContourPrivate::arc_verb, etp, pt, angle);
+  if (d->m_has_interpolators)
+    {
+      d->add_last_interpolator();
+    }
 }
 
 void
@@ -1333,18 +1976,14 @@ to_generic(const reference_counted_ptr<const PathContour::interpolator_base> &p)
   PathContourPrivate *d;
   d = static_cast<PathContourPrivate*>(m_d);
 
-  FASTUIDRAWassert(!d->m_interpolators.empty());
+  FASTUIDRAWassert(!d->m_pts.empty());
   FASTUIDRAWassert(d->m_current_control_points.empty());
-  FASTUIDRAWassert(!d->m_end_to_start);
+  FASTUIDRAWassert(!d->m_closed);
   FASTUIDRAWassert(p->prev_interpolator() == prev_interpolator());
 
-  d->m_is_flat = d->m_is_flat && p->is_flat();
-  d->m_interpolators.push_back(p);
-
-  Rect R;
-  p->approximate_bounding_box(&R);
-  d->m_bb.union_point(R.m_min_point);
-  d->m_bb.union_point(R.m_max_point);
+  make_interpolators();
+  d->add_generic_edge(p);
+  d->add_last_interpolator();
 }
 
 void
@@ -1354,40 +1993,27 @@ close_generic(reference_counted_ptr<const interpolator_base> p)
   PathContourPrivate *d;
   d = static_cast<PathContourPrivate*>(m_d);
 
-  FASTUIDRAWassert(!d->m_end_to_start);
+  FASTUIDRAWassert(!d->m_closed);
   FASTUIDRAWassert(d->m_current_control_points.empty());
-  FASTUIDRAWassert(!d->m_interpolators.empty());
+  FASTUIDRAWassert(!d->m_pts.empty());
   FASTUIDRAWassert(p->prev_interpolator() == prev_interpolator());
 
-  if (d->m_interpolators.size() == 1)
+  make_interpolators();
+  if (d->m_edges.empty())
     {
-      /* we have only the fake interpolator which will be replaced
-       * by p; to avoid needing to handle the corner cases of
+      /* to avoid needing to handle the corner cases of
        * having just one interpolator we will add an additional
-       * interpolator -after- p which starts and ends on the
-       * end point of p.
+       * edge -after- p which starts and ends on the end point
+       * of p.
        */
-      reference_counted_ptr<const interpolator_base> h;
-
       to_generic(p);
-      h = FASTUIDRAWnew flat(p, p->end_pt(), PathEnums::starts_new_edge);
-      p = h;
+      d->add_edge(PathContourPrivate::flat_verb, PathEnums::starts_new_edge, p->end_pt());
     }
-
-  /* hack-evil: we are going to replace m_interpolator[0]
-   * with p, we also need to change m_interpolator[1]->m_prev
-   * as well to p.
-   */
-  FASTUIDRAWassert(d->m_interpolators.size() > 1);
-
-  InterpolatorBasePrivate *q;
-  q = static_cast<InterpolatorBasePrivate*>(d->m_interpolators[1]->m_d);
-  q->m_prev = p.get();
-  FASTUIDRAWassert(q->m_type == PathEnums::starts_new_edge);
-
-  d->m_interpolators[0] = p;
-  d->m_end_to_start = p;
-  d->m_is_flat = d->m_is_flat && p->is_flat();
+  else
+    {
+      d->add_generic_edge(p);
+    }
+  mark_closed();
 }
 
 void
@@ -1397,21 +2023,22 @@ close(enum PathEnums::edge_type_t etp)
   PathContourPrivate *d;
   d = static_cast<PathContourPrivate*>(m_d);
 
-  reference_counted_ptr<const interpolator_base> h;
+  enum PathContourPrivate::verb_t verb;
+  vec2 start_pt(d->m_pts.front());
 
-  if (d->m_current_control_points.empty())
-    {
-      h = FASTUIDRAWnew flat(prev_interpolator(), d->m_start_pt, etp);
-    }
-  else
+  verb = d->m_current_control_points.empty() ?
+    PathContourPrivate::flat_verb :
+    PathContourPrivate::bezier_verb;
+
+  if (d->m_edges.empty())
     {
-      h = FASTUIDRAWnew bezier(prev_interpolator(),
-                               make_c_array(d->m_current_control_points),
-                               d->m_start_pt, etp);
+      /* see close_generic() */
+      to_point(start_pt, etp);
+      verb = PathContourPrivate::flat_verb;
+      etp = PathEnums::starts_new_edge;
     }
-
-  d->m_current_control_points.clear();
-  close_generic(h);
+  d->add_edge(verb, etp, start_pt);
+  mark_closed();
 }
 
 void
@@ -1421,9 +2048,19 @@ close_arc(float angle, enum PathEnums::edge_type_t etp)
   PathContourPrivate *d;
   d = static_cast<PathContourPrivate*>(m_d);
 
-  reference_counted_ptr<const interpolator_base> h;
-  h = FASTUIDRAWnew arc(prev_interpolator(), angle, d->m_start_pt, etp);
-  close_generic(h);
+  vec2 start_pt(d->m_pts.front());
+
+  if (d->m_edges.empty())
+    {
+      /* see close_generic() */
+      to_arc(angle, start_pt, etp);
+      d->add_edge(PathContourPrivate::flat_verb, PathEnums::starts_new_edge, start_pt);
+    }
+  else
+    {
+      d->add_edge(PathContourPrivate::arc_verb, etp, start_pt, angle);
+    }
+  mark_closed();
 }
 
 unsigned int
@@ -1432,15 +2069,22 @@ number_points(void) const
 {
   PathContourPrivate *d;
   d = static_cast<PathContourPrivate*>(m_d);
-  return d->m_interpolators.size();
+
+  /* the closing edge ends at the start point */
+  if (d->m_pts.empty())
+    {
+      return 0;
+    }
+  return (d->m_closed) ? d->m_edges.size() : d->m_edges.size() + 1;
 }
 
 unsigned int
 fastuidraw::PathContour::
 number_interpolators(void) const
 {
-  unsigned int b(!closed()), n(number_points());
-  return (n != 0) ? n - b : 0;
+  PathContourPrivate *d;
+  d = static_cast<PathContourPrivate*>(m_d);
+  return d->m_edges.size();
 }
 
 const fastuidraw::vec2&
@@ -1449,7 +2093,11 @@ point(unsigned int I) const
 {
   PathContourPrivate *d;
   d = static_cast<PathContourPrivate*>(m_d);
-  return d->m_interpolators[I]->end_pt();
+
+  FASTUIDRAWassert(I < number_points());
+  return (I == 0) ?
+    d->m_pts.front() :
+    d->m_pts[d->m_edges[I - 1].m_end];
 }
 
 const fastuidraw::reference_counted_ptr<const fastuidraw::PathContour::interpolator_base>&
@@ -1459,6 +2107,8 @@ interpolator(unsigned int I) const
   PathContourPrivate *d;
   d = static_cast<PathContourPrivate*>(m_d);
 
+  make_interpolators();
+
   /* m_interpolator[I + 1] connects point(I) to point(I + 1). */
   unsigned int J(I + 1);
   FASTUIDRAWassert(J != 0u);
@@ -1480,6 +2130,7 @@ prev_interpolator(void)
   PathContourPrivate *d;
   d = static_cast<PathContourPrivate*>(m_d);
 
+  make_interpolators();
   FASTUIDRAWassert(!d->m_interpolators.empty());
   return d->m_interpolators[d->m_interpolators.size() - 1];
 }
@@ -1491,7 +2142,7 @@ closed(void) const
   PathContourPrivate *d;
   d = static_cast<PathContourPrivate*>(m_d);
 
-  return d->m_end_to_start;
+  return d->m_closed;
 }
 
 bool
@@ -1503,6 +2154,21 @@ is_flat(void) const
   return d->m_is_flat;
 }
 
+const fastuidraw::reference_counted_ptr<const fastuidraw::TessellatedPath>&
+fastuidraw::PathContour::
+tessellation(void) const
+{
+  PathContourPrivate *d;
+  d = static_cast<PathContourPrivate*>(m_d);
+
+  FASTUIDRAWassert(closed());
+  std::call_once(d->m_tessellation_once, [d, this]()
+                 {
+                   d->m_tessellation = FASTUIDRAWnew TessellatedPath(*this);
+                 });
+  return d->m_tessellation;
+}
+
 fastuidraw::PathContour*
 fastuidraw::PathContour::
 deep_copy(void)
@@ -1514,31 +2180,53 @@ deep_copy(void)
   d = static_cast<PathContourPrivate*>(m_d);
   r = static_cast<PathContourPrivate*>(return_value->m_d);
 
-  r->m_start_pt = d->m_start_pt;
+  r->m_pts = d->m_pts;
+  r->m_edges = d->m_edges;
   r->m_current_control_points = d->m_current_control_points;
+  r->m_closed = d->m_closed;
+  r->m_bb = d->m_bb;
   r->m_is_flat = d->m_is_flat;
 
-  /* now we need to do the deep copies of the interpolator. eww. */
-  r->m_interpolators.resize(d->m_interpolators.size());
-
-  r->m_interpolators[0] = FASTUIDRAWnew FakeInterpolator(r->m_start_pt);
-  for(unsigned int i = 1, endi = d->m_interpolators.size(); i < endi; ++i)
+  /* without generic edges, the copy makes its interpolators
+   * from the copied edges if and when they are asked for.
+   */
+  if (d->m_generic.empty())
     {
-      r->m_interpolators[i] = d->m_interpolators[i]->deep_copy(r->m_interpolators[i-1]);
+      return return_value;
     }
 
-  if (d->m_end_to_start)
+  /* now we need to do the deep copies of the interpolator. eww. */
+  make_interpolators();
+  std::call_once(r->m_interpolators_once, [d, r]()
+                 {
+                   r->m_interpolators.resize(d->m_interpolators.size());
+
+                   r->m_interpolators[0] = FASTUIDRAWnew FakeInterpolator(r->m_pts.front());
+                   for(unsigned int i = 1, endi = d->m_interpolators.size(); i < endi; ++i)
+                     {
+                       r->m_interpolators[i] = d->m_interpolators[i]->deep_copy(r->m_interpolators[i-1]);
+                     }
+
+                   if (d->m_end_to_start)
+                     {
+                       r->set_end_to_start(d->m_end_to_start->deep_copy(r->m_interpolators.back()),
+                                           static_cast<InterpolatorBasePrivate*>(r->m_interpolators[1]->m_d));
+                     }
+                   r->m_has_interpolators = true;
+                 });
+
+  /* the generic edges of the copy are the copies of the
+   * interpolators of the generic edges.
+   */
+  r->m_generic.resize(d->m_generic.size());
+  for (unsigned int i = 0, endi = r->m_edges.size(); i < endi; ++i)
     {
-      r->m_interpolators[0] = d->m_end_to_start->deep_copy(r->m_interpolators.back());
-      r->m_end_to_start = r->m_interpolators[0];
-
-      //we also need to replace r->m_interpolators[1]->m_prev with
-      //the new value for r->m_interpolators[0]
-      FASTUIDRAWassert(r->m_interpolators.size() > 1);
-      InterpolatorBasePrivate *q;
-      q = static_cast<InterpolatorBasePrivate*>(r->m_interpolators[1]->m_d);
-      q->m_prev = r->m_end_to_start.get();
+      if (r->m_edges[i].m_verb == PathContourPrivate::generic_verb)
+        {
+          r->m_generic[r->m_edges[i].m_generic] = return_value->interpolator(i);
+        }
     }
+
   return return_value;
 }
 
@@ -1557,27 +2245,58 @@ approximate_bounding_box(Rect *out_bb) const
 
 /////////////////////////////////
 // TessellatedPathList methods
+TessellatedPathList::
+TessellatedPathList(const TessellatedPathList &obj)
+{
+  std::lock_guard<std::mutex> m(obj.m_data_mutex);
+  m_data = obj.m_data;
+  m_done = obj.m_done;
+}
+
 const typename TessellatedPathList::TessellatedPathRef&
 TessellatedPathList::
 tessellation(const fastuidraw::Path &path, float max_distance)
+{
+  const TessellatedPathRef *return_value;
+
+  {
+    std::lock_guard<std::mutex> m(m_data_mutex);
+    return_value = find(path, max_distance);
+    if (return_value)
+      {
+        return *return_value;
+      }
+  }
+
+  std::lock_guard<std::mutex> r(m_refine_mutex);
+  refine(path, max_distance);
+
+  std::lock_guard<std::mutex> m(m_data_mutex);
+  return_value = find(path, max_distance);
+  FASTUIDRAWassert(return_value);
+  return *return_value;
+}
+
+const typename TessellatedPathList::TessellatedPathRef*
+TessellatedPathList::
+find(const fastuidraw::Path &path, float max_distance) const
 {
   using namespace fastuidraw;
   using namespace detail;
 
   if (m_data.empty())
     {
-      TessellationParams params;
-      m_data.push_back(FASTUIDRAWnew TessellatedPath(path, params, &m_refiner));
+      return nullptr;
     }
 
   if (max_distance <= 0.0 || path.is_flat())
     {
-      return m_data.front();
+      return &m_data.front();
     }
 
   if (m_data.back()->max_distance() <= max_distance)
     {
-      typename std::vector<TessellatedPathRef>::const_iterator iter;
+      typename std::deque<TessellatedPathRef>::const_iterator iter;
       iter = std::lower_bound(m_data.begin(),
                               m_data.end(),
                               max_distance,
@@ -1586,12 +2305,53 @@ tessellation(const fastuidraw::Path &path, float max_distance)
       FASTUIDRAWassert(iter != m_data.end());
       FASTUIDRAWassert(*iter);
       FASTUIDRAWassert((*iter)->max_distance() <= max_distance);
-      return *iter;
+      return &*iter;
     }
 
   if (m_done)
     {
-      return m_data.back();
+      return &m_data.back();
+    }
+
+  return nullptr;
+}
+
+void
+TessellatedPathList::
+add(const TessellatedPathRef &ref, bool done)
+{
+  std::lock_guard<std::mutex> m(m_data_mutex);
+
+  /* we only add a tessellation if it is finer than the last one
+   * added.
+   */
+  if (m_data.empty() || m_data.back()->max_distance() > ref->max_distance())
+    {
+      m_data.push_back(ref);
+    }
+  m_done = m_done || done;
+}
+
+void
+TessellatedPathList::
+refine(const fastuidraw::Path &path, float max_distance)
+{
+  using namespace fastuidraw;
+  using namespace detail;
+
+  /* only the thread holding m_refine_mutex adds to m_data
+   * or sets m_done, so they can be read here without
+   * locking m_data_mutex.
+   */
+  if (m_data.empty())
+    {
+      TessellationParams params;
+      add(FASTUIDRAWnew TessellatedPath(path, params, &m_refiner), false);
+    }
+
+  if (max_distance <= 0.0 || path.is_flat())
+    {
+      return;
     }
 
   float current_max_distance;
@@ -1604,33 +2364,40 @@ tessellation(const fastuidraw::Path &path, float max_distance)
       while(!m_done && m_data.back()->max_distance() > current_max_distance)
         {
           TessellatedPathRef ref;
+          bool done;
 
-          m_refiner->refine_tessellation(current_max_distance, 1);
-          ref = m_refiner->tessellated_path();
-
-          /* we only add a tessellation if it is finer than the last one
-           * added. However, we do not abort if it is not as sometimes
-           * (especially with arc-tessellation) more refinement can make
-           * the tessellation improve.
-           */
-          if (m_data.back()->max_distance() > ref->max_distance())
+          if (!m_refiner)
             {
-              m_data.push_back(ref);
+              /* the tessellations were copied from another
+               * list, create a Refiner of our own.
+               */
+              TessellationParams params;
+              TessellatedPathRef start;
+
+              start = FASTUIDRAWnew TessellatedPath(path, params, &m_refiner);
             }
 
+          m_refiner->refine_tessellation(current_max_distance, 1);
+          ref = m_refiner->tessellated_path();
+
           /* We set an absolute abort at max_refine_recursion_limit
            * which represents that after sub-dividing that much, one
            * is just handling numerical garbage.
            */
-          if (ref->max_recursion() > MAX_REFINE_RECURSION_LIMIT)
+          done = (ref->max_recursion() > MAX_REFINE_RECURSION_LIMIT);
+
+          /* add() only adds a tessellation if it is finer than the
+           * last one added. However, we do not abort if it is not as
+           * sometimes (especially with arc-tessellation) more refinement
+           * can make the tessellation improve.
+           */
+          add(ref, done);
+          if (done)
             {
-              m_done = true;
               m_refiner = nullptr;
             }
         }
     }
-
-  return m_data.back();
 }
 
 /////////////////////////////////
@@ -1650,12 +2417,17 @@ PathPrivate(fastuidraw::Path *p, const PathPrivate &obj):
   m_contours(obj.m_contours),
   m_next_edge_type(obj.m_next_edge_type),
   m_tess_list(obj.m_tess_list),
-  m_start_check_bb(obj.m_start_check_bb),
-  m_bb(obj.m_bb),
   m_is_flat(obj.m_is_flat),
-  m_shader_filled_path(obj.m_shader_filled_path),
+  m_contour_registry(obj.m_contour_registry),
   m_p(p)
 {
+  {
+    std::lock_guard<std::mutex> m(obj.m_mutex);
+    m_start_check_bb = obj.m_start_check_bb;
+    m_bb = obj.m_bb;
+    m_shader_filled_path = obj.m_shader_filled_path;
+  }
+
   /* if the last contour is not closed, we need to do a
    * deep copy on it.
    */
@@ -1803,6 +2575,10 @@ add_contour(const reference_counted_ptr<const PathContour> &pcontour)
     {
       contour = contour->deep_copy();
     }
+  else if (d->m_contour_registry)
+    {
+      contour = d->m_contour_registry->intern(pcontour).const_cast_ptr<PathContour>();
+    }
 
   d->m_is_flat = d->m_is_flat && contour->is_flat();
   d->clear_tesses();
@@ -1848,6 +2624,10 @@ add_contours(const Path &path)
         {
           c = c->deep_copy();
         }
+      else if (d->m_contour_registry)
+        {
+          c = d->m_contour_registry->intern(c).const_cast_ptr<PathContour>();
+        }
       d->m_contours.push_back(c);
     }
 
@@ -1933,6 +2713,7 @@ approximate_bounding_box(Rect *out_bb) const
   PathPrivate *d;
   d = static_cast<PathPrivate*>(m_d);
 
+  std::lock_guard<std::mutex> m(d->m_mutex);
   for(unsigned endi = d->m_contours.size();
       d->m_start_check_bb < endi; ++d->m_start_check_bb)
     {
@@ -2115,6 +2896,25 @@ close_contour_custom(const reference_counted_ptr<const PathContour::interpolator
   return *this;
 }
 
+fastuidraw::Path&
+fastuidraw::Path::
+contour_registry(const reference_counted_ptr<PathContourRegistry> &v)
+{
+  PathPrivate *d;
+  d = static_cast<PathPrivate*>(m_d);
+  d->m_contour_registry = v;
+  return *this;
+}
+
+const fastuidraw::reference_counted_ptr<fastuidraw::PathContourRegistry>&
+fastuidraw::Path::
+contour_registry(void) const
+{
+  PathPrivate *d;
+  d = static_cast<PathPrivate*>(m_d);
+  return d->m_contour_registry;
+}
+
 unsigned int
 fastuidraw::Path::
 number_contours(void) const
@@ -2140,6 +2940,7 @@ shader_filled_path(void) const
   PathPrivate *d;
   d = static_cast<PathPrivate*>(m_d);
 
+  std::lock_guard<std::mutex> m(d->m_mutex);
   if (!d->m_shader_filled_path)
     {
       ShaderFilledPath::Builder B;
@@ -0,0 +1,337 @@
+/*!
+ * \file path_contour_registry.cpp
+ * \brief file path_contour_registry.cpp
+ *
+ * Copyright 2019 by Intel.
+ *
+ * Contact: kevin.rogovin@intel.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@intel.com>
+ *
+ */
+
+#include <vector>
+#include <deque>
+#include <list>
+#include <mutex>
+#include <cstring>
+#include <fastuidraw/path.hpp>
+#include <fastuidraw/path_contour_registry.hpp>
+#include "private/flat_hash_index.hpp"
+#include "private/path_contour_edges.hpp"
+
+namespace
+{
+  void
+  add_value(float f, std::vector<uint32_t> *dst)
+  {
+    uint32_t v;
+
+    std::memcpy(&v, &f, sizeof(v));
+    dst->push_back(v);
+  }
+
+  void
+  add_value(const fastuidraw::vec2 &p, std::vector<uint32_t> *dst)
+  {
+    add_value(p.x(), dst);
+    add_value(p.y(), dst);
+  }
+
+  /* Writes the contents of a closed contour as a sequence of
+   * words; two contours have the same contents exactly when
+   * their sequences are the same. Returns false if the contour
+   * has a generic interpolator. The contents are read from the
+   * compact storage of the edges so that the interpolator_base
+   * objects of the contour are not made.
+   */
+  bool
+  contour_contents(const fastuidraw::PathContour &contour,
+                   std::vector<uint32_t> *dst)
+  {
+    using namespace fastuidraw;
+
+    detail::PathContourEdges edges(contour);
+
+    dst->push_back(edges.number_edges());
+    add_value(contour.point(0), dst);
+    for (unsigned int i = 0, endi = edges.number_edges(); i < endi; ++i)
+      {
+        enum detail::PathContourEdges::verb_t verb(edges.verb(i));
+        c_array<const vec2> pts(edges.points(i));
+
+        dst->push_back(edges.edge_type(i));
+        dst->push_back(verb);
+        switch (verb)
+          {
+          case detail::PathContourEdges::flat_verb:
+            add_value(pts.back(), dst);
+            break;
+
+          case detail::PathContourEdges::bezier_verb:
+            dst->push_back(pts.size());
+            for (const vec2 &p : pts.sub_array(1))
+              {
+                add_value(p, dst);
+              }
+            break;
+
+          case detail::PathContourEdges::arc_verb:
+            add_value(pts.back(), dst);
+            add_value(edges.angle(i), dst);
+            break;
+
+          default:
+            return false;
+          }
+      }
+    return true;
+  }
+
+  class ContourKey
+  {
+  public:
+    ContourKey(void):
+      m_contents(nullptr),
+      m_hash(0u)
+    {}
+
+    explicit
+    ContourKey(const std::vector<uint32_t> *contents):
+      m_contents(contents),
+      m_hash(0xcbf29ce484222325ull)
+    {
+      for (uint32_t v : *contents)
+        {
+          m_hash = fastuidraw::detail::hash_mix(m_hash ^ v);
+        }
+    }
+
+    ContourKey(const std::vector<uint32_t> *contents, uint64_t hash):
+      m_contents(contents),
+      m_hash(hash)
+    {}
+
+    uint64_t
+    hash(void) const
+    {
+      return m_hash;
+    }
+
+    bool
+    operator==(const ContourKey &rhs) const
+    {
+      return m_hash == rhs.m_hash && *m_contents == *rhs.m_contents;
+    }
+
+  private:
+    const std::vector<uint32_t> *m_contents;
+    uint64_t m_hash;
+  };
+
+  class Entry
+  {
+  public:
+    std::vector<uint32_t> m_contents;
+    uint64_t m_hash;
+    fastuidraw::reference_counted_ptr<const fastuidraw::PathContour> m_contour;
+
+    /* location in PathContourRegistryPrivate::m_lru */
+    std::list<unsigned int>::iterator m_lru_location;
+  };
+
+  class PathContourRegistryPrivate
+  {
+  public:
+    PathContourRegistryPrivate(void):
+      m_max_contours(fastuidraw::PathContourRegistry::default_max_contours),
+      m_number_hits(0)
+    {}
+
+    /* release least recently used entries until there
+     * are no more than max_contours entries.
+     */
+    void
+    evict(unsigned int max_contours);
+
+    mutable std::mutex m_mutex;
+
+    /* a std::deque so that the ContourKey values of
+     * m_index, which point to Entry::m_contents, stay
+     * valid as entries are added; the slots of released
+     * entries are listed in m_free_slots and reused.
+     */
+    std::deque<Entry> m_entries;
+    std::vector<unsigned int> m_free_slots;
+    fastuidraw::detail::FlatHashIndex<ContourKey> m_index;
+
+    /* slots of m_entries in use, ordered from least
+     * recently used to most recently used.
+     */
+    std::list<unsigned int> m_lru;
+
+    unsigned int m_max_contours;
+    unsigned int m_number_hits;
+  };
+}
+
+////////////////////////////////////////////
+// PathContourRegistryPrivate methods
+void
+PathContourRegistryPrivate::
+evict(unsigned int max_contours)
+{
+  while (m_lru.size() > max_contours)
+    {
+      unsigned int slot(m_lru.front());
+      Entry &E(m_entries[slot]);
+      bool found;
+
+      found = m_index.erase(ContourKey(&E.m_contents, E.m_hash));
+      FASTUIDRAWassert(found);
+      FASTUIDRAWunused(found);
+
+      m_lru.pop_front();
+      E.m_contents.clear();
+      E.m_contour.clear();
+      m_free_slots.push_back(slot);
+    }
+}
+
+////////////////////////////////////////
+// fastuidraw::PathContourRegistry methods
+fastuidraw::PathContourRegistry::
+PathContourRegistry(void)
+{
+  m_d = FASTUIDRAWnew PathContourRegistryPrivate();
+}
+
+fastuidraw::PathContourRegistry::
+~PathContourRegistry()
+{
+  PathContourRegistryPrivate *d;
+  d = static_cast<PathContourRegistryPrivate*>(m_d);
+  FASTUIDRAWdelete(d);
+  m_d = nullptr;
+}
+
+fastuidraw::reference_counted_ptr<const fastuidraw::PathContour>
+fastuidraw::PathContourRegistry::
+intern(const reference_counted_ptr<const PathContour> &contour)
+{
+  PathContourRegistryPrivate *d;
+  std::vector<uint32_t> contents;
+  const unsigned int *slot;
+
+  d = static_cast<PathContourRegistryPrivate*>(m_d);
+  if (!contour || !contour->closed() || !contour_contents(*contour, &contents))
+    {
+      return contour;
+    }
+
+  ContourKey key(&contents);
+  std::lock_guard<std::mutex> m(d->m_mutex);
+
+  slot = d->m_index.find(key);
+  if (slot)
+    {
+      Entry &E(d->m_entries[*slot]);
+
+      ++d->m_number_hits;
+      d->m_lru.splice(d->m_lru.end(), d->m_lru, E.m_lru_location);
+      return E.m_contour;
+    }
+
+  if (d->m_max_contours == 0)
+    {
+      return contour;
+    }
+
+  unsigned int I;
+
+  d->evict(d->m_max_contours - 1);
+  if (!d->m_free_slots.empty())
+    {
+      I = d->m_free_slots.back();
+      d->m_free_slots.pop_back();
+    }
+  else
+    {
+      I = d->m_entries.size();
+      d->m_entries.push_back(Entry());
+    }
+
+  Entry &E(d->m_entries[I]);
+  E.m_contents.swap(contents);
+  E.m_hash = key.hash();
+  E.m_contour = contour;
+  E.m_lru_location = d->m_lru.insert(d->m_lru.end(), I);
+  d->m_index.insert(ContourKey(&E.m_contents, E.m_hash), I);
+
+  return contour;
+}
+
+unsigned int
+fastuidraw::PathContourRegistry::
+number_contours(void) const
+{
+  PathContourRegistryPrivate *d;
+  d = static_cast<PathContourRegistryPrivate*>(m_d);
+
+  std::lock_guard<std::mutex> m(d->m_mutex);
+  return d->m_lru.size();
+}
+
+void
+fastuidraw::PathContourRegistry::
+max_contours(unsigned int v)
+{
+  PathContourRegistryPrivate *d;
+  d = static_cast<PathContourRegistryPrivate*>(m_d);
+
+  std::lock_guard<std::mutex> m(d->m_mutex);
+  d->m_max_contours = v;
+  d->evict(v);
+}
+
+unsigned int
+fastuidraw::PathContourRegistry::
+max_contours(void) const
+{
+  PathContourRegistryPrivate *d;
+  d = static_cast<PathContourRegistryPrivate*>(m_d);
+
+  std::lock_guard<std::mutex> m(d->m_mutex);
+  return d->m_max_contours;
+}
+
+unsigned int
+fastuidraw::PathContourRegistry::
+number_hits(void) const
+{
+  PathContourRegistryPrivate *d;
+  d = static_cast<PathContourRegistryPrivate*>(m_d);
+
+  std::lock_guard<std::mutex> m(d->m_mutex);
+  return d->m_number_hits;
+}
+
+void
+fastuidraw::PathContourRegistry::
+clear(void)
+{
+  PathContourRegistryPrivate *d;
+  d = static_cast<PathContourRegistryPrivate*>(m_d);
+
+  std::lock_guard<std::mutex> m(d->m_mutex);
+  d->m_index.clear();
+  d->m_entries.clear();
+  d->m_free_slots.clear();
+  d->m_lru.clear();
+}
@@ -6,10 +6,13 @@ d		:= $(dir)
 
 FASTUIDRAW_PRIVATE_SOURCES += $(call filelist, \
 	interval_allocator.cpp \
+	bezier_eval.cpp \
 	path_util_private.cpp \
 	clip.cpp int_path.cpp \
 	util_private_math.cpp \
-	pack_texels.cpp rect_atlas.cpp)
+	pack_texels.cpp rect_atlas.cpp \
+	glyph_disk_cache.cpp \
+	worker_pool.cpp)
 
 # Begin standard footer
 d		:= $(dirstack_$(sp))
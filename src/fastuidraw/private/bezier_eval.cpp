@@ -0,0 +1,253 @@
+/*!
+ * \file bezier_eval.cpp
+ * \brief file bezier_eval.cpp
+ *
+ * Copyright 2019 by Intel.
+ *
+ * Contact: kevin.rogovin@intel.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@intel.com>
+ *
+ */
+
+#include <vector>
+#include <fastuidraw/util/math.hpp>
+#include "bezier_eval.hpp"
+
+#if defined(__AVX__)
+#include <immintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace
+{
+  /* The curve is evaluated by De Casteljau's algorithm on
+   * several times at once; each Lanes class below gives the
+   * operations on a vector holding one coordinate of a point
+   * for each of those times.
+   */
+  class ScalarLanes
+  {
+  public:
+    typedef float type;
+    enum { number_lanes = 1 };
+
+    static
+    type
+    splat(float v)
+    {
+      return v;
+    }
+
+    static
+    type
+    times(float t0, float)
+    {
+      return t0;
+    }
+
+    static
+    type
+    lerp(type a, type b, type t)
+    {
+      return a + t * (b - a);
+    }
+
+    static
+    void
+    store(type x, type y, fastuidraw::vec2 *dst)
+    {
+      dst->x() = x;
+      dst->y() = y;
+    }
+  };
+
+#if defined(__AVX__)
+  class SIMDLanes
+  {
+  public:
+    typedef __m256 type;
+    enum { number_lanes = 8 };
+
+    static
+    type
+    splat(float v)
+    {
+      return _mm256_set1_ps(v);
+    }
+
+    static
+    type
+    times(float t0, float dt)
+    {
+      return _mm256_add_ps(_mm256_set1_ps(t0),
+                           _mm256_mul_ps(_mm256_set1_ps(dt),
+                                         _mm256_setr_ps(0.0f, 1.0f, 2.0f, 3.0f,
+                                                        4.0f, 5.0f, 6.0f, 7.0f)));
+    }
+
+    static
+    type
+    lerp(type a, type b, type t)
+    {
+      return _mm256_add_ps(a, _mm256_mul_ps(t, _mm256_sub_ps(b, a)));
+    }
+
+    static
+    void
+    store(type x, type y, fastuidraw::vec2 *dst)
+    {
+      __m256 lo, hi;
+      float *p(&dst->x());
+
+      /* unpack interleaves within each 128-bit half */
+      lo = _mm256_unpacklo_ps(x, y);
+      hi = _mm256_unpackhi_ps(x, y);
+      _mm256_storeu_ps(p, _mm256_permute2f128_ps(lo, hi, 0x20));
+      _mm256_storeu_ps(p + 8, _mm256_permute2f128_ps(lo, hi, 0x31));
+    }
+  };
+#elif defined(__SSE2__)
+  class SIMDLanes
+  {
+  public:
+    typedef __m128 type;
+    enum { number_lanes = 4 };
+
+    static
+    type
+    splat(float v)
+    {
+      return _mm_set1_ps(v);
+    }
+
+    static
+    type
+    times(float t0, float dt)
+    {
+      return _mm_add_ps(_mm_set1_ps(t0),
+                        _mm_mul_ps(_mm_set1_ps(dt),
+                                   _mm_setr_ps(0.0f, 1.0f, 2.0f, 3.0f)));
+    }
+
+    static
+    type
+    lerp(type a, type b, type t)
+    {
+      return _mm_add_ps(a, _mm_mul_ps(t, _mm_sub_ps(b, a)));
+    }
+
+    static
+    void
+    store(type x, type y, fastuidraw::vec2 *dst)
+    {
+      float *p(&dst->x());
+
+      _mm_storeu_ps(p, _mm_unpacklo_ps(x, y));
+      _mm_storeu_ps(p + 4, _mm_unpackhi_ps(x, y));
+    }
+  };
+#else
+  typedef ScalarLanes SIMDLanes;
+#endif
+
+  /* Evaluates the curve at the times t0 + k * dt for
+   * begin <= k < end, Lanes::number_lanes times at
+   * a time; end - begin must be a multiple of number_lanes.
+   * The arrays qx and qy hold pts.size() elements and are
+   * used as scratch.
+   */
+  template<typename Lanes>
+  void
+  evaluate_lanes(fastuidraw::c_array<const fastuidraw::vec2> pts,
+                 float t0, float dt, unsigned int begin, unsigned int end,
+                 fastuidraw::vec2 *dst,
+                 typename Lanes::type *qx, typename Lanes::type *qy)
+  {
+    const unsigned int n(pts.size());
+
+    for (unsigned int k = begin; k < end; k += Lanes::number_lanes)
+      {
+        typename Lanes::type t;
+
+        t = Lanes::times(t0 + static_cast<float>(k) * dt, dt);
+        for (unsigned int j = 0; j < n; ++j)
+          {
+            qx[j] = Lanes::splat(pts[j].x());
+            qy[j] = Lanes::splat(pts[j].y());
+          }
+
+        /* De Casteljau's algorithm, see BezierTessRegion::create_children()
+         * in path.cpp; after the loop, qx[0] and qy[0] hold the value of
+         * the curve at t.
+         */
+        for (unsigned int sz = n - 1; sz > 0; --sz)
+          {
+            for (unsigned int j = 0; j < sz; ++j)
+              {
+                qx[j] = Lanes::lerp(qx[j], qx[j + 1], t);
+                qy[j] = Lanes::lerp(qy[j], qy[j + 1], t);
+              }
+          }
+        Lanes::store(qx[0], qy[0], dst + k);
+      }
+  }
+}
+
+void
+fastuidraw::detail::
+evaluate_bezier(c_array<const vec2> pts, float t0, float dt,
+                c_array<vec2> dst)
+{
+  unsigned int N, simd_end;
+
+  FASTUIDRAWassert(!pts.empty());
+  N = dst.size();
+
+  /* only the cubic and lower degree curves, which are nearly
+   * all of the curves, use the SIMD path; its scratch room
+   * is then on the stack.
+   */
+  enum { simd_max_points = 4 };
+  if (pts.size() <= simd_max_points)
+    {
+      SIMDLanes::type qx[simd_max_points], qy[simd_max_points];
+      ScalarLanes::type sx[simd_max_points], sy[simd_max_points];
+
+      simd_end = N - (N % SIMDLanes::number_lanes);
+      evaluate_lanes<SIMDLanes>(pts, t0, dt, 0, simd_end, dst.c_ptr(), qx, qy);
+      evaluate_lanes<ScalarLanes>(pts, t0, dt, simd_end, N, dst.c_ptr(), sx, sy);
+    }
+  else
+    {
+      std::vector<float> sx(pts.size()), sy(pts.size());
+      evaluate_lanes<ScalarLanes>(pts, t0, dt, 0, N, dst.c_ptr(), &sx[0], &sy[0]);
+    }
+}
+
+float
+fastuidraw::detail::
+bezier_chord_distance_bound(c_array<const vec2> pts)
+{
+  float n, m(0.0f);
+
+  if (pts.size() < 3)
+    {
+      return 0.0f;
+    }
+
+  for (unsigned int i = 0, endi = pts.size() - 2; i < endi; ++i)
+    {
+      m = t_max(m, (pts[i] - 2.0f * pts[i + 1] + pts[i + 2]).magnitude());
+    }
+
+  n = static_cast<float>(pts.size() - 1);
+  return 0.125f * n * (n - 1.0f) * m;
+}
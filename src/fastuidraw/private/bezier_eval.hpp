@@ -0,0 +1,49 @@
+/*!
+ * \file bezier_eval.hpp
+ * \brief file bezier_eval.hpp
+ *
+ * Copyright 2019 by Intel.
+ *
+ * Contact: kevin.rogovin@intel.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@intel.com>
+ *
+ */
+
+#pragma once
+
+#include <fastuidraw/util/util.hpp>
+#include <fastuidraw/util/c_array.hpp>
+#include <fastuidraw/util/vecN.hpp>
+
+namespace fastuidraw
+{
+  namespace detail
+  {
+    /* Evaluate the Bezier curve with the control points pts
+     * at the times t = t0 + k * dt for 0 <= k < dst.size(),
+     * writing the value at t0 + k * dt to dst[k]. Several
+     * times are evaluated at once with SSE2 or AVX when
+     * available.
+     */
+    void
+    evaluate_bezier(c_array<const vec2> pts, float t0, float dt,
+                    c_array<vec2> dst);
+
+    /* Returns a value B so that for any interval of times
+     * of length h, the distance between the Bezier curve
+     * with the control points pts restricted to the interval
+     * and the line segment connecting the end points of that
+     * restriction is no more than B * h * h. For a curve of
+     * degree n, B = n(n - 1) / 8 * max_i || pts[i] - 2 * pts[i + 1] + pts[i + 2] ||.
+     */
+    float
+    bezier_chord_distance_bound(c_array<const vec2> pts);
+  }
+}
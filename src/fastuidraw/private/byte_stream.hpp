@@ -0,0 +1,199 @@
+/*!
+ * \file byte_stream.hpp
+ * \brief file byte_stream.hpp
+ *
+ * Copyright 2019 by Intel.
+ *
+ * Contact: kevin.rogovin@intel.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@intel.com>
+ *
+ */
+
+
+#pragma once
+
+#include <cstring>
+#include <vector>
+#include <type_traits>
+#include <fastuidraw/util/c_array.hpp>
+
+namespace fastuidraw { namespace detail {
+
+/* A ByteWriter writes plain-old-data values, in host byte
+ * order, to a c_array<uint8_t>; it is used to serialize
+ * data (for example GlyphRenderData) whose size has been
+ * computed before hand. If the destination is too small,
+ * the writes that do not fit are dropped and overflowed()
+ * returns true.
+ */
+class ByteWriter
+{
+public:
+  explicit
+  ByteWriter(c_array<uint8_t> dst):
+    m_dst(dst),
+    m_overflowed(false)
+  {}
+
+  template<typename T>
+  ByteWriter&
+  write(const T &v)
+  {
+    static_assert(std::is_standard_layout<T>::value, "Only POD can be written");
+    write_bytes(&v, sizeof(T));
+    return *this;
+  }
+
+  template<typename T>
+  ByteWriter&
+  write(c_array<const T> v)
+  {
+    static_assert(std::is_standard_layout<T>::value, "Only POD can be written");
+    write_bytes(v.c_ptr(), sizeof(T) * v.size());
+    return *this;
+  }
+
+  template<typename T>
+  ByteWriter&
+  write(c_array<T> v)
+  {
+    return write(c_array<const T>(v));
+  }
+
+  bool
+  overflowed(void) const
+  {
+    return m_overflowed;
+  }
+
+  /* number of bytes not yet written */
+  unsigned int
+  remaining(void) const
+  {
+    return m_dst.size();
+  }
+
+private:
+  void
+  write_bytes(const void *src, unsigned int sz)
+  {
+    if (sz == 0)
+      {
+        return;
+      }
+
+    if (sz > m_dst.size())
+      {
+        m_overflowed = true;
+        m_dst = c_array<uint8_t>();
+        return;
+      }
+    std::memcpy(m_dst.c_ptr(), src, sz);
+    m_dst = m_dst.sub_array(sz);
+  }
+
+  c_array<uint8_t> m_dst;
+  bool m_overflowed;
+};
+
+/* A ByteReader reads back what a ByteWriter wrote; once a
+ * read cannot be satisfied, the ByteReader is failed() and
+ * all further reads fail as well.
+ */
+class ByteReader
+{
+public:
+  explicit
+  ByteReader(c_array<const uint8_t> src):
+    m_src(src),
+    m_failed(false)
+  {}
+
+  template<typename T>
+  ByteReader&
+  read(T *v)
+  {
+    static_assert(std::is_standard_layout<T>::value, "Only POD can be read");
+    read_bytes(v, sizeof(T));
+    return *this;
+  }
+
+  /* read count elements, resizing v to count */
+  template<typename T>
+  ByteReader&
+  read(unsigned int count, std::vector<T> *v)
+  {
+    static_assert(std::is_standard_layout<T>::value, "Only POD can be read");
+    if (m_failed || count > m_src.size() / sizeof(T))
+      {
+        m_failed = true;
+        return *this;
+      }
+    v->resize(count);
+    if (count > 0)
+      {
+        read_bytes(&v->front(), sizeof(T) * count);
+      }
+    return *this;
+  }
+
+  /* return the next sz bytes without copying them */
+  c_array<const uint8_t>
+  take(unsigned int sz)
+  {
+    c_array<const uint8_t> return_value;
+
+    if (m_failed || sz > m_src.size())
+      {
+        m_failed = true;
+        return return_value;
+      }
+    return_value = m_src.sub_array(0, sz);
+    m_src = m_src.sub_array(sz);
+    return return_value;
+  }
+
+  /* return all bytes not yet read without copying them */
+  c_array<const uint8_t>
+  take_remaining(void)
+  {
+    return take(m_src.size());
+  }
+
+  bool
+  failed(void) const
+  {
+    return m_failed;
+  }
+
+  bool
+  at_end(void) const
+  {
+    return !m_failed && m_src.empty();
+  }
+
+private:
+  void
+  read_bytes(void *dst, unsigned int sz)
+  {
+    if (m_failed || sz > m_src.size())
+      {
+        m_failed = true;
+        return;
+      }
+    std::memcpy(dst, m_src.c_ptr(), sz);
+    m_src = m_src.sub_array(sz);
+  }
+
+  c_array<const uint8_t> m_src;
+  bool m_failed;
+};
+
+}}
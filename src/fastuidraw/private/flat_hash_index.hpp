@@ -0,0 +1,252 @@
+/*!
+ * \file flat_hash_index.hpp
+ * \brief file flat_hash_index.hpp
+ *
+ * Copyright 2019 by Intel.
+ *
+ * Contact: kevin.rogovin@intel.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@intel.com>
+ *
+ */
+
+
+#pragma once
+
+#include <vector>
+#include <stdint.h>
+#include <fastuidraw/util/util.hpp>
+#include <fastuidraw/util/math.hpp>
+
+namespace fastuidraw { namespace detail {
+
+/* Mix the bits of a 64-bit value so that the low bits
+ * of the return value depend on all bits of the input
+ * (this is the finalizer of splitmix64).
+ */
+inline
+uint64_t
+hash_mix(uint64_t v)
+{
+  v ^= v >> 30u;
+  v *= 0xbf58476d1ce4e5b9ull;
+  v ^= v >> 27u;
+  v *= 0x94d049bb133111ebull;
+  v ^= v >> 31u;
+  return v;
+}
+
+/* A FlatHashIndex maps keys to unsigned int values (typically
+ * an index into an array) with an open-addressing hash table
+ * using linear probing; all entries live in a single array so
+ * that a lookup is one hash computation and a short linear
+ * scan instead of a tree walk. Erasing uses backward-shift
+ * deletion, so there are no tombstones and lookup cost does
+ * not degrade with churn. The key type K must provide
+ *  - uint64_t hash(void) const
+ *  - bool operator==(const K&) const
+ *  - a default ctor
+ */
+template<typename K>
+class FlatHashIndex
+{
+public:
+  FlatHashIndex(void):
+    m_size(0)
+  {}
+
+  unsigned int
+  size(void) const
+  {
+    return m_size;
+  }
+
+  bool
+  empty(void) const
+  {
+    return m_size == 0;
+  }
+
+  /* Returns a pointer to the value of the key,
+   * returns nullptr if the key is not present.
+   */
+  const unsigned int*
+  find(const K &key) const
+  {
+    if (m_size == 0)
+      {
+        return nullptr;
+      }
+
+    for (unsigned int I = home(key.hash()); m_entries[I].m_occupied; I = next(I))
+      {
+        if (m_entries[I].m_key == key)
+          {
+            return &m_entries[I].m_value;
+          }
+      }
+    return nullptr;
+  }
+
+  /* Add a key-value pair, returns false and does
+   * nothing if the key is already present.
+   */
+  bool
+  insert(const K &key, unsigned int value)
+  {
+    unsigned int I;
+
+    /* keep load factor at most 3/4 */
+    if (4u * (m_size + 1u) > 3u * m_entries.size())
+      {
+        rehash(t_max(16u, 2u * static_cast<unsigned int>(m_entries.size())));
+      }
+
+    for (I = home(key.hash()); m_entries[I].m_occupied; I = next(I))
+      {
+        if (m_entries[I].m_key == key)
+          {
+            return false;
+          }
+      }
+
+    m_entries[I].m_key = key;
+    m_entries[I].m_value = value;
+    m_entries[I].m_occupied = true;
+    ++m_size;
+    return true;
+  }
+
+  /* Remove a key, returns false if the key is not
+   * present. If out_value is non-null and the key is
+   * present, writes the value of the removed key to it.
+   */
+  bool
+  erase(const K &key, unsigned int *out_value = nullptr)
+  {
+    unsigned int I;
+
+    if (m_size == 0)
+      {
+        return false;
+      }
+
+    for (I = home(key.hash()); m_entries[I].m_occupied; I = next(I))
+      {
+        if (m_entries[I].m_key == key)
+          {
+            break;
+          }
+      }
+
+    if (!m_entries[I].m_occupied)
+      {
+        return false;
+      }
+
+    if (out_value)
+      {
+        *out_value = m_entries[I].m_value;
+      }
+
+    /* backward-shift deletion: move back any entry of the
+     * probe sequence after I that would no longer be
+     * reachable once I is empty.
+     */
+    for (unsigned int J = next(I); m_entries[J].m_occupied; J = next(J))
+      {
+        unsigned int H(home(m_entries[J].m_key.hash()));
+
+        /* the entry at J can be moved to I if its home
+         * position is not in the cyclic range (I, J].
+         */
+        if ((J > I) ? (H <= I || H > J) : (H <= I && H > J))
+          {
+            m_entries[I] = m_entries[J];
+            I = J;
+          }
+      }
+    m_entries[I].m_occupied = false;
+    m_entries[I].m_key = K();
+    --m_size;
+    return true;
+  }
+
+  void
+  clear(void)
+  {
+    for (Entry &e : m_entries)
+      {
+        e = Entry();
+      }
+    m_size = 0;
+  }
+
+  /* Call f(key, value) for each key-value pair */
+  template<typename F>
+  void
+  for_each(F f) const
+  {
+    for (const Entry &e : m_entries)
+      {
+        if (e.m_occupied)
+          {
+            f(e.m_key, e.m_value);
+          }
+      }
+  }
+
+private:
+  class Entry
+  {
+  public:
+    Entry(void):
+      m_value(0),
+      m_occupied(false)
+    {}
+
+    K m_key;
+    unsigned int m_value;
+    bool m_occupied;
+  };
+
+  unsigned int
+  home(uint64_t h) const
+  {
+    return static_cast<unsigned int>(hash_mix(h)) & (m_entries.size() - 1u);
+  }
+
+  unsigned int
+  next(unsigned int I) const
+  {
+    return (I + 1u) & (m_entries.size() - 1u);
+  }
+
+  void
+  rehash(unsigned int new_capacity)
+  {
+    std::vector<Entry> old_entries(new_capacity);
+
+    FASTUIDRAWassert((new_capacity & (new_capacity - 1u)) == 0u);
+    old_entries.swap(m_entries);
+    m_size = 0;
+    for (const Entry &e : old_entries)
+      {
+        if (e.m_occupied)
+          {
+            insert(e.m_key, e.m_value);
+          }
+      }
+  }
+
+  std::vector<Entry> m_entries;
+  unsigned int m_size;
+};
+
+}}
@@ -0,0 +1,592 @@
+/*!
+ * \file glyph_disk_cache.cpp
+ * \brief file glyph_disk_cache.cpp
+ *
+ * Copyright 2019 by Intel.
+ *
+ * Contact: kevin.rogovin@intel.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@intel.com>
+ *
+ */
+
+#include <vector>
+#include <cstring>
+#include <cstdio>
+#include <cerrno>
+#include <thread>
+#include <functional>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <fastuidraw/util/data_buffer.hpp>
+#include <fastuidraw/text/glyph_generate_params.hpp>
+#include <fastuidraw/text/glyph_render_data_texels.hpp>
+#include <fastuidraw/text/glyph_render_data_msdf.hpp>
+#include <fastuidraw/text/glyph_render_data_banded_rays.hpp>
+#include <fastuidraw/text/glyph_render_data_restricted_rays.hpp>
+#include "util_private.hpp"
+#include "glyph_disk_cache.hpp"
+#include "byte_stream.hpp"
+#include "hash_util.hpp"
+#include "path_contour_edges.hpp"
+
+namespace
+{
+  enum
+    {
+      /* "FUIGLYPH" */
+      file_magic_lo = 0x47495546u,
+      file_magic_hi = 0x48505943u,
+
+      /* increment whenever the file format or the
+       * serialization format of any GlyphRenderData
+       * changes.
+       */
+      file_version = 2u,
+
+      /* value to detect files written on a machine
+       * with a different byte order.
+       */
+      byte_order_mark = 0x01020304u,
+    };
+
+  /* Key of a glyph; the values are all 32-bit so that the
+   * class has no padding, which allows to compare keys with
+   * memcmp and to hash them as bytes.
+   */
+  class GlyphKey
+  {
+  public:
+    GlyphKey(uint64_t font_hash, uint32_t glyph_code,
+             fastuidraw::GlyphRenderer render);
+
+    uint64_t
+    hash(void) const
+    {
+      return fastuidraw::detail::FNV1aHash().add(*this).value();
+    }
+
+    uint32_t m_font_hash_lo, m_font_hash_hi;
+    uint32_t m_glyph_code;
+    uint32_t m_type;
+    int32_t m_pixel_size;
+
+    /* the GlyphGenerateParams values that affect glyphs
+     * of type m_type; values that do not are left as 0.
+     */
+    fastuidraw::vecN<uint32_t, 4> m_params;
+  };
+
+  class FileHeader
+  {
+  public:
+    FileHeader(void):
+      m_magic_lo(file_magic_lo),
+      m_magic_hi(file_magic_hi),
+      m_version(file_version),
+      m_byte_order_mark(byte_order_mark),
+      m_path_size(0),
+      m_render_data_size(0),
+      m_render_size(0.0f, 0.0f)
+    {}
+
+    bool
+    valid(void) const
+    {
+      return m_magic_lo == file_magic_lo
+        && m_magic_hi == file_magic_hi
+        && m_version == file_version
+        && m_byte_order_mark == byte_order_mark;
+    }
+
+    uint32_t m_magic_lo, m_magic_hi;
+    uint32_t m_version;
+    uint32_t m_byte_order_mark;
+    uint32_t m_path_size;
+    uint32_t m_render_data_size;
+    fastuidraw::vec2 m_render_size;
+  };
+
+  template<typename T>
+  uint32_t
+  as_uint32(T v)
+  {
+    static_assert(sizeof(T) == sizeof(uint32_t), "Bad type size");
+    uint32_t return_value;
+    std::memcpy(&return_value, &v, sizeof(T));
+    return return_value;
+  }
+
+  /* Serialization of a Path; a glyph Path is made only of
+   * closed contours of line segments and Bezier curves. For
+   * each contour, the number of interpolators is stored;
+   * for each interpolator, its start point, its edge type,
+   * the number of its interior control points and the
+   * control points. The edges are read with PathContourEdges
+   * so that the interpolators of the contours are not made.
+   */
+  bool
+  path_serialized_size(const fastuidraw::Path &path, unsigned int *out_size)
+  {
+    using namespace fastuidraw;
+
+    unsigned int sz(sizeof(uint32_t));
+    for (unsigned int c = 0, endc = path.number_contours(); c < endc; ++c)
+      {
+        const PathContour &contour(*path.contour(c));
+        detail::PathContourEdges edges(contour);
+
+        if (!contour.closed())
+          {
+            return false;
+          }
+
+        sz += sizeof(uint32_t);
+        for (unsigned int i = 0, endi = edges.number_edges(); i < endi; ++i)
+          {
+            sz += sizeof(vec2) + 2 * sizeof(uint32_t);
+            switch (edges.verb(i))
+              {
+              case detail::PathContourEdges::flat_verb:
+                break;
+              case detail::PathContourEdges::bezier_verb:
+                sz += sizeof(vec2) * (edges.points(i).size() - 2);
+                break;
+              default:
+                return false;
+              }
+          }
+      }
+    *out_size = sz;
+    return true;
+  }
+
+  void
+  serialize_path(const fastuidraw::Path &path,
+                 fastuidraw::detail::ByteWriter &W)
+  {
+    using namespace fastuidraw;
+
+    W.write(uint32_t(path.number_contours()));
+    for (unsigned int c = 0, endc = path.number_contours(); c < endc; ++c)
+      {
+        detail::PathContourEdges edges(*path.contour(c));
+
+        W.write(uint32_t(edges.number_edges()));
+        for (unsigned int i = 0, endi = edges.number_edges(); i < endi; ++i)
+          {
+            c_array<const vec2> pts(edges.points(i));
+            c_array<const vec2> control_pts;
+
+            if (edges.verb(i) == detail::PathContourEdges::bezier_verb)
+              {
+                control_pts = pts.sub_array(1, pts.size() - 2);
+              }
+            W.write(pts.front())
+              .write(uint32_t(edges.edge_type(i)))
+              .write(uint32_t(control_pts.size()))
+              .write(control_pts);
+          }
+      }
+  }
+
+  bool
+  deserialize_path(fastuidraw::c_array<const uint8_t> src,
+                   fastuidraw::Path &path)
+  {
+    using namespace fastuidraw;
+
+    /* parse everything before adding to the path so that
+     * path is unchanged if the data is corrupt.
+     */
+    detail::ByteReader R(src);
+    std::vector<uint32_t> contour_sizes, control_pt_counts;
+    std::vector<enum PathEnums::edge_type_t> edge_types;
+    std::vector<vec2> pts;
+    uint32_t num_contours(0);
+
+    R.read(&num_contours);
+    for (uint32_t c = 0; c < num_contours && !R.failed(); ++c)
+      {
+        uint32_t num_interpolators(0);
+
+        R.read(&num_interpolators);
+        contour_sizes.push_back(num_interpolators);
+        for (uint32_t i = 0; i < num_interpolators && !R.failed(); ++i)
+          {
+            vec2 pt(0.0f, 0.0f);
+            uint32_t edge_type(0), num_control_pts(0);
+            std::vector<vec2> control_pts;
+
+            R.read(&pt)
+              .read(&edge_type)
+              .read(&num_control_pts)
+              .read(num_control_pts, &control_pts);
+            if (R.failed() || edge_type > PathEnums::continues_edge)
+              {
+                return false;
+              }
+            pts.push_back(pt);
+            edge_types.push_back(static_cast<enum PathEnums::edge_type_t>(edge_type));
+            pts.insert(pts.end(), control_pts.begin(), control_pts.end());
+            control_pt_counts.push_back(num_control_pts);
+          }
+      }
+
+    if (!R.at_end())
+      {
+        return false;
+      }
+
+    unsigned int pt(0), interp(0);
+    for (uint32_t num_interpolators : contour_sizes)
+      {
+        if (num_interpolators == 0)
+          {
+            continue;
+          }
+
+        for (uint32_t i = 0; i < num_interpolators; ++i, ++interp)
+          {
+            /* the edge type applies to the edge started
+             * at the point, which is added by the next
+             * point or by closing the contour.
+             */
+            path << pts[pt++] << edge_types[interp];
+            for (uint32_t k = 0; k < control_pt_counts[interp]; ++k)
+              {
+                path << Path::control_point(pts[pt++]);
+              }
+          }
+        path << Path::contour_close();
+      }
+
+    return true;
+  }
+
+  /* returns an empty GlyphRenderData of the class that
+   * FontFreeType and FontDatabase generate for a type
+   */
+  fastuidraw::GlyphRenderData*
+  create_render_data(enum fastuidraw::glyph_type tp)
+  {
+    using namespace fastuidraw;
+    switch (tp)
+      {
+      case coverage_glyph:
+      case distance_field_glyph:
+        return FASTUIDRAWnew GlyphRenderDataTexels();
+      case restricted_rays_glyph:
+        return FASTUIDRAWnew GlyphRenderDataRestrictedRays();
+      case banded_rays_glyph:
+        return FASTUIDRAWnew GlyphRenderDataBandedRays();
+      case msdf_glyph:
+        return FASTUIDRAWnew GlyphRenderDataMSDF();
+      default:
+        return nullptr;
+      }
+  }
+
+  /* returns true if data is of the class returned by
+   * create_render_data(), only such data is stored.
+   */
+  bool
+  expected_render_data(enum fastuidraw::glyph_type tp,
+                       const fastuidraw::GlyphRenderData *data)
+  {
+    using namespace fastuidraw;
+    switch (tp)
+      {
+      case coverage_glyph:
+      case distance_field_glyph:
+        return dynamic_cast<const GlyphRenderDataTexels*>(data) != nullptr;
+      case restricted_rays_glyph:
+        return dynamic_cast<const GlyphRenderDataRestrictedRays*>(data) != nullptr;
+      case banded_rays_glyph:
+        return dynamic_cast<const GlyphRenderDataBandedRays*>(data) != nullptr;
+      case msdf_glyph:
+        return dynamic_cast<const GlyphRenderDataMSDF*>(data) != nullptr;
+      default:
+        return false;
+      }
+  }
+
+  enum fastuidraw::return_code
+  deserialize_render_data(fastuidraw::GlyphRenderData *data,
+                          enum fastuidraw::glyph_type tp,
+                          fastuidraw::c_array<const uint8_t> src)
+  {
+    using namespace fastuidraw;
+    switch (tp)
+      {
+      case coverage_glyph:
+      case distance_field_glyph:
+        return static_cast<GlyphRenderDataTexels*>(data)->deserialize(src);
+      case restricted_rays_glyph:
+        return static_cast<GlyphRenderDataRestrictedRays*>(data)->deserialize(src);
+      case banded_rays_glyph:
+        return static_cast<GlyphRenderDataBandedRays*>(data)->deserialize(src);
+      case msdf_glyph:
+        return static_cast<GlyphRenderDataMSDF*>(data)->deserialize(src);
+      default:
+        return routine_fail;
+      }
+  }
+
+  std::string
+  filename_for_key(const std::string &directory, const GlyphKey &key)
+  {
+    char buffer[32];
+
+    std::snprintf(buffer, sizeof(buffer), "%016llx.glyph",
+                  static_cast<unsigned long long>(key.hash()));
+    return directory + "/" + buffer;
+  }
+
+  /* Parse and check the header and key of the contents of
+   * the file of a glyph; on success the path and rendering
+   * data bytes (which point into src) are written.
+   */
+  bool
+  parse_file(fastuidraw::c_array<const uint8_t> src, const GlyphKey &key,
+             FileHeader *header,
+             fastuidraw::c_array<const uint8_t> *path_bytes,
+             fastuidraw::c_array<const uint8_t> *render_data_bytes)
+  {
+    fastuidraw::detail::ByteReader R(src);
+    GlyphKey file_key(key);
+
+    R.read(header)
+      .read(&file_key);
+    *path_bytes = R.take(header->m_path_size);
+    *render_data_bytes = R.take(header->m_render_data_size);
+
+    return R.at_end()
+      && header->valid()
+      && std::memcmp(&key, &file_key, sizeof(GlyphKey)) == 0;
+  }
+
+  bool
+  write_file(const std::string &filename,
+             fastuidraw::c_array<const uint8_t> bytes)
+  {
+    int fd;
+    bool success(true);
+
+    fd = ::open(filename.c_str(), O_WRONLY | O_CREAT | O_EXCL | O_CLOEXEC, 0644);
+    if (fd < 0)
+      {
+        return false;
+      }
+
+    while (!bytes.empty() && success)
+      {
+        ssize_t num_written;
+
+        num_written = ::write(fd, bytes.c_ptr(), bytes.size());
+        if (num_written > 0)
+          {
+            bytes = bytes.sub_array(num_written);
+          }
+        else
+          {
+            success = (num_written < 0 && errno == EINTR);
+          }
+      }
+
+    success = (::close(fd) == 0) && success;
+    return success;
+  }
+}
+
+////////////////////////////////
+// GlyphKey methods
+GlyphKey::
+GlyphKey(uint64_t font_hash, uint32_t glyph_code,
+         fastuidraw::GlyphRenderer render):
+  m_font_hash_lo(font_hash & 0xFFFFFFFFu),
+  m_font_hash_hi(font_hash >> 32u),
+  m_glyph_code(glyph_code),
+  m_type(render.m_type),
+  m_pixel_size(render.m_pixel_size),
+  m_params(0u)
+{
+  using namespace fastuidraw;
+
+  switch (render.m_type)
+    {
+    case distance_field_glyph:
+      m_params[0] = GlyphGenerateParams::distance_field_pixel_size();
+      m_params[1] = as_uint32(GlyphGenerateParams::distance_field_max_distance());
+      break;
+
+    case restricted_rays_glyph:
+      m_params[0] = as_uint32(GlyphGenerateParams::restricted_rays_minimum_render_size());
+      m_params[1] = GlyphGenerateParams::restricted_rays_split_thresh();
+      m_params[2] = GlyphGenerateParams::restricted_rays_max_recursion();
+      break;
+
+    case banded_rays_glyph:
+      m_params[0] = GlyphGenerateParams::banded_rays_max_recursion();
+      m_params[1] = as_uint32(GlyphGenerateParams::banded_rays_average_number_curves_thresh());
+      break;
+
+    case msdf_glyph:
+      m_params[0] = GlyphGenerateParams::msdf_pixel_size();
+      m_params[1] = as_uint32(GlyphGenerateParams::msdf_max_distance());
+      break;
+
+    default:
+      break;
+    }
+}
+
+////////////////////////////////////////////
+// fastuidraw::detail::GlyphDiskCache methods
+fastuidraw::detail::GlyphDiskCache::
+GlyphDiskCache(const std::string &directory):
+  m_directory(directory),
+  m_number_hits(0),
+  m_number_misses(0),
+  m_temp_file_count(0)
+{}
+
+fastuidraw::GlyphRenderData*
+fastuidraw::detail::GlyphDiskCache::
+fetch(const FontBase *font, uint32_t glyph_code,
+      GlyphRenderer render, Path &path, vec2 &render_size)
+{
+  uint64_t font_hash;
+
+  if (!font->content_hash(&font_hash))
+    {
+      return nullptr;
+    }
+
+  GlyphKey key(font_hash, glyph_code, render);
+  FileHeader header;
+  MappedFileBackingStore file(filename_for_key(m_directory, key).c_str());
+  c_array<const uint8_t> path_bytes, render_data_bytes;
+
+  if (!parse_file(file.data(), key, &header, &path_bytes, &render_data_bytes))
+    {
+      ++m_number_misses;
+      return nullptr;
+    }
+
+  GlyphRenderData *return_value;
+  return_value = create_render_data(render.m_type);
+  if (!return_value)
+    {
+      ++m_number_misses;
+      return nullptr;
+    }
+
+  Path tmp_path;
+  if (deserialize_render_data(return_value, render.m_type, render_data_bytes) == routine_fail
+      || !deserialize_path(path_bytes, tmp_path))
+    {
+      FASTUIDRAWdelete(return_value);
+      ++m_number_misses;
+      return nullptr;
+    }
+
+  ++m_number_hits;
+  path.swap(tmp_path);
+  render_size = header.m_render_size;
+  return return_value;
+}
+
+bool
+fastuidraw::detail::GlyphDiskCache::
+fetch_path(const FontBase *font, uint32_t glyph_code,
+           GlyphRenderer render, Path &path)
+{
+  uint64_t font_hash;
+
+  if (!font->content_hash(&font_hash))
+    {
+      return false;
+    }
+
+  GlyphKey key(font_hash, glyph_code, render);
+  FileHeader header;
+  MappedFileBackingStore file(filename_for_key(m_directory, key).c_str());
+  c_array<const uint8_t> path_bytes, render_data_bytes;
+  Path tmp_path;
+
+  if (!parse_file(file.data(), key, &header, &path_bytes, &render_data_bytes)
+      || !deserialize_path(path_bytes, tmp_path))
+    {
+      ++m_number_misses;
+      return false;
+    }
+
+  ++m_number_hits;
+  path.swap(tmp_path);
+  return true;
+}
+
+void
+fastuidraw::detail::GlyphDiskCache::
+store(const FontBase *font, uint32_t glyph_code,
+      GlyphRenderer render, const GlyphRenderData *data,
+      const Path &path, vec2 render_size)
+{
+  uint64_t font_hash;
+  FileHeader header;
+
+  if (!data
+      || !expected_render_data(render.m_type, data)
+      || !font->content_hash(&font_hash)
+      || !path_serialized_size(path, &header.m_path_size))
+    {
+      return;
+    }
+
+  header.m_render_data_size = data->serialized_size();
+  header.m_render_size = render_size;
+  if (header.m_render_data_size == 0)
+    {
+      return;
+    }
+
+  GlyphKey key(font_hash, glyph_code, render);
+  std::vector<uint8_t> bytes(sizeof(FileHeader) + sizeof(GlyphKey)
+                             + header.m_path_size + header.m_render_data_size);
+  c_array<uint8_t> dst(make_c_array(bytes));
+  ByteWriter W(dst.sub_array(0, sizeof(FileHeader) + sizeof(GlyphKey) + header.m_path_size));
+
+  W.write(header).write(key);
+  serialize_path(path, W);
+  if (W.overflowed() || W.remaining() != 0
+      || data->serialize(dst.sub_array(dst.size() - header.m_render_data_size)) == routine_fail)
+    {
+      return;
+    }
+
+  /* write to a temporary file that is then renamed so that
+   * a reader never sees a partially written file.
+   */
+  std::string filename(filename_for_key(m_directory, key));
+  std::string temp_filename;
+
+  temp_filename = filename + "." + std::to_string(::getpid())
+    + "." + std::to_string(std::hash<std::thread::id>()(std::this_thread::get_id()))
+    + "." + std::to_string(m_temp_file_count++) + ".tmp";
+
+  if (!write_file(temp_filename, dst)
+      || std::rename(temp_filename.c_str(), filename.c_str()) != 0)
+    {
+      std::remove(temp_filename.c_str());
+    }
+}
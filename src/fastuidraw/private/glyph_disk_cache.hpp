@@ -0,0 +1,104 @@
+/*!
+ * \file glyph_disk_cache.hpp
+ * \brief file glyph_disk_cache.hpp
+ *
+ * Copyright 2019 by Intel.
+ *
+ * Contact: kevin.rogovin@intel.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@intel.com>
+ *
+ */
+
+
+#pragma once
+
+#include <string>
+#include <atomic>
+#include <fastuidraw/util/util.hpp>
+#include <fastuidraw/path.hpp>
+#include <fastuidraw/text/font.hpp>
+#include <fastuidraw/text/glyph_renderer.hpp>
+#include <fastuidraw/text/glyph_render_data.hpp>
+
+namespace fastuidraw { namespace detail {
+
+/* A GlyphDiskCache stores the GlyphRenderData, Path and
+ * render size of glyphs as files in a directory, one file
+ * per glyph. A glyph is keyed by FontBase::content_hash()
+ * of its font, its glyph code, its GlyphRenderer and the
+ * GlyphGenerateParams values that affect the generation of
+ * the glyph. Files are read back by memory-mapping them and
+ * are written to a temporary file first that is then renamed,
+ * so that several processes (and threads) can share the same
+ * directory. The methods are thread safe.
+ */
+class GlyphDiskCache:fastuidraw::noncopyable
+{
+public:
+  /* Ctor.
+   * \param directory directory where the files are stored,
+   *                  it is NOT created by the GlyphDiskCache
+   */
+  explicit
+  GlyphDiskCache(const std::string &directory);
+
+  const std::string&
+  directory(void) const
+  {
+    return m_directory;
+  }
+
+  /* Fetch the glyph data from the cache, returns nullptr
+   * if the glyph is not in the cache. On success, the
+   * Path of the glyph is added to path and the render
+   * size is written to render_size.
+   */
+  GlyphRenderData*
+  fetch(const FontBase *font, uint32_t glyph_code,
+        GlyphRenderer render, Path &path, vec2 &render_size);
+
+  /* Fetch only the Path of the glyph from the cache, the
+   * rendering data is not read. Returns false if the glyph
+   * is not in the cache. On success, the Path of the glyph
+   * is added to path.
+   */
+  bool
+  fetch_path(const FontBase *font, uint32_t glyph_code,
+             GlyphRenderer render, Path &path);
+
+  /* Store the glyph data into the cache; silently does
+   * nothing if the font does not provide a content hash,
+   * if the render data cannot be serialized or if the
+   * file cannot be written.
+   */
+  void
+  store(const FontBase *font, uint32_t glyph_code,
+        GlyphRenderer render, const GlyphRenderData *data,
+        const Path &path, vec2 render_size);
+
+  unsigned int
+  number_hits(void) const
+  {
+    return m_number_hits;
+  }
+
+  unsigned int
+  number_misses(void) const
+  {
+    return m_number_misses;
+  }
+
+private:
+  std::string m_directory;
+  std::atomic<unsigned int> m_number_hits, m_number_misses;
+  std::atomic<unsigned int> m_temp_file_count;
+};
+
+}}
@@ -0,0 +1,84 @@
+/*!
+ * \file hash_util.hpp
+ * \brief file hash_util.hpp
+ *
+ * Copyright 2019 by Intel.
+ *
+ * Contact: kevin.rogovin@intel.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@intel.com>
+ *
+ */
+
+
+#pragma once
+
+#include <stdint.h>
+#include <type_traits>
+#include <fastuidraw/util/c_array.hpp>
+
+namespace fastuidraw { namespace detail {
+
+/* 64-bit FNV-1a hash; the value is stable across runs
+ * and builds (on machines of the same byte order), so
+ * it is suitable to key data that is stored on disk.
+ */
+class FNV1aHash
+{
+public:
+  FNV1aHash(void):
+    m_value(14695981039346656037ull)
+  {}
+
+  FNV1aHash&
+  add_bytes(const void *p, unsigned int sz)
+  {
+    const uint8_t *bytes(static_cast<const uint8_t*>(p));
+    for (unsigned int i = 0; i < sz; ++i)
+      {
+        m_value ^= bytes[i];
+        m_value *= 1099511628211ull;
+      }
+    return *this;
+  }
+
+  template<typename T>
+  FNV1aHash&
+  add(const T &v)
+  {
+    static_assert(std::is_standard_layout<T>::value, "Only POD can be hashed");
+    return add_bytes(&v, sizeof(T));
+  }
+
+  template<typename T>
+  FNV1aHash&
+  add(c_array<const T> v)
+  {
+    static_assert(std::is_standard_layout<T>::value, "Only POD can be hashed");
+    return add_bytes(v.c_ptr(), sizeof(T) * v.size());
+  }
+
+  template<typename T>
+  FNV1aHash&
+  add(c_array<T> v)
+  {
+    return add(c_array<const T>(v));
+  }
+
+  uint64_t
+  value(void) const
+  {
+    return m_value;
+  }
+
+private:
+  uint64_t m_value;
+};
+
+}}
@@ -34,9 +34,17 @@
 
 #include <iterator>
 #include <set>
+#include <limits>
+#include <functional>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
 #include "int_path.hpp"
 #include "bezier_util.hpp"
 #include "util_private_ostream.hpp"
+#include "worker_pool.hpp"
 
 namespace
 {
@@ -295,9 +303,14 @@ namespace
                               const IntBezierCurve::transformation<int> &tr,
                               std::vector<solution_pt> *out_value) const;
 
+    /*
+     * Compute the intersections against the lines at step * c
+     * for begin <= c < end, writing the intersections of the
+     * line at step * c to (*out_value)[c].
+     */
     void
     compute_lines_intersection(enum coordinate_type line_type,
-                               int step, int count,
+                               int step, int begin, int end,
                                uint32_t solution_types_accepted,
                                const IntBezierCurve::transformation<int> &tr,
                                std::vector<std::vector<solution_pt> > *out_value) const;
@@ -353,88 +366,65 @@ namespace
     const IntBezierCurve &m_curve;
   };
 
-  class distance_value
+  /* Values computed for each texel by DistanceFieldGenerator. The
+   * distances are stored in their own array, contiguous along y,
+   * so that the texels near a point can be updated several at a
+   * time with SIMD instructions.
+   */
+  class distance_values
   {
   public:
-    typedef fastuidraw::detail::IntBezierCurve IntBezierCurve;
-
-    enum winding_ray_t
-      {
-        from_pt_to_x_negative_infinity,
-        from_pt_to_x_positive_infinity,
-        from_pt_to_y_negative_infinity,
-        from_pt_to_y_positive_infinity,
-      };
-
-    distance_value(void):
-      m_distance(-1.0f),
-      m_ray_intersection_counts(0, 0, 0, 0),
-      m_winding_numbers(0, 0)
-    {}
-
-    void
-    record_distance_value(float v)
+    distance_values(int width, int height):
+      m_distances(width, height),
+      m_winding_numbers(width, height)
     {
-      FASTUIDRAWassert(v >= 0.0f);
-      m_distance = (m_distance >= 0.0f) ?
-        fastuidraw::t_min(v, m_distance) :
-        v;
+      /* +infinity indicates that no distance is assigned */
+      m_distances.fill(std::numeric_limits<float>::infinity());
+      m_winding_numbers.fill(fastuidraw::ivec2(0, 0));
     }
 
     void
-    increment_ray_intersection_count(enum winding_ray_t tp, int mult)
+    record_distance_value(int x, int y, float v)
     {
-      FASTUIDRAWassert(mult >= 0);
-      m_ray_intersection_counts[tp] += mult;
+      FASTUIDRAWassert(v >= 0.0f);
+      float &d(m_distances(x, y));
+      d = fastuidraw::t_min(v, d);
     }
 
-    void
-    set_winding_number(enum Solver::coordinate_type tp, int w)
+    /* returns a pointer to the distance value at (x, y); the
+     * distance values at (x, y + k) follow it contiguously.
+     */
+    float*
+    distances(int x, int y)
     {
-      m_winding_numbers[tp] = w;
+      return &m_distances(x, y);
     }
 
-    float
-    distance(float max_distance) const
+    void
+    set_winding_number(enum Solver::coordinate_type tp, int x, int y, int w)
     {
-      return (m_distance < 0.0f) ?
-        max_distance :
-        fastuidraw::t_min(max_distance, m_distance);
+      m_winding_numbers(x, y)[tp] = w;
     }
 
     float
-    raw_distance(void) const
+    distance(int x, int y, float max_distance) const
     {
-      return m_distance;
+      return fastuidraw::t_min(max_distance, m_distances(x, y));
     }
 
     int
-    ray_intersection_count(enum winding_ray_t tp) const
+    winding_number(enum Solver::coordinate_type tp, int x, int y) const
     {
-      return m_ray_intersection_counts[tp];
-    }
-
-    int
-    winding_number(enum Solver::coordinate_type tp = Solver::x_fixed) const
-    {
-      return m_winding_numbers[tp];
+      return m_winding_numbers(x, y)[tp];
     }
 
   private:
-    /* unsigned distance in IntPath coordinates,
-     * a negative value indicates value is not
-     * assigned
-     */
-    float m_distance;
-
-    /* number of intersection (counted with multiplicity)
-     * of a ray agains the path.
-     */
-    fastuidraw::vecN<int, 4> m_ray_intersection_counts;
+    /* unsigned distance in IntPath coordinates */
+    fastuidraw::array2d<float> m_distances;
 
     /* winding number computed from horizontal or vertical lines
      */
-    fastuidraw::vecN<int, 2> m_winding_numbers;
+    fastuidraw::array2d<fastuidraw::ivec2> m_winding_numbers;
   };
 
   class DistanceFieldGenerator
@@ -442,6 +432,7 @@ namespace
   public:
     typedef fastuidraw::detail::IntContour IntContour;
     typedef fastuidraw::detail::IntBezierCurve IntBezierCurve;
+    typedef fastuidraw::detail::WorkerPool WorkerPool;
     typedef fastuidraw::ivec2 ivec2;
     typedef fastuidraw::vec2 vec2;
 
@@ -451,55 +442,226 @@ namespace
     {}
 
     /*
-     * Compute distance_value for the domain
+     * Compute distance_values for the domain
      *  D = { (x(i), y(j)) : 0 <= i < count.x(), 0 <= j < count.y() }
      * where
      *  x(i) = step.x() * i
      *  y(j) = step.y() * j
      * One can get translation via using the transformation argument, tr.
+     * If pool is non-null, the lines of D are split into bands that
+     * are processed in parallel by the pool; the values computed do
+     * not depend on if (or how) the work is split.
      */
     void
     compute_distance_values(const ivec2 &step, const ivec2 &count,
                             const IntBezierCurve::transformation<int> &tr,
-                            int radius,
-                            fastuidraw::array2d<distance_value> &out_values) const;
+                            int radius, WorkerPool *pool,
+                            distance_values &out_values) const;
 
     static
     uint8_t
     pixel_value_from_distance(float dist, bool outside);
 
+    /* Split [0, count) into bands and call f(begin, end) on each
+     * band, the calls are made from the threads of the pool if
+     * pool is non-null and count is large enough.
+     */
+    static
+    void
+    for_each_band(WorkerPool *pool, int count,
+                  const std::function<void (int, int)> &f);
+
   private:
+    static
+    void
+    record_distance_values(float *dst, int cnt, int y0, int step_y,
+                           int base, int p_y);
+
+    static
+    void
+    record_distance_values(float *dst, int cnt, int y0, int step_y,
+                           float base, float p_y);
+
     template<typename T>
     static
     void
     record_distance_value_from_canidate(const fastuidraw::vecN<T, 2> &p, int radius,
                                         const ivec2 &step,
                                         const ivec2 &count,
-                                        fastuidraw::array2d<distance_value> &dst);
+                                        distance_values &dst);
 
     void
     compute_outline_point_values(const ivec2 &step, const ivec2 &count,
                                  const IntBezierCurve::transformation<int> &tr,
                                  int radius,
-                                 fastuidraw::array2d<distance_value> &dst) const;
+                                 distance_values &dst) const;
     void
     compute_derivative_cancel_values(const ivec2 &step, const ivec2 &count,
                                      const IntBezierCurve::transformation<int> &tr,
                                      int radius,
-                                     fastuidraw::array2d<distance_value> &dst) const;
+                                     distance_values &dst) const;
     void
-    compute_fixed_line_values(const ivec2 &step, const ivec2 &count,
+    compute_fixed_line_values(enum Solver::coordinate_type tp,
+                              const ivec2 &step, const ivec2 &count,
                               const IntBezierCurve::transformation<int> &tr,
-                              fastuidraw::array2d<distance_value> &dst) const;
+                              WorkerPool *pool,
+                              distance_values &dst) const;
+
     void
     compute_fixed_line_values(enum Solver::coordinate_type tp,
+                              int begin, int end,
                               std::vector<std::vector<Solver::solution_pt> > &work_room,
                               const ivec2 &step, const ivec2 &count,
                               const IntBezierCurve::transformation<int> &tr,
-                              fastuidraw::array2d<distance_value> &dst) const;
+                              distance_values &dst) const;
 
     const std::vector<fastuidraw::detail::IntContour> &m_contours;
   };
+
+  /* Distance from a point to an msdf_edge; the distance is
+   * signed with positive values to the left of the edge.
+   * Among edges with the same distance, the edge for which
+   * the point is most orthogonal (i.e. smallest m_dot) is
+   * closest.
+   */
+  class msdf_distance
+  {
+  public:
+    msdf_distance(void):
+      m_distance(std::numeric_limits<float>::infinity()),
+      m_dot(1.0f)
+    {}
+
+    bool
+    operator<(const msdf_distance &rhs) const
+    {
+      float a(fastuidraw::t_abs(m_distance)), b(fastuidraw::t_abs(rhs.m_distance));
+      return a < b || (a == b && m_dot < rhs.m_dot);
+    }
+
+    float m_distance;
+    float m_dot;
+  };
+
+  /* A curve of an IntPath after transformation, together with
+   * the channels of the multi-channel distance field to which
+   * the curve contributes.
+   */
+  class msdf_edge
+  {
+  public:
+    typedef fastuidraw::detail::IntBezierCurve IntBezierCurve;
+    typedef fastuidraw::vec2 vec2;
+
+    enum color_t
+      {
+        red = 1,
+        green = 2,
+        blue = 4,
+
+        cyan = green | blue,
+        magenta = red | blue,
+        yellow = red | green,
+        white = red | green | blue
+      };
+
+    msdf_edge(const IntBezierCurve &curve,
+              const IntBezierCurve::transformation<float> &tr);
+
+    /* returns true if all control points are the same */
+    bool
+    degenerate(void) const;
+
+    vec2
+    point(float t) const;
+
+    vec2
+    derivative(float t) const;
+
+    vec2
+    second_derivative(float t) const;
+
+    /* direction of the edge at its start and end */
+    vec2
+    direction_start(void) const;
+
+    vec2
+    direction_end(void) const;
+
+    /* compute the distance from p to the edge and
+     * the parameter of the point closest to p
+     */
+    void
+    distance(const vec2 &p, msdf_distance *out_distance, float *out_t) const;
+
+    /* the distance from p to the edge where the edge is
+     * extended along its tangent lines past its end points;
+     * d and t are as computed by distance().
+     */
+    float
+    pseudo_distance(const vec2 &p, const msdf_distance &d, float t) const;
+
+    /* lower bound of the distance from p to the edge */
+    float
+    distance_lower_bound(const vec2 &p) const
+    {
+      vec2 d(fastuidraw::t_max(0.0f, fastuidraw::t_max(m_min.x() - p.x(), p.x() - m_max.x())),
+             fastuidraw::t_max(0.0f, fastuidraw::t_max(m_min.y() - p.y(), p.y() - m_max.y())));
+      return d.magnitude();
+    }
+
+    fastuidraw::vecN<vec2, 4> m_pts;
+    int m_degree;
+    uint32_t m_color;
+
+    /* bounding box of the control points */
+    vec2 m_min, m_max;
+  };
+
+  /* Computes a multi-channel signed distance field (MSDF)
+   * of an IntPath: the curves of each contour are assigned
+   * to the channels so that the channels change at the
+   * corners of the contour, the median of the channels
+   * then retains the corners. See "Shape Decomposition for
+   * Multi-channel Distance Fields" by V. Chlumsky.
+   */
+  class MultiChannelDistanceFieldGenerator
+  {
+  public:
+    typedef fastuidraw::detail::IntContour IntContour;
+    typedef fastuidraw::detail::IntBezierCurve IntBezierCurve;
+    typedef fastuidraw::ivec2 ivec2;
+    typedef fastuidraw::vec2 vec2;
+    typedef fastuidraw::vec3 vec3;
+
+    MultiChannelDistanceFieldGenerator(const std::vector<IntContour> &contours,
+                                       const IntBezierCurve::transformation<int> &tr);
+
+    /* Compute the signed pseudo-distances of the channels
+     * at p, a channel is +infinity if no edge contributes
+     * to it. Also returns the unsigned distance from p to
+     * the path.
+     */
+    void
+    compute_values(const vec2 &p, vec3 *out_channels, float *out_distance) const;
+
+  private:
+    static
+    uint32_t
+    switch_color(uint32_t color, uint32_t banned);
+
+    static
+    int
+    symmetrical_trichotomy(int position, int n);
+
+    void
+    color_edges(fastuidraw::c_array<msdf_edge> edges);
+
+    std::vector<msdf_edge> m_edges;
+
+    /* 1 if the filled region is to the left of the edges, -1 otherwise */
+    float m_sign;
+  };
 }
 
 //////////////////////////////////////////////
@@ -914,7 +1076,7 @@ compute_line_intersection(int pt, enum coordinate_type line_type,
 
 void
 Solver::
-compute_lines_intersection(enum coordinate_type tp, int step, int count,
+compute_lines_intersection(enum coordinate_type tp, int step, int begin, int end,
                            uint32_t solution_types_accepted,
                            const IntBezierCurve::transformation<int> &tr,
                            std::vector<std::vector<solution_pt> > *out_value) const
@@ -922,7 +1084,7 @@ compute_lines_intersection(enum coordinate_type tp, int step, int count,
   int cstart, cend;
   int fixed_coord(fixed_coordinate(tp));
 
-  FASTUIDRAWassert(out_value->size() == static_cast<unsigned int>(count));
+  FASTUIDRAWassert(out_value->size() >= static_cast<unsigned int>(end));
 
   if ((solution_types_accepted & outside_0_1) == 0)
     {
@@ -944,13 +1106,13 @@ compute_lines_intersection(enum coordinate_type tp, int step, int count,
        *    bbmin / step <= c <= bbmax / step
        */
 
-      cstart = fastuidraw::t_max(0, bbmin / step);
-      cend = fastuidraw::t_min(count, 2 + bbmax / step);
+      cstart = fastuidraw::t_max(begin, bbmin / step);
+      cend = fastuidraw::t_min(end, 2 + bbmax / step);
     }
   else
     {
-      cstart = 0;
-      cend = count;
+      cstart = begin;
+      cend = end;
     }
 
   for(int c = cstart; c < cend; ++c)
@@ -964,29 +1126,138 @@ compute_lines_intersection(enum coordinate_type tp, int step, int count,
 
 //////////////////////////////////////////////
 // DistanceFieldGenerator methods
+void
+DistanceFieldGenerator::
+for_each_band(WorkerPool *pool, int count,
+              const std::function<void (int, int)> &f)
+{
+  /* do not bother to split into bands smaller than this */
+  const int min_band_size(8);
+  int num_bands(1);
+
+  if (pool)
+    {
+      /* make more bands than threads because the cost of a
+       * band is not uniform across the glyph.
+       */
+      num_bands = 2 * static_cast<int>(pool->number_threads() + 1u);
+      num_bands = fastuidraw::t_min(num_bands, count / min_band_size);
+    }
+
+  if (num_bands <= 1)
+    {
+      f(0, count);
+      return;
+    }
+
+  pool->parallel_for(num_bands,
+                     [count, num_bands, &f](unsigned int band)
+                     {
+                       int b(band);
+                       f((count * b) / num_bands, (count * (b + 1)) / num_bands);
+                     });
+}
+
+void
+DistanceFieldGenerator::
+record_distance_values(float *dst, int cnt, int y0, int step_y,
+                       int base, int p_y)
+{
+  /* dst[k] = min(dst[k], |(y0 + k) * step_y - p_y| + base)
+   * with the sum computed in int and then converted to
+   * float, exactly as the scalar code does.
+   */
+  int k(0);
+
+#ifdef __SSE2__
+  const __m128i offsets(_mm_setr_epi32(0, step_y, 2 * step_y, 3 * step_y));
+  const __m128i vbase(_mm_set1_epi32(base));
+  for(; k + 4 <= cnt; k += 4)
+    {
+      __m128i d, sgn;
+      __m128 v;
+
+      d = _mm_add_epi32(_mm_set1_epi32((y0 + k) * step_y - p_y), offsets);
+      sgn = _mm_srai_epi32(d, 31);
+      d = _mm_sub_epi32(_mm_xor_si128(d, sgn), sgn);
+      v = _mm_cvtepi32_ps(_mm_add_epi32(vbase, d));
+      _mm_storeu_ps(dst + k, _mm_min_ps(v, _mm_loadu_ps(dst + k)));
+    }
+#endif
+
+  for(; k < cnt; ++k)
+    {
+      float v;
+
+      v = static_cast<float>(base + fastuidraw::t_abs((y0 + k) * step_y - p_y));
+      FASTUIDRAWassert(v >= 0.0f);
+      dst[k] = fastuidraw::t_min(v, dst[k]);
+    }
+}
+
+void
+DistanceFieldGenerator::
+record_distance_values(float *dst, int cnt, int y0, int step_y,
+                       float base, float p_y)
+{
+  /* dst[k] = min(dst[k], base + |float((y0 + k) * step_y) - p_y|) */
+  int k(0);
+
+#ifdef __SSE2__
+  const __m128i offsets(_mm_setr_epi32(0, step_y, 2 * step_y, 3 * step_y));
+  const __m128 vbase(_mm_set1_ps(base));
+  const __m128 vp_y(_mm_set1_ps(p_y));
+  const __m128 sign_bit(_mm_set1_ps(-0.0f));
+  for(; k + 4 <= cnt; k += 4)
+    {
+      __m128 d, v;
+
+      d = _mm_cvtepi32_ps(_mm_add_epi32(_mm_set1_epi32((y0 + k) * step_y), offsets));
+      d = _mm_andnot_ps(sign_bit, _mm_sub_ps(d, vp_y));
+      v = _mm_add_ps(vbase, d);
+      _mm_storeu_ps(dst + k, _mm_min_ps(v, _mm_loadu_ps(dst + k)));
+    }
+#endif
+
+  for(; k < cnt; ++k)
+    {
+      float v;
+
+      v = base + fastuidraw::t_abs(float((y0 + k) * step_y) - p_y);
+      FASTUIDRAWassert(v >= 0.0f);
+      dst[k] = fastuidraw::t_min(v, dst[k]);
+    }
+}
+
 template<typename T>
 void
 DistanceFieldGenerator::
 record_distance_value_from_canidate(const fastuidraw::vecN<T, 2> &p, int radius,
                                     const ivec2 &step,
                                     const ivec2 &count,
-                                    fastuidraw::array2d<distance_value> &dst)
+                                    distance_values &dst)
 {
   ivec2 ip(p);
+  int miny(fastuidraw::t_max(0, ip.y() - radius));
+  int maxy(fastuidraw::t_min(count.y(), ip.y() + radius));
+
+  if (miny >= maxy)
+    {
+      return;
+    }
+
+  /* the texels (x, y) for a fixed x are contiguous, so
+   * each column is handled as one run of values
+   */
   for(int x = fastuidraw::t_max(0, ip.x() - radius),
         maxx = fastuidraw::t_min(count.x(), ip.x() + radius);
       x < maxx; ++x)
     {
-      for(int y = fastuidraw::t_max(0, ip.y() - radius),
-            maxy = fastuidraw::t_min(count.y(), ip.y() + radius);
-          y < maxy; ++y)
-        {
-          T v;
+      T base;
 
-          v = fastuidraw::t_abs(T(x * step.x()) - p.x())
-            + fastuidraw::t_abs(T(y * step.y()) - p.y());
-          dst(x, y).record_distance_value(static_cast<float>(v));
-        }
+      base = fastuidraw::t_abs(T(x * step.x()) - p.x());
+      record_distance_values(dst.distances(x, miny), maxy - miny,
+                             miny, step.y(), base, p.y());
     }
 }
 
@@ -1011,7 +1282,8 @@ void
 DistanceFieldGenerator::
 compute_distance_values(const ivec2 &step, const ivec2 &count,
                         const IntBezierCurve::transformation<int> &tr,
-                        int radius, fastuidraw::array2d<distance_value> &dst) const
+                        int radius, WorkerPool *pool,
+                        distance_values &dst) const
 {
   /* We are computing the L1-distance from the path. For a given
    * curve C, that value is given by
@@ -1032,17 +1304,24 @@ compute_distance_values(const ivec2 &step, const ivec2 &count,
    * Note that the actual number of polynomial solves needed is
    * then just count.x (for 1) plus count.y (for 2). The items
    * from (3) and (4) are already stored in IntBezierCurve
+   *
+   * The value at a texel is the minimum of the candidates,
+   * so the order in which candidates are recorded does not
+   * change the result. The passes of (1) and (2) dominate the
+   * cost and are split into bands of lines, each band writing
+   * only to the texels of its own lines.
    */
   compute_outline_point_values(step, count, tr, radius, dst);
   compute_derivative_cancel_values(step, count, tr, radius, dst);
-  compute_fixed_line_values(step, count, tr, dst);
+  compute_fixed_line_values(Solver::x_fixed, step, count, tr, pool, dst);
+  compute_fixed_line_values(Solver::y_fixed, step, count, tr, pool, dst);
 }
 
 void
 DistanceFieldGenerator::
 compute_outline_point_values(const ivec2 &step, const ivec2 &count,
                              const IntBezierCurve::transformation<int> &tr,
-                             int radius, fastuidraw::array2d<distance_value> &dst) const
+                             int radius, distance_values &dst) const
 {
   for(const IntContour &contour: m_contours)
     {
@@ -1060,7 +1339,7 @@ DistanceFieldGenerator::
 compute_derivative_cancel_values(const ivec2 &step, const ivec2 &count,
                                  const IntBezierCurve::transformation<int> &tr,
                                  int radius,
-                                 fastuidraw::array2d<distance_value> &dst) const
+                                 distance_values &dst) const
 {
   IntBezierCurve::transformation<float> ftr(tr.cast<float>());
   for(const IntContour &contour: m_contours)
@@ -1079,73 +1358,63 @@ compute_derivative_cancel_values(const ivec2 &step, const ivec2 &count,
 
 void
 DistanceFieldGenerator::
-compute_fixed_line_values(const ivec2 &step, const ivec2 &count,
+compute_fixed_line_values(enum Solver::coordinate_type tp,
+                          const ivec2 &step, const ivec2 &count,
                           const IntBezierCurve::transformation<int> &tr,
-                          fastuidraw::array2d<distance_value> &dst) const
+                          WorkerPool *pool,
+                          distance_values &dst) const
 {
-  std::vector<std::vector<Solver::solution_pt> > work_room0;
-  std::vector<std::vector<Solver::solution_pt> > work_room1;
+  const int fixed_coord(Solver::fixed_coordinate(tp));
+  std::vector<std::vector<Solver::solution_pt> > work_room(count[fixed_coord]);
 
-  compute_fixed_line_values(Solver::x_fixed, work_room0, step, count, tr, dst);
-  compute_fixed_line_values(Solver::y_fixed, work_room1, step, count, tr, dst);
+  for_each_band(pool, count[fixed_coord],
+                [&](int begin, int end)
+                {
+                  compute_fixed_line_values(tp, begin, end, work_room,
+                                            step, count, tr, dst);
+                });
 }
 
-
 void
 DistanceFieldGenerator::
 compute_fixed_line_values(enum Solver::coordinate_type tp,
+                          int begin, int end,
                           std::vector<std::vector<Solver::solution_pt> > &work_room,
                           const ivec2 &step, const ivec2 &count,
                           const IntBezierCurve::transformation<int> &tr,
-                          fastuidraw::array2d<distance_value> &dst) const
+                          distance_values &dst) const
 {
-  const enum distance_value::winding_ray_t ray_types[2][2] =
-    {
-      {distance_value::from_pt_to_y_negative_infinity, distance_value::from_pt_to_y_positive_infinity}, //fixed-coordinate 0
-      {distance_value::from_pt_to_x_negative_infinity, distance_value::from_pt_to_x_positive_infinity}, //fixed-coordinate 1
-    };
-
   const int fixed_coord(Solver::fixed_coordinate(tp));
   const int varying_coord(Solver::varying_coordinate(tp));
   const int winding_sgn((tp == Solver::x_fixed) ? 1 : -1);
 
-  work_room.resize(count[fixed_coord]);
-  for(int i = 0; i < count[fixed_coord]; ++i)
-    {
-      work_room[i].clear();
-    }
-
-  /* record the solutions for each fixed line */
+  /* record the solutions for each fixed line of the band,
+   * the curves are walked in the same order for every band
+   * so that the solutions of each line are also in the same
+   * order regardless of how the lines are split.
+   */
   for(const IntContour &contour: m_contours)
     {
       const std::vector<IntBezierCurve> &curves(contour.curves());
       for(const IntBezierCurve &curve : curves)
         {
           Solver(curve).compute_lines_intersection(tp, step[fixed_coord],
-                                                   count[fixed_coord],
+                                                   begin, end,
                                                    Solver::within_0_1,
                                                    tr, &work_room);
         }
     }
 
   /* now for each line, do the distance computation along the line. */
-  for(int c = 0; c < count[fixed_coord]; ++c)
+  for(int c = begin; c < end; ++c)
     {
       std::vector<Solver::solution_pt> &L(work_room[c]);
-      int total_cnt(0), winding(0);
+      int winding(0);
 
       /* sort by the value in the varying coordinate
        */
       std::sort(L.begin(), L.end(), Solver::CompareSolutions(varying_coord));
-      for(const Solver::solution_pt &S : L)
-        {
-          FASTUIDRAWassert(S.m_multiplicity > 0);
-          FASTUIDRAWassert(S.m_type != Solver::on_1_boundary);
-          FASTUIDRAWassert(S.m_t < 1.0f && S.m_t >= 0.0f);
-          total_cnt += S.m_multiplicity;
-        }
-
-      for(int v = 0, current_cnt = 0, current_idx = 0, sz = L.size();
+      for(int v = 0, current_idx = 0, sz = L.size();
           v < count[varying_coord]; ++v)
         {
           ivec2 pixel;
@@ -1163,7 +1432,8 @@ compute_fixed_line_values(enum Solver::coordinate_type tp,
           while(current_idx < sz && L[current_idx].m_p[varying_coord] < p)
             {
               FASTUIDRAWassert(L[current_idx].m_multiplicity > 0);
-              current_cnt += L[current_idx].m_multiplicity;
+              FASTUIDRAWassert(L[current_idx].m_type != Solver::on_1_boundary);
+              FASTUIDRAWassert(L[current_idx].m_t < 1.0f && L[current_idx].m_t >= 0.0f);
 
               if (L[current_idx].m_p_t[fixed_coord] > 0.0f)
                 {
@@ -1186,18 +1456,471 @@ compute_fixed_line_values(enum Solver::coordinate_type tp,
             {
               float f;
               f = fastuidraw::t_abs(p - L[idx].m_p[varying_coord]);
-              dst(pixel.x(), pixel.y()).record_distance_value(f);
+              dst.record_distance_value(pixel.x(), pixel.y(), f);
             }
 
-          /* update the ray-intersection counts */
-          dst(pixel.x(), pixel.y()).increment_ray_intersection_count(ray_types[fixed_coord][0], current_cnt);
-          dst(pixel.x(), pixel.y()).increment_ray_intersection_count(ray_types[fixed_coord][1], total_cnt - current_cnt);
-
           /* set winding number */
-          dst(pixel.x(), pixel.y()).set_winding_number(tp, winding_sgn * winding);
+          dst.set_winding_number(tp, pixel.x(), pixel.y(), winding_sgn * winding);
+        }
+
+      /* release the solutions of the line */
+      std::vector<Solver::solution_pt>().swap(L);
+    }
+}
+
+//////////////////////////////////////////////
+// msdf_edge methods
+msdf_edge::
+msdf_edge(const IntBezierCurve &curve,
+          const IntBezierCurve::transformation<float> &tr):
+  m_degree(curve.degree()),
+  m_color(white)
+{
+  fastuidraw::c_array<const fastuidraw::ivec2> pts(curve.control_pts());
+  for (unsigned int i = 0; i < pts.size(); ++i)
+    {
+      m_pts[i] = tr(vec2(pts[i]));
+    }
+
+  m_min = m_max = m_pts[0];
+  for (int i = 1; i <= m_degree; ++i)
+    {
+      m_min.x() = fastuidraw::t_min(m_min.x(), m_pts[i].x());
+      m_min.y() = fastuidraw::t_min(m_min.y(), m_pts[i].y());
+      m_max.x() = fastuidraw::t_max(m_max.x(), m_pts[i].x());
+      m_max.y() = fastuidraw::t_max(m_max.y(), m_pts[i].y());
+    }
+}
+
+bool
+msdf_edge::
+degenerate(void) const
+{
+  for (int i = 1; i <= m_degree; ++i)
+    {
+      if (m_pts[i] != m_pts[0])
+        {
+          return false;
+        }
+    }
+  return true;
+}
+
+msdf_edge::vec2
+msdf_edge::
+point(float t) const
+{
+  float s(1.0f - t);
+
+  /* return the end points exactly so that neighboring
+   * edges give the same distance at a shared point.
+   */
+  if (t == 0.0f)
+    {
+      return m_pts[0];
+    }
+
+  if (t == 1.0f)
+    {
+      return m_pts[m_degree];
+    }
+
+  switch (m_degree)
+    {
+    case 1:
+      return s * m_pts[0] + t * m_pts[1];
+    case 2:
+      return (s * s) * m_pts[0] + (2.0f * s * t) * m_pts[1] + (t * t) * m_pts[2];
+    default:
+      return (s * s * s) * m_pts[0] + (3.0f * s * s * t) * m_pts[1]
+        + (3.0f * s * t * t) * m_pts[2] + (t * t * t) * m_pts[3];
+    }
+}
+
+msdf_edge::vec2
+msdf_edge::
+derivative(float t) const
+{
+  float s(1.0f - t);
+
+  switch (m_degree)
+    {
+    case 1:
+      return m_pts[1] - m_pts[0];
+    case 2:
+      return 2.0f * (s * (m_pts[1] - m_pts[0]) + t * (m_pts[2] - m_pts[1]));
+    default:
+      return 3.0f * ((s * s) * (m_pts[1] - m_pts[0])
+                     + (2.0f * s * t) * (m_pts[2] - m_pts[1])
+                     + (t * t) * (m_pts[3] - m_pts[2]));
+    }
+}
+
+msdf_edge::vec2
+msdf_edge::
+second_derivative(float t) const
+{
+  switch (m_degree)
+    {
+    case 1:
+      return vec2(0.0f, 0.0f);
+    case 2:
+      return 2.0f * (m_pts[2] - 2.0f * m_pts[1] + m_pts[0]);
+    default:
+      return 6.0f * ((1.0f - t) * (m_pts[2] - 2.0f * m_pts[1] + m_pts[0])
+                     + t * (m_pts[3] - 2.0f * m_pts[2] + m_pts[1]));
+    }
+}
+
+msdf_edge::vec2
+msdf_edge::
+direction_start(void) const
+{
+  for (int i = 1; i <= m_degree; ++i)
+    {
+      if (m_pts[i] != m_pts[0])
+        {
+          return m_pts[i] - m_pts[0];
+        }
+    }
+  return vec2(0.0f, 0.0f);
+}
+
+msdf_edge::vec2
+msdf_edge::
+direction_end(void) const
+{
+  for (int i = m_degree - 1; i >= 0; --i)
+    {
+      if (m_pts[i] != m_pts[m_degree])
+        {
+          return m_pts[m_degree] - m_pts[i];
+        }
+    }
+  return vec2(0.0f, 0.0f);
+}
+
+void
+msdf_edge::
+distance(const vec2 &p, msdf_distance *out_distance, float *out_t) const
+{
+  float t, dist_sq;
+  vec2 q, dir;
+
+  if (m_degree == 1)
+    {
+      vec2 d(m_pts[1] - m_pts[0]);
+
+      t = fastuidraw::dot(p - m_pts[0], d) / d.magnitudeSq();
+      t = fastuidraw::t_min(1.0f, fastuidraw::t_max(0.0f, t));
+      dist_sq = (p - point(t)).magnitudeSq();
+    }
+  else
+    {
+      /* find the closest sample and then refine it with
+       * Newton's method applied to f(t) = <C(t) - p, C'(t)>,
+       * i.e. the derivative of |C(t) - p|^2 / 2.
+       */
+      const int num_samples(4 * m_degree);
+      float s;
+
+      t = 0.0f;
+      dist_sq = (p - m_pts[0]).magnitudeSq();
+      for (int i = 1; i <= num_samples; ++i)
+        {
+          float ti, di;
+
+          ti = static_cast<float>(i) / static_cast<float>(num_samples);
+          di = (p - point(ti)).magnitudeSq();
+          if (di < dist_sq)
+            {
+              t = ti;
+              dist_sq = di;
+            }
+        }
+
+      s = t;
+      for (int i = 0; i < 4; ++i)
+        {
+          vec2 c(point(s) - p), d1(derivative(s)), d2(second_derivative(s));
+          float f, fp, ds;
+
+          f = fastuidraw::dot(c, d1);
+          fp = d1.magnitudeSq() + fastuidraw::dot(c, d2);
+          if (fp <= 0.0f)
+            {
+              break;
+            }
+
+          s = fastuidraw::t_min(1.0f, fastuidraw::t_max(0.0f, s - f / fp));
+          ds = (p - point(s)).magnitudeSq();
+          if (ds < dist_sq)
+            {
+              t = s;
+              dist_sq = ds;
+            }
+        }
+    }
+
+  q = p - point(t);
+  dir = derivative(t);
+  if (dir.magnitudeSq() == 0.0f)
+    {
+      dir = (t < 0.5f) ? direction_start() : direction_end();
+    }
+
+  float dist(fastuidraw::t_sqrt(dist_sq));
+  float dir_mag(dir.magnitude());
+
+  out_distance->m_distance = (dir.x() * q.y() - dir.y() * q.x() >= 0.0f) ? dist : -dist;
+  out_distance->m_dot = (dist > 0.0f && dir_mag > 0.0f) ?
+    fastuidraw::t_abs(fastuidraw::dot(dir, q)) / (dist * dir_mag) :
+    0.0f;
+  *out_t = t;
+}
+
+float
+msdf_edge::
+pseudo_distance(const vec2 &p, const msdf_distance &d, float t) const
+{
+  vec2 dir, q;
+
+  if (t == 0.0f)
+    {
+      dir = direction_start();
+      q = p - m_pts[0];
+      if (fastuidraw::dot(q, dir) >= 0.0f)
+        {
+          return d.m_distance;
+        }
+    }
+  else if (t == 1.0f)
+    {
+      dir = direction_end();
+      q = p - m_pts[m_degree];
+      if (fastuidraw::dot(q, dir) <= 0.0f)
+        {
+          return d.m_distance;
+        }
+    }
+  else
+    {
+      return d.m_distance;
+    }
+
+  /* p is beyond an end point, use the distance to
+   * the tangent line at the end point instead.
+   */
+  float pd;
+  pd = (dir.x() * q.y() - dir.y() * q.x()) / dir.magnitude();
+  return (fastuidraw::t_abs(pd) <= fastuidraw::t_abs(d.m_distance)) ?
+    pd : d.m_distance;
+}
+
+//////////////////////////////////////////////
+// MultiChannelDistanceFieldGenerator methods
+MultiChannelDistanceFieldGenerator::
+MultiChannelDistanceFieldGenerator(const std::vector<IntContour> &contours,
+                                   const IntBezierCurve::transformation<int> &tr)
+{
+  IntBezierCurve::transformation<float> ftr(tr.cast<float>());
+  float area(0.0f);
+
+  for (const IntContour &contour : contours)
+    {
+      unsigned int start(m_edges.size());
+
+      for (const IntBezierCurve &curve : contour.curves())
+        {
+          msdf_edge E(curve, ftr);
+
+          if (!E.degenerate())
+            {
+              /* the signed area of the control polygons
+               * gives the orientation of the path.
+               */
+              for (int i = 0; i < E.m_degree; ++i)
+                {
+                  area += E.m_pts[i].x() * E.m_pts[i + 1].y()
+                    - E.m_pts[i + 1].x() * E.m_pts[i].y();
+                }
+              m_edges.push_back(E);
+            }
+        }
+      color_edges(fastuidraw::make_c_array(m_edges).sub_array(start));
+    }
+
+  m_sign = (area >= 0.0f) ? 1.0f : -1.0f;
+}
+
+uint32_t
+MultiChannelDistanceFieldGenerator::
+switch_color(uint32_t color, uint32_t banned)
+{
+  const uint32_t colors[3] =
+    {
+      msdf_edge::cyan, msdf_edge::magenta, msdf_edge::yellow
+    };
+
+  unsigned int start;
+
+  start = (color == msdf_edge::magenta) ? 1u :
+    (color == msdf_edge::yellow) ? 2u : 0u;
+  for (unsigned int i = 1; i <= 3; ++i)
+    {
+      uint32_t c(colors[(start + i) % 3]);
+      if (c != color && c != banned)
+        {
+          return c;
+        }
+    }
+  FASTUIDRAWassert(!"No color available");
+  return msdf_edge::white;
+}
+
+int
+MultiChannelDistanceFieldGenerator::
+symmetrical_trichotomy(int position, int n)
+{
+  /* split [0, n) into three parts with the middle
+   * part of the same size or larger than the other
+   * two, returning -1, 0 or 1.
+   */
+  return int(3.0f + 2.875f * float(position) / float(n - 1) - 1.4375f + 0.5f) - 3;
+}
+
+void
+MultiChannelDistanceFieldGenerator::
+color_edges(fastuidraw::c_array<msdf_edge> edges)
+{
+  /* sin(3 radians); a join between edges is a corner if the
+   * direction changes by more than pi - 3 radians
+   */
+  const float cross_thresh(0.14112f);
+  std::vector<unsigned int> corners;
+
+  if (edges.empty())
+    {
+      return;
+    }
+
+  for (unsigned int i = 0; i < edges.size(); ++i)
+    {
+      vec2 a, b;
+      unsigned int prev;
+
+      prev = (i == 0) ? edges.size() - 1 : i - 1;
+      a = edges[prev].direction_end();
+      b = edges[i].direction_start();
+      a /= a.magnitude();
+      b /= b.magnitude();
+      if (fastuidraw::dot(a, b) <= 0.0f
+          || fastuidraw::t_abs(a.x() * b.y() - a.y() * b.x()) > cross_thresh)
+        {
+          corners.push_back(i);
+        }
+    }
+
+  if (corners.empty() || (corners.size() == 1 && edges.size() < 3))
+    {
+      /* a smooth contour (or a teardrop made of fewer
+       * than three edges) contributes to all channels.
+       */
+      for (msdf_edge &E : edges)
+        {
+          E.m_color = msdf_edge::white;
+        }
+    }
+  else if (corners.size() == 1)
+    {
+      /* a teardrop: the edges on either side of the
+       * corner get different colors with white between
+       */
+      const uint32_t colors[3] =
+        {
+          msdf_edge::magenta, msdf_edge::white, msdf_edge::yellow
+        };
+      int m(edges.size());
+
+      for (int i = 0; i < m; ++i)
+        {
+          edges[(corners[0] + i) % m].m_color = colors[1 + symmetrical_trichotomy(i, m)];
+        }
+    }
+  else
+    {
+      /* change the color at each corner; the color of the
+       * last run of edges must also differ from the first.
+       */
+      unsigned int spline(0), start(corners[0]), m(edges.size());
+      uint32_t color(msdf_edge::cyan), initial_color(color);
+
+      for (unsigned int i = 0; i < m; ++i)
+        {
+          unsigned int index((start + i) % m);
+
+          if (spline + 1 < corners.size() && corners[spline + 1] == index)
+            {
+              ++spline;
+              color = switch_color(color, (spline + 1 == corners.size()) ?
+                                   initial_color : color);
+            }
+          edges[index].m_color = color;
+        }
+    }
+}
+
+void
+MultiChannelDistanceFieldGenerator::
+compute_values(const vec2 &p, vec3 *out_channels, float *out_distance) const
+{
+  fastuidraw::vecN<msdf_distance, 3> closest;
+  fastuidraw::vecN<const msdf_edge*, 3> closest_edge(nullptr, nullptr, nullptr);
+  vec3 closest_t(0.0f, 0.0f, 0.0f);
+  msdf_distance closest_all;
+
+  for (const msdf_edge &E : m_edges)
+    {
+      msdf_distance d;
+      float t, lb;
+
+      /* the curve is within the bounding box of its control
+       * points, skip the edge if that box is further than
+       * the closest edges found so far.
+       */
+      lb = E.distance_lower_bound(p);
+      if (lb > fastuidraw::t_abs(closest_all.m_distance)
+          && ((E.m_color & msdf_edge::red) == 0u || lb > fastuidraw::t_abs(closest[0].m_distance))
+          && ((E.m_color & msdf_edge::green) == 0u || lb > fastuidraw::t_abs(closest[1].m_distance))
+          && ((E.m_color & msdf_edge::blue) == 0u || lb > fastuidraw::t_abs(closest[2].m_distance)))
+        {
+          continue;
+        }
+
+      E.distance(p, &d, &t);
+      if (d < closest_all)
+        {
+          closest_all = d;
+        }
+
+      for (int c = 0; c < 3; ++c)
+        {
+          if ((E.m_color & (1u << c)) != 0u && d < closest[c])
+            {
+              closest[c] = d;
+              closest_edge[c] = &E;
+              closest_t[c] = t;
+            }
         }
+    }
 
+  for (int c = 0; c < 3; ++c)
+    {
+      (*out_channels)[c] = (closest_edge[c]) ?
+        m_sign * closest_edge[c]->pseudo_distance(p, closest[c], closest_t[c]) :
+        std::numeric_limits<float>::infinity();
     }
+  *out_distance = fastuidraw::t_abs(closest_all.m_distance);
 }
 
 //////////////////////////////////////////////
@@ -1672,10 +2395,11 @@ extract_render_data(const ivec2 &step, const ivec2 &image_sz,
                     float max_distance,
                     IntBezierCurve::transformation<int> tr,
                     const CustomFillRuleBase &fill_rule,
+                    WorkerPool *pool,
                     GlyphRenderDataTexels *dst) const
 {
   DistanceFieldGenerator compute(m_contours);
-  array2d<distance_value> dist_values(image_sz.x(), image_sz.y());
+  distance_values dist_values(image_sz.x(), image_sz.y());
   int radius(2);
 
   /* change tr to be offset by half a texel, so that the
@@ -1689,39 +2413,130 @@ extract_render_data(const ivec2 &step, const ivec2 &image_sz,
   ivec2 tr_translate(tr.translate() - step / 2 - ivec2(1, 1));
   tr = IntBezierCurve::transformation<int>(tr_scale, tr_translate);
 
-  compute.compute_distance_values(step, image_sz, tr, radius, dist_values);
+  compute.compute_distance_values(step, image_sz, tr, radius, pool, dist_values);
 
   dst->resize(image_sz);
   c_array<uint8_t> texel_data(dst->texel_data());
 
-  std::fill(texel_data.begin(), texel_data.end(), 0);
-  for(int y = 0; y < image_sz.y(); ++y)
-    {
-      for(int x = 0; x < image_sz.x(); ++x)
-        {
-          bool outside1, outside2;
-          float dist;
-          uint8_t v;
-          int w1, w2;
-          unsigned int location;
+  DistanceFieldGenerator::for_each_band(pool, image_sz.x(),
+                                        [&](int begin, int end)
+  {
+    for(int x = begin; x < end; ++x)
+      {
+        for(int y = 0; y < image_sz.y(); ++y)
+          {
+            bool outside1, outside2;
+            float dist;
+            uint8_t v;
+            int w1, w2;
+            unsigned int location;
+
+            w1 = dist_values.winding_number(Solver::x_fixed, x, y);
+            w2 = dist_values.winding_number(Solver::y_fixed, x, y);
+
+            outside1 = !fill_rule(w1);
+            outside2 = !fill_rule(w2);
+
+            dist = dist_values.distance(x, y, max_distance) / max_distance;
+            if (outside1 != outside2)
+              {
+                /* if the fills do not match, then a curve is going through
+                 * the test point of the texel, thus make the distance 0
+                 */
+                dist = 0.0f;
+              }
+            v = DistanceFieldGenerator::pixel_value_from_distance(dist, outside1);
+            location = x + y * image_sz.x();
+            texel_data[location] = v;
+          }
+      }
+  });
+}
 
-          w1 = dist_values(x, y).winding_number(Solver::x_fixed);
-          w2 = dist_values(x, y).winding_number(Solver::y_fixed);
+void
+fastuidraw::detail::IntPath::
+extract_render_data(const ivec2 &step, const ivec2 &image_sz,
+                    float max_distance,
+                    IntBezierCurve::transformation<int> tr,
+                    const CustomFillRuleBase &fill_rule,
+                    WorkerPool *pool,
+                    GlyphRenderDataMSDF *dst) const
+{
+  DistanceFieldGenerator compute(m_contours);
+  distance_values dist_values(image_sz.x(), image_sz.y());
+  int radius(2);
 
-          outside1 = !fill_rule(w1);
-          outside2 = !fill_rule(w2);
+  /* same sample points as the distance field, see above */
+  int tr_scale(tr.scale());
+  ivec2 tr_translate(tr.translate() - step / 2 - ivec2(1, 1));
+  tr = IntBezierCurve::transformation<int>(tr_scale, tr_translate);
 
-          dist = dist_values(x, y).distance(max_distance) / max_distance;
-          if (outside1 != outside2)
-            {
-              /* if the fills do not match, then a curve is going through
-               * the test point of the texel, thus make the distance 0
-               */
-              dist = 0.0f;
-            }
-          v = DistanceFieldGenerator::pixel_value_from_distance(dist, outside1);
-          location = x + y * image_sz.x();
-          texel_data[location] = v;
-        }
-    }
+  /* the winding numbers give if a texel is inside or outside
+   * which is used to correct the channels at those texels
+   * where the median of the channels gives the wrong side.
+   */
+  compute.compute_distance_values(step, image_sz, tr, radius, pool, dist_values);
+
+  MultiChannelDistanceFieldGenerator msdf(m_contours, tr);
+
+  dst->resize(image_sz);
+  c_array<uint8_t> texel_data(dst->texel_data());
+
+  DistanceFieldGenerator::for_each_band(pool, image_sz.x(),
+                                        [&](int begin, int end)
+  {
+    for(int x = begin; x < end; ++x)
+      {
+        for(int y = 0; y < image_sz.y(); ++y)
+          {
+            bool outside1, outside2;
+            float dist, median;
+            vec3 channels;
+            unsigned int location;
+
+            outside1 = !fill_rule(dist_values.winding_number(Solver::x_fixed, x, y));
+            outside2 = !fill_rule(dist_values.winding_number(Solver::y_fixed, x, y));
+
+            msdf.compute_values(vec2(step.x() * x, step.y() * y), &channels, &dist);
+            if (outside1 != outside2)
+              {
+                /* a curve goes through the texel */
+                dist = 0.0f;
+              }
+            else if (outside1)
+              {
+                dist = -dist;
+              }
+
+            for (int c = 0; c < 3; ++c)
+              {
+                if (channels[c] == std::numeric_limits<float>::infinity())
+                  {
+                    channels[c] = dist;
+                  }
+              }
+
+            median = t_max(t_min(channels[0], channels[1]),
+                           t_min(t_max(channels[0], channels[1]), channels[2]));
+            if (outside1 == outside2 && (median <= 0.0f) != outside1)
+              {
+                /* the channels give the wrong side of the path
+                 * at the texel, fall back to the true distance.
+                 */
+                channels = vec3(dist, dist, dist);
+              }
+
+            location = GlyphRenderDataMSDF::number_channels * (x + y * image_sz.x());
+            for (int c = 0; c < 3; ++c)
+              {
+                texel_data[location + c] =
+                  DistanceFieldGenerator::pixel_value_from_distance(t_abs(channels[c]) / max_distance,
+                                                                    channels[c] < 0.0f);
+              }
+            texel_data[location + GlyphRenderDataMSDF::alpha_channel] =
+              DistanceFieldGenerator::pixel_value_from_distance(t_abs(dist) / max_distance,
+                                                                dist < 0.0f);
+          }
+      }
+  });
 }
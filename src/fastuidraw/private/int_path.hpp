@@ -28,6 +28,7 @@
 #include <fastuidraw/path.hpp>
 #include <fastuidraw/painter/fill_rule.hpp>
 #include <fastuidraw/text/glyph_render_data_texels.hpp>
+#include <fastuidraw/text/glyph_render_data_msdf.hpp>
 
 #include "array2d.hpp"
 #include "bounding_box.hpp"
@@ -37,6 +38,8 @@ namespace fastuidraw
 {
   namespace detail
   {
+    class WorkerPool;
+
     class IntBezierCurve
     {
     public:
@@ -440,14 +443,32 @@ namespace fastuidraw
        *                   AFTER tr is applied
        * \param image_sz size of the distance field to make
        * \param tr transformation to apply to data of path
+       * \param pool if non-null, WorkerPool across which to
+       *             split the computation in bands of texels;
+       *             the output does not depend on the pool
        */
       void
       extract_render_data(const ivec2 &texel_size, const ivec2 &image_sz,
                           float max_distance,
                           IntBezierCurve::transformation<int> tr,
                           const CustomFillRuleBase &fill_rule,
+                          WorkerPool *pool,
                           GlyphRenderDataTexels *dst) const;
 
+      /* Compute multi-channel signed distance field data, where
+       * the distance values are sampled at the center of each
+       * texel. The arguments are as for the distance field
+       * overload, with max_distance being the distance that
+       * is mapped to the limits of the 8-bit channel values.
+       */
+      void
+      extract_render_data(const ivec2 &texel_size, const ivec2 &image_sz,
+                          float max_distance,
+                          IntBezierCurve::transformation<int> tr,
+                          const CustomFillRuleBase &fill_rule,
+                          WorkerPool *pool,
+                          GlyphRenderDataMSDF *dst) const;
+
     private:
       IntBezierCurve::ID_t
       computeID(void);
@@ -136,17 +136,90 @@ allocate_interval(int size)
       return -1;
     }
 
-  interval_ref interval_reference(*iter->second.begin());
+  return allocate_from_front(*iter->second.begin(), iter, size);
+}
+
+int
+fastuidraw::interval_allocator::
+allocate_interval_lowest(int size, int bound)
+{
+  if (size <= 0)
+    {
+      return -1;
+    }
+
+  /* m_free_intervals is keyed by the end of the intervals,
+   * and the free intervals are disjoint, so walking it
+   * visits the free intervals in order of location.
+   */
+  for (interval_ref iter = m_free_intervals.begin();
+       iter != m_free_intervals.end() && iter->second.m_begin + size <= bound;
+       ++iter)
+    {
+      int sz(iter->second.m_end - iter->second.m_begin);
+      if (sz >= size)
+        {
+          std::map<int, interval_ref_set>::iterator sorted_iter;
+
+          sorted_iter = m_sorted.find(sz);
+          FASTUIDRAWassert(sorted_iter != m_sorted.end());
+          sorted_iter->second.erase(iter);
+          if (sorted_iter->second.empty())
+            {
+              m_sorted.erase(sorted_iter);
+            }
+          return allocate_from_front(iter, m_sorted.end(), size);
+        }
+    }
+
+  return -1;
+}
+
+int
+fastuidraw::interval_allocator::
+lowest_free_location(int size) const
+{
+  if (size <= 0 || m_sorted.empty() || m_sorted.rbegin()->first < size)
+    {
+      return -1;
+    }
+
+  for (const auto &iter : m_free_intervals)
+    {
+      if (iter.second.m_end - iter.second.m_begin >= size)
+        {
+          return iter.second.m_begin;
+        }
+    }
+
+  FASTUIDRAWassert(!"Free interval of sufficient size not found");
+  return -1;
+}
+
+int
+fastuidraw::interval_allocator::
+allocate_from_front(interval_ref interval_reference,
+                    std::map<int, interval_ref_set>::iterator sorted_iter,
+                    int size)
+{
+  /* if sorted_iter is not m_sorted.end(), the interval is
+   * still in m_sorted and the first element of sorted_iter;
+   * otherwise the caller already removed it from m_sorted.
+   */
   interval I(interval_reference->second);
   interval return_value(I.m_begin, I.m_begin + size);
 
   FASTUIDRAWassert(interval_reference->second.m_end == interval_reference->first);
-  FASTUIDRAWassert(I.m_end - I.m_begin == iter->first);
+  FASTUIDRAWassert(I.m_end - I.m_begin >= size);
 
-  iter->second.erase(iter->second.begin());
-  if (iter->second.empty())
+  if (sorted_iter != m_sorted.end())
     {
-      m_sorted.erase(iter);
+      FASTUIDRAWassert(I.m_end - I.m_begin == sorted_iter->first);
+      sorted_iter->second.erase(sorted_iter->second.begin());
+      if (sorted_iter->second.empty())
+        {
+          m_sorted.erase(sorted_iter);
+        }
     }
 
   /* Now take away the room from the interval
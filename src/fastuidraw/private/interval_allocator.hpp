@@ -101,6 +101,27 @@ namespace fastuidraw
     int
     allocate_interval(int size);
 
+    /*!\fn
+     * Allocate at the lowest location possible, i.e. first fit instead
+     * of best fit, an interval that ends no later than a bound. Returns
+     * the "begin" of the interval allocated. Returns -1 on failure.
+     * Runs in time linear in the number of free intervals.
+     * \param size length of interval to allocate
+     * \param bound value that the end of the interval may not exceed
+     */
+    int
+    allocate_interval_lowest(int size, int bound);
+
+    /*!\fn
+     * Returns the lowest location of a free interval of atleast the
+     * given size, i.e. the value allocate_interval_lowest() would
+     * return with bound as size(). Returns -1 if there is no such
+     * interval. Runs in time linear in the number of free intervals.
+     * \param size length of interval
+     */
+    int
+    lowest_free_location(int size) const;
+
     /*!\fn
      * Free an interval.
      * \param location start of interval
@@ -121,6 +142,17 @@ namespace fastuidraw
         m_sorted.rbegin()->first;
     }
 
+    /*!\fn
+     * Returns the number of free intervals, i.e. the
+     * number of blocks into which the free room is
+     * split.
+     */
+    unsigned int
+    number_free_intervals(void) const
+    {
+      return m_free_intervals.size();
+    }
+
     /*!\fn
      * Returns the allocation status of an interval
      * \param begin start of interval
@@ -146,6 +178,11 @@ namespace fastuidraw
     };
     typedef std::set<interval_ref, compare_interval_ref> interval_ref_set;
 
+    int
+    allocate_from_front(interval_ref interval_reference,
+                        std::map<int, interval_ref_set>::iterator sorted_iter,
+                        int size);
+
     void
     remove_free_interval(interval_ref iter);
 
@@ -0,0 +1,81 @@
+/*!
+ * \file path_contour_edges.hpp
+ * \brief file path_contour_edges.hpp
+ *
+ * Copyright 2019 by Intel.
+ *
+ * Contact: kevin.rogovin@intel.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@intel.com>
+ *
+ */
+
+#pragma once
+
+#include <fastuidraw/util/c_array.hpp>
+#include <fastuidraw/util/vecN.hpp>
+#include <fastuidraw/path.hpp>
+
+namespace fastuidraw
+{
+  namespace detail
+  {
+    /* Read access to the compact storage of the edges of
+     * a PathContour; unlike PathContour::interpolator(),
+     * it does not make the interpolator_base objects of
+     * the edges. The PathContour must outlive the
+     * PathContourEdges and no edges may be added to it
+     * while the PathContourEdges is used.
+     */
+    class PathContourEdges
+    {
+    public:
+      enum verb_t
+        {
+          flat_verb,
+          bezier_verb,
+          arc_verb,
+          generic_verb
+        };
+
+      explicit
+      PathContourEdges(const PathContour &contour);
+
+      /* number of edges, i.e. PathContour::number_interpolators() */
+      unsigned int
+      number_edges(void) const;
+
+      enum verb_t
+      verb(unsigned int I) const;
+
+      enum PathEnums::edge_type_t
+      edge_type(unsigned int I) const;
+
+      /* the start point, the control points and the end
+       * point of the edge I; for an arc_verb or generic_verb
+       * edge, these are just the start and end point.
+       */
+      c_array<const vec2>
+      points(unsigned int I) const;
+
+      /* angle of the edge I, which must be an arc_verb edge */
+      float
+      angle(unsigned int I) const;
+
+      /* interpolator of the edge I, which must be
+       * a generic_verb edge.
+       */
+      const reference_counted_ptr<const PathContour::interpolator_base>&
+      generic(unsigned int I) const;
+
+    private:
+      const void *m_d;
+    };
+  }
+}
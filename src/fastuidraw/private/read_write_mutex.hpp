@@ -0,0 +1,96 @@
+/*!
+ * \file read_write_mutex.hpp
+ * \brief file read_write_mutex.hpp
+ *
+ * Copyright 2019 by Intel.
+ *
+ * Contact: kevin.rogovin@intel.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@intel.com>
+ *
+ */
+
+
+#pragma once
+
+#include <pthread.h>
+#include <fastuidraw/util/util.hpp>
+
+namespace fastuidraw { namespace detail {
+
+/* A ReadWriteMutex can be held by any number of readers
+ * (lock_shared()) or by one writer (lock()); C++11 does
+ * not provide std::shared_mutex, so it wraps a
+ * pthread_rwlock_t. The lock() and unlock() methods
+ * make it usable with std::lock_guard for writers.
+ */
+class ReadWriteMutex:fastuidraw::noncopyable
+{
+public:
+  ReadWriteMutex(void)
+  {
+    pthread_rwlock_init(&m_lock, nullptr);
+  }
+
+  ~ReadWriteMutex()
+  {
+    pthread_rwlock_destroy(&m_lock);
+  }
+
+  void
+  lock(void)
+  {
+    pthread_rwlock_wrlock(&m_lock);
+  }
+
+  void
+  unlock(void)
+  {
+    pthread_rwlock_unlock(&m_lock);
+  }
+
+  void
+  lock_shared(void)
+  {
+    pthread_rwlock_rdlock(&m_lock);
+  }
+
+  void
+  unlock_shared(void)
+  {
+    pthread_rwlock_unlock(&m_lock);
+  }
+
+private:
+  pthread_rwlock_t m_lock;
+};
+
+/* Analogue of std::lock_guard to hold a
+ * ReadWriteMutex as a reader.
+ */
+class SharedLockGuard:fastuidraw::noncopyable
+{
+public:
+  explicit
+  SharedLockGuard(ReadWriteMutex &m):
+    m_mutex(m)
+  {
+    m_mutex.lock_shared();
+  }
+
+  ~SharedLockGuard()
+  {
+    m_mutex.unlock_shared();
+  }
+
+private:
+  ReadWriteMutex &m_mutex;
+};
+
+}}
@@ -0,0 +1,222 @@
+/*!
+ * \file worker_pool.cpp
+ * \brief file worker_pool.cpp
+ *
+ * Copyright 2019 by Intel.
+ *
+ * Contact: kevin.rogovin@intel.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@intel.com>
+ *
+ */
+
+#include <atomic>
+#include <memory>
+#include <map>
+#include <fastuidraw/util/math.hpp>
+#include "worker_pool.hpp"
+
+namespace
+{
+  /* true for the threads spawned by a WorkerPool */
+  thread_local bool is_worker_thread = false;
+
+  /* The state of a parallel_for() is shared between the
+   * caller and the helper tasks; a helper task may start
+   * after the parallel_for() has returned (because the
+   * caller performed all the work), hence the state is
+   * reference counted.
+   */
+  class ParallelForJob
+  {
+  public:
+    ParallelForJob(unsigned int count,
+                   const std::function<void (unsigned int)> &f):
+      m_count(count),
+      m_next(0),
+      m_completed(0),
+      m_f(f)
+    {}
+
+    void
+    execute(void)
+    {
+      unsigned int I, num_completed(0);
+
+      while ((I = m_next++) < m_count)
+        {
+          m_f(I);
+          ++num_completed;
+        }
+
+      if (num_completed > 0
+          && (m_completed += num_completed) == m_count)
+        {
+          std::lock_guard<std::mutex> m(m_mutex);
+          m_cv.notify_all();
+        }
+    }
+
+    void
+    wait(void)
+    {
+      std::unique_lock<std::mutex> m(m_mutex);
+      m_cv.wait(m, [this] { return m_completed == m_count; });
+    }
+
+    unsigned int m_count;
+    std::atomic<unsigned int> m_next, m_completed;
+    std::function<void (unsigned int)> m_f;
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+  };
+}
+
+fastuidraw::detail::WorkerPool::
+WorkerPool(unsigned int number_threads):
+  m_terminate(false)
+{
+  m_threads.reserve(number_threads);
+  for (unsigned int i = 0; i < number_threads; ++i)
+    {
+      m_threads.push_back(std::thread(&WorkerPool::thread_main, this));
+    }
+}
+
+fastuidraw::detail::WorkerPool::
+~WorkerPool()
+{
+  {
+    std::lock_guard<std::mutex> m(m_mutex);
+    m_terminate = true;
+  }
+  m_cv.notify_all();
+
+  for (std::thread &t : m_threads)
+    {
+      t.join();
+    }
+}
+
+unsigned int
+fastuidraw::detail::WorkerPool::
+default_number_threads(void)
+{
+  unsigned int N;
+
+  N = std::thread::hardware_concurrency();
+  return (N > 1u) ? N - 1u : 0u;
+}
+
+bool
+fastuidraw::detail::WorkerPool::
+executing_task(void)
+{
+  return is_worker_thread;
+}
+
+std::shared_ptr<fastuidraw::detail::WorkerPool>
+fastuidraw::detail::WorkerPool::
+shared(unsigned int number_threads)
+{
+  static std::mutex shared_mutex;
+  static std::map<unsigned int, std::shared_ptr<WorkerPool> > shared_pools;
+
+  if (number_threads == 0)
+    {
+      return nullptr;
+    }
+
+  std::lock_guard<std::mutex> m(shared_mutex);
+  std::shared_ptr<WorkerPool> &pool(shared_pools[number_threads]);
+  if (!pool)
+    {
+      pool = std::make_shared<WorkerPool>(number_threads);
+    }
+  return pool;
+}
+
+void
+fastuidraw::detail::WorkerPool::
+thread_main(void)
+{
+  is_worker_thread = true;
+  for (;;)
+    {
+      std::function<void ()> task;
+
+      {
+        std::unique_lock<std::mutex> m(m_mutex);
+        m_cv.wait(m, [this] { return m_terminate || !m_tasks.empty(); });
+        if (m_tasks.empty())
+          {
+            FASTUIDRAWassert(m_terminate);
+            return;
+          }
+        task.swap(m_tasks.front());
+        m_tasks.pop_front();
+      }
+
+      task();
+    }
+}
+
+void
+fastuidraw::detail::WorkerPool::
+add_task(const std::function<void ()> &f)
+{
+  if (m_threads.empty())
+    {
+      f();
+      return;
+    }
+
+  {
+    std::lock_guard<std::mutex> m(m_mutex);
+    m_tasks.push_back(f);
+  }
+  m_cv.notify_one();
+}
+
+void
+fastuidraw::detail::WorkerPool::
+parallel_for(unsigned int count, const std::function<void (unsigned int)> &f)
+{
+  unsigned int num_helpers;
+
+  if (count == 0)
+    {
+      return;
+    }
+
+  num_helpers = t_min(count, number_threads() + 1u) - 1u;
+  if (num_helpers == 0)
+    {
+      for (unsigned int i = 0; i < count; ++i)
+        {
+          f(i);
+        }
+      return;
+    }
+
+  std::shared_ptr<ParallelForJob> job;
+
+  job = std::make_shared<ParallelForJob>(count, f);
+  {
+    std::lock_guard<std::mutex> m(m_mutex);
+    for (unsigned int i = 0; i < num_helpers; ++i)
+      {
+        m_tasks.push_back([job] { job->execute(); });
+      }
+  }
+  m_cv.notify_all();
+
+  job->execute();
+  job->wait();
+}
@@ -0,0 +1,110 @@
+/*!
+ * \file worker_pool.hpp
+ * \brief file worker_pool.hpp
+ *
+ * Copyright 2019 by Intel.
+ *
+ * Contact: kevin.rogovin@intel.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@intel.com>
+ *
+ */
+
+
+#pragma once
+
+#include <vector>
+#include <deque>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <fastuidraw/util/util.hpp>
+
+namespace fastuidraw { namespace detail {
+
+/* A WorkerPool is a fixed set of threads that execute
+ * tasks. The main use is parallel_for() where the calling
+ * thread also participates in the work; because of that,
+ * parallel_for() can be called from within a task of the
+ * same WorkerPool without dead-locking and a WorkerPool
+ * with zero threads is valid (all work is then performed
+ * by the calling thread).
+ */
+class WorkerPool:fastuidraw::noncopyable
+{
+public:
+  /* Ctor.
+   * \param number_threads number of threads the WorkerPool
+   *                       spawns
+   */
+  explicit
+  WorkerPool(unsigned int number_threads);
+
+  ~WorkerPool();
+
+  unsigned int
+  number_threads(void) const
+  {
+    return m_threads.size();
+  }
+
+  /* Execute f(i) for each 0 <= i < count, distributed across
+   * the threads of the WorkerPool and the calling thread.
+   * Returns only once all f(i) have completed.
+   */
+  void
+  parallel_for(unsigned int count, const std::function<void (unsigned int)> &f);
+
+  /* Add a task to be executed by a thread of the WorkerPool.
+   * If the WorkerPool has no threads, the task is executed
+   * by the calling thread before add_task() returns.
+   */
+  void
+  add_task(const std::function<void ()> &f);
+
+  /* Returns a reasonable default for the number of threads
+   * of a WorkerPool; this is one less than the number of
+   * hardware threads since the calling thread of parallel_for()
+   * also performs work.
+   */
+  static
+  unsigned int
+  default_number_threads(void);
+
+  /* Returns true if the calling thread is a thread of
+   * a WorkerPool, i.e. if the caller is (within) a task.
+   */
+  static
+  bool
+  executing_task(void);
+
+  /* Returns the process-wide WorkerPool with the named number
+   * of threads, creating it on first request; returns nullptr
+   * if number_threads is 0. There is one such WorkerPool for
+   * each thread count requested and it is never replaced, so
+   * users asking for different counts do not churn the pools.
+   */
+  static
+  std::shared_ptr<WorkerPool>
+  shared(unsigned int number_threads);
+
+private:
+  void
+  thread_main(void);
+
+  std::mutex m_mutex;
+  std::condition_variable m_cv;
+  std::deque<std::function<void ()> > m_tasks;
+  std::vector<std::thread> m_threads;
+  bool m_terminate;
+};
+
+}}
@@ -19,6 +19,8 @@
 
 #include <list>
 #include <vector>
+#include <deque>
+#include <mutex>
 #include <algorithm>
 #include <fastuidraw/tessellated_path.hpp>
 #include <fastuidraw/path.hpp>
@@ -39,8 +41,18 @@ namespace
     typedef PathContour::interpolator_base interpolator_base;
     typedef fastuidraw::reference_counted_ptr<const interpolator_base> interpolator_base_ref;
 
+    RefinerEdge(void):
+      m_from_contour_tessellation(false)
+    {}
+
     tessellation_state_ref m_tess_state;
     interpolator_base_ref m_interpolator;
+
+    /* true if the edge was taken from PathContour::tessellation()
+     * and so m_tess_state needs to be made before the first
+     * refinement.
+     */
+    bool m_from_contour_tessellation;
   };
 
   class RefinerContour
@@ -83,6 +95,17 @@ namespace
   public:
     std::vector<Edge> m_edges;
     bool m_is_closed;
+
+    /* segments of the contour, set by finalize(); they are
+     * either in TessellatedPathPrivate::m_segment_data or,
+     * if m_shared is non-null, in m_shared.
+     */
+    fastuidraw::c_array<const fastuidraw::TessellatedPath::segment> m_segments;
+
+    /* the tessellation of a PathContour (see PathContour::tessellation())
+     * from which the segments are taken without copying them.
+     */
+    fastuidraw::reference_counted_ptr<const fastuidraw::TessellatedPath> m_shared;
   };
 
   class TessellatedPathPrivate
@@ -110,19 +133,76 @@ namespace
     void
     end_contour(TessellatedPathBuildingState &b);
 
+    /* tessellate the edges of a contour into contour o,
+     * segment_storage is to write to work_room.
+     */
+    void
+    tessellate_contour(TessellatedPathBuildingState &b,
+                       unsigned int o,
+                       const fastuidraw::PathContour &contour,
+                       fastuidraw::TessellatedPath::SegmentStorage &segment_storage,
+                       std::vector<fastuidraw::TessellatedPath::segment> &work_room,
+                       RefinerContour *refiner_contour);
+
+    /* take the edges of contour o from contour_tess, a
+     * tessellation of a single contour made with the same
+     * tessellation parameters; the segments are referenced
+     * and not copied.
+     */
+    void
+    add_contour_tessellation(TessellatedPathBuildingState &b,
+                             unsigned int o,
+                             const fastuidraw::PathContour &contour,
+                             const fastuidraw::reference_counted_ptr<const fastuidraw::TessellatedPath> &contour_tess,
+                             RefinerContour *refiner_contour);
+
     void
     finalize(TessellatedPathBuildingState &b);
 
+    /* Returns the linearization for thresh or nullptr if a
+     * finer one needs to be made; m_linearization_mutex must
+     * be locked.
+     */
+    const fastuidraw::TessellatedPath*
+    find_linearization(float thresh) const;
+
     std::vector<TessellatedContour> m_contours;
+
+    /* segments of the contours whose TessellatedContour::m_shared
+     * is null; if m_number_shared is zero, these are all the
+     * segments.
+     */
     std::vector<fastuidraw::TessellatedPath::segment> m_segment_data;
+    unsigned int m_number_shared;
+
+    /* all segments, made only when TessellatedPath::segment_data()
+     * is called and some contours are shared.
+     */
+    std::once_flag m_all_segment_data_once;
+    std::vector<fastuidraw::TessellatedPath::segment> m_all_segment_data;
     fastuidraw::BoundingBox<float> m_bounding_box;
     fastuidraw::TessellatedPath::TessellationParams m_params;
     float m_max_distance;
     bool m_has_arcs;
     unsigned int m_max_recursion;
+
+    /* m_stroked and m_filled are made at most once by
+     * std::call_once() so that reading them after they
+     * are made does not need a lock.
+     */
+    std::once_flag m_stroked_once, m_filled_once;
     fastuidraw::reference_counted_ptr<const fastuidraw::StrokedPath> m_stroked;
     fastuidraw::reference_counted_ptr<const fastuidraw::FilledPath> m_filled;
-    std::vector<fastuidraw::reference_counted_ptr<const fastuidraw::TessellatedPath> > m_linearization;
+
+    /* m_linearization is only appended to (and a std::deque
+     * does not move its elements when appended to); the
+     * linearizations are made with m_linearization_build_mutex
+     * locked and m_linearization_mutex is held only to read
+     * or append to m_linearization. Thus finding a linearization
+     * already made does not wait for a finer one to be made.
+     */
+    std::mutex m_linearization_mutex, m_linearization_build_mutex;
+    std::deque<fastuidraw::reference_counted_ptr<const fastuidraw::TessellatedPath> > m_linearization;
   };
 
   void
@@ -334,6 +414,7 @@ TessellatedPathPrivate::
 TessellatedPathPrivate(unsigned int num_contours,
                        fastuidraw::TessellatedPath::TessellationParams TP):
   m_contours(num_contours),
+  m_number_shared(0),
   m_params(TP),
   m_max_distance(0.0f),
   m_has_arcs(false),
@@ -345,6 +426,7 @@ TessellatedPathPrivate::
 TessellatedPathPrivate(const fastuidraw::TessellatedPath &with_arcs,
                        float thresh):
   m_contours(with_arcs.number_contours()),
+  m_number_shared(0),
   m_params(with_arcs.tessellation_parameters()),
   m_max_distance(with_arcs.max_distance()),
   m_has_arcs(false),
@@ -489,19 +571,174 @@ end_contour(TessellatedPathBuildingState &builder)
     }
 }
 
+void
+TessellatedPathPrivate::
+tessellate_contour(TessellatedPathBuildingState &builder,
+                   unsigned int o,
+                   const fastuidraw::PathContour &contour,
+                   fastuidraw::TessellatedPath::SegmentStorage &segment_storage,
+                   std::vector<fastuidraw::TessellatedPath::segment> &work_room,
+                   RefinerContour *refiner_contour)
+{
+  using namespace fastuidraw;
+
+  if (refiner_contour)
+    {
+      refiner_contour->m_edges.resize(contour.number_interpolators());
+      refiner_contour->m_start_pt = contour.point(0);
+    }
+
+  start_contour(builder, o, contour.point(0), contour.number_interpolators());
+  for(unsigned int e = 0, ende = contour.number_interpolators(); e < ende; ++e)
+    {
+      const reference_counted_ptr<const PathContour::interpolator_base> &interpolator(contour.interpolator(e));
+      reference_counted_ptr<PathContour::tessellation_state> tess_state;
+      float tmp;
+
+      FASTUIDRAWassert(interpolator);
+      FASTUIDRAWassert(work_room.empty());
+
+      tess_state = interpolator->produce_tessellation(m_params, &segment_storage, &tmp);
+      if (tess_state)
+        {
+          m_max_recursion = t_max(m_max_recursion, tess_state->recursion_depth());
+        }
+
+      if (refiner_contour)
+        {
+          refiner_contour->m_edges[e].m_tess_state = tess_state;
+          refiner_contour->m_edges[e].m_interpolator = interpolator;
+        }
+
+      add_edge(builder, o, e, work_room, tmp);
+      m_contours[o].m_edges[e].m_edge_type = interpolator->edge_type();
+    }
+
+  end_contour(builder);
+  m_contours[o].m_is_closed = contour.closed();
+}
+
+void
+TessellatedPathPrivate::
+add_contour_tessellation(TessellatedPathBuildingState &builder,
+                         unsigned int o,
+                         const fastuidraw::PathContour &contour,
+                         const fastuidraw::reference_counted_ptr<const fastuidraw::TessellatedPath> &contour_tess,
+                         RefinerContour *refiner_contour)
+{
+  using namespace fastuidraw;
+
+  FASTUIDRAWassert(contour_tess->number_contours() == 1);
+  FASTUIDRAWassert(contour_tess->number_edges(0) == contour.number_interpolators());
+  FASTUIDRAWassert(contour.number_interpolators() > 0);
+
+  if (refiner_contour)
+    {
+      refiner_contour->m_edges.resize(contour.number_interpolators());
+      refiner_contour->m_start_pt = contour.point(0);
+    }
+
+  /* the segments of a contour do not depend on the other
+   * contours of the path, so the segments of contour_tess
+   * are exactly the segments of contour o; only the ranges
+   * into segment_data() are different. The per-edge maximum
+   * distances are not kept, but the maximum distance of the
+   * contour bounds each of them and gives the same value for
+   * the maximum across the path.
+   */
+  TessellatedContour &C(m_contours[o]);
+  unsigned int offset(builder.m_loc - contour_tess->contour_range(0).m_begin);
+
+  C.m_edges.resize(contour.number_interpolators());
+  for(unsigned int e = 0, ende = contour.number_interpolators(); e < ende; ++e)
+    {
+      range_type<unsigned int> R(contour_tess->edge_range(0, e));
+
+      C.m_edges[e].m_edge_range = range_type<unsigned int>(R.m_begin + offset, R.m_end + offset);
+      C.m_edges[e].m_edge_type = contour_tess->edge_type(0, e);
+      if (refiner_contour)
+        {
+          refiner_contour->m_edges[e].m_interpolator = contour.interpolator(e);
+          refiner_contour->m_edges[e].m_from_contour_tessellation = true;
+        }
+    }
+  builder.m_loc += contour_tess->contour_segment_data(0).size();
+
+  m_max_recursion = t_max(m_max_recursion, contour_tess->max_recursion());
+  m_max_distance = t_max(m_max_distance, contour_tess->max_distance());
+  m_has_arcs = m_has_arcs || contour_tess->has_arcs();
+  m_bounding_box.union_point(contour_tess->bounding_box().m_min_point);
+  m_bounding_box.union_point(contour_tess->bounding_box().m_max_point);
+
+  C.m_is_closed = true;
+  C.m_shared = contour_tess;
+  ++m_number_shared;
+}
+
 void
 TessellatedPathPrivate::
 finalize(TessellatedPathBuildingState &b)
 {
-  unsigned int total_needed;
+  unsigned int total_needed(0), loc(0);
+
+  for(auto iter = b.m_temp.begin(), end_iter = b.m_temp.end(); iter != end_iter; ++iter)
+    {
+      total_needed += iter->size();
+    }
 
-  total_needed = m_contours.back().m_edges.back().m_edge_range.m_end;
   m_segment_data.reserve(total_needed);
   for(auto iter = b.m_temp.begin(), end_iter = b.m_temp.end(); iter != end_iter; ++iter)
     {
       std::copy(iter->begin(), iter->end(), std::back_inserter(m_segment_data));
     }
-  FASTUIDRAWassert(total_needed == m_segment_data.size());
+
+  for (TessellatedContour &C : m_contours)
+    {
+      if (C.m_shared)
+        {
+          C.m_segments = C.m_shared->contour_segment_data(0);
+        }
+      else
+        {
+          unsigned int sz;
+
+          sz = C.m_edges.back().m_edge_range.m_end - C.m_edges.front().m_edge_range.m_begin;
+          C.m_segments = fastuidraw::make_c_array(m_segment_data).sub_array(loc, sz);
+          loc += sz;
+        }
+    }
+  FASTUIDRAWassert(loc == m_segment_data.size());
+}
+
+const fastuidraw::TessellatedPath*
+TessellatedPathPrivate::
+find_linearization(float thresh) const
+{
+  using namespace fastuidraw;
+
+  if (m_linearization.empty())
+    {
+      return nullptr;
+    }
+
+  if (thresh < 0.0f)
+    {
+      return m_linearization.front().get();
+    }
+
+  if (m_linearization.back()->max_distance() <= thresh)
+    {
+      typename std::deque<reference_counted_ptr<const TessellatedPath> >::const_iterator iter;
+      iter = std::lower_bound(m_linearization.begin(),
+                              m_linearization.end(),
+                              thresh, detail::reverse_compare_max_distance);
+      FASTUIDRAWassert(iter != m_linearization.end());
+      FASTUIDRAWassert(*iter);
+      FASTUIDRAWassert((*iter)->max_distance() <= thresh);
+      return iter->get();
+    }
+
+  return nullptr;
 }
 
 //////////////////////////////////////////////////////////
@@ -679,13 +916,27 @@ TessellatedPath(Refiner *p, float max_distance,
 
       for(unsigned int e = 0, ende = contour.m_edges.size(); e < ende; ++e)
         {
-          const RefinerEdge edge(contour.m_edges[e]);
+          RefinerEdge &edge(ref_d->m_contours[o].m_edges[e]);
           SegmentStorage segment_storage;
           float tmp;
 
           FASTUIDRAWassert(work_room.empty());
           segment_storage.m_d = &work_room;
 
+          if (edge.m_from_contour_tessellation)
+            {
+              /* The edge was taken from PathContour::tessellation()
+               * which does not give the tessellation state; remake
+               * it with the parameters of that tessellation so that
+               * resuming gives the same result as when the Path is
+               * tessellated directly.
+               */
+              edge.m_tess_state = edge.m_interpolator->produce_tessellation(TessellationParams(),
+                                                                            &segment_storage, &tmp);
+              edge.m_from_contour_tessellation = false;
+              work_room.clear();
+            }
+
           if (edge.m_tess_state)
             {
               edge.m_tess_state->resume_tessellation(d->m_params, &segment_storage, &tmp);
@@ -730,48 +981,50 @@ TessellatedPath(const Path &input,
       refiner_d = static_cast<RefinerPrivate*>(r->m_d);
     }
 
+  /* the tessellations of PathContour::tessellation() are made
+   * with the default parameters, so they can only be used for
+   * the default parameters.
+   */
+  TessellationParams default_params;
+  bool use_contour_tessellations(TP.m_max_distance == default_params.m_max_distance
+                                 && TP.m_max_recursion == default_params.m_max_recursion);
+
+  SegmentStorage segment_storage;
   TessellatedPathBuildingState builder;
+
+  segment_storage.m_d = &work_room;
   for(unsigned int o = 0, endo = input.number_contours(); o < endo; ++o)
     {
-      const reference_counted_ptr<const PathContour> &contour(input.contour(o));
+      reference_counted_ptr<const PathContour> contour(input.contour(o));
+      RefinerContour *refiner_contour;
 
-      if (refiner_d)
+      refiner_contour = (refiner_d) ? &refiner_d->m_contours[o] : nullptr;
+      if (use_contour_tessellations && contour->closed())
         {
-          refiner_d->m_contours[o].m_edges.resize(contour->number_interpolators());
-          refiner_d->m_contours[o].m_start_pt = contour->point(0);
+          d->add_contour_tessellation(builder, o, *contour, contour->tessellation(),
+                                      refiner_contour);
         }
-
-      d->start_contour(builder, o, contour->point(0), contour->number_interpolators());
-      for(unsigned int e = 0, ende = contour->number_interpolators(); e < ende; ++e)
+      else
         {
-          SegmentStorage segment_storage;
-          const reference_counted_ptr<const PathContour::interpolator_base> &interpolator(contour->interpolator(e));
-          reference_counted_ptr<PathContour::tessellation_state> tess_state;
-          float tmp;
-
-          FASTUIDRAWassert(interpolator);
-          FASTUIDRAWassert(work_room.empty());
-          segment_storage.m_d = &work_room;
-
-          tess_state = interpolator->produce_tessellation(d->m_params, &segment_storage, &tmp);
-          if (tess_state)
-            {
-              d->m_max_recursion = t_max(d->m_max_recursion, tess_state->recursion_depth());
-            }
+          d->tessellate_contour(builder, o, *contour, segment_storage,
+                                work_room, refiner_contour);
+        }
+    }
+  d->finalize(builder);
+}
 
-          if (refiner_d)
-            {
-              refiner_d->m_contours[o].m_edges[e].m_tess_state = tess_state;
-              refiner_d->m_contours[o].m_edges[e].m_interpolator = interpolator;
-            }
+fastuidraw::TessellatedPath::
+TessellatedPath(const PathContour &contour)
+{
+  TessellatedPathPrivate *d;
+  m_d = d = FASTUIDRAWnew TessellatedPathPrivate(1, TessellationParams());
 
-          d->add_edge(builder, o, e, work_room, tmp);
-          d->m_contours[o].m_edges[e].m_edge_type = interpolator->edge_type();
-        }
+  std::vector<segment> work_room;
+  SegmentStorage segment_storage;
+  TessellatedPathBuildingState builder;
 
-      d->end_contour(builder);
-      d->m_contours[o].m_is_closed = contour->closed();
-    }
+  segment_storage.m_d = &work_room;
+  d->tessellate_contour(builder, 0, contour, segment_storage, work_room, nullptr);
   d->finalize(builder);
 }
 
@@ -825,7 +1078,20 @@ segment_data(void) const
   TessellatedPathPrivate *d;
   d = static_cast<TessellatedPathPrivate*>(m_d);
 
-  return make_c_array(d->m_segment_data);
+  if (d->m_number_shared == 0)
+    {
+      return make_c_array(d->m_segment_data);
+    }
+
+  std::call_once(d->m_all_segment_data_once, [d]()
+                 {
+                   for (const TessellatedContour &C : d->m_contours)
+                     {
+                       d->m_all_segment_data.insert(d->m_all_segment_data.end(),
+                                                    C.m_segments.begin(), C.m_segments.end());
+                     }
+                 });
+  return make_c_array(d->m_all_segment_data);
 }
 
 unsigned int
@@ -866,7 +1132,7 @@ contour_segment_data(unsigned int contour) const
   TessellatedPathPrivate *d;
   d = static_cast<TessellatedPathPrivate*>(m_d);
 
-  return make_c_array(d->m_segment_data).sub_array(contour_range(contour));
+  return d->m_contours[contour].m_segments;
 }
 
 unsigned int
@@ -906,7 +1172,11 @@ edge_segment_data(unsigned int contour, unsigned int edge) const
   TessellatedPathPrivate *d;
   d = static_cast<TessellatedPathPrivate*>(m_d);
 
-  return make_c_array(d->m_segment_data).sub_array(edge_range(contour, edge));
+  const TessellatedContour &C(d->m_contours[contour]);
+  range_type<unsigned int> R(C.m_edges[edge].m_edge_range);
+
+  return C.m_segments.sub_array(R.m_begin - C.m_edges.front().m_edge_range.m_begin,
+                                R.m_end - R.m_begin);
 }
 
 const fastuidraw::Rect&
@@ -934,10 +1204,10 @@ stroked(void) const
 {
   TessellatedPathPrivate *d;
   d = static_cast<TessellatedPathPrivate*>(m_d);
-  if (!d->m_stroked)
-    {
-      d->m_stroked = FASTUIDRAWnew StrokedPath(*this);
-    }
+  std::call_once(d->m_stroked_once, [d, this]()
+                 {
+                   d->m_stroked = FASTUIDRAWnew StrokedPath(*this);
+                 });
   return d->m_stroked;
 }
 
@@ -953,41 +1223,58 @@ linearization(float thresh) const
       return this;
     }
 
-  if (d->m_linearization.empty())
+  /* asking for a finer tessellation than the
+   * max-distance of this TessellatedPath is
+   * pointless.
+   */
+  if (thresh >= 0.0f)
     {
-      /* default tessellation where arcs are barely tessellated */
-      d->m_linearization.push_back(FASTUIDRAWnew TessellatedPath(*this, -1.0f));
+      thresh = t_max(thresh, d->m_max_distance);
     }
 
-  if (thresh < 0.0f)
-    {
-      return d->m_linearization.front().get();
-    }
+  {
+    std::lock_guard<std::mutex> m(d->m_linearization_mutex);
+    const TessellatedPath *p;
 
-  /* asking for a finer tessellation than the
-   * max-distance of this TessellatedPath is
-   * pointless.
+    p = d->find_linearization(thresh);
+    if (p)
+      {
+        return p;
+      }
+  }
+
+  std::lock_guard<std::mutex> b(d->m_linearization_build_mutex);
+  float current;
+
+  /* only the thread holding m_linearization_build_mutex
+   * appends to m_linearization, so it can be read here
+   * without m_linearization_mutex.
    */
-  thresh = t_max(thresh, d->m_max_distance);
-  if (d->m_linearization.back()->max_distance() <= thresh)
+  if (d->m_linearization.empty())
     {
-      typename std::vector<reference_counted_ptr<const TessellatedPath> >::const_iterator iter;
-      iter = std::lower_bound(d->m_linearization.begin(),
-                              d->m_linearization.end(),
-                              thresh, detail::reverse_compare_max_distance);
-      FASTUIDRAWassert(iter != d->m_linearization.end());
-      FASTUIDRAWassert(*iter);
-      FASTUIDRAWassert((*iter)->max_distance() <= thresh);
-      return iter->get();
+      /* default tessellation where arcs are barely tessellated */
+      reference_counted_ptr<const TessellatedPath> L;
+
+      L = FASTUIDRAWnew TessellatedPath(*this, -1.0f);
+      std::lock_guard<std::mutex> m(d->m_linearization_mutex);
+      d->m_linearization.push_back(L);
     }
 
-  float current(d->m_linearization.back()->max_distance());
-  while (current > thresh)
+  current = d->m_linearization.back()->max_distance();
+  while (thresh >= 0.0f && current > thresh)
     {
+      reference_counted_ptr<const TessellatedPath> L;
+
       current *= 0.5f;
-      d->m_linearization.push_back(FASTUIDRAWnew TessellatedPath(*this, current));
+      L = FASTUIDRAWnew TessellatedPath(*this, current);
+      std::lock_guard<std::mutex> m(d->m_linearization_mutex);
+      d->m_linearization.push_back(L);
     }
-  return d->m_linearization.back().get();
+
+  std::lock_guard<std::mutex> m(d->m_linearization_mutex);
+  return (thresh < 0.0f) ?
+    d->m_linearization.front().get() :
+    d->m_linearization.back().get();
 }
 
 const fastuidraw::TessellatedPath*
@@ -1006,10 +1293,10 @@ filled(float thresh) const
 
   tess = linearization(thresh);
   tess_d = static_cast<TessellatedPathPrivate*>(tess->m_d);
-  if (!tess_d->m_filled)
-    {
-      tess_d->m_filled = FASTUIDRAWnew FilledPath(*tess);
-    }
+  std::call_once(tess_d->m_filled_once, [tess_d, tess]()
+                 {
+                   tess_d->m_filled = FASTUIDRAWnew FilledPath(*tess);
+                 });
   return tess_d->m_filled;
 }
 
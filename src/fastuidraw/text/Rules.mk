@@ -10,9 +10,11 @@ FASTUIDRAW_SOURCES += $(call filelist, glyph_atlas.cpp \
 	glyph_render_data_restricted_rays.cpp \
 	glyph_render_data_banded_rays.cpp \
 	glyph_render_data_texels.cpp \
+	glyph_render_data_msdf.cpp \
 	glyph_cache.cpp glyph.cpp \
 	freetype_face.cpp freetype_lib.cpp \
-	font_freetype.cpp font_properties.cpp)
+	font_freetype.cpp font_properties.cpp \
+	character_coverage.cpp font_file_index.cpp)
 
 # Begin standard footer
 d		:= $(dirstack_$(sp))
@@ -0,0 +1,213 @@
+/*!
+ * \file character_coverage.cpp
+ * \brief file character_coverage.cpp
+ *
+ * Copyright 2019 by Intel.
+ *
+ * Contact: kevin.rogovin@intel.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@intel.com>
+ *
+ */
+
+
+#include <vector>
+#include <algorithm>
+#include <fastuidraw/text/character_coverage.hpp>
+#include "../private/byte_stream.hpp"
+#include "../private/util_private.hpp"
+
+namespace
+{
+  enum
+    {
+      page_shift = 8u,
+      words_per_page = (1u << page_shift) / 32u,
+    };
+
+  class CharacterCoveragePrivate
+  {
+  public:
+    CharacterCoveragePrivate(void):
+      m_count(0)
+    {}
+
+    /* returns the index into m_pages of the page,
+     * or -1 if the page is not present.
+     */
+    int
+    find_page(uint32_t page) const
+    {
+      std::vector<uint32_t>::const_iterator iter;
+
+      /* fast path for the common case of adding in order */
+      if (!m_pages.empty() && m_pages.back() == page)
+        {
+          return m_pages.size() - 1;
+        }
+
+      iter = std::lower_bound(m_pages.begin(), m_pages.end(), page);
+      return (iter != m_pages.end() && *iter == page) ?
+        iter - m_pages.begin() :
+        -1;
+    }
+
+    /* sorted page numbers of the pages with at least one character code */
+    std::vector<uint32_t> m_pages;
+
+    /* bits of page m_pages[i] are m_bits[words_per_page * i + j] */
+    std::vector<uint32_t> m_bits;
+
+    unsigned int m_count;
+  };
+}
+
+////////////////////////////////////////
+// fastuidraw::CharacterCoverage methods
+fastuidraw::CharacterCoverage::
+CharacterCoverage(void)
+{
+  m_d = FASTUIDRAWnew CharacterCoveragePrivate();
+}
+
+fastuidraw::CharacterCoverage::
+~CharacterCoverage()
+{
+  CharacterCoveragePrivate *d;
+  d = static_cast<CharacterCoveragePrivate*>(m_d);
+  FASTUIDRAWdelete(d);
+  m_d = nullptr;
+}
+
+void
+fastuidraw::CharacterCoverage::
+add(uint32_t character_code)
+{
+  CharacterCoveragePrivate *d;
+  d = static_cast<CharacterCoveragePrivate*>(m_d);
+
+  uint32_t page(character_code >> page_shift);
+  uint32_t bit(character_code & ((1u << page_shift) - 1u));
+  uint32_t mask(1u << (bit & 31u));
+  int I;
+
+  I = d->find_page(page);
+  if (I == -1)
+    {
+      std::vector<uint32_t>::iterator iter;
+
+      iter = std::lower_bound(d->m_pages.begin(), d->m_pages.end(), page);
+      I = iter - d->m_pages.begin();
+      d->m_pages.insert(iter, page);
+      d->m_bits.insert(d->m_bits.begin() + words_per_page * I, words_per_page, 0u);
+    }
+
+  uint32_t &word(d->m_bits[words_per_page * I + (bit >> 5u)]);
+  if ((word & mask) == 0u)
+    {
+      word |= mask;
+      ++d->m_count;
+    }
+}
+
+bool
+fastuidraw::CharacterCoverage::
+contains(uint32_t character_code) const
+{
+  CharacterCoveragePrivate *d;
+  d = static_cast<CharacterCoveragePrivate*>(m_d);
+
+  uint32_t bit(character_code & ((1u << page_shift) - 1u));
+  int I;
+
+  I = d->find_page(character_code >> page_shift);
+  return I != -1
+    && (d->m_bits[words_per_page * I + (bit >> 5u)] & (1u << (bit & 31u))) != 0u;
+}
+
+unsigned int
+fastuidraw::CharacterCoverage::
+number_character_codes(void) const
+{
+  CharacterCoveragePrivate *d;
+  d = static_cast<CharacterCoveragePrivate*>(m_d);
+  return d->m_count;
+}
+
+unsigned int
+fastuidraw::CharacterCoverage::
+serialized_size(void) const
+{
+  CharacterCoveragePrivate *d;
+  d = static_cast<CharacterCoveragePrivate*>(m_d);
+  return sizeof(uint32_t) * (1u + d->m_pages.size() + d->m_bits.size());
+}
+
+enum fastuidraw::return_code
+fastuidraw::CharacterCoverage::
+serialize(c_array<uint8_t> dst) const
+{
+  CharacterCoveragePrivate *d;
+  d = static_cast<CharacterCoveragePrivate*>(m_d);
+
+  detail::ByteWriter W(dst);
+  W.write(uint32_t(d->m_pages.size()))
+    .write(make_c_array(d->m_pages))
+    .write(make_c_array(d->m_bits));
+
+  return (W.overflowed() || W.remaining() != 0) ?
+    routine_fail :
+    routine_success;
+}
+
+enum fastuidraw::return_code
+fastuidraw::CharacterCoverage::
+deserialize(c_array<const uint8_t> src)
+{
+  CharacterCoveragePrivate *d;
+  d = static_cast<CharacterCoveragePrivate*>(m_d);
+
+  detail::ByteReader R(src);
+  std::vector<uint32_t> pages, bits;
+  uint32_t number_pages;
+  unsigned int count(0);
+
+  R.read(&number_pages);
+  if (R.failed()
+      || uint64_t(src.size()) != uint64_t(sizeof(uint32_t)) * (1u + uint64_t(number_pages) * (1u + words_per_page)))
+    {
+      return routine_fail;
+    }
+
+  R.read(number_pages, &pages)
+    .read(number_pages * words_per_page, &bits);
+  FASTUIDRAWassert(R.at_end());
+
+  for (unsigned int i = 1; i < pages.size(); ++i)
+    {
+      if (pages[i - 1] >= pages[i])
+        {
+          return routine_fail;
+        }
+    }
+
+  for (uint32_t w : bits)
+    {
+      for (; w != 0u; w &= w - 1u)
+        {
+          ++count;
+        }
+    }
+
+  d->m_pages.swap(pages);
+  d->m_bits.swap(bits);
+  d->m_count = count;
+
+  return routine_success;
+}
@@ -39,8 +39,12 @@ namespace
     float m_restricted_rays_minimum_render_size;
     int m_restricted_rays_split_thresh;
     int m_restricted_rays_max_recursion;
+    unsigned int m_restricted_rays_number_threads;
     unsigned int m_banded_rays_max_recursion;
     float m_banded_rays_average_number_curves_thresh;
+    unsigned int m_distance_field_number_threads;
+    unsigned int m_msdf_pixel_size;
+    float m_msdf_max_distance;
 
     std::mutex m_mutex;
     unsigned int m_number_fonts_alive;
@@ -53,8 +57,12 @@ namespace
       m_restricted_rays_minimum_render_size(32.0f),
       m_restricted_rays_split_thresh(4),
       m_restricted_rays_max_recursion(12),
+      m_restricted_rays_number_threads(0),
       m_banded_rays_max_recursion(11),
       m_banded_rays_average_number_curves_thresh(2.5f),
+      m_distance_field_number_threads(0),
+      m_msdf_pixel_size(32),
+      m_msdf_max_distance(4.0f),
       m_number_fonts_alive(0),
       m_current_unqiue_id(0)
     {}
@@ -111,8 +119,12 @@ IMPLEMENT(float, distance_field_max_distance)
 IMPLEMENT(float, restricted_rays_minimum_render_size)
 IMPLEMENT(int, restricted_rays_split_thresh)
 IMPLEMENT(int, restricted_rays_max_recursion)
+IMPLEMENT(unsigned int, restricted_rays_number_threads)
 IMPLEMENT(unsigned int, banded_rays_max_recursion)
 IMPLEMENT(float, banded_rays_average_number_curves_thresh)
+IMPLEMENT(unsigned int, distance_field_number_threads)
+IMPLEMENT(unsigned int, msdf_pixel_size)
+IMPLEMENT(float, msdf_max_distance)
 
 ///////////////////////////////////////////
 // fastuidraw::FontBase methods
@@ -26,41 +26,179 @@
 
 #include <fastuidraw/text/font_database.hpp>
 #include "../private/util_private.hpp"
+#include "../private/read_write_mutex.hpp"
 
 namespace
 {
-  class AbstractFont
+  class AbstractFont:fastuidraw::noncopyable
   {
   public:
     typedef AbstractFont* pointer_type;
 
     AbstractFont(const fastuidraw::reference_counted_ptr<const fastuidraw::FontDatabase::FontGeneratorBase> &g):
-      m_generator(g)
+      m_generator(g),
+      m_coverage(g->character_coverage()),
+      m_font_ready(false),
+      m_coverage_known(m_coverage.get() != nullptr)
     {
       FASTUIDRAWassert(g);
     }
 
     AbstractFont(const fastuidraw::reference_counted_ptr<const fastuidraw::FontBase> &f):
-      m_font(f)
+      m_font(f),
+      m_font_ready(true),
+      m_coverage_known(false)
     {
       FASTUIDRAWassert(f);
     }
 
+    /* Generates the font if necessary; thread safe. */
     const fastuidraw::reference_counted_ptr<const fastuidraw::FontBase>&
     font(void);
 
     bool
     font_ready(void) const
     {
-      return m_font;
+      return m_font_ready.load(std::memory_order_acquire);
     }
 
+    /* Returns the coverage of the font or nullptr if the
+     * coverage is not known; the coverage of a font from
+     * a generator that does not provide it is not known
+     * until the font is generated. Thread safe.
+     */
+    const fastuidraw::CharacterCoverage*
+    coverage(void);
+
   private:
+    std::mutex m_mutex;
     fastuidraw::reference_counted_ptr<const fastuidraw::FontBase> m_font;
     fastuidraw::reference_counted_ptr<const fastuidraw::FontDatabase::FontGeneratorBase> m_generator;
+    fastuidraw::reference_counted_ptr<const fastuidraw::CharacterCoverage> m_coverage;
+    std::atomic<bool> m_font_ready, m_coverage_known;
+  };
+
+  /* For each character code, gives the index into the fonts
+   * of a font_group of the first font that may have a glyph
+   * for the character, i.e. the first font whose coverage
+   * has the character or whose coverage is not known. The
+   * values are stored in pages of 256 character codes that
+   * are built on first use; the pages are published with
+   * atomic pointers so that reading needs no lock.
+   */
+  class first_font_index:fastuidraw::noncopyable
+  {
+  public:
+    enum
+      {
+        page_shift = 8,
+        page_size = 1u << page_shift,
+        plane_shift = 16,
+        pages_per_plane = 1u << (plane_shift - page_shift),
+        number_planes = 17,
+
+        /* value for when no font has the character, also
+         * bounds the number of fonts that can be indexed.
+         */
+        no_font = 0xFFFF,
+      };
+
+    typedef fastuidraw::vecN<uint16_t, page_size> page;
+
+    first_font_index(void)
+    {
+      for (auto &p : m_planes)
+        {
+          p.store(nullptr, std::memory_order_relaxed);
+        }
+    }
+
+    ~first_font_index()
+    {
+      clear();
+    }
+
+    /* returns nullptr if the page of the character
+     * code is not yet built; thread safe.
+     */
+    const page*
+    fetch_page(uint32_t character_code) const
+    {
+      const plane *P;
+
+      FASTUIDRAWassert((character_code >> plane_shift) < number_planes);
+      P = m_planes[character_code >> plane_shift].load(std::memory_order_acquire);
+      return (P) ?
+        P->m_pages[(character_code >> page_shift) & (pages_per_plane - 1u)].load(std::memory_order_acquire) :
+        nullptr;
+    }
+
+    /* store the page of the character code, taking ownership
+     * of it; must only be called by one thread at a time.
+     */
+    void
+    store_page(uint32_t character_code, page *p)
+    {
+      plane *P;
+
+      FASTUIDRAWassert((character_code >> plane_shift) < number_planes);
+      P = m_planes[character_code >> plane_shift].load(std::memory_order_relaxed);
+      if (!P)
+        {
+          P = FASTUIDRAWnew plane();
+          m_planes[character_code >> plane_shift].store(P, std::memory_order_release);
+        }
+      P->m_pages[(character_code >> page_shift) & (pages_per_plane - 1u)].store(p, std::memory_order_release);
+    }
+
+    /* remove all pages; the caller must guarantee that
+     * no other thread is accessing the index.
+     */
+    void
+    clear(void)
+    {
+      for (auto &p : m_planes)
+        {
+          plane *P(p.load(std::memory_order_relaxed));
+          if (P)
+            {
+              FASTUIDRAWdelete(P);
+              p.store(nullptr, std::memory_order_relaxed);
+            }
+        }
+    }
+
+  private:
+    class plane:fastuidraw::noncopyable
+    {
+    public:
+      plane(void)
+      {
+        for (auto &p : m_pages)
+          {
+            p.store(nullptr, std::memory_order_relaxed);
+          }
+      }
+
+      ~plane()
+      {
+        for (auto &p : m_pages)
+          {
+            page *P(p.load(std::memory_order_relaxed));
+            if (P)
+              {
+                FASTUIDRAWdelete(P);
+              }
+          }
+      }
+
+      std::atomic<page*> m_pages[pages_per_plane];
+    };
+
+    std::atomic<plane*> m_planes[number_planes];
   };
 
-  class font_group:public fastuidraw::reference_counted<font_group>::non_concurrent
+  class font_group:public fastuidraw::reference_counted<font_group>::default_base
   {
   public:
     typedef fastuidraw::FontBase FontBase;
@@ -70,11 +208,13 @@ namespace
     explicit
     font_group(fastuidraw::reference_counted_ptr<font_group> p);
 
+    /* must be called with exclusive access to the group */
     void
     add_font(AbstractFont *h)
     {
       FASTUIDRAWassert(h);
       m_fonts.push_back(h);
+      m_index.clear();
     }
 
     fastuidraw::GlyphSource
@@ -99,8 +239,20 @@ namespace
     }
 
   private:
+    /* index into m_fonts of the first font that may
+     * have a glyph for the character code.
+     */
+    unsigned int
+    first_candidate(uint32_t character_code);
+
+    const first_font_index::page*
+    build_page(uint32_t character_code);
+
     std::vector<AbstractFont*> m_fonts;
     fastuidraw::reference_counted_ptr<font_group> m_parent;
+
+    std::mutex m_index_mutex;
+    first_font_index m_index;
   };
 
   class font_group_map_base
@@ -343,7 +495,11 @@ namespace
     enum fastuidraw::return_code
     add_font_no_lock(const fastuidraw::FontProperties &props, AbstractFont *h);
 
-    std::mutex m_mutex;
+    /* held exclusively to add fonts and shared to fetch
+     * fonts and glyphs; a font_group (and AbstractFont)
+     * has its own lock for what it builds on demand.
+     */
+    fastuidraw::detail::ReadWriteMutex m_mutex;
     std::map<std::string, AbstractFont*> m_fonts;
     fastuidraw::reference_counted_ptr<font_group> m_master_group;
     font_group_map<style_key> m_style_groups;
@@ -379,27 +535,117 @@ font_group(fastuidraw::reference_counted_ptr<font_group> parent):
 {
 }
 
+unsigned int
+font_group::
+first_candidate(uint32_t character_code)
+{
+  const first_font_index::page *p;
+  uint16_t v;
+
+  if (character_code >= (first_font_index::number_planes << first_font_index::plane_shift)
+      || m_fonts.size() >= first_font_index::no_font)
+    {
+      return 0;
+    }
+
+  p = m_index.fetch_page(character_code);
+  if (!p)
+    {
+      p = build_page(character_code);
+    }
+
+  v = (*p)[character_code & (first_font_index::page_size - 1u)];
+  return (v == first_font_index::no_font) ? m_fonts.size() : v;
+}
+
+const first_font_index::page*
+font_group::
+build_page(uint32_t character_code)
+{
+  std::lock_guard<std::mutex> m(m_index_mutex);
+  const first_font_index::page *p;
+
+  /* another thread may have built the page while we waited */
+  p = m_index.fetch_page(character_code);
+  if (p)
+    {
+      return p;
+    }
+
+  first_font_index::page *q;
+  uint32_t base(character_code & ~uint32_t(first_font_index::page_size - 1u));
+  unsigned int remaining(first_font_index::page_size);
+
+  q = FASTUIDRAWnew first_font_index::page(uint16_t(first_font_index::no_font));
+  for (unsigned int i = 0, endi = m_fonts.size(); i < endi && remaining > 0; ++i)
+    {
+      const fastuidraw::CharacterCoverage *coverage(m_fonts[i]->coverage());
+      for (unsigned int k = 0; k < first_font_index::page_size; ++k)
+        {
+          if ((*q)[k] == first_font_index::no_font
+              && (!coverage || coverage->contains(base + k)))
+            {
+              (*q)[k] = i;
+              --remaining;
+            }
+        }
+    }
+
+  m_index.store_page(character_code, q);
+  return q;
+}
+
 fastuidraw::GlyphSource
 font_group::
 fetch_glyph(uint32_t character_code, bool skip_parent)
 {
   uint32_t r;
+  unsigned int start;
 
-  for(const auto &abs : m_fonts)
+  /* no font before start has the character; if the font at
+   * start is generated and has the glyph, the loop over the
+   * generated fonts below ends at its first iteration.
+   */
+  start = first_candidate(character_code);
+  for (unsigned int i = start, endi = m_fonts.size(); i < endi; ++i)
     {
-      if (abs->font_ready())
+      AbstractFont *abs(m_fonts[i]);
+      const fastuidraw::CharacterCoverage *coverage;
+
+      if (!abs->font_ready())
         {
-          const auto &font(abs->font());
-          r = font->glyph_code(character_code);
-          if (r)
-            {
-              return fastuidraw::GlyphSource(font.get(), r);
-            }
+          continue;
+        }
+
+      coverage = abs->coverage();
+      if (coverage && !coverage->contains(character_code))
+        {
+          continue;
+        }
+
+      const auto &font(abs->font());
+      r = font->glyph_code(character_code);
+      if (r)
+        {
+          return fastuidraw::GlyphSource(font.get(), r);
         }
     }
 
-  for(const auto &abs : m_fonts)
+  for (unsigned int i = start, endi = m_fonts.size(); i < endi; ++i)
     {
+      AbstractFont *abs(m_fonts[i]);
+      const fastuidraw::CharacterCoverage *coverage;
+
+      /* fonts generated are tried again, as another
+       * thread may have generated a font after the
+       * first loop skipped it.
+       */
+      coverage = abs->coverage();
+      if (coverage && !coverage->contains(character_code))
+        {
+          continue;
+        }
+
       const auto &font(abs->font());
       r = font->glyph_code(character_code);
       if (r)
@@ -646,14 +892,42 @@ const fastuidraw::reference_counted_ptr<const fastuidraw::FontBase>&
 AbstractFont::
 font(void)
 {
-  if (!m_font)
+  if (!font_ready())
     {
-      m_font = m_generator->generate_font();
-      m_generator.clear();
+      std::lock_guard<std::mutex> m(m_mutex);
+      if (!m_font)
+        {
+          m_font = m_generator->generate_font();
+          m_generator.clear();
+          m_font_ready.store(true, std::memory_order_release);
+        }
     }
   return m_font;
 }
 
+const fastuidraw::CharacterCoverage*
+AbstractFont::
+coverage(void)
+{
+  if (m_coverage_known.load(std::memory_order_acquire))
+    {
+      return m_coverage.get();
+    }
+
+  if (!font_ready())
+    {
+      return nullptr;
+    }
+
+  std::lock_guard<std::mutex> m(m_mutex);
+  if (!m_coverage_known.load(std::memory_order_relaxed))
+    {
+      m_coverage = m_font->character_coverage();
+      m_coverage_known.store(true, std::memory_order_release);
+    }
+  return m_coverage.get();
+}
+
 ////////////////////////////////////////////////
 // fastuidraw::FontDatabase methods
 fastuidraw::FontDatabase::
@@ -684,7 +958,7 @@ add_font(const reference_counted_ptr<const FontBase> &h)
       FontDatabasePrivate *d;
 
       d = static_cast<FontDatabasePrivate*>(m_d);
-      std::lock_guard<std::mutex> m(d->m_mutex);
+      std::lock_guard<detail::ReadWriteMutex> m(d->m_mutex);
 
       return d->add_font_no_lock(h->properties(), FASTUIDRAWnew AbstractFont(h));
     }
@@ -703,7 +977,7 @@ add_font_generator(const reference_counted_ptr<const FontGeneratorBase> &h)
       FontDatabasePrivate *d;
 
       d = static_cast<FontDatabasePrivate*>(m_d);
-      std::lock_guard<std::mutex> m(d->m_mutex);
+      std::lock_guard<detail::ReadWriteMutex> m(d->m_mutex);
 
       return d->add_font_no_lock(h->font_properties(), FASTUIDRAWnew AbstractFont(h));
     }
@@ -724,7 +998,7 @@ fetch_or_generate_font(const reference_counted_ptr<const FontGeneratorBase> &h)
 
   a = FASTUIDRAWnew AbstractFont(h);
   d = static_cast<FontDatabasePrivate*>(m_d);
-  std::lock_guard<std::mutex> m(d->m_mutex);
+  std::lock_guard<detail::ReadWriteMutex> m(d->m_mutex);
 
   a = d->add_or_fetch_font_no_lock(h->font_properties(), a);
   return a->font();
@@ -737,7 +1011,7 @@ fetch_font(c_string source_label)
   FontDatabasePrivate *d;
   d = static_cast<FontDatabasePrivate*>(m_d);
 
-  std::lock_guard<std::mutex> m(d->m_mutex);
+  detail::SharedLockGuard m(d->m_mutex);
   reference_counted_ptr<const FontBase> return_value;
   std::map<std::string, AbstractFont*>::const_iterator iter;
 
@@ -788,7 +1062,7 @@ number_fonts(FontGroup G)
   g = static_cast<font_group*>(G.m_d);
   if (g)
     {
-      std::lock_guard<std::mutex> m(d->m_mutex);
+      detail::SharedLockGuard m(d->m_mutex);
       return_value = g->fonts().size();
     }
   return return_value;
@@ -805,10 +1079,13 @@ fetch_font(FontGroup G, unsigned int N)
   d = static_cast<FontDatabasePrivate*>(m_d);
   g = static_cast<font_group*>(G.m_d);
 
-  if (g && g->fonts().size() < N)
+  if (g)
     {
-      std::lock_guard<std::mutex> m(d->m_mutex);
-      return_value = g->fonts()[N]->font();
+      detail::SharedLockGuard m(d->m_mutex);
+      if (N < g->fonts().size())
+        {
+          return_value = g->fonts()[N]->font();
+        }
     }
 
   return return_value;
@@ -821,7 +1098,7 @@ fetch_font(const FontProperties &prop, uint32_t selection_strategy)
   FontDatabasePrivate *d;
   d = static_cast<FontDatabasePrivate*>(m_d);
 
-  std::lock_guard<std::mutex> m(d->m_mutex);
+  detail::SharedLockGuard m(d->m_mutex);
   return d->fetch_font_group_no_lock(prop, selection_strategy)->first_font()->font();
 }
 
@@ -851,7 +1128,7 @@ lock_mutex(void)
 {
   FontDatabasePrivate *d;
   d = static_cast<FontDatabasePrivate*>(m_d);
-  d->m_mutex.lock();
+  d->m_mutex.lock_shared();
 }
 
 void
@@ -860,7 +1137,7 @@ unlock_mutex(void)
 {
   FontDatabasePrivate *d;
   d = static_cast<FontDatabasePrivate*>(m_d);
-  d->m_mutex.unlock();
+  d->m_mutex.unlock_shared();
 }
 
 fastuidraw::GlyphSource
@@ -890,7 +1167,7 @@ fetch_group(const FontProperties &props, uint32_t selection_strategy)
   FontDatabasePrivate *d;
   d = static_cast<FontDatabasePrivate*>(m_d);
 
-  std::lock_guard<std::mutex> m(d->m_mutex);
+  detail::SharedLockGuard m(d->m_mutex);
   h = d->fetch_font_group_no_lock(props, selection_strategy);
   return_value.m_d = h.get();
 
@@ -918,7 +1195,7 @@ fetch_glyph(const FontProperties &props, uint32_t character_code, uint32_t selec
 
   d = static_cast<FontDatabasePrivate*>(m_d);
 
-  std::lock_guard<std::mutex> m(d->m_mutex);
+  detail::SharedLockGuard m(d->m_mutex);
   g = d->fetch_font_group_no_lock(props, selection_strategy);
   return d->fetch_glyph(g, character_code, (selection_strategy & exact_match) != 0u);
 }
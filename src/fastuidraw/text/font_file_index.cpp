@@ -0,0 +1,652 @@
+/*!
+ * \file font_file_index.cpp
+ * \brief file font_file_index.cpp
+ *
+ * Copyright 2019 by Intel.
+ *
+ * Contact: kevin.rogovin@intel.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@intel.com>
+ *
+ */
+
+
+#include <map>
+#include <vector>
+#include <string>
+#include <cstring>
+#include <cstdio>
+#include <cerrno>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <fastuidraw/util/data_buffer.hpp>
+#include <fastuidraw/text/font_file_index.hpp>
+#include <fastuidraw/text/font_freetype.hpp>
+#include <fastuidraw/text/freetype_face.hpp>
+#include "../private/util_private.hpp"
+#include "../private/byte_stream.hpp"
+
+namespace
+{
+  enum
+    {
+      /* "FUIFONTI" */
+      file_magic_lo = 0x46495546u,
+      file_magic_hi = 0x49544e4fu,
+
+      /* increment whenever the file format changes */
+      file_version = 1u,
+
+      /* value to detect files written on a machine
+       * with a different byte order.
+       */
+      byte_order_mark = 0x01020304u,
+    };
+
+  class FileHeader
+  {
+  public:
+    FileHeader(void):
+      m_magic_lo(file_magic_lo),
+      m_magic_hi(file_magic_hi),
+      m_version(file_version),
+      m_byte_order_mark(byte_order_mark),
+      m_number_files(0)
+    {}
+
+    bool
+    valid(void) const
+    {
+      return m_magic_lo == file_magic_lo
+        && m_magic_hi == file_magic_hi
+        && m_version == file_version
+        && m_byte_order_mark == byte_order_mark;
+    }
+
+    uint32_t m_magic_lo, m_magic_hi;
+    uint32_t m_version;
+    uint32_t m_byte_order_mark;
+    uint32_t m_number_files;
+  };
+
+  /* The values of stat() used to decide if the entry
+   * of a font file is still valid.
+   */
+  class FileStamp
+  {
+  public:
+    FileStamp(void):
+      m_size(0),
+      m_mtime_sec(0),
+      m_mtime_nsec(0)
+    {}
+
+    bool
+    operator==(const FileStamp &rhs) const
+    {
+      return m_size == rhs.m_size
+        && m_mtime_sec == rhs.m_mtime_sec
+        && m_mtime_nsec == rhs.m_mtime_nsec;
+    }
+
+    int64_t m_size;
+    int64_t m_mtime_sec;
+    int64_t m_mtime_nsec;
+  };
+
+  class FaceEntry
+  {
+  public:
+    int m_face_index;
+    fastuidraw::FontProperties m_properties;
+    fastuidraw::reference_counted_ptr<const fastuidraw::CharacterCoverage> m_coverage;
+  };
+
+  class FileEntry
+  {
+  public:
+    std::string m_filename;
+    FileStamp m_stamp;
+    std::vector<FaceEntry> m_faces;
+  };
+
+  class FontEntry
+  {
+  public:
+    fastuidraw::FontProperties m_properties;
+    fastuidraw::reference_counted_ptr<const fastuidraw::CharacterCoverage> m_coverage;
+    fastuidraw::reference_counted_ptr<const fastuidraw::FontDatabase::FontGeneratorBase> m_generator;
+  };
+
+  /* FontGeneratorBase that opens the font file
+   * only when the font is generated.
+   */
+  class IndexedFontGenerator:public fastuidraw::FontDatabase::FontGeneratorBase
+  {
+  public:
+    IndexedFontGenerator(const std::string &filename, const FaceEntry &face,
+                         const fastuidraw::reference_counted_ptr<fastuidraw::FreeTypeLib> &lib):
+      m_filename(filename),
+      m_face_index(face.m_face_index),
+      m_props(face.m_properties),
+      m_coverage(face.m_coverage),
+      m_lib(lib)
+    {}
+
+    virtual
+    fastuidraw::reference_counted_ptr<const fastuidraw::FontBase>
+    generate_font(void) const
+    {
+      fastuidraw::reference_counted_ptr<fastuidraw::FreeTypeFace::GeneratorBase> h;
+
+      h = FASTUIDRAWnew fastuidraw::FreeTypeFace::GeneratorMemory(m_filename.c_str(), m_face_index);
+      return FASTUIDRAWnew fastuidraw::FontFreeType(h, m_props, m_lib);
+    }
+
+    virtual
+    const fastuidraw::FontProperties&
+    font_properties(void) const
+    {
+      return m_props;
+    }
+
+    virtual
+    fastuidraw::reference_counted_ptr<const fastuidraw::CharacterCoverage>
+    character_coverage(void) const
+    {
+      return m_coverage;
+    }
+
+  private:
+    std::string m_filename;
+    int m_face_index;
+    fastuidraw::FontProperties m_props;
+    fastuidraw::reference_counted_ptr<const fastuidraw::CharacterCoverage> m_coverage;
+    fastuidraw::reference_counted_ptr<fastuidraw::FreeTypeLib> m_lib;
+  };
+
+  /* Appends plain-old-data values, in host byte order,
+   * to a std::vector<uint8_t>; unlike ByteWriter, the
+   * size need not be known in advance.
+   */
+  class ByteAppender
+  {
+  public:
+    explicit
+    ByteAppender(std::vector<uint8_t> &dst):
+      m_dst(dst)
+    {}
+
+    template<typename T>
+    ByteAppender&
+    write(const T &v)
+    {
+      static_assert(std::is_standard_layout<T>::value, "Only POD can be written");
+      write_bytes(&v, sizeof(T));
+      return *this;
+    }
+
+    ByteAppender&
+    write_string(fastuidraw::c_string s)
+    {
+      uint32_t sz(s ? std::strlen(s) : 0u);
+      write(sz);
+      write_bytes(s, sz);
+      return *this;
+    }
+
+    fastuidraw::c_array<uint8_t>
+    reserve(unsigned int sz)
+    {
+      unsigned int start(m_dst.size());
+
+      m_dst.resize(start + sz);
+      return fastuidraw::make_c_array(m_dst).sub_array(start, sz);
+    }
+
+  private:
+    void
+    write_bytes(const void *src, unsigned int sz)
+    {
+      const uint8_t *bytes(static_cast<const uint8_t*>(src));
+      m_dst.insert(m_dst.end(), bytes, bytes + sz);
+    }
+
+    std::vector<uint8_t> &m_dst;
+  };
+
+  bool
+  read_string(fastuidraw::detail::ByteReader &R, std::string *out_value)
+  {
+    fastuidraw::c_array<const uint8_t> bytes;
+    uint32_t sz(0);
+
+    R.read(&sz);
+    bytes = R.take(sz);
+    if (R.failed())
+      {
+        return false;
+      }
+    out_value->assign(reinterpret_cast<const char*>(bytes.c_ptr()), sz);
+    return true;
+  }
+
+  bool
+  read_file_entry(fastuidraw::detail::ByteReader &R, FileEntry *out_value)
+  {
+    using namespace fastuidraw;
+
+    uint32_t number_faces(0);
+
+    if (!read_string(R, &out_value->m_filename))
+      {
+        return false;
+      }
+
+    R.read(&out_value->m_stamp)
+      .read(&number_faces);
+    if (R.failed())
+      {
+        return false;
+      }
+
+    for (uint32_t f = 0; f < number_faces; ++f)
+      {
+        FaceEntry face;
+        std::string family, style, foundry;
+        reference_counted_ptr<CharacterCoverage> coverage;
+        int32_t face_index(0);
+        uint32_t bold(0), italic(0), coverage_size(0);
+        c_array<const uint8_t> coverage_bytes;
+
+        R.read(&face_index)
+          .read(&bold)
+          .read(&italic);
+        if (!read_string(R, &family)
+            || !read_string(R, &style)
+            || !read_string(R, &foundry))
+          {
+            return false;
+          }
+
+        R.read(&coverage_size);
+        coverage_bytes = R.take(coverage_size);
+        coverage = FASTUIDRAWnew CharacterCoverage();
+        if (R.failed() || coverage->deserialize(coverage_bytes) == routine_fail)
+          {
+            return false;
+          }
+
+        face.m_face_index = face_index;
+        face.m_coverage = coverage;
+        face.m_properties
+          .bold(bold != 0u)
+          .italic(italic != 0u)
+          .family(family.c_str())
+          .style(style.c_str())
+          .foundry(foundry.c_str())
+          .source_label(out_value->m_filename.c_str(), face_index);
+        out_value->m_faces.push_back(face);
+      }
+    return true;
+  }
+
+  void
+  write_file_entry(ByteAppender &W, const FileEntry &entry)
+  {
+    using namespace fastuidraw;
+
+    W.write_string(entry.m_filename.c_str())
+      .write(entry.m_stamp)
+      .write(uint32_t(entry.m_faces.size()));
+
+    for (const FaceEntry &face : entry.m_faces)
+      {
+        uint32_t coverage_size(face.m_coverage->serialized_size());
+        enum return_code R;
+
+        W.write(int32_t(face.m_face_index))
+          .write(uint32_t(face.m_properties.bold()))
+          .write(uint32_t(face.m_properties.italic()))
+          .write_string(face.m_properties.family())
+          .write_string(face.m_properties.style())
+          .write_string(face.m_properties.foundry())
+          .write(coverage_size);
+
+        R = face.m_coverage->serialize(W.reserve(coverage_size));
+        FASTUIDRAWassert(R == routine_success);
+        FASTUIDRAWunused(R);
+      }
+  }
+
+  bool
+  write_file(const std::string &filename,
+             fastuidraw::c_array<const uint8_t> bytes)
+  {
+    int fd;
+    bool success(true);
+
+    fd = ::open(filename.c_str(), O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (fd < 0)
+      {
+        return false;
+      }
+
+    while (!bytes.empty() && success)
+      {
+        ssize_t num_written;
+
+        num_written = ::write(fd, bytes.c_ptr(), bytes.size());
+        if (num_written > 0)
+          {
+            bytes = bytes.sub_array(num_written);
+          }
+        else
+          {
+            success = (num_written < 0 && errno == EINTR);
+          }
+      }
+
+    success = (::close(fd) == 0) && success;
+    return success;
+  }
+
+  bool
+  stamp_file(const std::string &filename, FileStamp *out_value)
+  {
+    struct stat st;
+
+    if (::stat(filename.c_str(), &st) != 0 || !S_ISREG(st.st_mode))
+      {
+        return false;
+      }
+
+    out_value->m_size = st.st_size;
+    out_value->m_mtime_sec = st.st_mtim.tv_sec;
+    out_value->m_mtime_nsec = st.st_mtim.tv_nsec;
+    return true;
+  }
+
+  class FontFileIndexPrivate
+  {
+  public:
+    explicit
+    FontFileIndexPrivate(const fastuidraw::reference_counted_ptr<fastuidraw::FreeTypeLib> &lib);
+
+    void
+    read_font_file(FileEntry *entry);
+
+    fastuidraw::reference_counted_ptr<fastuidraw::FreeTypeLib> m_lib;
+
+    /* entries read by load(), keyed by file name */
+    std::map<std::string, FileEntry> m_loaded;
+
+    /* entries of the files added by add_file(), keyed by file name */
+    std::map<std::string, FileEntry> m_files;
+
+    std::vector<FontEntry> m_fonts;
+    bool m_modified;
+  };
+}
+
+///////////////////////////////////////
+// FontFileIndexPrivate methods
+FontFileIndexPrivate::
+FontFileIndexPrivate(const fastuidraw::reference_counted_ptr<fastuidraw::FreeTypeLib> &lib):
+  m_lib(lib),
+  m_modified(false)
+{
+  if (!m_lib)
+    {
+      m_lib = FASTUIDRAWnew fastuidraw::FreeTypeLib();
+    }
+}
+
+void
+FontFileIndexPrivate::
+read_font_file(FileEntry *entry)
+{
+  using namespace fastuidraw;
+
+  int number_faces(1);
+
+  for (int i = 0; i < number_faces; ++i)
+    {
+      reference_counted_ptr<FreeTypeFace::GeneratorBase> generator;
+      reference_counted_ptr<FreeTypeFace> face;
+
+      generator = FASTUIDRAWnew FreeTypeFace::GeneratorFile(entry->m_filename.c_str(), i);
+      face = generator->create_face(m_lib);
+      if (!face || !face->face())
+        {
+          continue;
+        }
+
+      if (i == 0)
+        {
+          number_faces = face->face()->num_faces;
+        }
+
+      if ((face->face()->face_flags & FT_FACE_FLAG_SCALABLE) != 0)
+        {
+          FaceEntry F;
+
+          F.m_face_index = i;
+          FontFreeType::compute_font_properties_from_face(face->face(), F.m_properties);
+          F.m_properties.source_label(entry->m_filename.c_str(), i);
+          F.m_coverage = FontFreeType::compute_character_coverage_from_face(face->face());
+          entry->m_faces.push_back(F);
+        }
+    }
+}
+
+///////////////////////////////////////////
+// fastuidraw::FontFileIndex methods
+fastuidraw::FontFileIndex::
+FontFileIndex(const reference_counted_ptr<FreeTypeLib> &lib)
+{
+  m_d = FASTUIDRAWnew FontFileIndexPrivate(lib);
+}
+
+fastuidraw::FontFileIndex::
+~FontFileIndex()
+{
+  FontFileIndexPrivate *d;
+  d = static_cast<FontFileIndexPrivate*>(m_d);
+  FASTUIDRAWdelete(d);
+  m_d = nullptr;
+}
+
+enum fastuidraw::return_code
+fastuidraw::FontFileIndex::
+load(c_string filename)
+{
+  FontFileIndexPrivate *d;
+  d = static_cast<FontFileIndexPrivate*>(m_d);
+
+  MappedFileBackingStore file(filename);
+  detail::ByteReader R(file.data());
+  std::map<std::string, FileEntry> loaded;
+  FileHeader header;
+
+  R.read(&header);
+  if (R.failed() || !header.valid())
+    {
+      return routine_fail;
+    }
+
+  for (uint32_t i = 0; i < header.m_number_files; ++i)
+    {
+      FileEntry entry;
+
+      if (!read_file_entry(R, &entry))
+        {
+          return routine_fail;
+        }
+      loaded[entry.m_filename] = entry;
+    }
+
+  if (!R.at_end())
+    {
+      return routine_fail;
+    }
+
+  d->m_loaded.swap(loaded);
+  return routine_success;
+}
+
+enum fastuidraw::return_code
+fastuidraw::FontFileIndex::
+save(c_string filename) const
+{
+  FontFileIndexPrivate *d;
+  d = static_cast<FontFileIndexPrivate*>(m_d);
+
+  std::vector<uint8_t> bytes;
+  ByteAppender W(bytes);
+  FileHeader header;
+
+  header.m_number_files = d->m_files.size();
+  W.write(header);
+  for (const auto &e : d->m_files)
+    {
+      write_file_entry(W, e.second);
+    }
+
+  /* write to a temporary file that is then renamed so that
+   * a reader never sees a partially written file.
+   */
+  std::string temp_filename;
+
+  temp_filename = std::string(filename) + "." + std::to_string(::getpid()) + ".tmp";
+  if (!write_file(temp_filename, make_c_array(bytes))
+      || std::rename(temp_filename.c_str(), filename) != 0)
+    {
+      std::remove(temp_filename.c_str());
+      return routine_fail;
+    }
+
+  return routine_success;
+}
+
+bool
+fastuidraw::FontFileIndex::
+modified(void) const
+{
+  FontFileIndexPrivate *d;
+  d = static_cast<FontFileIndexPrivate*>(m_d);
+  return d->m_modified;
+}
+
+unsigned int
+fastuidraw::FontFileIndex::
+add_file(c_string pfilename)
+{
+  FontFileIndexPrivate *d;
+  d = static_cast<FontFileIndexPrivate*>(m_d);
+
+  std::string filename(pfilename);
+  std::map<std::string, FileEntry>::iterator iter;
+  FileStamp stamp;
+  FileEntry *entry;
+
+  if (d->m_files.find(filename) != d->m_files.end()
+      || !stamp_file(filename, &stamp))
+    {
+      return 0;
+    }
+
+  entry = &d->m_files[filename];
+  entry->m_filename = filename;
+  entry->m_stamp = stamp;
+
+  iter = d->m_loaded.find(filename);
+  if (iter != d->m_loaded.end() && iter->second.m_stamp == stamp)
+    {
+      entry->m_faces.swap(iter->second.m_faces);
+      d->m_loaded.erase(iter);
+    }
+  else
+    {
+      d->read_font_file(entry);
+      d->m_modified = true;
+    }
+
+  for (const FaceEntry &face : entry->m_faces)
+    {
+      FontEntry F;
+
+      F.m_properties = face.m_properties;
+      F.m_coverage = face.m_coverage;
+      F.m_generator = FASTUIDRAWnew IndexedFontGenerator(filename, face, d->m_lib);
+      d->m_fonts.push_back(F);
+    }
+
+  return entry->m_faces.size();
+}
+
+unsigned int
+fastuidraw::FontFileIndex::
+number_fonts(void) const
+{
+  FontFileIndexPrivate *d;
+  d = static_cast<FontFileIndexPrivate*>(m_d);
+  return d->m_fonts.size();
+}
+
+const fastuidraw::FontProperties&
+fastuidraw::FontFileIndex::
+font_properties(unsigned int I) const
+{
+  FontFileIndexPrivate *d;
+  d = static_cast<FontFileIndexPrivate*>(m_d);
+  FASTUIDRAWassert(I < d->m_fonts.size());
+  return d->m_fonts[I].m_properties;
+}
+
+const fastuidraw::reference_counted_ptr<const fastuidraw::CharacterCoverage>&
+fastuidraw::FontFileIndex::
+character_coverage(unsigned int I) const
+{
+  FontFileIndexPrivate *d;
+  d = static_cast<FontFileIndexPrivate*>(m_d);
+  FASTUIDRAWassert(I < d->m_fonts.size());
+  return d->m_fonts[I].m_coverage;
+}
+
+const fastuidraw::reference_counted_ptr<const fastuidraw::FontDatabase::FontGeneratorBase>&
+fastuidraw::FontFileIndex::
+font_generator(unsigned int I) const
+{
+  FontFileIndexPrivate *d;
+  d = static_cast<FontFileIndexPrivate*>(m_d);
+  FASTUIDRAWassert(I < d->m_fonts.size());
+  return d->m_fonts[I].m_generator;
+}
+
+unsigned int
+fastuidraw::FontFileIndex::
+add_to_database(FontDatabase &database) const
+{
+  FontFileIndexPrivate *d;
+  d = static_cast<FontFileIndexPrivate*>(m_d);
+
+  unsigned int return_value(0);
+  for (const FontEntry &F : d->m_fonts)
+    {
+      if (database.add_font_generator(F.m_generator) == routine_success)
+        {
+          ++return_value;
+        }
+    }
+  return return_value;
+}
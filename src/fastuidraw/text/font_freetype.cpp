@@ -20,6 +20,7 @@
 #include <fastuidraw/text/glyph_generate_params.hpp>
 #include <fastuidraw/text/glyph_render_data.hpp>
 #include <fastuidraw/text/glyph_render_data_texels.hpp>
+#include <fastuidraw/text/glyph_render_data_msdf.hpp>
 #include <fastuidraw/text/glyph_render_data_restricted_rays.hpp>
 #include <fastuidraw/text/glyph_render_data_banded_rays.hpp>
 
@@ -27,7 +28,12 @@
 #include "../private/util_private.hpp"
 #include "../private/int_path.hpp"
 #include "../private/bezier_util.hpp"
+#include "../private/hash_util.hpp"
+#include "../private/worker_pool.hpp"
 
+#include <mutex>
+#include <thread>
+#include <condition_variable>
 #include <ft2build.h>
 #include FT_OUTLINE_H
 
@@ -70,11 +76,17 @@ namespace
   public:
     GenerateParams(void):
       m_distance_field_pixel_size(fastuidraw::GlyphGenerateParams::distance_field_pixel_size()),
-      m_distance_field_max_distance(fastuidraw::GlyphGenerateParams::distance_field_max_distance())
+      m_distance_field_max_distance(fastuidraw::GlyphGenerateParams::distance_field_max_distance()),
+      m_distance_field_pool(fastuidraw::detail::WorkerPool::shared(fastuidraw::GlyphGenerateParams::distance_field_number_threads())),
+      m_msdf_pixel_size(fastuidraw::GlyphGenerateParams::msdf_pixel_size()),
+      m_msdf_max_distance(fastuidraw::GlyphGenerateParams::msdf_max_distance())
     {}
 
     unsigned int m_distance_field_pixel_size;
     float m_distance_field_max_distance;
+    std::shared_ptr<fastuidraw::detail::WorkerPool> m_distance_field_pool;
+    unsigned int m_msdf_pixel_size;
+    float m_msdf_max_distance;
   };
 
   class ComputeOutlineDegree
@@ -250,6 +262,10 @@ namespace
 
       fastuidraw::FreeTypeFace *m_p;
       enum fastuidraw::CharacterEncoding::encoding_value_t *m_current_encoding;
+
+    private:
+      FontFreeTypePrivate *m_q;
+      FaceAndEncoding *m_face;
     };
 
     FontFreeTypePrivate(fastuidraw::FontFreeType *p,
@@ -270,12 +286,27 @@ namespace
                                     fastuidraw::Path &path,
                                     fastuidraw::vec2 &render_size);
 
+    /* T is GlyphRenderDataTexels for distance field glyphs
+     * and GlyphRenderDataMSDF for MSDF glyphs.
+     */
+    template<typename T>
     void
-    compute_rendering_data_distance_field(fastuidraw::GlyphMetrics glyph_metrics,
-                                          fastuidraw::GlyphRenderDataTexels &output,
+    compute_rendering_data_distance_field(int pixel_size, float max_distance_pixels,
+                                          fastuidraw::GlyphMetrics glyph_metrics,
+                                          T &output,
                                           fastuidraw::Path &path,
                                           fastuidraw::vec2 &render_size);
 
+    /* computes the same Path as the compute_rendering_data_ methods
+     * without generating the rendering data; the path of coverage
+     * glyphs is in the coordinates of pixel_size, the path of the
+     * other glyphs is in font units.
+     */
+    void
+    compute_path(enum fastuidraw::glyph_type tp, int pixel_size,
+                 fastuidraw::GlyphMetrics glyph_metrics,
+                 fastuidraw::Path &path);
+
     template<typename T>
     void
     compute_rendering_data_rays(fastuidraw::GlyphMetrics glyph_metrics,
@@ -308,12 +339,61 @@ namespace
     fastuidraw::reference_counted_ptr<fastuidraw::FreeTypeLib> m_lib;
     fastuidraw::FontFreeType *m_p;
 
-    /* for now we have a static number of m_faces we use for parallel
-     * glyph generation
+    /* Pool of faces for parallel glyph generation. Faces are
+     * created on demand from m_generator, i.e. only when all
+     * created faces are borrowed, up to m_max_number_faces;
+     * this way the memory cost of the faces is bounded by the
+     * number of threads actually using the font concurrently.
+     */
+    FaceAndEncoding*
+    borrow_face(void);
+
+    void
+    return_face(FaceAndEncoding *face);
+
+    FaceAndEncoding*
+    create_face(void);
+
+    /* there is no point in having more faces than
+     * threads that can run concurrently.
      */
-    std::vector<FaceAndEncoding> m_faces;
+    static
+    unsigned int
+    compute_max_number_faces(unsigned int num_faces)
+    {
+      unsigned int hw(std::thread::hardware_concurrency());
+      if (hw > 0)
+        {
+          num_faces = fastuidraw::t_min(hw, num_faces);
+        }
+      return fastuidraw::t_max(1u, num_faces);
+    }
+
+    std::mutex m_faces_mutex;
+    std::condition_variable m_faces_cv;
+    std::vector<FaceAndEncoding*> m_faces, m_free_faces;
+    unsigned int m_max_number_faces, m_number_faces_creating;
     bool m_all_faces_null;
     unsigned int m_number_glyphs;
+
+    /* hash of the data of the font, computed
+     * lazily by compute_content_hash()
+     */
+    void
+    compute_content_hash(void);
+
+    std::once_flag m_content_hash_once;
+    bool m_content_hash_valid;
+    uint64_t m_content_hash;
+
+    /* Unicode coverage of the font, computed lazily
+     * by compute_character_coverage()
+     */
+    void
+    compute_character_coverage(void);
+
+    std::once_flag m_character_coverage_once;
+    fastuidraw::reference_counted_ptr<const fastuidraw::CharacterCoverage> m_character_coverage;
   };
 }
 
@@ -321,28 +401,26 @@ namespace
 // FontFreeTypePrivate::FaceGrabber methods
 FontFreeTypePrivate::FaceGrabber::
 FaceGrabber(FontFreeTypePrivate *q):
-  m_p(nullptr)
+  m_p(nullptr),
+  m_current_encoding(nullptr),
+  m_q(q),
+  m_face(q->borrow_face())
 {
-  while(!m_p && !q->m_all_faces_null)
+  if (m_face)
     {
-      for(unsigned int i = 0, endi = q->m_faces.size(); i < endi && !m_p; ++i)
-        {
-          const fastuidraw::reference_counted_ptr<fastuidraw::FreeTypeFace> &face(q->m_faces[i].m_face);
-          if (face && face->try_lock())
-            {
-              m_p = face.get();
-              m_current_encoding = &q->m_faces[i].m_current_encoding;
-            }
-        }
+      m_p = m_face->m_face.get();
+      m_current_encoding = &m_face->m_current_encoding;
+      m_p->lock();
     }
 }
 
 FontFreeTypePrivate::FaceGrabber::
 ~FaceGrabber()
 {
-  if (m_p)
+  if (m_face)
     {
-      m_p->unlock();
+      m_face->m_face->unlock();
+      m_q->return_face(m_face);
     }
 }
 
@@ -356,31 +434,197 @@ FontFreeTypePrivate(fastuidraw::FontFreeType *p,
   m_generator(generator),
   m_lib(lib),
   m_p(p),
-  m_faces(num_faces),
+  m_max_number_faces(compute_max_number_faces(num_faces)),
+  m_number_faces_creating(0),
   m_all_faces_null(true),
-  m_number_glyphs(0)
+  m_number_glyphs(0),
+  m_content_hash_valid(false),
+  m_content_hash(0)
 {
+  FaceAndEncoding *face;
+
   if (!m_lib)
     {
       m_lib = FASTUIDRAWnew fastuidraw::FreeTypeLib();
     }
 
-  for(unsigned int i = 0; i < m_faces.size(); ++i)
+  /* create the first face to get the number of glyphs
+   * and to know if the generator is able to create faces.
+   */
+  face = create_face();
+  if (face)
+    {
+      m_all_faces_null = false;
+      m_number_glyphs = face->m_face->face()->num_glyphs;
+      m_faces.push_back(face);
+      m_free_faces.push_back(face);
+    }
+}
+
+FontFreeTypePrivate::
+~FontFreeTypePrivate()
+{
+  FASTUIDRAWassert(m_free_faces.size() == m_faces.size());
+  for (FaceAndEncoding *f : m_faces)
+    {
+      FASTUIDRAWdelete(f);
+    }
+}
+
+FaceAndEncoding*
+FontFreeTypePrivate::
+create_face(void)
+{
+  fastuidraw::reference_counted_ptr<fastuidraw::FreeTypeFace> face;
+  FaceAndEncoding *return_value(nullptr);
+
+  face = m_generator->create_face(m_lib);
+  if (face && face->face())
+    {
+      FT_Set_Transform(face->face(), nullptr, nullptr);
+      FASTUIDRAWwarn_assert(face->face()->face_flags & FT_FACE_FLAG_SCALABLE);
+
+      return_value = FASTUIDRAWnew FaceAndEncoding();
+      return_value->m_face = face;
+    }
+  return return_value;
+}
+
+FaceAndEncoding*
+FontFreeTypePrivate::
+borrow_face(void)
+{
+  if (m_all_faces_null)
+    {
+      return nullptr;
+    }
+
+  std::unique_lock<std::mutex> lock(m_faces_mutex);
+  for (;;)
     {
-      m_faces[i].m_face = m_generator->create_face(m_lib);
-      if (m_faces[i].m_face && m_faces[i].m_face->face())
+      if (!m_free_faces.empty())
         {
-          m_all_faces_null = false;
-          m_number_glyphs = m_faces[i].m_face->face()->num_glyphs;
-          FT_Set_Transform(m_faces[i].m_face->face(), nullptr, nullptr);
-          FASTUIDRAWwarn_assert(m_faces[i].m_face->face()->face_flags & FT_FACE_FLAG_SCALABLE);
+          FaceAndEncoding *return_value(m_free_faces.back());
+          m_free_faces.pop_back();
+          return return_value;
         }
+
+      if (m_faces.size() + m_number_faces_creating < m_max_number_faces)
+        {
+          FaceAndEncoding *return_value;
+
+          /* create the face without holding the lock; the
+           * FreeTypeLib has its own lock for face creation.
+           */
+          ++m_number_faces_creating;
+          lock.unlock();
+          return_value = create_face();
+          lock.lock();
+          --m_number_faces_creating;
+
+          if (return_value)
+            {
+              m_faces.push_back(return_value);
+              return return_value;
+            }
+
+          /* the generator failed to make another face, then
+           * do not attempt to create more faces.
+           */
+          m_max_number_faces = m_faces.size();
+        }
+
+      m_faces_cv.wait(lock, [this] { return !m_free_faces.empty(); });
     }
 }
 
+void
 FontFreeTypePrivate::
-~FontFreeTypePrivate()
+return_face(FaceAndEncoding *face)
 {
+  {
+    std::lock_guard<std::mutex> m(m_faces_mutex);
+    m_free_faces.push_back(face);
+  }
+  m_faces_cv.notify_one();
+}
+
+void
+FontFreeTypePrivate::
+compute_character_coverage(void)
+{
+  FaceGrabber p(this);
+
+  if (!p.m_p || !p.m_p->face())
+    {
+      return;
+    }
+
+  m_character_coverage = fastuidraw::FontFreeType::compute_character_coverage_from_face(p.m_p->face());
+
+  /* computing the coverage changes the selected character
+   * map, force glyph_codes() to select it again.
+   */
+  *p.m_current_encoding = static_cast<enum fastuidraw::CharacterEncoding::encoding_value_t>(0);
+}
+
+void
+FontFreeTypePrivate::
+compute_content_hash(void)
+{
+  FaceGrabber p(this);
+
+  if (!p.m_p || !p.m_p->face() || !p.m_p->face()->stream)
+    {
+      return;
+    }
+
+  FT_Face face(p.m_p->face());
+  FT_Stream stream(face->stream);
+  fastuidraw::detail::FNV1aHash hash;
+
+  hash
+    .add(int(FREETYPE_MAJOR))
+    .add(int(FREETYPE_MINOR))
+    .add(int(FREETYPE_PATCH))
+    .add(static_cast<int64_t>(face->face_index))
+    .add(static_cast<uint64_t>(stream->size));
+
+  if (stream->read)
+    {
+      /* the stream is not memory backed, read it in chunks;
+       * for FT_Stream, a zero count read means seek, so the
+       * read callback is always given a non-zero count.
+       */
+      std::vector<unsigned char> buffer(64 * 1024);
+      unsigned long offset(0);
+
+      while (offset < stream->size)
+        {
+          unsigned long count, num_read;
+
+          count = fastuidraw::t_min(stream->size - offset,
+                                    static_cast<unsigned long>(buffer.size()));
+          num_read = stream->read(stream, offset, &buffer[0], count);
+          if (num_read != count)
+            {
+              return;
+            }
+          hash.add_bytes(&buffer[0], count);
+          offset += count;
+        }
+    }
+  else if (stream->base)
+    {
+      hash.add_bytes(stream->base, stream->size);
+    }
+  else
+    {
+      return;
+    }
+
+  m_content_hash = hash.value();
+  m_content_hash_valid = true;
 }
 
 void
@@ -454,10 +698,12 @@ compute_rendering_data_coverage(int pixel_size,
     }
 }
 
+template<typename T>
 void
 FontFreeTypePrivate::
-compute_rendering_data_distance_field(fastuidraw::GlyphMetrics glyph_metrics,
-                                      fastuidraw::GlyphRenderDataTexels &output,
+compute_rendering_data_distance_field(int pixel_size, float max_distance_pixels,
+                                      fastuidraw::GlyphMetrics glyph_metrics,
+                                      T &output,
                                       fastuidraw::Path &path,
                                       fastuidraw::vec2 &render_size)
 {
@@ -508,7 +754,6 @@ compute_rendering_data_distance_field(fastuidraw::GlyphMetrics glyph_metrics,
     fastuidraw::PainterEnums::nonzero_fill_rule;
 
   /* compute the step value needed to create the distance field value*/
-  int pixel_size(m_generate_params.m_distance_field_pixel_size);
   float scale_factor(static_cast<float>(pixel_size) / static_cast<float>(units_per_EM));
 
   /* compute how many pixels we need to store the glyph. */
@@ -532,14 +777,49 @@ compute_rendering_data_distance_field(fastuidraw::GlyphMetrics glyph_metrics,
   fastuidraw::ivec2 tr_translate(-2 * pixel_size * layout_offset);
   fastuidraw::detail::IntBezierCurve::transformation<int> tr(tr_scale, tr_translate);
   fastuidraw::ivec2 texel_distance(2 * units_per_EM);
-  float max_distance = (m_generate_params.m_distance_field_max_distance)
-    * static_cast<float>(2 * units_per_EM);
+  float max_distance = max_distance_pixels * static_cast<float>(2 * units_per_EM);
 
   int_path_ecm.extract_render_data(texel_distance, image_sz, max_distance, tr,
                                    fastuidraw::CustomFillRuleFunction(fill_rule),
+                                   m_generate_params.m_distance_field_pool.get(),
                                    &output);
 }
 
+void
+FontFreeTypePrivate::
+compute_path(enum fastuidraw::glyph_type tp, int pixel_size,
+             fastuidraw::GlyphMetrics glyph_metrics,
+             fastuidraw::Path &path)
+{
+  FaceGrabber p(this);
+
+  if (!p.m_p || !p.m_p->face())
+    {
+      return;
+    }
+
+  FT_Face face(p.m_p->face());
+  uint32_t glyph_code(glyph_metrics.glyph_code());
+
+  if (tp == fastuidraw::coverage_glyph)
+    {
+      font_coordinate_converter C(face, pixel_size);
+
+      FT_Set_Pixel_Sizes(face, pixel_size, pixel_size);
+      FT_Load_Glyph(face, glyph_code, FT_LOAD_NO_BITMAP);
+      IntPathCreator::decompose_to_path(&face->glyph->outline, path, C);
+    }
+  else
+    {
+      fastuidraw::detail::IntPath int_path_ecm;
+      fastuidraw::detail::IntBezierCurve::transformation<float> identity_tr;
+
+      load_glyph(face, glyph_code);
+      IntPathCreator::decompose_to_path(&face->glyph->outline, int_path_ecm, 1);
+      int_path_ecm.add_to_path(identity_tr, &path);
+    }
+}
+
 template<typename T>
 void
 FontFreeTypePrivate::
@@ -718,7 +998,8 @@ can_create_rendering_data(enum glyph_type tp) const
   return tp == coverage_glyph
     || tp == distance_field_glyph
     || tp == restricted_rays_glyph
-    || tp == banded_rays_glyph;
+    || tp == banded_rays_glyph
+    || tp == msdf_glyph;
 }
 
 unsigned int
@@ -730,6 +1011,34 @@ number_glyphs(void) const
   return d->m_number_glyphs;
 }
 
+bool
+fastuidraw::FontFreeType::
+content_hash(uint64_t *out_hash) const
+{
+  FontFreeTypePrivate *d;
+  d = static_cast<FontFreeTypePrivate*>(m_d);
+
+  std::call_once(d->m_content_hash_once,
+                 &FontFreeTypePrivate::compute_content_hash, d);
+  if (d->m_content_hash_valid)
+    {
+      *out_hash = d->m_content_hash;
+    }
+  return d->m_content_hash_valid;
+}
+
+fastuidraw::reference_counted_ptr<const fastuidraw::CharacterCoverage>
+fastuidraw::FontFreeType::
+character_coverage(void) const
+{
+  FontFreeTypePrivate *d;
+  d = static_cast<FontFreeTypePrivate*>(m_d);
+
+  std::call_once(d->m_character_coverage_once,
+                 &FontFreeTypePrivate::compute_character_coverage, d);
+  return d->m_character_coverage;
+}
+
 void
 fastuidraw::FontFreeType::
 compute_metrics(uint32_t glyph_code, GlyphMetricsValue &metrics) const
@@ -780,7 +1089,20 @@ compute_rendering_data(GlyphRenderer render, GlyphMetrics glyph_metrics,
       {
         GlyphRenderDataTexels *data;
         data = FASTUIDRAWnew GlyphRenderDataTexels();
-        d->compute_rendering_data_distance_field(glyph_metrics, *data, path, render_size);
+        d->compute_rendering_data_distance_field(d->m_generate_params.m_distance_field_pixel_size,
+                                                 d->m_generate_params.m_distance_field_max_distance,
+                                                 glyph_metrics, *data, path, render_size);
+        return data;
+      }
+      break;
+
+    case msdf_glyph:
+      {
+        GlyphRenderDataMSDF *data;
+        data = FASTUIDRAWnew GlyphRenderDataMSDF();
+        d->compute_rendering_data_distance_field(d->m_generate_params.m_msdf_pixel_size,
+                                                 d->m_generate_params.m_msdf_max_distance,
+                                                 glyph_metrics, *data, path, render_size);
         return data;
       }
       break;
@@ -809,6 +1131,18 @@ compute_rendering_data(GlyphRenderer render, GlyphMetrics glyph_metrics,
     }
 }
 
+bool
+fastuidraw::FontFreeType::
+compute_path(GlyphRenderer render, GlyphMetrics glyph_metrics,
+             Path &path) const
+{
+  FontFreeTypePrivate *d;
+  d = static_cast<FontFreeTypePrivate*>(m_d);
+
+  d->compute_path(render.m_type, render.m_pixel_size, glyph_metrics, path);
+  return true;
+}
+
 const fastuidraw::reference_counted_ptr<fastuidraw::FreeTypeFace::GeneratorBase>&
 fastuidraw::FontFreeType::
 face_generator(void) const
@@ -848,6 +1182,33 @@ compute_font_properties_from_face(const reference_counted_ptr<FreeTypeFace> &in_
   return return_value;
 }
 
+fastuidraw::reference_counted_ptr<fastuidraw::CharacterCoverage>
+fastuidraw::FontFreeType::
+compute_character_coverage_from_face(FT_Face in_face)
+{
+  reference_counted_ptr<CharacterCoverage> return_value;
+  FT_ULong character_code;
+  FT_UInt glyph_code;
+
+  return_value = FASTUIDRAWnew CharacterCoverage();
+  if (!in_face)
+    {
+      return return_value;
+    }
+
+  /* if the face has no Unicode character map, stay
+   * with whatever character map the face has selected.
+   */
+  FT_Select_Charmap(in_face, FT_ENCODING_UNICODE);
+  for (character_code = FT_Get_First_Char(in_face, &glyph_code);
+       glyph_code != 0;
+       character_code = FT_Get_Next_Char(in_face, character_code, &glyph_code))
+    {
+      return_value->add(character_code);
+    }
+  return return_value;
+}
+
 void
 fastuidraw::FontFreeType::
 compute_font_properties_from_face(FT_Face in_face, FontProperties &out_properties)
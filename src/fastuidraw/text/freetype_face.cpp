@@ -153,7 +153,17 @@ fastuidraw::FreeTypeFace::GeneratorMemory::
 GeneratorMemory(c_string filename, int face_index)
 {
   DataBufferBase *p;
-  p = FASTUIDRAWnew DataBuffer(filename);
+
+  /* map the file so that the font data is read on demand
+   * from the page cache and shared across processes; fall
+   * back to copying the file if it cannot be mapped.
+   */
+  p = FASTUIDRAWnew MappedDataBuffer(filename);
+  if (p->data_ro().empty())
+    {
+      FASTUIDRAWdelete(p);
+      p = FASTUIDRAWnew DataBuffer(filename);
+    }
   m_d = FASTUIDRAWnew GeneratorMemoryPrivate(p, face_index);
 }
 
@@ -29,13 +29,28 @@ namespace
   {
   public:
     GlyphAtlasBackingStoreBasePrivate(unsigned int psize, bool presizable):
-      m_resizeable(presizable),
-      m_size(psize)
+      m_size(psize),
+      m_page_size(0),
+      m_max_size(presizable ? ~0u : psize)
     {
     }
 
-    bool m_resizeable;
+    GlyphAtlasBackingStoreBasePrivate(unsigned int psize,
+                                      unsigned int ppage_size,
+                                      unsigned int pmax_size):
+      m_page_size(ppage_size)
+    {
+      FASTUIDRAWassert(m_page_size > 0);
+      m_max_size = pmax_size - pmax_size % m_page_size;
+      m_size = m_page_size * ((psize + m_page_size - 1) / m_page_size);
+      m_size = fastuidraw::t_min(m_size, m_max_size);
+    }
+
     unsigned int m_size;
+
+    /* 0 if the store is not paged */
+    unsigned int m_page_size;
+    unsigned int m_max_size;
   };
 
   class DelayedDeallocate
@@ -54,9 +69,11 @@ namespace
       m_store_constant(m_store),
       m_data_allocator(pstore->size()),
       m_data_allocated(0),
+      m_data_delayed_deallocated(0),
       m_number_times_cleared(0),
       m_lock_resource_counter(0),
-      m_clear_issued(false)
+      m_clear_issued(false),
+      m_store_cannot_copy(false)
     {
       FASTUIDRAWassert(m_store);
     };
@@ -70,11 +87,41 @@ namespace
     clear_implement(void)
     {
       m_data_allocator.reset(m_data_allocator.size());
+      m_data_allocated = 0;
+      m_data_delayed_deallocated = 0;
       ++m_number_times_cleared;
       m_clear_issued = false;
       m_delayed_deallocates.clear();
     }
 
+    /* Returns the size to which to grow the store so that
+     * an allocation of count elements succeeds, returns 0
+     * if the store cannot grow enough. A store that is not
+     * paged is doubled (because resizing it may copy its
+     * contents); a paged store gets only the pages needed.
+     */
+    unsigned int
+    grown_size(unsigned int count)
+    {
+      uint64_t sz(m_store->size()), max_sz(m_store->max_size());
+      uint64_t page(m_store->page_size()), R;
+
+      if (!m_store->resizeable())
+        {
+          return 0;
+        }
+
+      if (page == 0)
+        {
+          R = count + 2 * sz;
+        }
+      else
+        {
+          R = sz + page * ((count + page - 1) / page);
+        }
+      return (R <= max_sz) ? R : 0;
+    }
+
     void
     deallocate_implement(int location, int count)
     {
@@ -89,9 +136,15 @@ namespace
 
     std::mutex m_mutex;
     std::atomic<unsigned int> m_data_allocated;
+    std::atomic<unsigned int> m_data_delayed_deallocated;
     std::atomic<unsigned int> m_number_times_cleared;
     std::atomic<int> m_lock_resource_counter;
     std::atomic<bool> m_clear_issued;
+
+    /* set once the store fails to copy data, so that
+     * copy_data_below() does not allocate for nothing.
+     */
+    bool m_store_cannot_copy;
   };
 }
 
@@ -103,6 +156,14 @@ GlyphAtlasBackingStoreBase(unsigned int psize, bool presizable)
   m_d = FASTUIDRAWnew GlyphAtlasBackingStoreBasePrivate(psize, presizable);
 }
 
+fastuidraw::GlyphAtlasBackingStoreBase::
+GlyphAtlasBackingStoreBase(unsigned int psize,
+                           unsigned int ppage_size,
+                           unsigned int pmax_size)
+{
+  m_d = FASTUIDRAWnew GlyphAtlasBackingStoreBasePrivate(psize, ppage_size, pmax_size);
+}
+
 fastuidraw::GlyphAtlasBackingStoreBase::
 ~GlyphAtlasBackingStoreBase()
 {
@@ -114,7 +175,7 @@ fastuidraw::GlyphAtlasBackingStoreBase::
 
 unsigned int
 fastuidraw::GlyphAtlasBackingStoreBase::
-size(void)
+size(void) const
 {
   GlyphAtlasBackingStoreBasePrivate *d;
   d = static_cast<GlyphAtlasBackingStoreBasePrivate*>(m_d);
@@ -127,21 +188,40 @@ resizeable(void) const
 {
   GlyphAtlasBackingStoreBasePrivate *d;
   d = static_cast<GlyphAtlasBackingStoreBasePrivate*>(m_d);
-  return d->m_resizeable;
+  return d->m_size < d->m_max_size;
 }
 
+get_implement(fastuidraw::GlyphAtlasBackingStoreBase,
+              GlyphAtlasBackingStoreBasePrivate,
+              unsigned int, page_size)
+get_implement(fastuidraw::GlyphAtlasBackingStoreBase,
+              GlyphAtlasBackingStoreBasePrivate,
+              unsigned int, max_size)
+
 void
 fastuidraw::GlyphAtlasBackingStoreBase::
 resize(unsigned int new_size)
 {
   GlyphAtlasBackingStoreBasePrivate *d;
   d = static_cast<GlyphAtlasBackingStoreBasePrivate*>(m_d);
-  FASTUIDRAWassert(d->m_resizeable);
   FASTUIDRAWassert(new_size > d->m_size);
+  FASTUIDRAWassert(new_size <= d->m_max_size);
+  FASTUIDRAWassert(d->m_page_size == 0 || new_size % d->m_page_size == 0);
   resize_implement(new_size);
   d->m_size = new_size;
 }
 
+enum fastuidraw::return_code
+fastuidraw::GlyphAtlasBackingStoreBase::
+copy_values(unsigned int dst_location, unsigned int src_location,
+            unsigned int count)
+{
+  FASTUIDRAWunused(dst_location);
+  FASTUIDRAWunused(src_location);
+  FASTUIDRAWunused(count);
+  return routine_fail;
+}
+
 ///////////////////////////////////////////////
 // fastuidraw::GlyphAtlas methods
 fastuidraw::GlyphAtlas::
@@ -177,17 +257,18 @@ allocate_data(c_array<const generic_data> pdata)
   return_value = d->m_data_allocator.allocate_interval(pdata.size());
   if (return_value == -1)
     {
-      if (d->m_store->resizeable())
-        {
-          d->m_store->resize(pdata.size() + 2 * d->m_store->size());
-          d->m_data_allocator.resize(d->m_store->size());
-          return_value = d->m_data_allocator.allocate_interval(pdata.size());
-          FASTUIDRAWassert(return_value != -1);
-        }
-      else
+      unsigned int new_size;
+
+      new_size = d->grown_size(pdata.size());
+      if (new_size == 0)
         {
           return return_value;
         }
+
+      d->m_store->resize(new_size);
+      d->m_data_allocator.resize(d->m_store->size());
+      return_value = d->m_data_allocator.allocate_interval(pdata.size());
+      FASTUIDRAWassert(return_value != -1);
     }
 
   d->m_data_allocated += pdata.size();
@@ -195,6 +276,119 @@ allocate_data(c_array<const generic_data> pdata)
   return return_value;
 }
 
+int
+fastuidraw::GlyphAtlas::
+allocate_data_below(c_array<const generic_data> pdata, int bound)
+{
+  if (pdata.empty())
+    {
+      return 0;
+    }
+
+  GlyphAtlasPrivate *d;
+  d = static_cast<GlyphAtlasPrivate*>(m_d);
+
+  std::lock_guard<std::mutex> m(d->m_mutex);
+
+  int return_value;
+  return_value = d->m_data_allocator.allocate_interval_lowest(pdata.size(), bound);
+  if (return_value != -1)
+    {
+      d->m_data_allocated += pdata.size();
+      d->m_store->set_values(return_value, pdata);
+    }
+  return return_value;
+}
+
+int
+fastuidraw::GlyphAtlas::
+copy_data_below(int location, int count, int bound)
+{
+  if (count <= 0)
+    {
+      return 0;
+    }
+
+  GlyphAtlasPrivate *d;
+  d = static_cast<GlyphAtlasPrivate*>(m_d);
+
+  std::lock_guard<std::mutex> m(d->m_mutex);
+
+  int return_value;
+  if (d->m_store_cannot_copy)
+    {
+      return -1;
+    }
+
+  return_value = d->m_data_allocator.allocate_interval_lowest(count, bound);
+  if (return_value != -1)
+    {
+      if (d->m_store->copy_values(return_value, location, count) == routine_success)
+        {
+          d->m_data_allocated += count;
+        }
+      else
+        {
+          d->m_data_allocator.free_interval(return_value, count);
+          d->m_store_cannot_copy = true;
+          return_value = -1;
+        }
+    }
+  return return_value;
+}
+
+int
+fastuidraw::GlyphAtlas::
+lowest_free_location(unsigned int count)
+{
+  GlyphAtlasPrivate *d;
+  d = static_cast<GlyphAtlasPrivate*>(m_d);
+
+  std::lock_guard<std::mutex> m(d->m_mutex);
+  return d->m_data_allocator.lowest_free_location(count);
+}
+
+unsigned int
+fastuidraw::GlyphAtlas::
+largest_free_block(void)
+{
+  GlyphAtlasPrivate *d;
+  d = static_cast<GlyphAtlasPrivate*>(m_d);
+
+  std::lock_guard<std::mutex> m(d->m_mutex);
+  return d->m_data_allocator.largest_free_interval();
+}
+
+unsigned int
+fastuidraw::GlyphAtlas::
+number_free_blocks(void)
+{
+  GlyphAtlasPrivate *d;
+  d = static_cast<GlyphAtlasPrivate*>(m_d);
+
+  std::lock_guard<std::mutex> m(d->m_mutex);
+  return d->m_data_allocator.number_free_intervals();
+}
+
+float
+fastuidraw::GlyphAtlas::
+fragmentation(void)
+{
+  GlyphAtlasPrivate *d;
+  int free_room, largest;
+
+  d = static_cast<GlyphAtlasPrivate*>(m_d);
+  std::lock_guard<std::mutex> m(d->m_mutex);
+
+  free_room = d->m_data_allocator.size() - static_cast<int>(d->m_data_allocated);
+  largest = d->m_data_allocator.largest_free_interval();
+  if (free_room <= 0)
+    {
+      return 0.0f;
+    }
+  return 1.0f - static_cast<float>(largest) / static_cast<float>(free_room);
+}
+
 void
 fastuidraw::GlyphAtlas::
 deallocate_data(int location, int count)
@@ -222,6 +416,7 @@ deallocate_data(int location, int count)
 
       std::lock_guard<std::mutex> m(d->m_mutex);
       d->m_delayed_deallocates.push_back(D);
+      d->m_data_delayed_deallocated += count;
     }
 }
 
@@ -235,6 +430,16 @@ data_allocated(void)
   return d->m_data_allocated;
 }
 
+unsigned int
+fastuidraw::GlyphAtlas::
+data_delayed_deallocated(void)
+{
+  GlyphAtlasPrivate *d;
+  d = static_cast<GlyphAtlasPrivate*>(m_d);
+
+  return d->m_data_delayed_deallocated;
+}
+
 void
 fastuidraw::GlyphAtlas::
 clear(void)
@@ -290,6 +495,15 @@ lock_resources(void)
   ++d->m_lock_resource_counter;
 }
 
+bool
+fastuidraw::GlyphAtlas::
+resources_locked(void) const
+{
+  GlyphAtlasPrivate *d;
+  d = static_cast<GlyphAtlasPrivate*>(m_d);
+  return d->m_lock_resource_counter > 0;
+}
+
 void
 fastuidraw::GlyphAtlas::
 unlock_resources(void)
@@ -313,6 +527,7 @@ unlock_resources(void)
               d->deallocate_implement(m.m_location, m.m_count);
             }
           d->m_delayed_deallocates.clear();
+          d->m_data_delayed_deallocated = 0;
         }
       FASTUIDRAWassert(d->m_delayed_deallocates.empty());
     }
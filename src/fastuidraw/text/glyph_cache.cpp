@@ -17,12 +17,22 @@
  */
 
 
-#include <map>
+#include <list>
+#include <algorithm>
+#include <deque>
 #include <vector>
 #include <mutex>
+#include <atomic>
+#include <memory>
+#include <chrono>
+#include <condition_variable>
 #include <fastuidraw/text/glyph_cache.hpp>
 #include <fastuidraw/text/glyph_render_data.hpp>
 #include "../private/util_private.hpp"
+#include "../private/worker_pool.hpp"
+#include "../private/glyph_disk_cache.hpp"
+#include "../private/flat_hash_index.hpp"
+#include "../private/path_contour_edges.hpp"
 
 
 namespace
@@ -30,6 +40,71 @@ namespace
 
   class GlyphCachePrivate;
 
+  /* Estimate of the bytes used by the curves of a Path; it does
+   * not include the tessellations cached by the Path nor the
+   * interpolator_base objects that a PathContour makes only
+   * when they are first requested.
+   */
+  unsigned int
+  estimate_path_bytes(const fastuidraw::Path &path)
+  {
+    /* rough sizes of the objects behind a PathContour,
+     * the compact data of each of its edges and each
+     * interpolator of a generic edge.
+     */
+    enum
+      {
+        contour_bytes = 256,
+        edge_bytes = 12,
+        generic_bytes = 96
+      };
+
+    unsigned int return_value(0);
+    for (unsigned int c = 0, endc = path.number_contours(); c < endc; ++c)
+      {
+        fastuidraw::detail::PathContourEdges edges(*path.contour(c));
+
+        return_value += contour_bytes + sizeof(fastuidraw::vec2);
+        for (unsigned int i = 0, endi = edges.number_edges(); i < endi; ++i)
+          {
+            return_value += edge_bytes
+              + (edges.points(i).size() - 1u) * sizeof(fastuidraw::vec2);
+            if (edges.verb(i) == fastuidraw::detail::PathContourEdges::generic_verb)
+              {
+                return_value += generic_bytes;
+              }
+          }
+      }
+    return return_value;
+  }
+
+  class PrefetchHandlePrivate
+  {
+  public:
+    explicit
+    PrefetchHandlePrivate(unsigned int number_glyphs):
+      m_number_glyphs(number_glyphs),
+      m_number_glyphs_done(0)
+    {}
+
+    void
+    mark_done(unsigned int cnt)
+    {
+      std::lock_guard<std::mutex> m(m_mutex);
+      m_number_glyphs_done += cnt;
+      FASTUIDRAWassert(m_number_glyphs_done <= m_number_glyphs);
+      if (m_number_glyphs_done == m_number_glyphs)
+        {
+          m_cv.notify_all();
+        }
+    }
+
+    unsigned int m_number_glyphs;
+    unsigned int m_number_glyphs_done;
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+  };
+
   class GlyphDataAlloc
   {
   public:
@@ -37,6 +112,13 @@ namespace
     int m_size;
   };
 
+  class GlyphRelocatableAttribute
+  {
+  public:
+    unsigned int m_attribute;
+    int m_location;
+  };
+
   class GlyphAtlasProxyPrivate
   {
   public:
@@ -48,6 +130,11 @@ namespace
 
     unsigned int m_total_allocated;
     std::vector<GlyphDataAlloc> m_data_locations;
+
+    /* attributes that hold a location of m_data_locations,
+     * see GlyphAtlasProxy::relocatable_attribute().
+     */
+    std::vector<GlyphRelocatableAttribute> m_relocatable_attributes;
     GlyphCachePrivate *m_cache;
   };
 
@@ -114,22 +201,136 @@ namespace
     void
     remove_from_atlas(void);
 
+    /* Set m_path_bytes and m_render_data_bytes from m_path
+     * and m_glyph_data.
+     */
+    void
+    compute_cpu_bytes(void)
+    {
+      m_path_bytes = (m_path) ? estimate_path_bytes(*m_path) : 0u;
+      m_render_data_bytes = (m_glyph_data) ? m_glyph_data->serialized_size() : 0u;
+    }
+
+    /* Delete m_glyph_data, must be called with m_glyphs_mutex
+     * locked if the glyph is part of a GlyphCache.
+     */
+    void
+    delete_glyph_data(void);
+
+    /* Release m_path and m_glyph_data because of
+     * GlyphCache::cpu_byte_budget(); must be called
+     * with m_glyphs_mutex locked.
+     */
+    void
+    release_cpu_data(void);
+
+    /* Recreate the path released by release_cpu_data(); does
+     * NOT require any lock to be held as long as m_in_flight
+     * is true.
+     */
+    fastuidraw::reference_counted_ptr<const fastuidraw::GlyphPath>
+    recreate_path(fastuidraw::GlyphMetrics metrics);
+
+    /* Set m_path to a path made by recreate_path(); must
+     * be called with m_glyphs_mutex locked.
+     */
+    void
+    set_recreated_path(const fastuidraw::reference_counted_ptr<const fastuidraw::GlyphPath> &path);
+
+    /* Returns true if the glyph is in GlyphCachePrivate::m_release_lru */
+    bool
+    releasable(void) const
+    {
+      return m_uploaded_to_atlas && !m_released;
+    }
+
+    /* Upload m_glyph_data to the atlas, must be called with
+     * m_glyphs_mutex locked; if the glyph was evicted or the
+     * atlas cleared, m_glyph_data must first be regenerated,
+     * see GlyphCachePrivate::ready_upload().
+     */
     enum fastuidraw::return_code
-    upload_to_atlas(fastuidraw::GlyphMetrics metrics,
-                    fastuidraw::GlyphAtlasProxy &S,
+    upload_to_atlas(fastuidraw::GlyphAtlasProxy &S,
                     fastuidraw::GlyphAttribute::Array &T);
 
+    /* Generate m_glyph_data, m_path and m_render_size from
+     * m_render and the metrics; does NOT require any lock to
+     * be held as long as m_in_flight is true.
+     */
+    void
+    generate_rendering_data(fastuidraw::GlyphMetrics metrics);
+
+    /* Fetch the rendering data from the disk cache of m_cache
+     * or, if not present there, create it with the font and
+     * then store it into the disk cache; does NOT require any
+     * lock to be held.
+     */
+    fastuidraw::GlyphRenderData*
+    compute_rendering_data(fastuidraw::GlyphMetrics metrics,
+                           fastuidraw::Path &path,
+                           fastuidraw::vec2 &render_size);
+
     /* location into m_cache->m_glyphs  */
     unsigned int m_cache_location;
 
     fastuidraw::GlyphRenderer m_render;
     GlyphMetricsPrivate *m_metrics;
 
+    /* true while a thread is generating the rendering
+     * data of the glyph without holding m_glyphs_mutex;
+     * other threads requesting the glyph wait on
+     * GlyphCachePrivate::m_glyphs_cv for it to become
+     * false.
+     */
+    bool m_in_flight;
+
+    /* true while m_in_flight is true because the rendering
+     * data of the glyph is regenerated for an upload (see
+     * GlyphCachePrivate::ready_upload()), rather than
+     * generated for the first time.
+     */
+    bool m_regenerating;
+
     std::vector<fastuidraw::GlyphAttribute> m_attributes;
     bool m_uploaded_to_atlas;
 
-    /* Path of the glyph */
-    fastuidraw::Path m_path;
+    /* value of GlyphCachePrivate::m_current_epoch when the
+     * glyph was last fetched.
+     */
+    unsigned int m_last_use_epoch;
+
+    /* location in GlyphCachePrivate::m_lru, only valid
+     * if m_uploaded_to_atlas is true.
+     */
+    std::list<GlyphDataPrivate*>::iterator m_lru_location;
+
+    /* true if m_path and m_glyph_data were released
+     * because of GlyphCache::cpu_byte_budget().
+     */
+    bool m_released;
+
+    /* location in GlyphCachePrivate::m_release_lru, only
+     * valid if releasable() is true.
+     */
+    std::list<GlyphDataPrivate*>::iterator m_release_lru_location;
+
+    /* true if the last upload of the glyph failed while the
+     * resources of the atlas were locked and the glyph is in
+     * GlyphCachePrivate::m_failed_uploads.
+     */
+    bool m_upload_failed;
+
+    /* estimated bytes of m_path and m_glyph_data; while the
+     * glyph is part of a GlyphCache, they are included in
+     * GlyphCachePrivate::m_path_bytes and m_render_data_bytes.
+     */
+    unsigned int m_path_bytes, m_render_data_bytes;
+
+    /* Path of the glyph; it is reference counted because
+     * Glyph::path() returns it and the glyph may release it
+     * (see release_cpu_data()) while the caller still uses it.
+     */
+    fastuidraw::reference_counted_ptr<const fastuidraw::GlyphPath> m_path;
 
     /* rendeirng size of the glyph */
     fastuidraw::vec2 m_render_size;
@@ -140,10 +341,21 @@ namespace
     std::vector<fastuidraw::GlyphRenderCostInfo> m_render_cost_info;
   };
 
+  /* A Store holds the GlyphDataPrivate or GlyphMetricsPrivate
+   * objects of a GlyphCache. Objects created by the Store are
+   * allocated from a pool (a std::deque which never moves its
+   * elements) and are recycled through free slots; a key is
+   * looked up with an open-addressing hash index.
+   */
   template<typename K, typename T>
-  class Store
+  class Store:fastuidraw::noncopyable
   {
   public:
+    ~Store()
+    {
+      release();
+    }
+
     fastuidraw::c_array<T*>
     data(void)
     {
@@ -153,27 +365,27 @@ namespace
     enum fastuidraw::return_code
     take(T *d, GlyphCachePrivate *c, const K &key)
     {
-      if (m_map.find(key) != m_map.end())
+      if (!m_index.insert(key, m_data.size()))
         {
           return fastuidraw::routine_fail;
         }
 
       d->m_cache = c;
       d->m_cache_location = m_data.size();
-      m_map[key] = m_data.size();
       m_data.push_back(d);
+      m_taken.push_back(d);
       return fastuidraw::routine_success;
     }
 
     T*
     fetch_or_allocate(GlyphCachePrivate *c, const K &key)
     {
-      typename map::iterator iter;
+      const unsigned int *slot_ptr;
 
-      iter = m_map.find(key);
-      if (iter != m_map.end())
+      slot_ptr = m_index.find(key);
+      if (slot_ptr)
         {
-          return m_data[iter->second];
+          return m_data[*slot_ptr];
         }
 
       T *p;
@@ -187,45 +399,66 @@ namespace
         }
       else
         {
-          p = FASTUIDRAWnew T(c, m_data.size());
           slot = m_data.size();
+          m_pool.emplace_back(c, slot);
+          p = &m_pool.back();
           m_data.push_back(p);
         }
-      m_map[key] = slot;
+      m_index.insert(key, slot);
       return p;
     }
 
     void
     remove_value(const K &key)
     {
-      typename map::iterator iter;
+      unsigned int slot(0);
+      bool found;
 
-      iter = m_map.find(key);
-      FASTUIDRAWassert(iter != m_map.end());
+      found = m_index.erase(key, &slot);
+      FASTUIDRAWassert(found);
+      FASTUIDRAWunused(found);
 
-      m_data[iter->second]->clear();
-      m_free_slots.push_back(iter->second);
-      m_map.erase(iter);
+      m_data[slot]->clear();
+      m_free_slots.push_back(slot);
     }
 
     void
     clear(void)
     {
-      for (const auto &m : m_map)
+      m_index.for_each([this](const K&, unsigned int slot)
+                       {
+                         m_data[slot]->clear();
+                         m_free_slots.push_back(slot);
+                         FASTUIDRAWassert(slot == m_data[slot]->m_cache_location);
+                       });
+      m_index.clear();
+    }
+
+    /* delete all objects of the Store */
+    void
+    release(void)
+    {
+      for (T *p : m_taken)
         {
-          m_data[m.second]->clear();
-          m_free_slots.push_back(m.second);
-          FASTUIDRAWassert(m.second == m_data[m.second]->m_cache_location);
+          FASTUIDRAWdelete(p);
         }
-      m_map.clear();
+      m_taken.clear();
+      m_pool.clear();
+      m_data.clear();
+      m_free_slots.clear();
+      m_index.clear();
     }
 
   private:
-    typedef std::map<K, unsigned int> map;
-
-    map m_map;
+    fastuidraw::detail::FlatHashIndex<K> m_index;
     std::vector<T*> m_data;
     std::vector<unsigned int> m_free_slots;
+
+    /* backing of the objects created by the Store */
+    std::deque<T> m_pool;
+
+    /* objects passed to take(), owned by the Store */
+    std::vector<T*> m_taken;
   };
 
   class glyph_key
@@ -246,11 +479,27 @@ namespace
     }
 
     bool
-    operator<(const glyph_key &rhs) const
+    operator==(const glyph_key &rhs) const
+    {
+      return m_font == rhs.m_font
+        && m_glyph_code == rhs.m_glyph_code
+        && m_render == rhs.m_render;
+    }
+
+    uint64_t
+    hash(void) const
     {
-      return (m_font != rhs.m_font) ? m_font < rhs.m_font :
-        (m_glyph_code != rhs.m_glyph_code) ? m_glyph_code < rhs.m_glyph_code :
-        m_render < rhs.m_render;
+      /* the pixel size is ignored for scalable glyph types,
+       * see GlyphRenderer::operator==()
+       */
+      uint64_t r;
+      r = static_cast<uint32_t>(m_render.m_type);
+      if (!fastuidraw::GlyphRenderer::scalable(m_render.m_type))
+        {
+          r |= static_cast<uint64_t>(static_cast<uint32_t>(m_render.m_pixel_size)) << 32u;
+        }
+      return fastuidraw::detail::hash_mix(reinterpret_cast<uintptr_t>(m_font))
+        ^ fastuidraw::detail::hash_mix(r + m_glyph_code);
     }
 
     const fastuidraw::FontBase *m_font;
@@ -283,10 +532,17 @@ namespace
     {}
 
     bool
-    operator<(const glyph_metrics_key &rhs) const
+    operator==(const glyph_metrics_key &rhs) const
+    {
+      return m_font == rhs.m_font
+        && m_glyph_code == rhs.m_glyph_code;
+    }
+
+    uint64_t
+    hash(void) const
     {
-      return (m_font != rhs.m_font) ? m_font < rhs.m_font :
-        m_glyph_code < rhs.m_glyph_code;
+      return fastuidraw::detail::hash_mix(reinterpret_cast<uintptr_t>(m_font))
+        ^ m_glyph_code;
     }
 
     const fastuidraw::FontBase *m_font;
@@ -302,6 +558,122 @@ namespace
 
     ~GlyphCachePrivate();
 
+    /* Must be called with m_glyphs_mutex locked. Returns the entry
+     * for the named glyph; if the entry has not yet been generated,
+     * it is marked as in flight and added to to_generate, the caller
+     * is then responsible to call GlyphDataPrivate::generate_rendering_data()
+     * (without the lock held) and then mark_generated() (with the lock
+     * held).
+     */
+    GlyphDataPrivate*
+    fetch_or_reserve(fastuidraw::GlyphRenderer render,
+                     GlyphMetricsPrivate *metrics,
+                     std::vector<GlyphDataPrivate*> &to_generate);
+
+    /* Must be called with m_glyphs_mutex locked. */
+    void
+    mark_generated(fastuidraw::c_array<GlyphDataPrivate* const> glyphs);
+
+    /* Must be called with m_glyphs_mutex locked; marks the
+     * glyph as used in the current epoch.
+     */
+    void
+    mark_used(GlyphDataPrivate *q)
+    {
+      q->m_last_use_epoch = m_current_epoch;
+      if (q->m_uploaded_to_atlas)
+        {
+          m_lru.splice(m_lru.end(), m_lru, q->m_lru_location);
+        }
+      if (q->releasable())
+        {
+          m_release_lru.splice(m_release_lru.end(), m_release_lru, q->m_release_lru_location);
+        }
+    }
+
+    /* Must be called with m_glyphs_mutex locked. Release the
+     * CPU data of least recently used glyphs that were not used
+     * in the current epoch until within m_cpu_byte_budget.
+     */
+    void
+    enforce_cpu_byte_budget(void);
+
+    /* Must be called with m_glyphs_mutex locked. Evict least
+     * recently used glyphs that were not used in the current
+     * epoch until atleast size generic_data values have been
+     * freed. Returns true if any glyph was evicted.
+     */
+    bool
+    evict_least_recently_used(unsigned int size);
+
+    /* Returns the data allocated on m_atlas, not counting the
+     * data deallocated whose deallocation is delayed because
+     * the resources of m_atlas are locked; the delayed data
+     * is counted as free so that a budget does not evict for
+     * every upload while the resources are locked.
+     */
+    unsigned int
+    atlas_data_in_use(void)
+    {
+      unsigned int a(m_atlas->data_allocated());
+      unsigned int b(m_atlas->data_delayed_deallocated());
+      return (a > b) ? a - b : 0u;
+    }
+
+    /* Allocate data on m_atlas for a glyph upload, evicting
+     * glyphs as necessary. Must be called with m_glyphs_mutex
+     * locked.
+     */
+    int
+    allocate_glyph_data(fastuidraw::c_array<const fastuidraw::generic_data> pdata);
+
+    /* Ready a glyph for GlyphDataPrivate::upload_to_atlas(),
+     * lock must be on m_glyphs_mutex. The rendering data of a
+     * glyph is deleted once it is uploaded; if the glyph was
+     * since evicted or the atlas cleared, the data is regenerated
+     * with the lock released and the glyph marked as in flight.
+     */
+    void
+    ready_upload(std::unique_lock<std::mutex> &lock, GlyphDataPrivate *q,
+                 fastuidraw::GlyphMetrics metrics);
+
+    /* Must be called with m_glyphs_mutex locked. Move the data
+     * of an uploaded glyph to below bound by copying it within
+     * m_atlas and adjusting its relocatable attributes (see
+     * GlyphAtlasProxy::relocatable_attribute()); the old data
+     * is added to m_compaction_pending. Returns false if the
+     * glyph has no relocatable attributes, if the store of
+     * m_atlas cannot copy or if there is no room.
+     */
+    bool
+    move_glyph_by_copy(GlyphDataPrivate *q, int bound);
+
+    /* Must be called with m_glyphs_mutex locked. Free the old
+     * data of the glyphs moved by GlyphCache::compact_atlas()
+     * (see m_compaction_pending), thus ending the batch of
+     * moves. Returns true if any data was freed.
+     */
+    bool
+    flush_compaction(void);
+
+    /* Executed by a worker thread to generate the glyphs of
+     * a portion of a GlyphCache::prefetch() call.
+     */
+    void
+    execute_prefetch(fastuidraw::GlyphRenderer render,
+                     const fastuidraw::FontBase *font,
+                     fastuidraw::c_array<const uint32_t> glyph_codes,
+                     PrefetchHandlePrivate *handle);
+
+    /* Wait until the named glyph is no longer in flight, the
+     * lock must be on m_glyphs_mutex.
+     */
+    void
+    wait_generated(std::unique_lock<std::mutex> &lock, GlyphDataPrivate *q)
+    {
+      m_glyphs_cv.wait(lock, [q] { return !q->m_in_flight; });
+    }
+
     /* When the atlas is full, we will clear the atlas, but save
      *  the values in m_glyphs but mark them as not having been
      *  uploaded, this way returned values are safe and we do
@@ -309,6 +681,96 @@ namespace
      */
 
     std::mutex m_glyphs_mutex, m_glyphs_metrics_mutex;
+
+    /* signaled whenever glyphs finish generating */
+    std::condition_variable m_glyphs_cv;
+
+    /* number of glyphs with m_in_flight as true */
+    unsigned int m_number_in_flight;
+
+    /* number of tasks added by GlyphCache::prefetch() that
+     * have not yet completed; the dtor waits for them and
+     * sets m_prefetch_cancelled so that those not yet started
+     * do not generate their glyphs.
+     */
+    unsigned int m_number_prefetch_tasks;
+    bool m_prefetch_cancelled;
+
+    /* glyphs uploaded to the atlas, ordered from least
+     * recently used to most recently used.
+     */
+    std::list<GlyphDataPrivate*> m_lru;
+    std::atomic<unsigned int> m_current_epoch;
+
+    /* glyphs whose CPU data can be released because of
+     * m_cpu_byte_budget (see GlyphDataPrivate::releasable()),
+     * ordered from least recently used to most recently used.
+     */
+    std::list<GlyphDataPrivate*> m_release_lru;
+
+    /* budget in bytes of m_path_bytes plus m_render_data_bytes,
+     * a value of 0 indicates no budget.
+     */
+    std::atomic<unsigned int> m_cpu_byte_budget;
+    uint64_t m_path_bytes, m_render_data_bytes;
+
+    /* statistics of fetching and generating glyphs */
+    uint64_t m_number_hits, m_number_misses;
+    std::atomic<uint64_t> m_number_generated, m_generation_time_us;
+
+    /* budget in bytes of the atlas data for glyphs, a
+     * value of 0 indicates no budget.
+     */
+    std::atomic<unsigned int> m_atlas_byte_budget;
+    std::atomic<unsigned int> m_number_glyphs_evicted;
+    std::atomic<unsigned int> m_number_eviction_passes;
+    std::atomic<unsigned int> m_number_compaction_passes;
+
+    /* glyphs whose upload failed while the resources of the
+     * atlas were locked; GlyphCache::advance_epoch() uploads
+     * again those used in the epoch it ends and, if any
+     * succeeds, increments m_number_retry_passes so that
+     * GlyphCache::number_times_atlas_cleared() changes.
+     */
+    std::vector<GlyphDataPrivate*> m_failed_uploads;
+    std::atomic<unsigned int> m_number_retry_passes;
+
+    /* the old data of the glyphs moved by GlyphCache::compact_atlas();
+     * it stays allocated, so that attributes packed before the glyphs
+     * were moved remain valid, until flush_compaction() frees all of
+     * it and changes GlyphCache::number_times_atlas_cleared() once
+     * for the batch of moves.
+     */
+    std::vector<GlyphDataAlloc> m_compaction_pending;
+    unsigned int m_compaction_pending_size;
+
+    /* if non-negative, the location that glyph data allocated
+     * by allocate_glyph_data() may not exceed; set while
+     * GlyphCache::compact_atlas() moves a glyph.
+     */
+    int m_relocation_bound;
+
+    /* pool used by fetch_glyphs() to generate glyphs
+     * in parallel; accessed with m_glyphs_mutex locked,
+     * a fetch_glyphs() call keeps its own reference
+     * so that the pool can be replaced while in use.
+     */
+    std::shared_ptr<fastuidraw::detail::WorkerPool> m_generation_pool;
+
+    /* on-disk cache of glyph rendering data; glyphs are
+     * generated without m_glyphs_mutex locked, so the disk
+     * cache has its own lock and users keep a reference.
+     */
+    std::shared_ptr<fastuidraw::detail::GlyphDiskCache>
+    disk_cache(void)
+    {
+      std::lock_guard<std::mutex> m(m_disk_cache_mutex);
+      return m_disk_cache;
+    }
+
+    std::mutex m_disk_cache_mutex;
+    std::shared_ptr<fastuidraw::detail::GlyphDiskCache> m_disk_cache;
+
     fastuidraw::reference_counted_ptr<fastuidraw::GlyphAtlas> m_atlas;
     Store<glyph_key, GlyphDataPrivate> m_glyphs;
     Store<glyph_metrics_key, GlyphMetricsPrivate> m_glyph_metrics;
@@ -323,7 +785,14 @@ GlyphDataPrivate(GlyphCachePrivate *c, unsigned int I):
   GlyphAtlasProxyPrivate(c),
   m_cache_location(I),
   m_metrics(nullptr),
+  m_in_flight(false),
+  m_regenerating(false),
   m_uploaded_to_atlas(false),
+  m_last_use_epoch(0),
+  m_released(false),
+  m_upload_failed(false),
+  m_path_bytes(0),
+  m_render_data_bytes(0),
   m_glyph_data(nullptr)
 {}
 
@@ -332,7 +801,14 @@ GlyphDataPrivate(void):
   GlyphAtlasProxyPrivate(nullptr),
   m_cache_location(~0u),
   m_metrics(nullptr),
+  m_in_flight(false),
+  m_regenerating(false),
   m_uploaded_to_atlas(false),
+  m_last_use_epoch(0),
+  m_released(false),
+  m_upload_failed(false),
+  m_path_bytes(0),
+  m_render_data_bytes(0),
   m_glyph_data(nullptr)
 {}
 
@@ -356,7 +832,18 @@ remove_from_atlas(void)
           m_cache->m_atlas->deallocate_data(g.m_location, g.m_size);
         }
       m_data_locations.clear();
+      m_relocatable_attributes.clear();
+      if (m_uploaded_to_atlas)
+        {
+          m_cache->m_lru.erase(m_lru_location);
+        }
+      if (releasable())
+        {
+          m_cache->m_release_lru.erase(m_release_lru_location);
+        }
     }
+  m_attributes.clear();
+  m_total_allocated = 0;
   m_uploaded_to_atlas = false;
 }
 
@@ -364,28 +851,118 @@ void
 GlyphDataPrivate::
 clear(void)
 {
+  FASTUIDRAWassert(!m_in_flight);
   m_render = fastuidraw::GlyphRenderer();
   FASTUIDRAWassert(!m_render.valid());
 
   remove_from_atlas();
+  delete_glyph_data();
+  if (m_metrics && !m_metrics->m_cache)
+    {
+      FASTUIDRAWdelete(m_metrics);
+    }
+  m_attributes.clear();
+  m_metrics = nullptr;
+  m_path = nullptr;
+  if (m_cache)
+    {
+      m_cache->m_path_bytes -= m_path_bytes;
+    }
+  m_path_bytes = 0;
+  m_released = false;
+  m_upload_failed = false;
+}
+
+void
+GlyphDataPrivate::
+delete_glyph_data(void)
+{
   if (m_glyph_data)
     {
       FASTUIDRAWdelete(m_glyph_data);
       m_glyph_data = nullptr;
     }
-  if (m_metrics && !m_metrics->m_cache)
+  if (m_cache)
     {
-      FASTUIDRAWdelete(m_metrics);
+      m_cache->m_render_data_bytes -= m_render_data_bytes;
+    }
+  m_render_data_bytes = 0;
+}
+
+void
+GlyphDataPrivate::
+release_cpu_data(void)
+{
+  FASTUIDRAWassert(m_cache);
+  FASTUIDRAWassert(releasable());
+
+  m_cache->m_release_lru.erase(m_release_lru_location);
+  m_released = true;
+
+  delete_glyph_data();
+  m_path = nullptr;
+  m_cache->m_path_bytes -= m_path_bytes;
+  m_path_bytes = 0;
+}
+
+fastuidraw::reference_counted_ptr<const fastuidraw::GlyphPath>
+GlyphDataPrivate::
+recreate_path(fastuidraw::GlyphMetrics metrics)
+{
+  std::shared_ptr<fastuidraw::detail::GlyphDiskCache> disk_cache;
+  const fastuidraw::FontBase *font(m_metrics->m_font.get());
+  fastuidraw::GlyphPath *path;
+  fastuidraw::reference_counted_ptr<const fastuidraw::GlyphPath> return_value;
+  fastuidraw::GlyphRenderData *data;
+  fastuidraw::vec2 render_size;
+
+  FASTUIDRAWassert(m_cache);
+  FASTUIDRAWassert(m_in_flight);
+
+  path = FASTUIDRAWnew fastuidraw::GlyphPath();
+  return_value = path;
+
+  /* only the path is needed, so avoid generating the
+   * rendering data when the disk cache or the font can
+   * provide just the path.
+   */
+  disk_cache = m_cache->disk_cache();
+  if (disk_cache && disk_cache->fetch_path(font, m_metrics->m_glyph_code, m_render, *path))
+    {
+      return return_value;
+    }
+
+  if (font->compute_path(m_render, metrics, *path))
+    {
+      return return_value;
+    }
+
+  data = compute_rendering_data(metrics, *path, render_size);
+  FASTUIDRAWdelete(data);
+
+  return return_value;
+}
+
+void
+GlyphDataPrivate::
+set_recreated_path(const fastuidraw::reference_counted_ptr<const fastuidraw::GlyphPath> &path)
+{
+  FASTUIDRAWassert(m_cache);
+  FASTUIDRAWassert(m_released);
+
+  m_path = path;
+  m_released = false;
+  m_path_bytes = estimate_path_bytes(*m_path);
+  m_cache->m_path_bytes += m_path_bytes;
+  if (releasable())
+    {
+      m_release_lru_location = m_cache->m_release_lru.insert(m_cache->m_release_lru.end(), this);
     }
-  m_attributes.clear();
-  m_metrics = nullptr;
-  m_path.clear();
 }
 
 enum fastuidraw::return_code
 GlyphDataPrivate::
-upload_to_atlas(fastuidraw::GlyphMetrics metrics,
-                fastuidraw::GlyphAtlasProxy &S,
+upload_to_atlas(fastuidraw::GlyphAtlasProxy &S,
                 fastuidraw::GlyphAttribute::Array &T)
 {
   enum fastuidraw::return_code return_value;
@@ -395,19 +972,13 @@ upload_to_atlas(fastuidraw::GlyphMetrics metrics,
       return fastuidraw::routine_success;
     }
 
-  if (!m_cache)
+  if (!m_cache || !m_glyph_data)
     {
       return fastuidraw::routine_fail;
     }
 
-  FASTUIDRAWassert(m_glyph_data);
   FASTUIDRAWassert(m_attributes.empty());
 
-  if (!m_glyph_data)
-    {
-      m_glyph_data = m_metrics->m_font->compute_rendering_data(m_render, metrics, m_path, m_render_size);
-    }
-
   fastuidraw::c_array<const fastuidraw::c_string> render_cost_labels(m_glyph_data->render_info_labels());
   std::vector<float> tmp(render_cost_labels.size(), 0.0f);
 
@@ -423,14 +994,76 @@ upload_to_atlas(fastuidraw::GlyphMetrics metrics,
       m_render_cost_info.back().m_label = "SizeOnCacheInKB";
       m_render_cost_info.back().m_value = static_cast<float>(S.total_allocated() * 4) / 1024.0f;
       m_uploaded_to_atlas = true;
+      m_upload_failed = false;
+      m_lru_location = m_cache->m_lru.insert(m_cache->m_lru.end(), this);
+      if (releasable())
+        {
+          m_release_lru_location = m_cache->m_release_lru.insert(m_cache->m_release_lru.end(), this);
+        }
     }
   else
     {
       remove_from_atlas();
+      if (!m_upload_failed && m_cache->m_atlas->resources_locked())
+        {
+          m_upload_failed = true;
+          m_cache->m_failed_uploads.push_back(this);
+        }
+    }
+
+  delete_glyph_data();
+
+  return return_value;
+}
+
+void
+GlyphDataPrivate::
+generate_rendering_data(fastuidraw::GlyphMetrics metrics)
+{
+  FASTUIDRAWassert(m_in_flight);
+  FASTUIDRAWassert(!m_glyph_data);
+  FASTUIDRAWassert(m_metrics);
+
+  fastuidraw::GlyphPath *path;
+
+  path = FASTUIDRAWnew fastuidraw::GlyphPath();
+  m_path = path;
+  m_glyph_data = compute_rendering_data(metrics, *path, m_render_size);
+  compute_cpu_bytes();
+}
+
+fastuidraw::GlyphRenderData*
+GlyphDataPrivate::
+compute_rendering_data(fastuidraw::GlyphMetrics metrics,
+                       fastuidraw::Path &path,
+                       fastuidraw::vec2 &render_size)
+{
+  std::shared_ptr<fastuidraw::detail::GlyphDiskCache> disk_cache;
+  const fastuidraw::FontBase *font(m_metrics->m_font.get());
+  fastuidraw::GlyphRenderData *return_value(nullptr);
+  std::chrono::steady_clock::time_point start_time(std::chrono::steady_clock::now());
+
+  disk_cache = m_cache->disk_cache();
+  if (disk_cache)
+    {
+      return_value = disk_cache->fetch(font, m_metrics->m_glyph_code,
+                                       m_render, path, render_size);
+    }
+
+  if (!return_value)
+    {
+      return_value = font->compute_rendering_data(m_render, metrics,
+                                                  path, render_size);
+      if (disk_cache)
+        {
+          disk_cache->store(font, m_metrics->m_glyph_code, m_render,
+                            return_value, path, render_size);
+        }
     }
 
-  FASTUIDRAWdelete(m_glyph_data);
-  m_glyph_data = nullptr;
+  std::chrono::steady_clock::duration elapsed(std::chrono::steady_clock::now() - start_time);
+  m_cache->m_generation_time_us += std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+  ++m_cache->m_number_generated;
 
   return return_value;
 }
@@ -440,6 +1073,24 @@ upload_to_atlas(fastuidraw::GlyphMetrics metrics,
 GlyphCachePrivate::
 GlyphCachePrivate(fastuidraw::reference_counted_ptr<fastuidraw::GlyphAtlas> patlas,
                   fastuidraw::GlyphCache *p):
+  m_number_in_flight(0),
+  m_number_prefetch_tasks(0),
+  m_prefetch_cancelled(false),
+  m_current_epoch(0),
+  m_cpu_byte_budget(0),
+  m_path_bytes(0),
+  m_render_data_bytes(0),
+  m_number_hits(0),
+  m_number_misses(0),
+  m_number_generated(0),
+  m_generation_time_us(0),
+  m_atlas_byte_budget(0),
+  m_number_glyphs_evicted(0),
+  m_number_eviction_passes(0),
+  m_number_compaction_passes(0),
+  m_number_retry_passes(0),
+  m_compaction_pending_size(0),
+  m_relocation_bound(-1),
   m_atlas(patlas),
   m_p(p)
 {}
@@ -447,36 +1098,363 @@ GlyphCachePrivate(fastuidraw::reference_counted_ptr<fastuidraw::GlyphAtlas> patl
 GlyphCachePrivate::
 ~GlyphCachePrivate()
 {
+  /* the prefetch tasks refer to this object, so wait
+   * for those started to finish and make the others
+   * skip their work.
+   */
+  {
+    std::unique_lock<std::mutex> lock(m_glyphs_mutex);
+    m_prefetch_cancelled = true;
+    m_glyphs_cv.wait(lock, [this] { return m_number_prefetch_tasks == 0; });
+  }
+
   for(GlyphDataPrivate *p : m_glyphs.data())
     {
       p->clear();
-      FASTUIDRAWdelete(p);
     }
-
-  for(GlyphMetricsPrivate *p : m_glyph_metrics.data())
+  for (const GlyphDataAlloc &A : m_compaction_pending)
     {
-      FASTUIDRAWdelete(p);
+      m_atlas->deallocate_data(A.m_location, A.m_size);
     }
+
+  /* the glyphs refer to the metrics, so the
+   * glyphs are to be released first.
+   */
+  m_glyphs.release();
+  m_glyph_metrics.release();
 }
 
-//////////////////////////////////////////////
-// fastuidraw::GlyphAtlasProxy methods
-int
-fastuidraw::GlyphAtlasProxy::
-allocate_data(c_array<const generic_data> pdata)
+GlyphDataPrivate*
+GlyphCachePrivate::
+fetch_or_reserve(fastuidraw::GlyphRenderer render,
+                 GlyphMetricsPrivate *metrics,
+                 std::vector<GlyphDataPrivate*> &to_generate)
 {
-  int L;
-  GlyphAtlasProxyPrivate *d;
+  GlyphDataPrivate *q;
+  glyph_key src(metrics->m_font.get(), metrics->m_glyph_code, render);
 
-  d = static_cast<GlyphAtlasProxyPrivate*>(m_d);
-  L = d->m_cache->m_atlas->allocate_data(pdata);
-  if (L != -1)
+  q = m_glyphs.fetch_or_allocate(this, src);
+  if (!q->m_render.valid())
     {
-      GlyphDataAlloc A;
-      A.m_location = L;
-      A.m_size = pdata.size();
-      d->m_total_allocated += A.m_size;
-      d->m_data_locations.push_back(A);
+      FASTUIDRAWassert(!q->m_glyph_data);
+      FASTUIDRAWassert(!q->m_in_flight);
+      q->m_render = render;
+      q->m_metrics = metrics;
+      q->m_in_flight = true;
+      ++m_number_in_flight;
+      ++m_number_misses;
+      to_generate.push_back(q);
+    }
+  else
+    {
+      ++m_number_hits;
+    }
+  return q;
+}
+
+void
+GlyphCachePrivate::
+mark_generated(fastuidraw::c_array<GlyphDataPrivate* const> glyphs)
+{
+  if (glyphs.empty())
+    {
+      return;
+    }
+
+  for (GlyphDataPrivate *q : glyphs)
+    {
+      FASTUIDRAWassert(q->m_in_flight);
+      FASTUIDRAWassert(m_number_in_flight > 0);
+      q->m_in_flight = false;
+      --m_number_in_flight;
+      m_path_bytes += q->m_path_bytes;
+      m_render_data_bytes += q->m_render_data_bytes;
+    }
+  m_glyphs_cv.notify_all();
+  enforce_cpu_byte_budget();
+}
+
+void
+GlyphCachePrivate::
+enforce_cpu_byte_budget(void)
+{
+  unsigned int budget(m_cpu_byte_budget);
+
+  if (budget == 0)
+    {
+      return;
+    }
+
+  while (m_path_bytes + m_render_data_bytes > budget
+         && !m_release_lru.empty()
+         && m_release_lru.front()->m_last_use_epoch != m_current_epoch)
+    {
+      m_release_lru.front()->release_cpu_data();
+    }
+}
+
+void
+GlyphCachePrivate::
+execute_prefetch(fastuidraw::GlyphRenderer render,
+                 const fastuidraw::FontBase *font,
+                 fastuidraw::c_array<const uint32_t> glyph_codes,
+                 PrefetchHandlePrivate *handle)
+{
+  bool cancelled;
+
+  {
+    std::lock_guard<std::mutex> m(m_glyphs_mutex);
+    cancelled = m_prefetch_cancelled;
+  }
+
+  if (!cancelled)
+    {
+      std::vector<fastuidraw::Glyph> glyphs(glyph_codes.size());
+      m_p->fetch_glyphs(render, font, glyph_codes,
+                        fastuidraw::make_c_array(glyphs), false);
+    }
+  handle->mark_done(glyph_codes.size());
+
+  /* after the lock is released, the dtor may proceed and
+   * thus this object can no longer be accessed.
+   */
+  std::lock_guard<std::mutex> m(m_glyphs_mutex);
+  FASTUIDRAWassert(m_number_prefetch_tasks > 0);
+  if (--m_number_prefetch_tasks == 0)
+    {
+      m_glyphs_cv.notify_all();
+    }
+}
+
+bool
+GlyphCachePrivate::
+evict_least_recently_used(unsigned int size)
+{
+  unsigned int freed(0), evicted(0);
+
+  /* evict atleast an eighth of what is allocated so that
+   * a sequence of uploads does not trigger an eviction pass
+   * (and thus an invalidation of the derived data of the
+   * glyph locations) for each upload.
+   */
+  size = fastuidraw::t_max(size, atlas_data_in_use() / 8u);
+  while (freed < size
+         && !m_lru.empty()
+         && m_lru.front()->m_last_use_epoch != m_current_epoch)
+    {
+      GlyphDataPrivate *q(m_lru.front());
+
+      freed += q->m_total_allocated;
+      q->remove_from_atlas();
+      ++evicted;
+    }
+
+  if (evicted > 0)
+    {
+      m_number_glyphs_evicted += evicted;
+      ++m_number_eviction_passes;
+      return true;
+    }
+  return false;
+}
+
+int
+GlyphCachePrivate::
+allocate_glyph_data(fastuidraw::c_array<const fastuidraw::generic_data> pdata)
+{
+  unsigned int budget(m_atlas_byte_budget);
+  int L;
+
+  if (m_relocation_bound >= 0)
+    {
+      /* moving a glyph must neither evict nor grow the atlas */
+      return m_atlas->allocate_data_below(pdata, m_relocation_bound);
+    }
+
+  if (budget > 0)
+    {
+      unsigned int required;
+
+      /* the budget is soft: if not enough glyphs can be
+       * evicted, the allocation proceeds anyways. The old
+       * data of moved glyphs is freed before evicting.
+       */
+      required = sizeof(fastuidraw::generic_data) * (atlas_data_in_use() + pdata.size());
+      if (required > budget && flush_compaction())
+        {
+          required = sizeof(fastuidraw::generic_data) * (atlas_data_in_use() + pdata.size());
+        }
+      if (required > budget)
+        {
+          unsigned int excess;
+
+          excess = (required - budget + sizeof(fastuidraw::generic_data) - 1u) / sizeof(fastuidraw::generic_data);
+          evict_least_recently_used(excess);
+        }
+    }
+
+  L = m_atlas->allocate_data(pdata);
+  if (L == -1 && flush_compaction())
+    {
+      L = m_atlas->allocate_data(pdata);
+    }
+
+  if (L == -1 && m_atlas->resources_locked())
+    {
+      /* while the atlas resources are locked, the data of
+       * evicted glyphs is freed only once they are unlocked,
+       * thus evicting does not make room for this allocation.
+       * Evict anyways, unless enough data is already waiting
+       * to be freed, so that the room is there for when
+       * GlyphCache::advance_epoch() retries the upload.
+       */
+      if (m_atlas->data_delayed_deallocated() < pdata.size())
+        {
+          evict_least_recently_used(pdata.size());
+        }
+      return L;
+    }
+
+  while (L == -1 && evict_least_recently_used(pdata.size()))
+    {
+      L = m_atlas->allocate_data(pdata);
+    }
+  return L;
+}
+
+bool
+GlyphCachePrivate::
+move_glyph_by_copy(GlyphDataPrivate *q, int bound)
+{
+  std::vector<GlyphDataAlloc> new_locations;
+
+  if (q->m_relocatable_attributes.empty())
+    {
+      return false;
+    }
+
+  for (const GlyphDataAlloc &A : q->m_data_locations)
+    {
+      GlyphDataAlloc N;
+
+      N.m_location = m_atlas->copy_data_below(A.m_location, A.m_size, bound);
+      N.m_size = A.m_size;
+      if (N.m_location == -1)
+        {
+          for (const GlyphDataAlloc &B : new_locations)
+            {
+              m_atlas->deallocate_data(B.m_location, B.m_size);
+            }
+          return false;
+        }
+      new_locations.push_back(N);
+    }
+
+  /* the attributes are adjusted in place because the
+   * arrays returned by Glyph::attributes() point to them;
+   * the location is in the low bits of each value and
+   * only decreases, so adding the (negative) distance
+   * moved leaves the other bits unchanged.
+   */
+  for (GlyphRelocatableAttribute &R : q->m_relocatable_attributes)
+    {
+      FASTUIDRAWassert(R.m_attribute < q->m_attributes.size());
+      for (unsigned int i = 0; i < q->m_data_locations.size(); ++i)
+        {
+          const GlyphDataAlloc &A(q->m_data_locations[i]);
+          if (A.m_size > 0 && A.m_location == R.m_location)
+            {
+              uint32_t delta;
+
+              delta = static_cast<uint32_t>(new_locations[i].m_location - A.m_location);
+              for (unsigned int c = 0; c < 4; ++c)
+                {
+                  q->m_attributes[R.m_attribute].m_data[c] += delta;
+                }
+              R.m_location = new_locations[i].m_location;
+              break;
+            }
+        }
+    }
+
+  for (const GlyphDataAlloc &A : q->m_data_locations)
+    {
+      m_compaction_pending.push_back(A);
+      m_compaction_pending_size += A.m_size;
+    }
+  q->m_data_locations.swap(new_locations);
+  return true;
+}
+
+bool
+GlyphCachePrivate::
+flush_compaction(void)
+{
+  if (m_compaction_pending.empty())
+    {
+      return false;
+    }
+
+  for (const GlyphDataAlloc &A : m_compaction_pending)
+    {
+      m_atlas->deallocate_data(A.m_location, A.m_size);
+    }
+  m_compaction_pending.clear();
+  m_compaction_pending_size = 0;
+  ++m_number_compaction_passes;
+  return true;
+}
+
+void
+GlyphCachePrivate::
+ready_upload(std::unique_lock<std::mutex> &lock, GlyphDataPrivate *q,
+             fastuidraw::GlyphMetrics metrics)
+{
+  /* another thread may be generating the glyph */
+  wait_generated(lock, q);
+  if (!q->m_uploaded_to_atlas && !q->m_glyph_data)
+    {
+      fastuidraw::GlyphRenderData *data;
+      fastuidraw::Path path;
+      fastuidraw::vec2 render_size;
+
+      q->m_in_flight = true;
+      q->m_regenerating = true;
+      ++m_number_in_flight;
+      lock.unlock();
+
+      /* m_path and m_render_size are already set */
+      data = q->compute_rendering_data(metrics, path, render_size);
+
+      lock.lock();
+      q->m_in_flight = false;
+      q->m_regenerating = false;
+      --m_number_in_flight;
+      m_glyphs_cv.notify_all();
+
+      FASTUIDRAWassert(!q->m_glyph_data);
+      q->m_glyph_data = data;
+    }
+}
+
+//////////////////////////////////////////////
+// fastuidraw::GlyphAtlasProxy methods
+int
+fastuidraw::GlyphAtlasProxy::
+allocate_data(c_array<const generic_data> pdata)
+{
+  int L;
+  GlyphAtlasProxyPrivate *d;
+
+  d = static_cast<GlyphAtlasProxyPrivate*>(m_d);
+  L = d->m_cache->allocate_glyph_data(pdata);
+  if (L != -1)
+    {
+      GlyphDataAlloc A;
+      A.m_location = L;
+      A.m_size = pdata.size();
+      d->m_total_allocated += A.m_size;
+      d->m_data_locations.push_back(A);
     }
   return L;
 }
@@ -490,6 +1468,19 @@ total_allocated(void) const
   return d->m_total_allocated;
 }
 
+void
+fastuidraw::GlyphAtlasProxy::
+relocatable_attribute(unsigned int attribute, int location)
+{
+  GlyphAtlasProxyPrivate *d;
+  GlyphRelocatableAttribute R;
+
+  d = static_cast<GlyphAtlasProxyPrivate*>(m_d);
+  R.m_attribute = attribute;
+  R.m_location = location;
+  d->m_relocatable_attributes.push_back(R);
+}
+
 //////////////////////////////////////////////
 // fastuidraw::GlyphAttribute::Array methods
 unsigned int
@@ -622,10 +1613,13 @@ upload_to_atlas(void) const
       return routine_fail;
     }
 
-  std::lock_guard<std::mutex> m(p->m_cache->m_glyphs_mutex);
+  std::unique_lock<std::mutex> lock(p->m_cache->m_glyphs_mutex);
+  p->m_cache->mark_used(p);
+  p->m_cache->ready_upload(lock, p, metrics());
+
   GlyphAtlasProxy S(p);
   GlyphAttribute::Array T(&p->m_attributes);
-  return p->upload_to_atlas(metrics(), S, T);
+  return p->upload_to_atlas(S, T);
 }
 
 bool
@@ -639,13 +1633,47 @@ uploaded_to_atlas(void) const
   return p->m_uploaded_to_atlas;
 }
 
-const fastuidraw::Path&
+fastuidraw::reference_counted_ptr<const fastuidraw::GlyphPath>
 fastuidraw::Glyph::
 path(void) const
 {
   GlyphDataPrivate *p;
   p = static_cast<GlyphDataPrivate*>(m_opaque);
   FASTUIDRAWassert(p != nullptr && p->m_render.valid());
+  if (!p->m_cache)
+    {
+      return p->m_path;
+    }
+
+  GlyphCachePrivate *c(p->m_cache);
+  std::unique_lock<std::mutex> lock(c->m_glyphs_mutex);
+
+  c->mark_used(p);
+
+  /* another thread may be recreating the path */
+  c->wait_generated(lock, p);
+  if (p->m_released)
+    {
+      reference_counted_ptr<const GlyphPath> path;
+
+      /* recreate the path without the lock held; marking the
+       * glyph as in flight prevents GlyphCache::clear_cache()
+       * from recycling it meanwhile.
+       */
+      p->m_in_flight = true;
+      ++c->m_number_in_flight;
+      lock.unlock();
+
+      path = p->recreate_path(GlyphMetrics(p->m_metrics));
+
+      lock.lock();
+      p->m_in_flight = false;
+      --c->m_number_in_flight;
+      c->m_glyphs_cv.notify_all();
+
+      p->set_recreated_path(path);
+      c->enforce_cpu_byte_budget();
+    }
   return p->m_path;
 }
 
@@ -685,10 +1713,15 @@ create_glyph(GlyphRenderer render,
   GlyphMetricsValue v(d->m_metrics);
   GlyphMetrics cv(d->m_metrics);
 
+  GlyphPath *path;
+
   d->m_render = render;
   font->compute_metrics(glyph_code, v);
-  d->m_glyph_data = font->compute_rendering_data(d->m_render, cv, d->m_path,
+  path = FASTUIDRAWnew GlyphPath();
+  d->m_path = path;
+  d->m_glyph_data = font->compute_rendering_data(d->m_render, cv, *path,
 						 d->m_render_size);
+  d->compute_cpu_bytes();
   return Glyph(d);
 }
 
@@ -864,28 +1897,41 @@ fetch_glyph(GlyphRenderer render, const FontBase *font,
   d = static_cast<GlyphCachePrivate*>(m_d);
 
   GlyphDataPrivate *q;
-  glyph_key src(font, glyph_code, render);
+  GlyphMetrics metrics;
+  std::vector<GlyphDataPrivate*> to_generate;
 
-  std::lock_guard<std::mutex> m(d->m_glyphs_mutex);
-  q = d->m_glyphs.fetch_or_allocate(d, src);
+  /* fetch the metrics before taking m_glyphs_mutex so that
+   * m_glyphs_metrics_mutex is never taken while holding
+   * m_glyphs_mutex.
+   */
+  metrics = fetch_glyph_metrics(font, glyph_code);
 
-  if (!q->m_render.valid())
+  std::unique_lock<std::mutex> lock(d->m_glyphs_mutex);
+  q = d->fetch_or_reserve(render, static_cast<GlyphMetricsPrivate*>(metrics.m_d), to_generate);
+  d->mark_used(q);
+  if (!to_generate.empty())
     {
-      GlyphMetrics m;
-
-      q->m_render = render;
-      FASTUIDRAWassert(!q->m_glyph_data);
-      m = fetch_glyph_metrics(font, glyph_code);
-      q->m_metrics = static_cast<GlyphMetricsPrivate*>(m.m_d);
-      q->m_glyph_data = font->compute_rendering_data(q->m_render, m,
-						     q->m_path, q->m_render_size);
+      /* generate the rendering data without holding the lock
+       * so that other threads can fetch (and generate) other
+       * glyphs concurrently.
+       */
+      lock.unlock();
+      q->generate_rendering_data(metrics);
+      lock.lock();
+      d->mark_generated(make_c_array(to_generate));
+    }
+  else
+    {
+      d->wait_generated(lock, q);
     }
 
   if (upload_to_atlas)
     {
+      d->ready_upload(lock, q, GlyphMetrics(q->m_metrics));
+
       GlyphAtlasProxy S(q);
       GlyphAttribute::Array T(&q->m_attributes);
-      q->upload_to_atlas(GlyphMetrics(q->m_metrics), S, T);
+      q->upload_to_atlas(S, T);
     }
 
   return Glyph(q);
@@ -931,44 +1977,173 @@ fetch_glyphs(GlyphRenderer render,
   GlyphCachePrivate *d;
   d = static_cast<GlyphCachePrivate*>(m_d);
 
-  std::lock_guard<std::mutex> m(d->m_glyphs_mutex);
+  std::vector<GlyphDataPrivate*> to_generate, to_wait;
+  std::unique_lock<std::mutex> lock(d->m_glyphs_mutex);
+
+  /* first pass: reserve an entry for each glyph, glyphs
+   * that need generation are marked as in-flight.
+   */
   for(unsigned int i = 0; i < glyph_metrics.size(); ++i)
     {
       if (glyph_metrics[i].valid())
         {
-          glyph_key src(glyph_metrics[i].font().get(),
-			glyph_metrics[i].glyph_code(),
-			render);
           GlyphDataPrivate *q;
 
-          q = d->m_glyphs.fetch_or_allocate(d, src);
-          if (!q->m_render.valid())
-            {
-              GlyphMetrics m(glyph_metrics[i]);
+          q = d->fetch_or_reserve(render,
+                                  static_cast<GlyphMetricsPrivate*>(glyph_metrics[i].m_d),
+                                  to_generate);
+          d->mark_used(q);
+          out_glyphs[i] = Glyph(q);
+        }
+      else
+        {
+          out_glyphs[i] = Glyph();
+        }
+    }
 
-              q->m_render = render;
-              FASTUIDRAWassert(!q->m_glyph_data);
-              q->m_metrics = static_cast<GlyphMetricsPrivate*>(m.m_d);
-              q->m_glyph_data = src.m_font->compute_rendering_data(q->m_render, m,
-								   q->m_path, q->m_render_size);
-            }
+  /* second pass: generate the rendering data of those glyphs
+   * this call reserved without holding the lock; the glyphs
+   * are generated in parallel if there is a generation pool.
+   */
+  if (!to_generate.empty())
+    {
+      std::shared_ptr<detail::WorkerPool> pool;
+
+      /* a thread of a WorkerPool (i.e. one executing the
+       * task of a prefetch()) does not use the generation
+       * pool since its reference might be the last one to
+       * the pool on which it executes.
+       */
+      if (!detail::WorkerPool::executing_task())
+        {
+          pool = d->m_generation_pool;
+        }
 
-          if (upload_to_atlas)
+      lock.unlock();
+      if (pool && to_generate.size() > 1)
+        {
+          pool->parallel_for(to_generate.size(),
+                             [&to_generate](unsigned int i)
+                             {
+                               GlyphDataPrivate *q(to_generate[i]);
+                               q->generate_rendering_data(GlyphMetrics(q->m_metrics));
+                             });
+        }
+      else
+        {
+          for (GlyphDataPrivate *q : to_generate)
             {
-	      GlyphAtlasProxy S(q);
-	      GlyphAttribute::Array T(&q->m_attributes);
-              q->upload_to_atlas(GlyphMetrics(q->m_metrics), S, T);
+              q->generate_rendering_data(GlyphMetrics(q->m_metrics));
             }
+        }
+      lock.lock();
+      d->mark_generated(make_c_array(to_generate));
+    }
 
-          out_glyphs[i] = Glyph(q);
+  /* last pass: upload the glyphs that are ready and only
+   * then wait on (and upload) any glyphs that other threads
+   * are still generating.
+   */
+  for(unsigned int i = 0; i < out_glyphs.size(); ++i)
+    {
+      GlyphDataPrivate *q;
+
+      q = static_cast<GlyphDataPrivate*>(out_glyphs[i].m_opaque);
+      if (q && q->m_in_flight)
+        {
+          to_wait.push_back(q);
         }
-      else
+      else if (q && upload_to_atlas)
         {
-          out_glyphs[i] = Glyph();
+          d->ready_upload(lock, q, GlyphMetrics(q->m_metrics));
+
+          GlyphAtlasProxy S(q);
+          GlyphAttribute::Array T(&q->m_attributes);
+          q->upload_to_atlas(S, T);
+        }
+    }
+
+  for (GlyphDataPrivate *q : to_wait)
+    {
+      d->wait_generated(lock, q);
+      if (upload_to_atlas)
+        {
+          d->ready_upload(lock, q, GlyphMetrics(q->m_metrics));
+
+          GlyphAtlasProxy S(q);
+          GlyphAttribute::Array T(&q->m_attributes);
+          q->upload_to_atlas(S, T);
         }
     }
 }
 
+fastuidraw::reference_counted_ptr<const fastuidraw::GlyphCache::PrefetchHandle>
+fastuidraw::GlyphCache::
+prefetch(GlyphRenderer render, const FontBase *font,
+         c_array<const uint32_t> glyph_codes)
+{
+  /* number of glyphs generated by a single task; small enough
+   * that the tasks of a prefetch spread across the threads and
+   * large enough that the locking of a task is amortized.
+   */
+  enum
+    {
+      glyphs_per_task = 16
+    };
+
+  GlyphCachePrivate *d;
+  reference_counted_ptr<PrefetchHandle> handle;
+  PrefetchHandlePrivate *handle_d;
+
+  d = static_cast<GlyphCachePrivate*>(m_d);
+  handle = FASTUIDRAWnew PrefetchHandle(glyph_codes.size());
+  handle_d = static_cast<PrefetchHandlePrivate*>(handle->m_d);
+
+  if (glyph_codes.empty())
+    {
+      return handle;
+    }
+
+  if (!font || !font->can_create_rendering_data(render.m_type))
+    {
+      handle_d->mark_done(glyph_codes.size());
+      return handle;
+    }
+
+  std::shared_ptr<detail::WorkerPool> pool;
+  std::shared_ptr<std::vector<uint32_t> > codes;
+  reference_counted_ptr<const FontBase> font_ref(font);
+  unsigned int num_glyphs(glyph_codes.size()), num_tasks;
+
+  codes = std::make_shared<std::vector<uint32_t> >(glyph_codes.begin(), glyph_codes.end());
+  num_tasks = (num_glyphs + glyphs_per_task - 1u) / glyphs_per_task;
+  {
+    std::lock_guard<std::mutex> m(d->m_glyphs_mutex);
+    pool = d->m_generation_pool;
+    d->m_number_prefetch_tasks += num_tasks;
+  }
+
+  if (!pool)
+    {
+      pool = detail::WorkerPool::shared(t_max(1u, detail::WorkerPool::default_number_threads()));
+    }
+
+  for (unsigned int t = 0, begin = 0; t < num_tasks; ++t, begin += glyphs_per_task)
+    {
+      unsigned int cnt;
+
+      cnt = t_min(static_cast<unsigned int>(glyphs_per_task), num_glyphs - begin);
+      pool->add_task([d, render, font_ref, codes, begin, cnt, handle]()
+                     {
+                       c_array<const uint32_t> C(make_c_array(*codes));
+                       d->execute_prefetch(render, font_ref.get(), C.sub_array(begin, cnt),
+                                           static_cast<PrefetchHandlePrivate*>(handle->m_d));
+                     });
+    }
+
+  return handle;
+}
+
 enum fastuidraw::return_code
 fastuidraw::GlyphCache::
 add_glyph(Glyph glyph, bool upload_to_atlas)
@@ -989,15 +2164,18 @@ add_glyph(Glyph glyph, bool upload_to_atlas)
       return routine_fail;
     }
 
-  std::lock_guard<std::mutex> m(d->m_glyphs_mutex);
+  std::unique_lock<std::mutex> lock(d->m_glyphs_mutex);
   if (g->m_cache)
     {
+      d->mark_used(g);
       /* already part of this cache, upload if necessary */
       if (upload_to_atlas)
         {
-	  GlyphAtlasProxy S(g);
-	  GlyphAttribute::Array T(&g->m_attributes);
-	  g->upload_to_atlas(GlyphMetrics(g->m_metrics), S, T);
+          d->ready_upload(lock, g, GlyphMetrics(g->m_metrics));
+
+          GlyphAtlasProxy S(g);
+          GlyphAttribute::Array T(&g->m_attributes);
+          g->upload_to_atlas(S, T);
         }
       return routine_success;
     }
@@ -1006,24 +2184,34 @@ add_glyph(Glyph glyph, bool upload_to_atlas)
 		g->m_metrics->m_glyph_code,
 		g->m_render);
 
-  std::lock_guard<std::mutex> m2(d->m_glyphs_metrics_mutex);
-
-  /* Take the metrics if we can */
-  glyph_metrics_key metrics_src(g->m_metrics->m_font.get(),
-				g->m_metrics->m_glyph_code);
-  d->m_glyph_metrics.take(g->m_metrics, d, metrics_src);
-
-  /* take the glyph */
-  if (d->m_glyphs.take(g, d, src) == routine_fail)
-    {
-      return routine_fail;
-    }
+  {
+    /* ready_upload() may release m_glyphs_mutex, thus
+     * m_glyphs_metrics_mutex is released before it.
+     */
+    std::lock_guard<std::mutex> m2(d->m_glyphs_metrics_mutex);
+
+    /* Take the metrics if we can */
+    glyph_metrics_key metrics_src(g->m_metrics->m_font.get(),
+                                  g->m_metrics->m_glyph_code);
+    d->m_glyph_metrics.take(g->m_metrics, d, metrics_src);
+
+    /* take the glyph */
+    if (d->m_glyphs.take(g, d, src) == routine_fail)
+      {
+        return routine_fail;
+      }
+  }
+  d->m_path_bytes += g->m_path_bytes;
+  d->m_render_data_bytes += g->m_render_data_bytes;
+  d->mark_used(g);
 
   if (upload_to_atlas)
     {
+      d->ready_upload(lock, g, GlyphMetrics(g->m_metrics));
+
       GlyphAtlasProxy S(g);
       GlyphAttribute::Array T(&g->m_attributes);
-      g->upload_to_atlas(GlyphMetrics(g->m_metrics), S, T);
+      g->upload_to_atlas(S, T);
     }
 
   return routine_success;
@@ -1045,7 +2233,8 @@ delete_glyph(Glyph G)
   glyph_key src(g->m_metrics->m_font.get(),
 		g->m_metrics->m_glyph_code,
 		g->m_render);
-  std::lock_guard<std::mutex> m(d->m_glyphs_mutex);
+  std::unique_lock<std::mutex> lock(d->m_glyphs_mutex);
+  d->wait_generated(lock, g);
   d->m_glyphs.remove_value(src);
 }
 
@@ -1066,7 +2255,13 @@ clear_atlas(void)
        */
       g->m_uploaded_to_atlas = false;
       g->m_data_locations.clear();
+      g->m_attributes.clear();
+      g->m_total_allocated = 0;
     }
+  d->m_lru.clear();
+  d->m_release_lru.clear();
+  d->m_compaction_pending.clear();
+  d->m_compaction_pending_size = 0;
 }
 
 void
@@ -1076,11 +2271,23 @@ clear_cache(void)
   GlyphCachePrivate *d;
   d = static_cast<GlyphCachePrivate*>(m_d);
 
-  std::lock_guard<std::mutex> m1(d->m_glyphs_mutex);
+  std::unique_lock<std::mutex> m1(d->m_glyphs_mutex);
+
+  /* entries that are in flight are written to without
+   * the lock held, so wait for all of them to complete.
+   */
+  d->m_glyphs_cv.wait(m1, [d] { return d->m_number_in_flight == 0; });
+
   std::lock_guard<std::mutex> m2(d->m_glyphs_metrics_mutex);
-  d->m_atlas->clear();
+  /* clear the glyphs before the atlas so that the
+   * glyphs release their blocks from the allocator
+   * that the atlas is about to reset.
+   */
   d->m_glyphs.clear();
   d->m_glyph_metrics.clear();
+  d->m_compaction_pending.clear();
+  d->m_compaction_pending_size = 0;
+  d->m_atlas->clear();
 }
 
 unsigned int
@@ -1091,10 +2298,476 @@ number_times_atlas_cleared(void)
    * is to allow for classes that have derived
    * data from glyph locations in an atlas, to
    * know that the data needs to be regenerated.
+   * An eviction or compaction pass also changes glyph
+   * locations, so they are counted as well, as are the
+   * retries of failed uploads by advance_epoch().
    */
   GlyphCachePrivate *d;
   d = static_cast<GlyphCachePrivate*>(m_d);
-  return d->m_atlas->number_times_cleared();
+  return d->m_atlas->number_times_cleared()
+    + d->m_number_eviction_passes
+    + d->m_number_compaction_passes
+    + d->m_number_retry_passes;
+}
+
+void
+fastuidraw::GlyphCache::
+advance_epoch(void)
+{
+  GlyphCachePrivate *d;
+  d = static_cast<GlyphCachePrivate*>(m_d);
+
+  std::unique_lock<std::mutex> lock(d->m_glyphs_mutex);
+
+  /* retry the uploads that failed while the atlas resources
+   * were locked, since the data of the glyphs evicted for them
+   * was not yet freed; this is done before the epoch advances
+   * so that the retries do not evict the glyphs of the epoch
+   * that ends.
+   */
+  if (!d->m_failed_uploads.empty() && !d->m_atlas->resources_locked())
+    {
+      std::vector<GlyphDataPrivate*> failed;
+      bool any_uploaded(false);
+
+      failed.swap(d->m_failed_uploads);
+      for (GlyphDataPrivate *q : failed)
+        {
+          /* the glyph may have been uploaded or cleared since */
+          if (!q->m_upload_failed)
+            {
+              continue;
+            }
+
+          /* another thread is generating the glyph, it will
+           * be uploaded by that thread or by the next retry.
+           */
+          if (q->m_in_flight)
+            {
+              d->m_failed_uploads.push_back(q);
+              continue;
+            }
+
+          q->m_upload_failed = false;
+          if (q->m_last_use_epoch != d->m_current_epoch)
+            {
+              /* the glyph is not used by the epoch that ends,
+               * it is uploaded the next time it is fetched.
+               */
+              continue;
+            }
+
+          d->ready_upload(lock, q, GlyphMetrics(q->m_metrics));
+
+          GlyphAtlasProxy S(q);
+          GlyphAttribute::Array T(&q->m_attributes);
+          if (q->upload_to_atlas(S, T) == routine_success)
+            {
+              any_uploaded = true;
+            }
+        }
+
+      if (any_uploaded)
+        {
+          ++d->m_number_retry_passes;
+        }
+    }
+
+  ++d->m_current_epoch;
+
+  /* the glyphs used in the previous epoch can now be released */
+  d->enforce_cpu_byte_budget();
+}
+
+unsigned int
+fastuidraw::GlyphCache::
+epoch(void) const
+{
+  GlyphCachePrivate *d;
+  d = static_cast<GlyphCachePrivate*>(m_d);
+  return d->m_current_epoch;
+}
+
+void
+fastuidraw::GlyphCache::
+mark_glyphs_used(c_array<const Glyph> glyphs)
+{
+  GlyphCachePrivate *d;
+  d = static_cast<GlyphCachePrivate*>(m_d);
+
+  std::lock_guard<std::mutex> m(d->m_glyphs_mutex);
+  for (const Glyph &G : glyphs)
+    {
+      GlyphDataPrivate *q;
+
+      q = static_cast<GlyphDataPrivate*>(G.m_opaque);
+      if (q && q->m_cache == d && q->m_render.valid())
+        {
+          d->mark_used(q);
+        }
+    }
+}
+
+void
+fastuidraw::GlyphCache::
+atlas_byte_budget(unsigned int v)
+{
+  GlyphCachePrivate *d;
+  d = static_cast<GlyphCachePrivate*>(m_d);
+  d->m_atlas_byte_budget = v;
+}
+
+unsigned int
+fastuidraw::GlyphCache::
+atlas_byte_budget(void) const
+{
+  GlyphCachePrivate *d;
+  d = static_cast<GlyphCachePrivate*>(m_d);
+  return d->m_atlas_byte_budget;
+}
+
+unsigned int
+fastuidraw::GlyphCache::
+number_glyphs_evicted(void) const
+{
+  GlyphCachePrivate *d;
+  d = static_cast<GlyphCachePrivate*>(m_d);
+  return d->m_number_glyphs_evicted;
+}
+
+unsigned int
+fastuidraw::GlyphCache::
+number_eviction_passes(void) const
+{
+  GlyphCachePrivate *d;
+  d = static_cast<GlyphCachePrivate*>(m_d);
+  return d->m_number_eviction_passes;
+}
+
+unsigned int
+fastuidraw::GlyphCache::
+compact_atlas(unsigned int max_count)
+{
+  GlyphCachePrivate *d;
+  d = static_cast<GlyphCachePrivate*>(m_d);
+
+  std::unique_lock<std::mutex> lock(d->m_glyphs_mutex);
+
+  /* the glyphs whose data is at the highest locations are
+   * moved first, each to below its lowest location.
+   */
+  std::vector<std::pair<int, GlyphDataPrivate*> > candidates;
+  for (GlyphDataPrivate *q : d->m_lru)
+    {
+      int L(-1);
+
+      if (q->m_in_flight)
+        {
+          continue;
+        }
+
+      for (const GlyphDataAlloc &A : q->m_data_locations)
+        {
+          L = (L == -1) ? A.m_location : t_min(L, A.m_location);
+        }
+      if (L != -1)
+        {
+          candidates.push_back(std::make_pair(L, q));
+        }
+    }
+  std::sort(candidates.begin(), candidates.end(),
+            [](const std::pair<int, GlyphDataPrivate*> &a,
+               const std::pair<int, GlyphDataPrivate*> &b)
+            {
+              return a.first > b.first;
+            });
+
+  /* move the glyphs for which there is room below them;
+   * the data of a glyph with relocatable attributes is
+   * copied within the atlas, the other glyphs are marked
+   * as in flight so that their rendering data can be
+   * regenerated without the lock held.
+   */
+  std::vector<std::pair<int, GlyphDataPrivate*> > to_move;
+  unsigned int selected(0), moved(0);
+  for (const auto &c : candidates)
+    {
+      GlyphDataPrivate *q(c.second);
+      int largest(0), F;
+
+      if (selected >= max_count)
+        {
+          break;
+        }
+
+      for (const GlyphDataAlloc &A : q->m_data_locations)
+        {
+          largest = t_max(largest, A.m_size);
+        }
+      F = d->m_atlas->lowest_free_location(largest);
+      if (F < 0 || F + largest > c.first)
+        {
+          continue;
+        }
+
+      if (d->move_glyph_by_copy(q, c.first))
+        {
+          selected += q->m_total_allocated;
+          moved += q->m_total_allocated;
+          continue;
+        }
+
+      q->m_in_flight = true;
+      ++d->m_number_in_flight;
+      selected += q->m_total_allocated;
+      to_move.push_back(c);
+    }
+
+  std::vector<GlyphRenderData*> move_data(to_move.size(), nullptr);
+  lock.unlock();
+  for (unsigned int i = 0; i < to_move.size(); ++i)
+    {
+      Path path;
+      vec2 render_size;
+
+      move_data[i] = to_move[i].second->compute_rendering_data(GlyphMetrics(to_move[i].second->m_metrics),
+                                                               path, render_size);
+    }
+  lock.lock();
+
+  for (unsigned int i = 0; i < to_move.size(); ++i)
+    {
+      GlyphDataPrivate *q(to_move[i].second);
+      int L(-1);
+
+      q->m_in_flight = false;
+      --d->m_number_in_flight;
+
+      /* the glyph may have been evicted or the atlas cleared
+       * while its data was generated, and generating its data
+       * may have failed.
+       */
+      for (const GlyphDataAlloc &A : q->m_data_locations)
+        {
+          L = (L == -1) ? A.m_location : t_min(L, A.m_location);
+        }
+
+      if (move_data[i] && q->m_uploaded_to_atlas && L == to_move[i].first)
+        {
+          GlyphAtlasProxyPrivate new_data(d);
+          std::vector<GlyphAttribute> new_attributes;
+          std::vector<float> costs(move_data[i]->render_info_labels().size(), 0.0f);
+          GlyphAtlasProxy S(&new_data);
+          GlyphAttribute::Array T(&new_attributes);
+          enum return_code R;
+
+          d->m_relocation_bound = L;
+          R = move_data[i]->upload_to_atlas(S, T, make_c_array(costs));
+          d->m_relocation_bound = -1;
+
+          /* on success keep the old locations until the batch
+           * of moves ends, on failure release what was allocated
+           * of the new ones. The attributes are rewritten in place
+           * because the arrays returned by Glyph::attributes()
+           * point to them.
+           */
+          if (R == routine_success && new_attributes.size() == q->m_attributes.size())
+            {
+              std::swap(q->m_data_locations, new_data.m_data_locations);
+              std::swap(q->m_relocatable_attributes, new_data.m_relocatable_attributes);
+              std::copy(new_attributes.begin(), new_attributes.end(), q->m_attributes.begin());
+              moved += q->m_total_allocated;
+              for (const GlyphDataAlloc &A : new_data.m_data_locations)
+                {
+                  d->m_compaction_pending.push_back(A);
+                  d->m_compaction_pending_size += A.m_size;
+                }
+            }
+          else
+            {
+              for (const GlyphDataAlloc &A : new_data.m_data_locations)
+                {
+                  d->m_atlas->deallocate_data(A.m_location, A.m_size);
+                }
+            }
+        }
+
+      if (move_data[i])
+        {
+          FASTUIDRAWdelete(move_data[i]);
+        }
+    }
+  d->m_glyphs_cv.notify_all();
+
+  if (moved == 0 || d->m_compaction_pending_size >= d->m_atlas->data_allocated() / 8u)
+    {
+      d->flush_compaction();
+    }
+  return moved;
+}
+
+unsigned int
+fastuidraw::GlyphCache::
+number_compaction_passes(void) const
+{
+  GlyphCachePrivate *d;
+  d = static_cast<GlyphCachePrivate*>(m_d);
+  return d->m_number_compaction_passes;
+}
+
+void
+fastuidraw::GlyphCache::
+cpu_byte_budget(unsigned int v)
+{
+  GlyphCachePrivate *d;
+  d = static_cast<GlyphCachePrivate*>(m_d);
+
+  std::lock_guard<std::mutex> m(d->m_glyphs_mutex);
+  d->m_cpu_byte_budget = v;
+  d->enforce_cpu_byte_budget();
+}
+
+unsigned int
+fastuidraw::GlyphCache::
+cpu_byte_budget(void) const
+{
+  GlyphCachePrivate *d;
+  d = static_cast<GlyphCachePrivate*>(m_d);
+  return d->m_cpu_byte_budget;
+}
+
+fastuidraw::GlyphCache::Statistics
+fastuidraw::GlyphCache::
+statistics(void) const
+{
+  GlyphCachePrivate *d;
+  Statistics return_value;
+
+  d = static_cast<GlyphCachePrivate*>(m_d);
+  return_value.m_atlas_bytes = sizeof(generic_data) * d->m_atlas->data_allocated();
+  return_value.m_atlas_store_bytes = sizeof(generic_data) * d->m_atlas->store()->size();
+  return_value.m_atlas_largest_free_block_bytes = sizeof(generic_data) * d->m_atlas->largest_free_block();
+  return_value.m_atlas_number_free_blocks = d->m_atlas->number_free_blocks();
+  return_value.m_atlas_fragmentation = d->m_atlas->fragmentation();
+  return_value.m_number_generated = d->m_number_generated;
+  return_value.m_generation_time_us = d->m_generation_time_us;
+
+  std::lock_guard<std::mutex> m(d->m_glyphs_mutex);
+  for (const GlyphDataPrivate *q : d->m_glyphs.data())
+    {
+      /* glyphs in flight that are generated for the first time
+       * are not yet counted in m_path_bytes and m_render_data_bytes,
+       * so they are not counted here either; glyphs in flight because
+       * their path is recreated (they are released), because they
+       * are moved by compact_atlas() (they are uploaded) or because
+       * their rendering data is regenerated for an upload are counted.
+       */
+      if (!q->m_render.valid()
+          || (q->m_in_flight && !q->m_released
+              && !q->m_uploaded_to_atlas && !q->m_regenerating))
+        {
+          continue;
+        }
+
+      if (q->m_render.m_type < return_value.m_number_glyphs.size())
+        {
+          ++return_value.m_number_glyphs[q->m_render.m_type];
+        }
+      if (q->m_uploaded_to_atlas)
+        {
+          ++return_value.m_number_glyphs_uploaded;
+        }
+      if (q->m_released)
+        {
+          ++return_value.m_number_glyphs_released;
+        }
+    }
+  return_value.m_path_bytes = d->m_path_bytes;
+  return_value.m_render_data_bytes = d->m_render_data_bytes;
+  return_value.m_number_hits = d->m_number_hits;
+  return_value.m_number_misses = d->m_number_misses;
+
+  return return_value;
+}
+
+void
+fastuidraw::GlyphCache::
+number_generation_threads(unsigned int v)
+{
+  GlyphCachePrivate *d;
+  std::shared_ptr<detail::WorkerPool> pool;
+
+  d = static_cast<GlyphCachePrivate*>(m_d);
+  if (v > 0)
+    {
+      pool = std::make_shared<detail::WorkerPool>(v);
+    }
+
+  std::lock_guard<std::mutex> m(d->m_glyphs_mutex);
+  d->m_generation_pool.swap(pool);
+}
+
+unsigned int
+fastuidraw::GlyphCache::
+number_generation_threads(void) const
+{
+  GlyphCachePrivate *d;
+  d = static_cast<GlyphCachePrivate*>(m_d);
+
+  std::lock_guard<std::mutex> m(d->m_glyphs_mutex);
+  return (d->m_generation_pool) ?
+    d->m_generation_pool->number_threads() :
+    0u;
+}
+
+unsigned int
+fastuidraw::GlyphCache::
+default_number_generation_threads(void)
+{
+  return detail::WorkerPool::default_number_threads();
+}
+
+void
+fastuidraw::GlyphCache::
+disk_cache_directory(c_string directory)
+{
+  GlyphCachePrivate *d;
+  std::shared_ptr<detail::GlyphDiskCache> disk_cache;
+
+  d = static_cast<GlyphCachePrivate*>(m_d);
+  if (directory && directory[0])
+    {
+      disk_cache = std::make_shared<detail::GlyphDiskCache>(directory);
+    }
+
+  std::lock_guard<std::mutex> m(d->m_disk_cache_mutex);
+  d->m_disk_cache.swap(disk_cache);
+}
+
+fastuidraw::c_string
+fastuidraw::GlyphCache::
+disk_cache_directory(void) const
+{
+  GlyphCachePrivate *d;
+  d = static_cast<GlyphCachePrivate*>(m_d);
+
+  std::lock_guard<std::mutex> m(d->m_disk_cache_mutex);
+  return (d->m_disk_cache) ?
+    d->m_disk_cache->directory().c_str() :
+    nullptr;
+}
+
+unsigned int
+fastuidraw::GlyphCache::
+number_disk_cache_hits(void) const
+{
+  GlyphCachePrivate *d;
+  d = static_cast<GlyphCachePrivate*>(m_d);
+
+  std::lock_guard<std::mutex> m(d->m_disk_cache_mutex);
+  return (d->m_disk_cache) ?
+    d->m_disk_cache->number_hits() :
+    0u;
 }
 
 fastuidraw::GlyphCache::AllocationHandle
@@ -1127,3 +2800,82 @@ deallocate_data(AllocationHandle h)
       d->m_atlas->deallocate_data(h.m_location, h.m_size);
     }
 }
+
+////////////////////////////////////////////////////
+// fastuidraw::GlyphCache::Statistics methods
+fastuidraw::GlyphCache::Statistics::
+Statistics(void):
+  m_number_glyphs(0u),
+  m_number_glyphs_uploaded(0),
+  m_number_glyphs_released(0),
+  m_render_data_bytes(0),
+  m_path_bytes(0),
+  m_atlas_bytes(0),
+  m_atlas_store_bytes(0),
+  m_atlas_largest_free_block_bytes(0),
+  m_atlas_number_free_blocks(0),
+  m_atlas_fragmentation(0.0f),
+  m_number_hits(0),
+  m_number_misses(0),
+  m_number_generated(0),
+  m_generation_time_us(0)
+{}
+
+////////////////////////////////////////////////////
+// fastuidraw::GlyphCache::PrefetchHandle methods
+fastuidraw::GlyphCache::PrefetchHandle::
+PrefetchHandle(unsigned int number_glyphs)
+{
+  m_d = FASTUIDRAWnew PrefetchHandlePrivate(number_glyphs);
+}
+
+fastuidraw::GlyphCache::PrefetchHandle::
+~PrefetchHandle()
+{
+  PrefetchHandlePrivate *d;
+  d = static_cast<PrefetchHandlePrivate*>(m_d);
+  FASTUIDRAWdelete(d);
+  m_d = nullptr;
+}
+
+unsigned int
+fastuidraw::GlyphCache::PrefetchHandle::
+number_glyphs(void) const
+{
+  PrefetchHandlePrivate *d;
+  d = static_cast<PrefetchHandlePrivate*>(m_d);
+  return d->m_number_glyphs;
+}
+
+unsigned int
+fastuidraw::GlyphCache::PrefetchHandle::
+number_glyphs_done(void) const
+{
+  PrefetchHandlePrivate *d;
+  d = static_cast<PrefetchHandlePrivate*>(m_d);
+
+  std::lock_guard<std::mutex> m(d->m_mutex);
+  return d->m_number_glyphs_done;
+}
+
+bool
+fastuidraw::GlyphCache::PrefetchHandle::
+ready(void) const
+{
+  PrefetchHandlePrivate *d;
+  d = static_cast<PrefetchHandlePrivate*>(m_d);
+
+  std::lock_guard<std::mutex> m(d->m_mutex);
+  return d->m_number_glyphs_done == d->m_number_glyphs;
+}
+
+void
+fastuidraw::GlyphCache::PrefetchHandle::
+wait(void) const
+{
+  PrefetchHandlePrivate *d;
+  d = static_cast<PrefetchHandlePrivate*>(m_d);
+
+  std::unique_lock<std::mutex> m(d->m_mutex);
+  d->m_cv.wait(m, [d] { return d->m_number_glyphs_done == d->m_number_glyphs; });
+}
@@ -19,8 +19,6 @@
 
 #include <vector>
 #include <algorithm>
-#include <set>
-#include <map>
 #include <cstdlib>
 #include <mutex>
 #include <fstream>
@@ -29,8 +27,14 @@
 #include <fastuidraw/text/glyph_generate_params.hpp>
 #include <fastuidraw/text/glyph_render_data_banded_rays.hpp>
 #include "../private/bounding_box.hpp"
+#include "../private/byte_stream.hpp"
 #include "../private/util_private.hpp"
 #include "../private/util_private_ostream.hpp"
+#include "../private/flat_hash_index.hpp"
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
 
 namespace
 {
@@ -54,6 +58,23 @@ namespace
     return fp16.x() | (fp16.y() << 16u);
   }
 
+  /* pack the value of a band from the number of curves
+   * and the offset (relative to base) of its curve list
+   */
+  uint32_t
+  pack_band_value(fastuidraw::uvec2 list, uint32_t base)
+  {
+    using namespace fastuidraw;
+    typedef GlyphRenderDataBandedRays G;
+
+    return pack_bits(G::band_numcurves_bit0,
+                     G::band_numcurves_numbits,
+                     list.x())
+      | pack_bits(G::band_curveoffset_bit0,
+                  G::band_curveoffset_numbits,
+                  list.y() + base);
+  }
+
   bool
   is_flat(float a, float b, float c)
   {
@@ -141,44 +162,6 @@ namespace
       return m_control;
     }
 
-    template<enum band_t b>
-    bool
-    intersects_band(float min_v, float max_v) const
-    {
-      /* band_t made cleverly so that we just check
-       * against [b] for the values on band interection
-       */
-      bool min_culls, max_culls;
-
-      min_culls = (m_start[b] < min_v) && (m_end[b] < min_v)
-        && (m_control[b] < min_v);
-
-      max_culls = (m_start[b] > max_v) && (m_end[b] > max_v)
-        && (m_control[b] > max_v);
-
-      return !(min_culls || max_culls);
-    }
-
-    template<enum band_t b>
-    bool
-    present_before_split(float split_v) const
-    {
-      /* for splitting, we check the coord 1 - b. */
-      const int c(1 - b);
-      return (m_start[c] <= split_v) || (m_end[c] <= split_v)
-        || (m_control[c] <= split_v);
-    }
-
-    template<enum band_t b>
-    bool
-    present_after_split(float split_v) const
-    {
-      /* for splitting, we check the coord 1 - b. */
-      const int c(1 - b);
-      return (m_start[c] >= split_v) || (m_end[c] >= split_v)
-        || (m_control[c] >= split_v);
-    }
-
     float
     min_coordinate(int coord) const
     {
@@ -210,18 +193,6 @@ namespace
     bool m_is_horizontal, m_is_vertical;
   };
 
-  class CurveID
-  {
-  public:
-    unsigned int& contour(void) { return m_ID.x(); }
-    unsigned int& curve(void) { return m_ID.y(); }
-    unsigned int contour(void) const { return m_ID.x(); }
-    unsigned int curve(void) const { return m_ID.y(); }
-    bool operator<(const CurveID &rhs) const { return m_ID < rhs.m_ID; }
-  private:
-    fastuidraw::uvec2 m_ID;
-  };
-
   class Contour
   {
   public:
@@ -287,81 +258,193 @@ namespace
     std::vector<Curve> m_curves;
   };
 
-  template<enum band_t BandType>
-  class CurveListHoard:fastuidraw::noncopyable
+  /* The values of the curves of a GlyphPath needed to build
+   * the bands of one band_t, a curve is referred to by its
+   * index when walking the curves of the contours in order.
+   * The values are held in arrays so that the loops of the
+   * band construction walk contiguous memory instead of
+   * going through Curve objects.
+   */
+  class BandCurves
   {
   public:
-    uint32_t
-    fetch_curve_list_offset(const std::vector<CurveID> &p, uint32_t &value);
-
+    template<enum band_t BandType>
     void
-    pack_curves(const GlyphPath &path,
-                fastuidraw::c_array<fastuidraw::generic_data> dst) const;
+    set(const GlyphPath &path);
+
+    /* range of each curve in the coordinate of the band */
+    std::vector<float> m_min_band, m_max_band;
+
+    /* amount each curve contributes to the average curve
+     * coverage of a band when in the curve list before and
+     * after the split, see Band::compute_average_curve_coverage()
+     */
+    std::vector<float> m_before_coverage, m_after_coverage;
+
+    /* the three packed points of each curve (see pack_point()) */
+    std::vector<uint32_t> m_packed;
+
+    /* the curves, not ignored by the band type, that are
+     * present before and after the split sorted as needed
+     * by the shader; because the curve lists of the bands
+     * are filtered from these lists in order, they are
+     * sorted as well and do not need to be sorted again.
+     */
+    std::vector<uint32_t> m_before_split, m_after_split;
 
   private:
-    std::map<std::vector<CurveID>, uint32_t> m_offsets;
+    std::vector<float> m_min_split, m_max_split;
   };
 
-  template<enum band_t BandType>
-  class Band
+  /* A CurveList is a range of the arrays of a CurveListArena */
+  class CurveList
   {
   public:
-    static
-    float
-    create_bands(std::vector<Band> *dst, const GlyphPath &path,
-                 unsigned int max_num_iterations, float avg_curve_thresh);
+    unsigned int
+    size(void) const
+    {
+      return m_end - m_begin;
+    }
+
+    unsigned int m_begin, m_end;
+  };
 
+  /* Holds the curve lists of the bands of one level of the
+   * subdivision into bands. Along with the index of each
+   * curve, its range in the band coordinate is copied so
+   * that dividing a band needs no indirection. The arrays
+   * are only grown, the number of elements used is m_size.
+   */
+  class CurveListArena
+  {
+  public:
     void
-    assign_curve_list_offset(CurveListHoard<BandType> &hoard, uint32_t &value)
+    reset(unsigned int capacity)
     {
-      m_before_split.assign_curve_list_offset(hoard, value);
-      m_after_split.assign_curve_list_offset(hoard, value);
+      m_size = 0;
+      if (m_curves.size() < capacity)
+        {
+          m_curves.resize(capacity);
+          m_min_band.resize(capacity);
+          m_max_band.resize(capacity);
+        }
     }
 
-    uint32_t
-    before_split_packed_band_value(void) const
+    unsigned int
+    allocate(unsigned int cnt)
     {
-      return m_before_split.pack_band_value();
+      unsigned int R(m_size);
+
+      m_size += cnt;
+      FASTUIDRAWassert(m_size <= m_curves.size());
+      return R;
     }
 
-    uint32_t
-    after_split_packed_band_value(void) const
+    fastuidraw::c_array<const uint32_t>
+    curves(CurveList L) const
     {
-      return m_after_split.pack_band_value();
+      return fastuidraw::make_c_array(m_curves).sub_array(L.m_begin, L.size());
     }
 
-  private:
-    class SubBand
-    {
-    public:
-      SubBand(void);
-      SubBand(const GlyphPath &path, const SubBand *parent,
-              float minv, float maxv);
+    std::vector<uint32_t> m_curves;
+    std::vector<float> m_min_band, m_max_band;
+    unsigned int m_size;
+  };
 
-      void
-      assign_curve_list_offset(CurveListHoard<BandType> &hoard, uint32_t &value);
+  class Band
+  {
+  public:
+    float
+    compute_average_curve_coverage(const CurveListArena &arena,
+                                   const BandCurves &curves) const;
 
-      uint32_t
-      pack_band_value(void) const;
+    /* Add to dst the two bands into which this band divides,
+     * with the curve lists filtered from the curve lists of
+     * this band in src.
+     */
+    void
+    divide(const CurveListArena &src, float slack,
+           std::vector<Band> *dst, CurveListArena *dst_arena) const;
 
-      std::vector<CurveID> m_curves;
-      uint32_t m_curve_list_offset;
-    };
+    float m_min_v, m_max_v;
+    CurveList m_before_split, m_after_split;
+  };
+
+  /* Key to find a curve list already added to the packed
+   * data of a glyph; the curves are not owned.
+   */
+  class CurveListKey
+  {
+  public:
+    CurveListKey(void):
+      m_hash(0)
+    {}
 
     explicit
-    Band(const GlyphPath &path);
+    CurveListKey(fastuidraw::c_array<const uint32_t> curves):
+      m_curves(curves),
+      m_hash(curves.size())
+    {
+      for (uint32_t c : curves)
+        {
+          m_hash = fastuidraw::detail::hash_mix(m_hash ^ c);
+        }
+    }
 
-    Band(const GlyphPath &path, const Band *parent, float min_v, float max_v);
+    bool
+    operator==(const CurveListKey &rhs) const
+    {
+      return m_hash == rhs.m_hash
+        && m_curves.size() == rhs.m_curves.size()
+        && std::equal(m_curves.begin(), m_curves.end(), rhs.m_curves.begin());
+    }
 
-    float
-    compute_average_curve_coverage(const GlyphPath &path) const;
+    uint64_t
+    hash(void) const
+    {
+      return m_hash;
+    }
 
-    void
-    divide(std::vector<Band> *dst, const GlyphPath &path, float slack) const;
+  private:
+    fastuidraw::c_array<const uint32_t> m_curves;
+    uint64_t m_hash;
+  };
 
-    float m_min_v, m_max_v;
-    SubBand m_before_split;
-    SubBand m_after_split;
+  /* Working memory for building the bands of a glyph; each
+   * thread has its own that is reused across the glyphs it
+   * builds, so that building the bands of a glyph does not
+   * allocate once the arrays are large enough.
+   */
+  class BandedRaysScratch:fastuidraw::noncopyable
+  {
+  public:
+    static
+    BandedRaysScratch&
+    thread_scratch(void)
+    {
+      static thread_local BandedRaysScratch R;
+      return R;
+    }
+
+    /* Build the bands of a band_t, returning the average number
+     * of curves per band. For each band, the (number of curves,
+     * offset) of the curve list after and then before the split
+     * are appended to band_lists; the offset is into curve_data,
+     * to which the packed points of the curves of each distinct
+     * list are appended.
+     */
+    template<enum band_t BandType>
+    float
+    create_bands(const GlyphPath &path,
+                 unsigned int max_num_iterations, float avg_curve_thresh,
+                 std::vector<fastuidraw::uvec2> *band_lists,
+                 std::vector<uint32_t> *curve_data);
+
+  private:
+    BandCurves m_curves;
+    CurveListArena m_arenas[2];
+    std::vector<Band> m_bands[2];
+    fastuidraw::detail::FlatHashIndex<CurveListKey> m_list_offsets;
   };
 
   class GlyphPath
@@ -408,12 +491,10 @@ namespace
       return m_contours[C].curves().size();
     }
 
-    const Curve&
-    curve(CurveID ID) const
+    const std::vector<Contour>&
+    contours(void) const
     {
-      FASTUIDRAWassert(ID.contour() < m_contours.size());
-      FASTUIDRAWassert(ID.curve() < m_contours[ID.contour()].curves().size());
-      return m_contours[ID.contour()].curves()[ID.curve()];
+      return m_contours;
     }
 
     unsigned int
@@ -434,76 +515,6 @@ namespace
     std::vector<Contour> m_contours;
   };
 
-  template<enum band_t BandType>
-  class SortCurvesCullAfterSplit
-  {
-  public:
-    explicit
-    SortCurvesCullAfterSplit(const GlyphPath &path):
-      m_path(path)
-    {}
-
-    bool
-    operator()(const Curve &lhs, const Curve &rhs) const
-    {
-      /* we want to quickly cull curves once we
-       * are far along when going in increasing.
-       * If we are at value V, we want to stop
-       * walking the array once we know all the
-       * following elements come completely before
-       * V. Thus we want those whose maximum
-       * coordinate is before V removed which
-       * means the sorting is that larger maximum
-       * values come first.
-       */
-      return lhs.max_coordinate(1 - BandType) > rhs.max_coordinate(1 - BandType);
-    }
-
-    bool
-    operator()(CurveID lhs, CurveID rhs) const
-    {
-      return operator()(m_path.curve(lhs), m_path.curve(rhs));
-    }
-
-  private:
-    const GlyphPath &m_path;
-  };
-
-  template<enum band_t BandType>
-  class SortCurvesCullBeforeSplit
-  {
-  public:
-    explicit
-    SortCurvesCullBeforeSplit(const GlyphPath &path):
-      m_path(path)
-    {}
-
-    bool
-    operator()(const Curve &lhs, const Curve &rhs) const
-    {
-      /* we want to quickly cull curves once we
-       * are far along when going in decreasing.
-       * If we are at value V, we want to stop
-       * walking the array once we know all the
-       * following elements come completely after
-       * V. Thus we want those whose minimum
-       * coordinate is after V removed which
-       * means the sorting is that smaller minimum
-       * values come first.
-       */
-      return lhs.min_coordinate(1 - BandType) < rhs.min_coordinate(1 - BandType);
-    }
-
-    bool
-    operator()(CurveID lhs, CurveID rhs) const
-    {
-      return operator()(m_path.curve(lhs), m_path.curve(rhs));
-    }
-
-  private:
-    const GlyphPath &m_path;
-  };
-
   enum
     {
       horizontal_band_avg_curve_count,
@@ -540,247 +551,330 @@ namespace
 
 
 /////////////////////////////////
-// CurveListHoard methods
-template<enum band_t BandType>
-uint32_t
-CurveListHoard<BandType>::
-fetch_curve_list_offset(const std::vector<CurveID> &p, uint32_t &value)
-{
-  std::map<std::vector<CurveID>, uint32_t>::iterator iter;
-  uint32_t offset;
-
-  iter = m_offsets.find(p);
-  if (iter == m_offsets.end())
-    {
-      offset = value;
-      value += 3 * p.size();
-      m_offsets[p] = offset;
-    }
-  else
-    {
-      offset = iter->second;
-    }
-  return offset;
-}
-
+// BandCurves methods
 template<enum band_t BandType>
 void
-CurveListHoard<BandType>::
-pack_curves(const GlyphPath &path,
-            fastuidraw::c_array<fastuidraw::generic_data> dst) const
+BandCurves::
+set(const GlyphPath &path)
 {
-  for (const auto &e : m_offsets)
+  const float edge(fastuidraw::GlyphRenderDataBandedRays::glyph_coord_value);
+  const int c(1 - BandType);
+  unsigned int N(path.total_number_curves()), I(0);
+
+  m_min_band.resize(N);
+  m_max_band.resize(N);
+  m_min_split.resize(N);
+  m_max_split.resize(N);
+  m_before_coverage.resize(N);
+  m_after_coverage.resize(N);
+  m_packed.resize(3 * N);
+  m_before_split.clear();
+  m_after_split.clear();
+
+  for (const Contour &contour : path.contours())
     {
-      unsigned int offset(e.second);
-      for (const CurveID &id : e.first)
+      for (const Curve &curve : contour.curves())
         {
-          const Curve &curve(path.curve(id));
-          dst[offset++].u = pack_point<BandType>(curve.start());
-          dst[offset++].u = pack_point<BandType>(curve.control());
-          dst[offset++].u = pack_point<BandType>(curve.end());
+          float v;
+
+          m_min_band[I] = curve.min_coordinate(BandType);
+          m_max_band[I] = curve.max_coordinate(BandType);
+          m_min_split[I] = curve.min_coordinate(c);
+          m_max_split[I] = curve.max_coordinate(c);
+
+          /* a curve after the split hits all the area
+           * between 0 and its maximum coordinate.
+           */
+          v = fastuidraw::t_min(edge, m_max_split[I]);
+          m_after_coverage[I] = fastuidraw::t_max(0.0f, v);
+
+          /* a curve before the split hits all the area
+           * between 0 and its minimum coordinate (which is negative!).
+           */
+          v = fastuidraw::t_min(edge, -m_min_split[I]);
+          m_before_coverage[I] = fastuidraw::t_max(0.0f, v);
+
+          m_packed[3 * I + 0] = pack_point<BandType>(curve.start());
+          m_packed[3 * I + 1] = pack_point<BandType>(curve.control());
+          m_packed[3 * I + 2] = pack_point<BandType>(curve.end());
+
+          if (!curve.ignore_curve(BandType))
+            {
+              /* a curve is present before (after) the split
+               * if any of its coordinates is at or before
+               * (after) the split which is at 0.0
+               */
+              if (m_min_split[I] <= 0.0f)
+                {
+                  m_before_split.push_back(I);
+                }
+
+              if (m_max_split[I] >= 0.0f)
+                {
+                  m_after_split.push_back(I);
+                }
+            }
+          ++I;
         }
     }
-}
 
-///////////////////////////////////////
-// Band::SubBand methods
-template<enum band_t BandType>
-Band<BandType>::SubBand::
-SubBand(void)
-{}
+  /* The shader walks the curves before the split in
+   * decreasing direction and wants to stop once all
+   * the following curves come completely after the
+   * current value, thus smaller minimum values come
+   * first. Likewise the shader walks the curves after
+   * the split in increasing direction, so larger
+   * maximum values come first. Ties are broken by the
+   * index of the curve so that the order is well
+   * defined.
+   */
+  std::sort(m_before_split.begin(), m_before_split.end(),
+            [this](uint32_t lhs, uint32_t rhs)
+            {
+              return m_min_split[lhs] < m_min_split[rhs]
+                || (m_min_split[lhs] == m_min_split[rhs] && lhs < rhs);
+            });
 
-template<enum band_t BandType>
-Band<BandType>::SubBand::
-SubBand(const GlyphPath &path, const SubBand *parent,
-        float minv, float maxv)
+  std::sort(m_after_split.begin(), m_after_split.end(),
+            [this](uint32_t lhs, uint32_t rhs)
+            {
+              return m_max_split[lhs] > m_max_split[rhs]
+                || (m_max_split[lhs] == m_max_split[rhs] && lhs < rhs);
+            });
+}
+
+///////////////////////////////
+// Band methods
+float
+Band::
+compute_average_curve_coverage(const CurveListArena &arena,
+                               const BandCurves &curves) const
 {
-  for (const CurveID &C : parent->m_curves)
+  const float edge(fastuidraw::GlyphRenderDataBandedRays::glyph_coord_value);
+  float curve_draw(0.0f);
+
+  for (uint32_t id : arena.curves(m_after_split))
     {
-      if (path.curve(C).intersects_band<BandType>(minv, maxv))
-        {
-          m_curves.push_back(C);
-        }
+      curve_draw += curves.m_after_coverage[id];
     }
+
+  for (uint32_t id : arena.curves(m_before_split))
+    {
+      curve_draw += curves.m_before_coverage[id];
+    }
+
+  return curve_draw / (2.0f * edge);
 }
 
-template<enum band_t BandType>
 void
-Band<BandType>::SubBand::
-assign_curve_list_offset(CurveListHoard<BandType> &hoard, uint32_t &value)
+Band::
+divide(const CurveListArena &src, float slack,
+       std::vector<Band> *dst, CurveListArena *dst_arena) const
 {
-  m_curve_list_offset = hoard.fetch_curve_list_offset(m_curves, value);
-}
+  float split(0.5 * (m_min_v + m_max_v));
+  Band B0, B1;
 
-template<enum band_t BandType>
-uint32_t
-Band<BandType>::SubBand::
-pack_band_value(void) const
-{
-  using namespace fastuidraw;
-  typedef GlyphRenderDataBandedRays G;
-
-  uint32_t v;
-  v = pack_bits(G::band_numcurves_bit0,
-                G::band_numcurves_numbits,
-                m_curves.size())
-    | pack_bits(G::band_curveoffset_bit0,
-                G::band_curveoffset_numbits,
-                m_curve_list_offset);
-  return v;
-}
+  /* we add a little slack around the band to capture
+   * curves that nearly touch the boundary of a band.
+   */
+  B0.m_min_v = m_min_v;
+  B0.m_max_v = split + slack;
+  B1.m_min_v = split - slack;
+  B1.m_max_v = m_max_v;
 
-///////////////////////////////
-// Band methods
-template<enum band_t BandType>
-Band<BandType>::
-Band(const GlyphPath &path):
-  m_min_v(-fastuidraw::GlyphRenderDataBandedRays::glyph_coord_value),
-  m_max_v(fastuidraw::GlyphRenderDataBandedRays::glyph_coord_value)
-{
-  CurveID ID;
-  unsigned int contour_end(path.num_contours());
+  const CurveList *src_lists[2] = { &m_before_split, &m_after_split };
+  CurveList *dst0_lists[2] = { &B0.m_before_split, &B0.m_after_split };
+  CurveList *dst1_lists[2] = { &B1.m_before_split, &B1.m_after_split };
 
-  for (ID.contour() = 0; ID.contour() < contour_end; ++ID.contour())
+  for (unsigned int L = 0; L < 2; ++L)
     {
-      unsigned int curve_end(path.num_curves(ID.contour()));
-
-      for (ID.curve() = 0; ID.curve() < curve_end; ++ID.curve())
+      const CurveList &S(*src_lists[L]);
+      unsigned int w0, w1, k(S.m_begin);
+      const float *lo(src.m_min_band.data());
+      const float *hi(src.m_max_band.data());
+      const uint32_t *ids(src.m_curves.data());
+      float *dst_lo(dst_arena->m_min_band.data());
+      float *dst_hi(dst_arena->m_max_band.data());
+      uint32_t *dst_ids(dst_arena->m_curves.data());
+
+      dst0_lists[L]->m_begin = w0 = dst_arena->allocate(S.size());
+      dst1_lists[L]->m_begin = w1 = dst_arena->allocate(S.size());
+
+      /* A curve intersects the range [a, b] unless all of
+       * its coordinates are less than a or all are greater
+       * than b. Each curve is
+       * written to both children and the write position of
+       * a child only advances if the curve intersects it,
+       * which avoids branching on the classification.
+       */
+#ifdef __SSE2__
+      const __m128 min0(_mm_set1_ps(B0.m_min_v)), max0(_mm_set1_ps(B0.m_max_v));
+      const __m128 min1(_mm_set1_ps(B1.m_min_v)), max1(_mm_set1_ps(B1.m_max_v));
+      for (; k + 4 <= S.m_end; k += 4)
         {
-          if (!path.curve(ID).ignore_curve(BandType))
+          __m128 vlo, vhi;
+          int mask0, mask1;
+
+          vlo = _mm_loadu_ps(lo + k);
+          vhi = _mm_loadu_ps(hi + k);
+          mask0 = _mm_movemask_ps(_mm_and_ps(_mm_cmpge_ps(vhi, min0), _mm_cmple_ps(vlo, max0)));
+          mask1 = _mm_movemask_ps(_mm_and_ps(_mm_cmpge_ps(vhi, min1), _mm_cmple_ps(vlo, max1)));
+          for (unsigned int j = 0; j < 4; ++j)
             {
-              if (path.curve(ID).present_before_split<BandType>(0.0f))
-                {
-                  m_before_split.m_curves.push_back(ID);
-                }
-
-              if (path.curve(ID).present_after_split<BandType>(0.0f))
-                {
-                  m_after_split.m_curves.push_back(ID);
-                }
+              dst_ids[w0] = ids[k + j];
+              dst_lo[w0] = lo[k + j];
+              dst_hi[w0] = hi[k + j];
+              w0 += (mask0 >> j) & 1;
+
+              dst_ids[w1] = ids[k + j];
+              dst_lo[w1] = lo[k + j];
+              dst_hi[w1] = hi[k + j];
+              w1 += (mask1 >> j) & 1;
             }
         }
+#endif
+
+      for (; k < S.m_end; ++k)
+        {
+          dst_ids[w0] = ids[k];
+          dst_lo[w0] = lo[k];
+          dst_hi[w0] = hi[k];
+          w0 += (hi[k] >= B0.m_min_v && lo[k] <= B0.m_max_v);
+
+          dst_ids[w1] = ids[k];
+          dst_lo[w1] = lo[k];
+          dst_hi[w1] = hi[k];
+          w1 += (hi[k] >= B1.m_min_v && lo[k] <= B1.m_max_v);
+        }
+
+      dst0_lists[L]->m_end = w0;
+      dst1_lists[L]->m_end = w1;
     }
-}
 
-template<enum band_t BandType>
-Band<BandType>::
-Band(const GlyphPath &path, const Band *parent, float min_v, float max_v):
-  m_min_v(min_v),
-  m_max_v(max_v),
-  m_before_split(path, &parent->m_before_split, min_v, max_v),
-  m_after_split(path, &parent->m_after_split, min_v, max_v)
-{}
+  dst->push_back(B0);
+  dst->push_back(B1);
+}
 
+////////////////////////////////////////
+// BandedRaysScratch methods
 template<enum band_t BandType>
 float
-Band<BandType>::
-create_bands(std::vector<Band> *pdst, const GlyphPath &path,
-             unsigned int max_num_iterations, float avg_curve_thresh)
+BandedRaysScratch::
+create_bands(const GlyphPath &path,
+             unsigned int max_num_iterations, float avg_curve_thresh,
+             std::vector<fastuidraw::uvec2> *band_lists,
+             std::vector<uint32_t> *curve_data)
 {
   const float width(2 * fastuidraw::GlyphRenderDataBandedRays::glyph_coord_value);
   const float epsilon(1e-5);
   const float slack(epsilon * width);
   float avg_num_curves;
-  unsigned int num_iterations;
-  std::vector<std::vector<Band> > tmp(1);
+  unsigned int num_iterations, current(0);
 
-  tmp.reserve(max_num_iterations + 1);
-  tmp.back().push_back(Band(path));
+  m_curves.set<BandType>(path);
 
-  //std::cout << "\n\nCreateBands(" << BandType << ")\n";
+  /* the initial band covers everything and takes
+   * its curve lists from m_curves.
+   */
+  {
+    unsigned int nb(m_curves.m_before_split.size());
+    unsigned int na(m_curves.m_after_split.size());
+    CurveListArena &arena(m_arenas[current]);
+    Band band;
+
+    arena.reset(nb + na);
+    band.m_min_v = -fastuidraw::GlyphRenderDataBandedRays::glyph_coord_value;
+    band.m_max_v = fastuidraw::GlyphRenderDataBandedRays::glyph_coord_value;
+    band.m_before_split.m_begin = arena.allocate(nb);
+    band.m_before_split.m_end = band.m_before_split.m_begin + nb;
+    band.m_after_split.m_begin = arena.allocate(na);
+    band.m_after_split.m_end = band.m_after_split.m_begin + na;
+    for (unsigned int i = 0; i < nb; ++i)
+      {
+        uint32_t id(m_curves.m_before_split[i]);
+        arena.m_curves[band.m_before_split.m_begin + i] = id;
+        arena.m_min_band[band.m_before_split.m_begin + i] = m_curves.m_min_band[id];
+        arena.m_max_band[band.m_before_split.m_begin + i] = m_curves.m_max_band[id];
+      }
+    for (unsigned int i = 0; i < na; ++i)
+      {
+        uint32_t id(m_curves.m_after_split[i]);
+        arena.m_curves[band.m_after_split.m_begin + i] = id;
+        arena.m_min_band[band.m_after_split.m_begin + i] = m_curves.m_min_band[id];
+        arena.m_max_band[band.m_after_split.m_begin + i] = m_curves.m_max_band[id];
+      }
+    m_bands[current].clear();
+    m_bands[current].push_back(band);
+  }
 
   /* basic idea: keep breaking each band in half until
    * each band does not have too many curves.
    */
-  for (num_iterations = 0, avg_num_curves = tmp.back().back().compute_average_curve_coverage(path);
+  for (num_iterations = 0,
+         avg_num_curves = m_bands[current].back().compute_average_curve_coverage(m_arenas[current], m_curves);
        num_iterations < max_num_iterations && avg_num_curves > avg_curve_thresh; ++num_iterations)
     {
-      const std::vector<Band> &src(tmp.back());
-
-      //std::cout << "\tIteration #" << num_iterations << " avg_num_curves " << avg_num_curves;
-
-      /* the src reference will stay valid because of the
-       * call to reserve before the loop.
-       */
-      tmp.push_back(std::vector<Band>());
-      tmp.back().reserve(2u << num_iterations);
-      for (const Band &band : src)
+      const CurveListArena &src(m_arenas[current]);
+      CurveListArena &dst(m_arenas[1 - current]);
+      std::vector<Band> &dst_bands(m_bands[1 - current]);
+
+      /* each curve of a band goes to at most both halves */
+      dst.reset(2 * src.m_size);
+      dst_bands.clear();
+      for (const Band &band : m_bands[current])
         {
-          band.divide(&tmp.back(), path, slack);
+          band.divide(src, slack, &dst_bands, &dst);
         }
+      current = 1 - current;
 
       avg_num_curves = 0.0f;
-      for (const Band &band : tmp.back())
+      for (const Band &band : m_bands[current])
         {
-          avg_num_curves += band.compute_average_curve_coverage(path);
+          avg_num_curves += band.compute_average_curve_coverage(m_arenas[current], m_curves);
         }
-      avg_num_curves /= static_cast<float>(tmp.back().size());
-      //std::cout << " ---> " << avg_num_curves << "\n";
+      avg_num_curves /= static_cast<float>(m_bands[current].size());
     }
 
-  /* sort the curves for the shader */
-  for (Band &b : tmp.back())
+  /* pack the curve lists, sharing the data of identical lists */
+  const CurveListArena &arena(m_arenas[current]);
+  m_list_offsets.clear();
+  for (const Band &band : m_bands[current])
     {
-      std::sort(b.m_before_split.m_curves.begin(),
-                b.m_before_split.m_curves.end(),
-                SortCurvesCullBeforeSplit<BandType>(path));
+      fastuidraw::uvec2 lists[2];
+      const CurveList *src_lists[2] = { &band.m_before_split, &band.m_after_split };
 
-      std::sort(b.m_after_split.m_curves.begin(),
-                b.m_after_split.m_curves.end(),
-                SortCurvesCullAfterSplit<BandType>(path));
-    }
-  std::swap(*pdst, tmp.back());
-  //std::cout << "\n\tNumBands = " << pdst->size() << "\n";
+      for (unsigned int L = 0; L < 2; ++L)
+        {
+          fastuidraw::c_array<const uint32_t> ids(arena.curves(*src_lists[L]));
+          CurveListKey key(ids);
+          const unsigned int *p;
 
-  //std::cout << "Glyph complexity: " << avg_num_curves << "\n";
-  return avg_num_curves;
-}
+          p = m_list_offsets.find(key);
+          if (p)
+            {
+              lists[L] = fastuidraw::uvec2(ids.size(), *p);
+            }
+          else
+            {
+              uint32_t offset(curve_data->size());
 
-template<enum band_t BandType>
-float
-Band<BandType>::
-compute_average_curve_coverage(const GlyphPath &path) const
-{
-  const float edge(fastuidraw::GlyphRenderDataBandedRays::glyph_coord_value);
-  float curve_draw(0.0f);
+              m_list_offsets.insert(key, offset);
+              lists[L] = fastuidraw::uvec2(ids.size(), offset);
+              for (uint32_t id : ids)
+                {
+                  curve_data->push_back(m_curves.m_packed[3 * id + 0]);
+                  curve_data->push_back(m_curves.m_packed[3 * id + 1]);
+                  curve_data->push_back(m_curves.m_packed[3 * id + 2]);
+                }
+            }
+        }
 
-  for (const CurveID id : m_after_split.m_curves)
-    {
-      const Curve &c(path.curve(id));
-      /* a curve after the split hits all the area
-       * between 0 and its maximum coordinate.
-       */
-      float v;
-      v = fastuidraw::t_min(edge, c.max_coordinate(1 - BandType));
-      curve_draw += fastuidraw::t_max(0.0f, v);
+      /* after the split first, then before the split */
+      band_lists->push_back(lists[1]);
+      band_lists->push_back(lists[0]);
     }
 
-  for (const CurveID id : m_before_split.m_curves)
-    {
-      const Curve &c(path.curve(id));
-      /* a curve before the split hits all the area
-       * between 0 and its minimum coordinate (which is negative!).
-       */
-      float v;
-      v = fastuidraw::t_min(edge, -c.min_coordinate(1 - BandType));
-      curve_draw += fastuidraw::t_max(0.0f, v);
-    }
-
-  return curve_draw / (2.0f * edge);
-}
-
-template<enum band_t BandType>
-void
-Band<BandType>::
-divide(std::vector<Band> *dst, const GlyphPath &path, float slack) const
-{
-  float split(0.5 * (m_min_v + m_max_v));
-
-  /* we add a little slack around the band to capture
-   * curves that nearly touch the boundary of a band.
-   */
-  dst->push_back(Band(path, this, m_min_v, split + slack));
-  dst->push_back(Band(path, this, split - slack, m_max_v));
+  return avg_num_curves;
 }
 
 ////////////////////////////////////////////////
@@ -966,74 +1060,64 @@ finalize(enum PainterEnums::fill_rule_t f, const Rect &glyph_rect,
 
   /* step 1: break into split-bands; The split is -ALWAYS-
    *         in the middle. Also, record the render costs
-   *         comptue from the bands.
+   *         comptue from the bands. The curve lists of the
+   *         bands are packed into curve_data as they are
+   *         made, with the offsets relative to curve_data.
    */
-  std::vector<Band<horizontal_band> > split_horiz_bands;
-  std::vector<Band<vertical_band> > split_vert_bands;
+  BandedRaysScratch &scratch(BandedRaysScratch::thread_scratch());
+  std::vector<uvec2> horiz_band_lists, vert_band_lists;
+  std::vector<uint32_t> curve_data;
 
   d->m_render_cost[horizontal_band_avg_curve_count]
-    = Band<horizontal_band>::create_bands(&split_horiz_bands, *d->m_glyph,
-                                          max_recursion, avg_num_curves_thresh);
+    = scratch.create_bands<horizontal_band>(*d->m_glyph, max_recursion, avg_num_curves_thresh,
+                                            &horiz_band_lists, &curve_data);
 
   d->m_render_cost[vertical_band_avg_curve_count]
-    = Band<vertical_band>::create_bands(&split_vert_bands, *d->m_glyph,
-                                        max_recursion, avg_num_curves_thresh);
+    = scratch.create_bands<vertical_band>(*d->m_glyph, max_recursion, avg_num_curves_thresh,
+                                          &vert_band_lists, &curve_data);
+
+  uint32_t offset, H, V;
 
-  d->m_render_cost[number_horizontal_bands] = split_horiz_bands.size();
-  d->m_render_cost[number_vertical_bands] = split_vert_bands.size();
+  H = horiz_band_lists.size() / 2;
+  V = vert_band_lists.size() / 2;
+
+  d->m_render_cost[number_horizontal_bands] = H;
+  d->m_render_cost[number_vertical_bands] = V;
 
   d->m_render_cost[total_number_curves] = d->m_glyph->total_number_curves();
 
-  /* step 2: compute the offsets. The data packing is first
+  /* step 2: pack the data. The data packing is first
    *         that each band takes a single 32-bit value
    *         (that is packed as according to band_t) then
    *         comes the location of each of the curve lists.
-   */
-  uint32_t offset, H, V;
-  CurveListHoard<horizontal_band> horiz_hoard;
-  CurveListHoard<vertical_band> vert_hoard;
-
-  H = split_horiz_bands.size();
-  V = split_vert_bands.size();
-
-  /* the starting offset for the curve lists comes after all
-   * the bands
+   *
+   * The bands come in a very specific order:
+   *  - horizontal_band_plus_infinity <--> horizontal bands, after split
+   *  - horizontal_band_negative_infinity <--> horizontal bands, before split
+   *  - vertical_band_plus_infinity <--> vertical bands, after split
+   *  - vertical_band_negative_infinity <--> vertical bands, before split
    */
   offset = 2 * (H + V);
-  for (auto &p : split_horiz_bands)
-    {
-      p.assign_curve_list_offset(horiz_hoard, offset);
-    }
-  for (auto &p : split_vert_bands)
+  d->m_render_data.resize(offset + curve_data.size());
+  c_array<generic_data> dst(make_c_array(d->m_render_data));
+
+  for (unsigned int i = 0, endi = curve_data.size(); i < endi; ++i)
     {
-      p.assign_curve_list_offset(vert_hoard, offset);
+      dst[offset + i].u = curve_data[i];
     }
 
-  // the needed room is now stored in offset
-  d->m_render_data.resize(offset);
-  c_array<generic_data> dst(make_c_array(d->m_render_data));
-
-  /* step 3: pack the data
-   * The bands come in a very specific order:
-   *  - horizontal_band_plus_infinity <--> split_horiz_bands.m_after_split
-   *  - horizontal_band_negative_infinity <--> split_horiz_bands.m_before_split
-   *  - vertical_band_plus_infinity <--> split_vert_bands.m_after_split
-   *  - vertical_band_negative_infinity <--> split_vert_bands.m_before_split
-   */
-  horiz_hoard.pack_curves(*d->m_glyph, dst);
-  vert_hoard.pack_curves(*d->m_glyph, dst);
   for (unsigned int i = 0; i < H; ++i)
     {
-      dst[i].u = split_horiz_bands[i].after_split_packed_band_value();
-      dst[i + H].u = split_horiz_bands[i].before_split_packed_band_value();
+      dst[i].u = pack_band_value(horiz_band_lists[2 * i], offset);
+      dst[i + H].u = pack_band_value(horiz_band_lists[2 * i + 1], offset);
     }
   for (unsigned int i = 0; i < V; ++i)
     {
-      dst[i + 2 * H].u = split_vert_bands[i].after_split_packed_band_value();
-      dst[i + 2 * H + V].u = split_vert_bands[i].before_split_packed_band_value();
+      dst[i + 2 * H].u = pack_band_value(vert_band_lists[2 * i], offset);
+      dst[i + 2 * H + V].u = pack_band_value(vert_band_lists[2 * i + 1], offset);
     }
 
-  /* step 4: record the data neeed for shading */
+  /* step 3: record the data neeed for shading */
   d->m_num_bands[vertical_band] = V;
   d->m_num_bands[horizontal_band] = H;
 
@@ -1083,6 +1167,7 @@ upload_to_atlas(GlyphAtlasProxy &atlas_proxy,
                            d->m_num_bands[vertical_band],
                            d->m_num_bands[horizontal_band],
                            d->m_fill_rule, data_offset);
+  atlas_proxy.relocatable_attribute(glyph_offset, data_offset);
 
   for (unsigned int i = 0; i < num_costs; ++i)
     {
@@ -1111,6 +1196,87 @@ query(query_info *out_info) const
   return routine_success;
 }
 
+unsigned int
+fastuidraw::GlyphRenderDataBandedRays::
+serialized_size(void) const
+{
+  GlyphRenderDataBandedRaysPrivate *d;
+  d = static_cast<GlyphRenderDataBandedRaysPrivate*>(m_d);
+
+  if (d->m_glyph)
+    {
+      return 0;
+    }
+
+  return sizeof(d->m_num_bands)
+    + sizeof(int32_t)
+    + sizeof(d->m_render_cost)
+    + sizeof(generic_data) * d->m_render_data.size();
+}
+
+enum fastuidraw::return_code
+fastuidraw::GlyphRenderDataBandedRays::
+serialize(c_array<uint8_t> dst) const
+{
+  GlyphRenderDataBandedRaysPrivate *d;
+  d = static_cast<GlyphRenderDataBandedRaysPrivate*>(m_d);
+
+  if (d->m_glyph)
+    {
+      return routine_fail;
+    }
+
+  detail::ByteWriter W(dst);
+  W.write(d->m_num_bands)
+    .write(int32_t(d->m_fill_rule))
+    .write(d->m_render_cost)
+    .write(make_c_array(d->m_render_data));
+
+  return (W.overflowed() || W.remaining() != 0) ?
+    routine_fail :
+    routine_success;
+}
+
+enum fastuidraw::return_code
+fastuidraw::GlyphRenderDataBandedRays::
+deserialize(c_array<const uint8_t> src)
+{
+  GlyphRenderDataBandedRaysPrivate *d;
+  d = static_cast<GlyphRenderDataBandedRaysPrivate*>(m_d);
+
+  detail::ByteReader R(src);
+  ivec2 num_bands;
+  int32_t fill_rule;
+  vecN<float, num_costs> render_cost;
+  c_array<const uint8_t> data;
+
+  R.read(&num_bands)
+    .read(&fill_rule)
+    .read(&render_cost);
+  data = R.take_remaining();
+  if (R.failed()
+      || num_bands.x() < 0 || num_bands.y() < 0
+      || fill_rule < 0 || fill_rule >= PainterEnums::fill_rule_data_count
+      || data.size() % sizeof(generic_data) != 0
+      || data.size() / sizeof(generic_data) < 2u * unsigned(num_bands.x() + num_bands.y()))
+    {
+      return routine_fail;
+    }
+
+  if (d->m_glyph)
+    {
+      FASTUIDRAWdelete(d->m_glyph);
+      d->m_glyph = nullptr;
+    }
+
+  d->m_num_bands = num_bands;
+  d->m_fill_rule = static_cast<enum PainterEnums::fill_rule_t>(fill_rule);
+  d->m_render_cost = render_cost;
+  detail::ByteReader(data).read(data.size() / sizeof(generic_data), &d->m_render_data);
+
+  return routine_success;
+}
+
 ///////////////////////////////////////////////////////////
 // fastuidraw::GlyphRenderDataBandedRays::query_info methods
 void
@@ -0,0 +1,200 @@
+/*!
+ * \file glyph_render_data_msdf.cpp
+ * \brief file glyph_render_data_msdf.cpp
+ *
+ * Copyright 2019 by Intel.
+ *
+ * Contact: kevin.rogovin@intel.com
+ *
+ * This Source Code Form is subject to the
+ * terms of the Mozilla Public License, v. 2.0.
+ * If a copy of the MPL was not distributed with
+ * this file, You can obtain one at
+ * http://mozilla.org/MPL/2.0/.
+ *
+ * \author Kevin Rogovin <kevin.rogovin@intel.com>
+ *
+ */
+
+
+#include <vector>
+#include <fastuidraw/text/glyph_render_data_msdf.hpp>
+#include "../private/byte_stream.hpp"
+#include "../private/util_private.hpp"
+
+namespace
+{
+  class GlyphDataPrivate
+  {
+  public:
+    GlyphDataPrivate(void):
+      m_resolution(0, 0)
+    {}
+
+    void
+    resize(fastuidraw::ivec2 sz)
+    {
+      FASTUIDRAWassert(sz.x() >= 0);
+      FASTUIDRAWassert(sz.y() >= 0);
+      m_texels.resize(fastuidraw::GlyphRenderDataMSDF::number_channels * sz.x() * sz.y());
+      m_resolution = sz;
+    }
+
+    fastuidraw::ivec2 m_resolution;
+    std::vector<uint8_t> m_texels;
+  };
+}
+
+////////////////////////////////////
+// fastuidraw::GlyphRenderDataMSDF methods
+fastuidraw::GlyphRenderDataMSDF::
+GlyphRenderDataMSDF(void)
+{
+  m_d = FASTUIDRAWnew GlyphDataPrivate();
+}
+
+fastuidraw::GlyphRenderDataMSDF::
+~GlyphRenderDataMSDF(void)
+{
+  GlyphDataPrivate *d;
+  d = static_cast<GlyphDataPrivate*>(m_d);
+  FASTUIDRAWdelete(d);
+  m_d = nullptr;
+}
+
+fastuidraw::ivec2
+fastuidraw::GlyphRenderDataMSDF::
+resolution(void) const
+{
+  GlyphDataPrivate *d;
+  d = static_cast<GlyphDataPrivate*>(m_d);
+  return d->m_resolution;
+}
+
+fastuidraw::c_array<const uint8_t>
+fastuidraw::GlyphRenderDataMSDF::
+texel_data(void) const
+{
+  GlyphDataPrivate *d;
+  d = static_cast<GlyphDataPrivate*>(m_d);
+  return make_c_array(d->m_texels);
+}
+
+fastuidraw::c_array<uint8_t>
+fastuidraw::GlyphRenderDataMSDF::
+texel_data(void)
+{
+  GlyphDataPrivate *d;
+  d = static_cast<GlyphDataPrivate*>(m_d);
+  return make_c_array(d->m_texels);
+}
+
+void
+fastuidraw::GlyphRenderDataMSDF::
+resize(fastuidraw::ivec2 sz)
+{
+  GlyphDataPrivate *d;
+  d = static_cast<GlyphDataPrivate*>(m_d);
+  d->resize(sz);
+}
+
+fastuidraw::c_array<const fastuidraw::c_string>
+fastuidraw::GlyphRenderDataMSDF::
+render_info_labels(void) const
+{
+  return c_array<const c_string>();
+}
+
+enum fastuidraw::return_code
+fastuidraw::GlyphRenderDataMSDF::
+upload_to_atlas(GlyphAtlasProxy &atlas_proxy,
+                GlyphAttribute::Array &attributes,
+                c_array<float> /* render_costs */) const
+{
+  GlyphDataPrivate *d;
+  d = static_cast<GlyphDataPrivate*>(m_d);
+
+  attributes.resize(2);
+  attributes[0].pack_texel_rect(d->m_resolution.x(),
+				d->m_resolution.y());
+
+  if (d->m_texels.empty())
+    {
+      attributes[1].m_data = vecN<uint32_t, 4>(0u);
+      return routine_success;
+    }
+
+  /* each texel is packed into a single 32-bit value
+   * with the red channel in the lowest 8-bits.
+   */
+  std::vector<generic_data> data(d->m_texels.size() / number_channels);
+  int location;
+
+  for (unsigned int i = 0, src = 0; i < data.size(); ++i, src += number_channels)
+    {
+      data[i].u = uint32_t(d->m_texels[src + red_channel])
+        | (uint32_t(d->m_texels[src + green_channel]) << 8u)
+        | (uint32_t(d->m_texels[src + blue_channel]) << 16u)
+        | (uint32_t(d->m_texels[src + alpha_channel]) << 24u);
+    }
+
+  location = atlas_proxy.allocate_data(make_c_array(data));
+  if (location == -1)
+    {
+      return routine_fail;
+    }
+  attributes[1].m_data = vecN<uint32_t, 4>(location);
+  atlas_proxy.relocatable_attribute(1, location);
+
+  return routine_success;
+}
+
+unsigned int
+fastuidraw::GlyphRenderDataMSDF::
+serialized_size(void) const
+{
+  GlyphDataPrivate *d;
+  d = static_cast<GlyphDataPrivate*>(m_d);
+  return sizeof(ivec2) + d->m_texels.size();
+}
+
+enum fastuidraw::return_code
+fastuidraw::GlyphRenderDataMSDF::
+serialize(c_array<uint8_t> dst) const
+{
+  GlyphDataPrivate *d;
+  d = static_cast<GlyphDataPrivate*>(m_d);
+
+  detail::ByteWriter W(dst);
+  W.write(d->m_resolution)
+    .write(make_c_array(d->m_texels));
+
+  return (W.overflowed() || W.remaining() != 0) ?
+    routine_fail :
+    routine_success;
+}
+
+enum fastuidraw::return_code
+fastuidraw::GlyphRenderDataMSDF::
+deserialize(c_array<const uint8_t> src)
+{
+  GlyphDataPrivate *d;
+  d = static_cast<GlyphDataPrivate*>(m_d);
+
+  detail::ByteReader R(src);
+  ivec2 resolution;
+
+  R.read(&resolution);
+  if (R.failed() || resolution.x() < 0 || resolution.y() < 0
+      || uint64_t(src.size() - sizeof(ivec2))
+      != uint64_t(number_channels) * uint64_t(resolution.x()) * uint64_t(resolution.y()))
+    {
+      return routine_fail;
+    }
+
+  d->resize(resolution);
+  R.read(d->m_texels.size(), &d->m_texels);
+  FASTUIDRAWassert(R.at_end());
+
+  return routine_success;
+}
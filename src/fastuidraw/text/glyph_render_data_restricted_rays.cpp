@@ -23,12 +23,16 @@
 #include <map>
 #include <cstdlib>
 #include <mutex>
+#include <memory>
 #include <fastuidraw/util/matrix.hpp>
 #include <fastuidraw/text/glyph_generate_params.hpp>
 #include <fastuidraw/text/glyph_render_data_restricted_rays.hpp>
 #include "../private/bounding_box.hpp"
+#include "../private/byte_stream.hpp"
 #include "../private/util_private.hpp"
 #include "../private/util_private_ostream.hpp"
+#include "../private/flat_hash_index.hpp"
+#include "../private/worker_pool.hpp"
 
 namespace
 {
@@ -440,48 +444,6 @@ namespace
     std::vector<Curve> m_curves;
   };
 
-  class CurveList
-  {
-  public:
-    CurveList(void):
-      m_offset(-1),
-      m_p(nullptr)
-    {}
-
-    unsigned int
-    init(const GlyphPath *p,
-         const fastuidraw::vec2 &min_pt,
-         const fastuidraw::vec2 &max_pt);
-
-    unsigned int //returns the splitting coordinate
-    split(CurveList &out_pre, CurveList &out_post,
-          fastuidraw::vec2 near_thresh) const;
-
-    const std::vector<CurveID>&
-    curves(void) const
-    {
-      FASTUIDRAWassert(m_p);
-      return m_curves;
-    }
-
-    const fastuidraw::BoundingBox<float>&
-    box(void) const
-    {
-      return m_box;
-    }
-
-    const GlyphPath&
-    glyph_path(void) const { return *m_p; }
-
-    /* Assigned in GlyphRenderDataRestrictedRays::finalize() */
-    int m_offset;
-
-  private:
-    const GlyphPath *m_p;
-    std::vector<CurveID> m_curves;
-    fastuidraw::BoundingBox<float> m_box;
-  };
-
   class CurveListPacker
   {
   public:
@@ -509,131 +471,225 @@ namespace
     uint32_t m_current_value;
   };
 
-  class CurveListCollection
+  class CurveListKey
   {
   public:
-    explicit
-    CurveListCollection(unsigned int start_offset):
-      m_start_offset(start_offset),
-      m_current_offset(start_offset)
+    CurveListKey(void):
+      m_hash(0)
     {}
 
-    unsigned int
-    start_offset(void) const
+    explicit
+    CurveListKey(fastuidraw::c_array<const uint32_t> curves):
+      m_curves(curves),
+      m_hash(curves.size())
     {
-      return m_start_offset;
+      for (uint32_t c : curves)
+        {
+          m_hash = fastuidraw::detail::hash_mix(m_hash ^ c);
+        }
     }
 
-    unsigned int
-    current_offset(void) const
+    bool
+    operator==(const CurveListKey &rhs) const
     {
-      return m_current_offset;
+      return m_hash == rhs.m_hash
+        && m_curves.size() == rhs.m_curves.size()
+        && std::equal(m_curves.begin(), m_curves.end(), rhs.m_curves.begin());
     }
 
-    void
-    assign_offset(CurveList &C);
-
-    void
-    pack_data(const GlyphPath *p,
-              fastuidraw::c_array<fastuidraw::generic_data> data) const;
+    uint64_t
+    hash(void) const
+    {
+      return m_hash;
+    }
 
   private:
-    void
-    pack_element(const GlyphPath *p,
-                 const std::vector<CurveID> &curves,
-                 unsigned int offset,
-                 fastuidraw::c_array<fastuidraw::generic_data> data) const;
-
-    unsigned int m_start_offset, m_current_offset;
-    std::map<std::vector<CurveID>, unsigned int> m_offsets;
+    fastuidraw::c_array<const uint32_t> m_curves;
+    uint64_t m_hash;
   };
 
-  class CurveListHierarchy
+  /* A node of a CurveListHierarchy; the children of a node
+   * are adjacent to each other and come after the node in
+   * the node array. The curve list of a node is a range of
+   * the curve arena of the CurveListHierarchy whose values
+   * are indices into the array of curves of the glyph.
+   */
+  class HierarchyNode
   {
   public:
-    CurveListHierarchy(const GlyphPath *p,
-                       const fastuidraw::ivec2 &min_pt,
-                       const fastuidraw::ivec2 &max_pt,
-                       unsigned int max_recursion,
-                       unsigned int split_thresh,
-                       fastuidraw::vec2 near_thresh):
-      m_child(nullptr, nullptr),
-      m_offset(-1),
+    HierarchyNode(const fastuidraw::BoundingBox<float> &box,
+                  unsigned int generation,
+                  unsigned int curves_begin,
+                  unsigned int curves_end):
+      m_box(box),
+      m_generation(generation),
+      m_curves_begin(curves_begin),
+      m_curves_end(curves_end),
+      m_child(-1),
+      m_has_children(false),
       m_splitting_coordinate(3),
-      m_generation(0)
+      m_offset(0),
+      m_curve_list_offset(0),
+      m_winding(0),
+      m_delta(128, 128),
+      m_best_dist(0.0f)
+    {}
+
+    unsigned int
+    num_curves(void) const
     {
-      m_curves.init(p,
-                    fastuidraw::vec2(min_pt),
-                    fastuidraw::vec2(max_pt));
-      subdivide(max_recursion, split_thresh, near_thresh);
+      return m_curves_end - m_curves_begin;
     }
 
-    ~CurveListHierarchy()
+    fastuidraw::BoundingBox<float> m_box;
+    unsigned int m_generation, m_curves_begin, m_curves_end;
+
+    /* index of the pre-split child, the post-split child
+     * is at m_child + 1; is -1 if the node was not split
+     */
+    int m_child;
+
+    /* false if the node was not split or if its children
+     * were removed because they do not reduce the curves
+     */
+    bool m_has_children;
+    unsigned int m_splitting_coordinate;
+
+    /* Assigned in GlyphRenderDataRestrictedRays::finalize() */
+    unsigned int m_offset, m_curve_list_offset;
+
+    /* sample point of a leaf */
+    int m_winding;
+    fastuidraw::ivec2 m_delta;
+    float m_best_dist;
+  };
+
+  /* The hierarchy of boxes of a glyph. It is built one
+   * generation at a time; the splits of the nodes of a
+   * generation are independent of each other and are
+   * computed in parallel for glyphs with many curves. Each
+   * thread has its own CurveListHierarchy whose arrays are
+   * reused across the glyphs it builds, so that building
+   * the hierarchy does not allocate once the arrays are
+   * large enough.
+   */
+  class CurveListHierarchy:fastuidraw::noncopyable
+  {
+  public:
+    static
+    CurveListHierarchy&
+    thread_hierarchy(void)
     {
-      if (has_children())
-        {
-          FASTUIDRAWdelete(m_child[0]);
-          FASTUIDRAWdelete(m_child[1]);
-        }
+      static thread_local CurveListHierarchy R;
+      return R;
     }
 
+    void
+    build(const GlyphPath *p,
+          unsigned int max_recursion,
+          unsigned int split_thresh,
+          fastuidraw::vec2 near_thresh,
+          fastuidraw::detail::WorkerPool *pool);
+
+    /* returns the size of the tree */
     unsigned int
     assign_tree_offsets(void)
     {
       unsigned int size(0);
 
-      assign_tree_offsets(size);
+      assign_tree_offsets(0, size);
       return size;
     }
 
-    void
-    assign_curve_list_offsets(CurveListCollection &C);
+    /* returns the offset after the last curve list */
+    unsigned int
+    assign_curve_list_offsets(unsigned int start_offset);
 
     void
     pack_data(fastuidraw::c_array<fastuidraw::generic_data> dst) const;
 
     float
-    compute_average_curve_cost(void) const;
+    compute_average_curve_cost(void) const
+    {
+      return compute_average_curve_cost(0);
+    }
 
     float
-    compute_average_node_cost(void) const;
+    compute_average_node_cost(void) const
+    {
+      return compute_average_node_cost(0);
+    }
 
   private:
-    explicit
-    CurveListHierarchy(unsigned int parent_gen):
-      m_child(nullptr, nullptr),
-      m_offset(-1),
-      m_splitting_coordinate(3),
-      m_generation(parent_gen + 1)
+    class SplitJob
+    {
+    public:
+      SplitJob(unsigned int node, unsigned int scratch_offset):
+        m_node(node),
+        m_scratch_offset(scratch_offset),
+        m_coordinate(3)
+      {}
+
+      unsigned int m_node, m_scratch_offset;
+
+      /* sizes of the lists before and after splitting
+       * in x (.x() and .y()) and in y (.z() and .w())
+       */
+      fastuidraw::uvec4 m_sizes;
+      unsigned int m_coordinate;
+    };
+
+    CurveListHierarchy(void):
+      m_path(nullptr)
     {}
 
+    fastuidraw::c_array<const uint32_t>
+    curves(const HierarchyNode &node) const
+    {
+      return fastuidraw::make_c_array(m_curve_arena).sub_array(node.m_curves_begin,
+                                                              node.num_curves());
+    }
+
     void
-    subdivide(unsigned int max_recursion, unsigned int split_thresh,
-              fastuidraw::vec2 near_thresh);
+    split_node(SplitJob &job, fastuidraw::vec2 near_thresh);
 
     void
-    assign_tree_offsets(unsigned int &start);
+    add_children(const SplitJob &job);
 
-    bool
-    has_children(void) const
-    {
-      FASTUIDRAWassert((m_child[0] == nullptr) == (m_child[1] == nullptr));
-      return m_child[0] != nullptr;
-    }
+    void
+    remove_useless_splits(void);
 
     void
-    pack_texel(fastuidraw::c_array<fastuidraw::generic_data> dst) const;
+    compute_initial_sample(HierarchyNode &node) const;
 
     void
-    pack_sample_point(unsigned int &offset,
-                      fastuidraw::c_array<fastuidraw::generic_data> dst) const;
+    refine_samples(unsigned int node);
 
-    fastuidraw::vecN<CurveListHierarchy*, 2> m_child;
-    unsigned int m_offset, m_splitting_coordinate, m_generation;
-    CurveList m_curves;
+    void
+    assign_tree_offsets(unsigned int node, unsigned int &current);
 
-    int m_winding;
-    fastuidraw::ivec2 m_delta;
+    void
+    assign_curve_list_offsets(unsigned int node, unsigned int &current);
+
+    void
+    pack_node(unsigned int node,
+              fastuidraw::c_array<fastuidraw::generic_data> dst) const;
+
+    float
+    compute_average_curve_cost(unsigned int node) const;
+
+    float
+    compute_average_node_cost(unsigned int node) const;
+
+    const GlyphPath *m_path;
+    std::vector<const Curve*> m_curves;
+    std::vector<uint32_t> m_curve_arena;
+    std::vector<HierarchyNode> m_nodes;
+    std::vector<SplitJob> m_split_jobs;
+    std::vector<uint32_t> m_split_scratch;
+    std::vector<unsigned int> m_leaves;
+    std::vector<unsigned int> m_distinct_lists;
+    fastuidraw::detail::FlatHashIndex<CurveListKey> m_list_offsets;
   };
 
   class EdgeTracker
@@ -733,14 +789,6 @@ namespace
     pack_data(fastuidraw::c_array<fastuidraw::generic_data> dst,
               const Transformation &tr) const;
 
-    const Curve&
-    fetch_curve(const CurveID &id) const
-    {
-      FASTUIDRAWassert(id.contour() < m_contours.size());
-      FASTUIDRAWassert(id.curve() < m_contours[id.contour()].num_curves());
-      return m_contours[id.contour()][id.curve()];
-    }
-
     void
     mark_cancel_curves(void);
 
@@ -1327,121 +1375,6 @@ pack_data(fastuidraw::c_array<fastuidraw::generic_data> dst,
     }
 }
 
-//////////////////////////////////////
-// CurveList methods
-unsigned int
-CurveList::
-init(const GlyphPath *p,
-     const fastuidraw::vec2 &min_pt,
-     const fastuidraw::vec2 &max_pt)
-{
-  FASTUIDRAWassert(!m_p);
-  m_p = p;
-  m_box = fastuidraw::BoundingBox<float>(min_pt, max_pt);
-
-  const std::vector<Contour> &g(m_p->contours());
-  for (unsigned int o = 0, endo = g.size(); o < endo; ++o)
-    {
-      for (unsigned int c = 0, endc = g[o].num_curves(); c < endc; ++c)
-        {
-          if (!g[o][c].m_cancelled_edge)
-            {
-              m_curves.push_back(CurveID()
-                                 .curve(c)
-                                 .contour(o));
-            }
-        }
-    }
-  return m_curves.size();
-}
-
-unsigned int
-CurveList::
-split(CurveList &out_pre, CurveList &out_post,
-      fastuidraw::vec2 near_thresh) const
-{
-  using namespace fastuidraw;
-  typedef vecN<BoundingBox<float>, 2> BoxPair;
-
-  vecN<std::vector<CurveID>, 2> splitX;
-  vecN<std::vector<CurveID>, 2> splitY;
-  BoxPair splitX_box(m_box.split_x()), splitY_box(m_box.split_y());
-  vecN<BoxPair, 2> enlarged_splitX_box, enlarged_splitY_box;
-  vec2 box_size(m_box.size());
-  ivec2 sz;
-  int return_value;
-
-  /* if there are curves already in this box, then going further
-   * than the box size gives us nothing because the curves within
-   * the box_size are all already closer.
-   */
-  near_thresh.x() = t_min(near_thresh.x(), box_size.x());
-  near_thresh.y() = t_min(near_thresh.y(), box_size.y());
-
-  create_enlarged_boxes(splitX_box,
-                        near_thresh.x(), near_thresh.y(),
-                        enlarged_splitX_box);
-
-  create_enlarged_boxes(splitY_box,
-                        near_thresh.x(), near_thresh.y(),
-                        enlarged_splitY_box);
-
-  /* choose the partition with the smallest sum of curves */
-  FASTUIDRAWassert(std::is_sorted(m_curves.begin(), m_curves.end()));
-  for (const CurveID &id : m_curves)
-    {
-      const Curve &curve(m_p->fetch_curve(id));
-      for (int i = 0; i < 2; ++i)
-        {
-          if (curve.intersects(splitX_box[i], enlarged_splitX_box[i], near_thresh))
-            {
-              splitX[i].push_back(id);
-            }
-          if (curve.intersects(splitY_box[i], enlarged_splitY_box[i], near_thresh))
-            {
-              splitY[i].push_back(id);
-            }
-        }
-    }
-
-  out_pre.m_p = m_p;
-  out_post.m_p = m_p;
-
-  sz.x() = splitX[0].size() + splitX[1].size();
-  sz.y() = splitY[0].size() + splitY[1].size();
-
-  if (sz.x() == sz.y())
-    {
-      return_value = (box_size.x() > box_size.y()) ?
-        0 : 1;
-    }
-  else if (sz.x() < sz.y())
-    {
-      return_value = 0;
-    }
-  else
-    {
-      return_value = 1;
-    }
-
-  if (return_value == 0)
-    {
-      std::swap(out_pre.m_curves, splitX[0]);
-      std::swap(out_post.m_curves, splitX[1]);
-      out_pre.m_box = splitX_box[0];
-      out_post.m_box = splitX_box[1];
-    }
-  else
-    {
-      std::swap(out_pre.m_curves, splitY[0]);
-      std::swap(out_post.m_curves, splitY[1]);
-      out_pre.m_box = splitY_box[0];
-      out_post.m_box = splitY_box[1];
-    }
-
-  return return_value;
-}
-
 //////////////////////////////////
 // CurveListPacker methods
 void
@@ -1494,146 +1427,336 @@ end_list(void)
     }
 }
 
-///////////////////////////////////////////
-// CurveListCollection methods
+///////////////////////////////////
+// CurveListHierarchy methods
 void
-CurveListCollection::
-assign_offset(CurveList &C)
+CurveListHierarchy::
+build(const GlyphPath *p,
+      unsigned int max_recursion,
+      unsigned int split_thresh,
+      fastuidraw::vec2 near_thresh,
+      fastuidraw::detail::WorkerPool *pool)
 {
-  if (C.curves().empty())
+  using namespace fastuidraw;
+
+  /* number of curve tests of a generation (or of curve
+   * evaluations for the sample points) from which the
+   * work is split across the threads of the pool
+   */
+  const unsigned int parallel_work_thresh = 4096u;
+  unsigned int generation_begin, generation_end, work;
+
+  m_path = p;
+  m_curves.clear();
+  m_curve_arena.clear();
+  m_nodes.clear();
+  m_leaves.clear();
+
+  /* the root has all curves that are not cancelled */
+  for (const Contour &contour : p->contours())
     {
-      C.m_offset = 0;
-      return;
+      for (unsigned int c = 0, endc = contour.num_curves(); c < endc; ++c)
+        {
+          if (!contour[c].m_cancelled_edge)
+            {
+              m_curve_arena.push_back(m_curves.size());
+              m_curves.push_back(&contour[c]);
+            }
+        }
     }
+  m_nodes.push_back(HierarchyNode(BoundingBox<float>(vec2(p->glyph_rect_min()),
+                                                     vec2(p->glyph_rect_max())),
+                                  0, 0, m_curve_arena.size()));
+
+  for (generation_begin = 0, generation_end = 1;
+       generation_begin < generation_end;
+       generation_begin = generation_end, generation_end = m_nodes.size())
+    {
+      unsigned int scratch_size(0);
 
-  std::map<std::vector<CurveID>, unsigned int>::iterator iter;
+      work = 0;
+      m_split_jobs.clear();
+      for (unsigned int n = generation_begin; n < generation_end; ++n)
+        {
+          unsigned int cnt(m_nodes[n].num_curves());
+          if (m_nodes[n].m_generation < max_recursion && cnt > split_thresh)
+            {
+              /* room for both lists of splitting in x and in y */
+              m_split_jobs.push_back(SplitJob(n, scratch_size));
+              scratch_size += 4u * cnt;
+              work += cnt;
+            }
+        }
 
-  iter = m_offsets.find(C.curves());
-  if (iter != m_offsets.end())
+      if (m_split_scratch.size() < scratch_size)
+        {
+          m_split_scratch.resize(scratch_size);
+        }
+
+      if (pool && m_split_jobs.size() > 1u && work >= parallel_work_thresh)
+        {
+          pool->parallel_for(m_split_jobs.size(),
+                             [this, near_thresh](unsigned int i)
+                             {
+                               split_node(m_split_jobs[i], near_thresh);
+                             });
+        }
+      else
+        {
+          for (SplitJob &job : m_split_jobs)
+            {
+              split_node(job, near_thresh);
+            }
+        }
+
+      for (const SplitJob &job : m_split_jobs)
+        {
+          add_children(job);
+        }
+    }
+
+  remove_useless_splits();
+
+  for (unsigned int n = 0, endn = m_nodes.size(); n < endn; ++n)
     {
-      C.m_offset = iter->second;
+      if (!m_nodes[n].m_has_children)
+        {
+          m_leaves.push_back(n);
+        }
+    }
+
+  work = m_leaves.size() * m_curves.size();
+  if (pool && m_leaves.size() > 1u && work >= parallel_work_thresh)
+    {
+      pool->parallel_for(m_leaves.size(),
+                         [this](unsigned int i)
+                         {
+                           compute_initial_sample(m_nodes[m_leaves[i]]);
+                         });
     }
   else
     {
-      C.m_offset = m_current_offset;
-      iter = m_offsets.insert(std::make_pair(C.curves(), C.m_offset)).first;
-      m_current_offset += CurveListPacker::room_required(C.curves().size());
+      for (unsigned int n : m_leaves)
+        {
+          compute_initial_sample(m_nodes[n]);
+        }
     }
+
+  refine_samples(0);
 }
 
 void
-CurveListCollection::
-pack_data(const GlyphPath *p,
-          fastuidraw::c_array<fastuidraw::generic_data> data) const
+CurveListHierarchy::
+split_node(SplitJob &job, fastuidraw::vec2 near_thresh)
 {
-  for (const auto &element : m_offsets)
+  using namespace fastuidraw;
+
+  const HierarchyNode &node(m_nodes[job.m_node]);
+  c_array<const uint32_t> src(curves(node));
+  BoxPair splitX_box(node.m_box.split_x()), splitY_box(node.m_box.split_y());
+  vecN<BoxPair, 2> enlarged_splitX_box, enlarged_splitY_box;
+  vec2 box_size(node.m_box.size());
+  vecN<uint32_t*, 4> dst;
+  ivec2 sz;
+
+  /* if there are curves already in this box, then going further
+   * than the box size gives us nothing because the curves within
+   * the box_size are all already closer.
+   */
+  near_thresh.x() = t_min(near_thresh.x(), box_size.x());
+  near_thresh.y() = t_min(near_thresh.y(), box_size.y());
+
+  create_enlarged_boxes(splitX_box,
+                        near_thresh.x(), near_thresh.y(),
+                        enlarged_splitX_box);
+
+  create_enlarged_boxes(splitY_box,
+                        near_thresh.x(), near_thresh.y(),
+                        enlarged_splitY_box);
+
+  /* the lists of splitting in x are dst[0] and dst[1],
+   * the lists of splitting in y are dst[2] and dst[3]
+   */
+  for (unsigned int i = 0; i < 4; ++i)
+    {
+      dst[i] = &m_split_scratch[job.m_scratch_offset + i * src.size()];
+    }
+
+  job.m_sizes = uvec4(0u);
+  for (uint32_t id : src)
+    {
+      const Curve &curve(*m_curves[id]);
+      for (int i = 0; i < 2; ++i)
+        {
+          if (curve.intersects(splitX_box[i], enlarged_splitX_box[i], near_thresh))
+            {
+              dst[i][job.m_sizes[i]++] = id;
+            }
+          if (curve.intersects(splitY_box[i], enlarged_splitY_box[i], near_thresh))
+            {
+              dst[2 + i][job.m_sizes[2 + i]++] = id;
+            }
+        }
+    }
+
+  /* choose the partition with the smallest sum of curves */
+  sz.x() = job.m_sizes[0] + job.m_sizes[1];
+  sz.y() = job.m_sizes[2] + job.m_sizes[3];
+
+  if (sz.x() == sz.y())
+    {
+      job.m_coordinate = (box_size.x() > box_size.y()) ?
+        0 : 1;
+    }
+  else if (sz.x() < sz.y())
+    {
+      job.m_coordinate = 0;
+    }
+  else
     {
-      pack_element(p, element.first, element.second, data);
+      job.m_coordinate = 1;
     }
 }
 
 void
-CurveListCollection::
-pack_element(const GlyphPath *p,
-             const std::vector<CurveID> &curves,
-             unsigned int offset,
-             fastuidraw::c_array<fastuidraw::generic_data> dst) const
+CurveListHierarchy::
+add_children(const SplitJob &job)
 {
-  CurveListPacker curve_list_packer(dst, offset);
+  using namespace fastuidraw;
 
-  FASTUIDRAWassert(!curves.empty());
-  FASTUIDRAWassert(std::is_sorted(curves.begin(), curves.end()));
-  for (const CurveID &id : curves)
+  unsigned int cnt(m_nodes[job.m_node].num_curves());
+  unsigned int generation(m_nodes[job.m_node].m_generation + 1);
+  unsigned int coord(job.m_coordinate);
+  BoxPair boxes;
+
+  FASTUIDRAWassert(coord <= 1u);
+  boxes = (coord == 0) ?
+    m_nodes[job.m_node].m_box.split_x() :
+    m_nodes[job.m_node].m_box.split_y();
+
+  m_nodes[job.m_node].m_child = m_nodes.size();
+  m_nodes[job.m_node].m_splitting_coordinate = coord;
+  m_nodes[job.m_node].m_has_children = true;
+  for (unsigned int i = 0; i < 2; ++i)
     {
-      const Curve &curve(p->fetch_curve(id));
-      bool has_ctl(curve.has_control());
+      const uint32_t *src(&m_split_scratch[job.m_scratch_offset + (2 * coord + i) * cnt]);
+      unsigned int begin(m_curve_arena.size());
 
-      FASTUIDRAWassert(curve.m_offset > 0);
-      curve_list_packer.add_curve(curve.m_offset, has_ctl);
+      m_curve_arena.insert(m_curve_arena.end(), src, src + job.m_sizes[2 * coord + i]);
+      m_nodes.push_back(HierarchyNode(boxes[i], generation, begin, m_curve_arena.size()));
     }
+}
 
-  curve_list_packer.end_list();
+void
+CurveListHierarchy::
+remove_useless_splits(void)
+{
+  /* the children of a node come after the node, thus
+   * walking backwards handles the children of a node
+   * before the node.
+   */
+  for (unsigned int n = m_nodes.size(); n > 0; --n)
+    {
+      HierarchyNode &node(m_nodes[n - 1]);
+      if (node.m_child >= 0)
+        {
+          const HierarchyNode &child0(m_nodes[node.m_child]);
+          const HierarchyNode &child1(m_nodes[node.m_child + 1]);
+
+          /* if both children have no children and the same
+           * curve list, there is no point of subdividing the
+           * node.
+           */
+          if (!child0.m_has_children
+              && !child1.m_has_children
+              && child0.num_curves() == node.num_curves()
+              && child1.num_curves() == node.num_curves())
+            {
+              node.m_has_children = false;
+              node.m_splitting_coordinate = 3;
+            }
+        }
+    }
 }
 
-///////////////////////////////////
-// CurveListHierarchy methods
 void
 CurveListHierarchy::
-pack_sample_point(unsigned int &offset,
-                  fastuidraw::c_array<fastuidraw::generic_data> dst) const
+compute_initial_sample(HierarchyNode &node) const
 {
   using namespace fastuidraw;
-  typedef GlyphRenderDataRestrictedRays G;
 
-  /* bits 0-15 for winding, biased
-   * bits 16-23 for dx
-   * bits 24-31 for dy
-   */
-  dst[offset++].u = pack_bits(G::winding_value_bit0,
-                              G::winding_value_numbits,
-                              bias_winding(m_winding))
-    | pack_bits(G::delta_x_bit0, G::delta_numbits, m_delta.x())
-    | pack_bits(G::delta_y_bit0, G::delta_numbits, m_delta.y());
+  vec2 pt(node.m_box.min_point());
+  vec2 factor(node.m_box.size() / float(GlyphRenderDataRestrictedRays::delta_div_factor));
+
+  node.m_delta = ivec2(128, 128);
+  node.m_winding = m_path->compute_winding_number(pt + vec2(node.m_delta) * factor,
+                                                  &node.m_best_dist);
 }
 
 void
 CurveListHierarchy::
-pack_texel(fastuidraw::c_array<fastuidraw::generic_data> dst) const
+refine_samples(unsigned int n)
 {
   using namespace fastuidraw;
-  typedef GlyphRenderDataRestrictedRays G;
 
-  if (!has_children())
+  /* The sample point of a leaf is improved by trying random
+   * points; to give the same sample points as generating the
+   * hierarchy recursively, the std::rand() values are consumed
+   * in that order: depth first with the children of a node
+   * before the node, including the nodes whose children were
+   * removed by remove_useless_splits().
+   */
+  HierarchyNode &node(m_nodes[n]);
+  if (node.m_child >= 0)
     {
-      unsigned int offset(m_offset);
-
-      dst[offset++].u = pack_bits(G::hierarchy_leaf_curve_list_bit0,
-                                  G::hierarchy_leaf_curve_list_numbits,
-                                  m_curves.m_offset)
-        | pack_bits(G::hierarchy_leaf_curve_list_size_bit0,
-                    G::hierarchy_leaf_curve_list_size_numbits,
-                    m_curves.curves().size());
-
-      pack_sample_point(offset, dst);
+      refine_samples(node.m_child);
+      refine_samples(node.m_child + 1);
     }
-  else
-    {
-      FASTUIDRAWassert(m_splitting_coordinate <= 1u);
 
-      /* pack the splitting data */
-      dst[m_offset].u =
-        (1u << G::hierarchy_is_node_bit) // bit flag to indicate a node
-        | (m_splitting_coordinate << G::hierarchy_splitting_coordinate_bit) // splitting coordinate
-        | pack_bits(G::hierarchy_child0_offset_bit0,
-                    G::hierarchy_child_offset_numbits,
-                    m_child[0]->m_offset) // pre-split child
-        | pack_bits(G::hierarchy_child1_offset_bit0,
-                    G::hierarchy_child_offset_numbits,
-                    m_child[1]->m_offset); // post-split child
+  if (node.m_has_children)
+    {
+      return;
     }
-}
 
-void
-CurveListHierarchy::
-pack_data(fastuidraw::c_array<fastuidraw::generic_data> dst) const
-{
-  pack_texel(dst);
-  if (has_children())
+  float thresh;
+  vec2 pt(node.m_box.min_point());
+  vec2 box_size(node.m_box.size());
+  vec2 factor(box_size / float(GlyphRenderDataRestrictedRays::delta_div_factor));
+  const int MAX_TRIES = 50;
+
+  thresh = t_sqrt(box_size.x() * box_size.y()) * 0.01f;
+  for (int i = 0; i < MAX_TRIES && node.m_best_dist < thresh; ++i)
     {
-      m_child[0]->pack_data(dst);
-      m_child[1]->pack_data(dst);
+      ivec2 idelta;
+      vec2 delta;
+      float dist;
+      int winding;
+
+      idelta.x() = std::rand() % GlyphRenderDataRestrictedRays::delta_div_factor;
+      idelta.y() = std::rand() % GlyphRenderDataRestrictedRays::delta_div_factor;
+      delta = vec2(idelta) * factor;
+
+      winding = m_path->compute_winding_number(delta + pt, &dist);
+      if (dist > node.m_best_dist)
+        {
+          node.m_delta = idelta;
+          node.m_winding = winding;
+          node.m_best_dist = dist;
+        }
     }
 }
 
 void
 CurveListHierarchy::
-assign_tree_offsets(unsigned int &current)
+assign_tree_offsets(unsigned int n, unsigned int &current)
 {
-  m_offset = current++;
-  if (has_children())
+  HierarchyNode &node(m_nodes[n]);
+
+  node.m_offset = current++;
+  if (node.m_has_children)
     {
-      m_child[0]->assign_tree_offsets(current);
-      m_child[1]->assign_tree_offsets(current);
+      assign_tree_offsets(node.m_child, current);
+      assign_tree_offsets(node.m_child + 1, current);
     }
   else
     {
@@ -1642,115 +1765,154 @@ assign_tree_offsets(unsigned int &current)
     }
 }
 
+unsigned int
+CurveListHierarchy::
+assign_curve_list_offsets(unsigned int start_offset)
+{
+  unsigned int current(start_offset);
+
+  m_list_offsets.clear();
+  m_distinct_lists.clear();
+  assign_curve_list_offsets(0, current);
+  return current;
+}
+
 void
 CurveListHierarchy::
-assign_curve_list_offsets(CurveListCollection &C)
+assign_curve_list_offsets(unsigned int n, unsigned int &current)
 {
-  if (has_children())
+  HierarchyNode &node(m_nodes[n]);
+
+  if (node.m_has_children)
     {
-      m_child[0]->assign_curve_list_offsets(C);
-      m_child[1]->assign_curve_list_offsets(C);
+      assign_curve_list_offsets(node.m_child, current);
+      assign_curve_list_offsets(node.m_child + 1, current);
+    }
+  else if (node.num_curves() == 0)
+    {
+      node.m_curve_list_offset = 0;
     }
   else
     {
-      C.assign_offset(m_curves);
+      CurveListKey key(curves(node));
+      const unsigned int *offset;
+
+      offset = m_list_offsets.find(key);
+      if (offset)
+        {
+          node.m_curve_list_offset = *offset;
+        }
+      else
+        {
+          node.m_curve_list_offset = current;
+          m_list_offsets.insert(key, current);
+          m_distinct_lists.push_back(n);
+          current += CurveListPacker::room_required(node.num_curves());
+        }
     }
 }
 
 void
 CurveListHierarchy::
-subdivide(unsigned int max_recursion, unsigned int split_thresh,
-          fastuidraw::vec2 near_thresh)
+pack_data(fastuidraw::c_array<fastuidraw::generic_data> dst) const
 {
-  using namespace fastuidraw;
-  if (m_generation < max_recursion && m_curves.curves().size() > split_thresh)
+  pack_node(0, dst);
+  for (unsigned int n : m_distinct_lists)
     {
-      m_child[0] = FASTUIDRAWnew CurveListHierarchy(m_generation);
-      m_child[1] = FASTUIDRAWnew CurveListHierarchy(m_generation);
+      const HierarchyNode &node(m_nodes[n]);
+      CurveListPacker curve_list_packer(dst, node.m_curve_list_offset);
 
-      m_splitting_coordinate = m_curves.split(m_child[0]->m_curves,
-                                              m_child[1]->m_curves,
-                                              near_thresh);
-      m_child[0]->subdivide(max_recursion, split_thresh, near_thresh);
-      m_child[1]->subdivide(max_recursion, split_thresh, near_thresh);
-
-      if (!m_child[0]->has_children()
-          && !m_child[1]->has_children()
-          && m_child[0]->m_curves.curves().size() == m_curves.curves().size()
-          && m_child[1]->m_curves.curves().size() == m_curves.curves().size())
+      for (uint32_t id : curves(node))
         {
-          /* both children have no children and
-           * the same curve list, thus there is
-           * no point of subdivding this node
-           */
-          FASTUIDRAWdelete(m_child[0]); m_child[0] = nullptr;
-          FASTUIDRAWdelete(m_child[1]); m_child[1] = nullptr;
-          m_splitting_coordinate = 3;
+          const Curve &curve(*m_curves[id]);
+
+          FASTUIDRAWassert(curve.m_offset > 0);
+          curve_list_packer.add_curve(curve.m_offset, curve.has_control());
         }
+      curve_list_packer.end_list();
     }
+}
+
+void
+CurveListHierarchy::
+pack_node(unsigned int n,
+          fastuidraw::c_array<fastuidraw::generic_data> dst) const
+{
+  using namespace fastuidraw;
+  typedef GlyphRenderDataRestrictedRays G;
 
-  if (!has_children())
+  const HierarchyNode &node(m_nodes[n]);
+  if (!node.m_has_children)
     {
-      float best_dist, thresh;
-      vec2 pt(m_curves.box().min_point());
-      vec2 box_size(m_curves.box().size());
-      vec2 factor(box_size / float(GlyphRenderDataRestrictedRays::delta_div_factor));
-      const int MAX_TRIES = 50;
+      unsigned int offset(node.m_offset);
 
-      thresh = t_sqrt(box_size.x() * box_size.y()) * 0.01f;
-      m_delta = ivec2(128, 128);
-      m_winding = m_curves.glyph_path().compute_winding_number(pt + vec2(m_delta) * factor,
-							       &best_dist);
-      for (int i = 0; i < MAX_TRIES && best_dist < thresh; ++i)
-        {
-          ivec2 idelta;
-          vec2 delta;
-          float dist;
-          int winding;
+      dst[offset++].u = pack_bits(G::hierarchy_leaf_curve_list_bit0,
+                                  G::hierarchy_leaf_curve_list_numbits,
+                                  node.m_curve_list_offset)
+        | pack_bits(G::hierarchy_leaf_curve_list_size_bit0,
+                    G::hierarchy_leaf_curve_list_size_numbits,
+                    node.num_curves());
 
-          idelta.x() = std::rand() % GlyphRenderDataRestrictedRays::delta_div_factor;
-          idelta.y() = std::rand() % GlyphRenderDataRestrictedRays::delta_div_factor;
-          delta = vec2(idelta) * factor;
+      /* bits 0-15 for winding, biased
+       * bits 16-23 for dx
+       * bits 24-31 for dy
+       */
+      dst[offset].u = pack_bits(G::winding_value_bit0,
+                                G::winding_value_numbits,
+                                bias_winding(node.m_winding))
+        | pack_bits(G::delta_x_bit0, G::delta_numbits, node.m_delta.x())
+        | pack_bits(G::delta_y_bit0, G::delta_numbits, node.m_delta.y());
+    }
+  else
+    {
+      FASTUIDRAWassert(node.m_splitting_coordinate <= 1u);
 
-          winding = m_curves.glyph_path().compute_winding_number(delta + pt, &dist);
-          if (dist > best_dist)
-            {
-              m_delta = idelta;
-              m_winding = winding;
-              best_dist = dist;
-            }
-        }
+      /* pack the splitting data */
+      dst[node.m_offset].u =
+        (1u << G::hierarchy_is_node_bit) // bit flag to indicate a node
+        | (node.m_splitting_coordinate << G::hierarchy_splitting_coordinate_bit) // splitting coordinate
+        | pack_bits(G::hierarchy_child0_offset_bit0,
+                    G::hierarchy_child_offset_numbits,
+                    m_nodes[node.m_child].m_offset) // pre-split child
+        | pack_bits(G::hierarchy_child1_offset_bit0,
+                    G::hierarchy_child_offset_numbits,
+                    m_nodes[node.m_child + 1].m_offset); // post-split child
+
+      pack_node(node.m_child, dst);
+      pack_node(node.m_child + 1, dst);
     }
 }
 
 float
 CurveListHierarchy::
-compute_average_curve_cost(void) const
+compute_average_curve_cost(unsigned int n) const
 {
-  if (has_children())
+  const HierarchyNode &node(m_nodes[n]);
+  if (node.m_has_children)
     {
       float v0, v1;
 
-      v0 = m_child[0]->compute_average_curve_cost();
-      v1 = m_child[1]->compute_average_curve_cost();
+      v0 = compute_average_curve_cost(node.m_child);
+      v1 = compute_average_curve_cost(node.m_child + 1);
       return 0.5f * (v0 + v1);
     }
   else
     {
-      return static_cast<float>(m_curves.curves().size());
+      return static_cast<float>(node.num_curves());
     }
 }
 
 float
 CurveListHierarchy::
-compute_average_node_cost(void) const
+compute_average_node_cost(unsigned int n) const
 {
-  if (has_children())
+  const HierarchyNode &node(m_nodes[n]);
+  if (node.m_has_children)
     {
       float v0, v1;
 
-      v0 = m_child[0]->compute_average_node_cost();
-      v1 = m_child[1]->compute_average_node_cost();
+      v0 = compute_average_node_cost(node.m_child);
+      v1 = compute_average_node_cost(node.m_child + 1);
 
       // return the cost of walking this node (value = 1)
       // plus the average of the cost of the children.
@@ -2275,24 +2437,29 @@ finalize(enum PainterEnums::fill_rule_t f,
    */
   d->m_glyph->mark_cancel_curves();
 
-  /* step 3: create the tree */
-  CurveListHierarchy hierarchy(d->m_glyph,
-                               d->m_glyph->glyph_rect_min(),
-                               d->m_glyph->glyph_rect_max(),
-                               max_recursion,
-                               split_thresh,
-                               near_thresh);
+  /* step 3: create the tree; the work is split across the
+   * threads of a WorkerPool unless the caller is a task of a
+   * WorkerPool, in which case glyphs are already generated
+   * in parallel with each other.
+   */
+  CurveListHierarchy &hierarchy(CurveListHierarchy::thread_hierarchy());
+  std::shared_ptr<detail::WorkerPool> pool;
+
+  if (!detail::WorkerPool::executing_task())
+    {
+      pool = detail::WorkerPool::shared(GlyphGenerateParams::restricted_rays_number_threads());
+    }
+  hierarchy.build(d->m_glyph, max_recursion, split_thresh, near_thresh, pool.get());
 
   /* step 4: assign tree offsets */
-  unsigned int tree_size, total_size;
+  unsigned int tree_size, curve_lists_end, total_size;
   tree_size = hierarchy.assign_tree_offsets();
 
   /* step 5: assign the curve list offsets */
-  CurveListCollection curve_lists(tree_size);
-  hierarchy.assign_curve_list_offsets(curve_lists);
+  curve_lists_end = hierarchy.assign_curve_list_offsets(tree_size);
 
   /* step 6: assign the offsets to each of the curves */
-  total_size = d->m_glyph->assign_curve_offsets(curve_lists.current_offset());
+  total_size = d->m_glyph->assign_curve_offsets(curve_lists_end);
 
   /* step 7: pack the data */
   Transformation tr(RectT<int>()
@@ -2302,7 +2469,6 @@ finalize(enum PainterEnums::fill_rule_t f,
   c_array<generic_data> render_data(make_c_array(d->m_render_data));
 
   hierarchy.pack_data(render_data);
-  curve_lists.pack_data(d->m_glyph, render_data);
   d->m_glyph->pack_data(render_data, tr);
 
   d->m_costs[node_average_cost] = hierarchy.compute_average_node_cost();
@@ -2337,6 +2503,7 @@ upload_to_atlas(GlyphAtlasProxy &atlas_proxy,
 
   attributes.resize(glyph_num_attributes);
   d->fill_glyph_attributes(attributes, d->m_fill_rule, data_offset);
+  atlas_proxy.relocatable_attribute(glyph_offset, data_offset);
 
   for (unsigned int i = 0; i < num_costs; ++i)
     {
@@ -2377,6 +2544,80 @@ query(query_info *out_info) const
   return routine_success;
 }
 
+unsigned int
+fastuidraw::GlyphRenderDataRestrictedRays::
+serialized_size(void) const
+{
+  GlyphRenderDataRestrictedRaysPrivate *d;
+  d = static_cast<GlyphRenderDataRestrictedRaysPrivate*>(m_d);
+
+  if (d->m_glyph)
+    {
+      return 0;
+    }
+
+  return sizeof(int32_t)
+    + sizeof(d->m_costs)
+    + sizeof(generic_data) * d->m_render_data.size();
+}
+
+enum fastuidraw::return_code
+fastuidraw::GlyphRenderDataRestrictedRays::
+serialize(c_array<uint8_t> dst) const
+{
+  GlyphRenderDataRestrictedRaysPrivate *d;
+  d = static_cast<GlyphRenderDataRestrictedRaysPrivate*>(m_d);
+
+  if (d->m_glyph)
+    {
+      return routine_fail;
+    }
+
+  detail::ByteWriter W(dst);
+  W.write(int32_t(d->m_fill_rule))
+    .write(d->m_costs)
+    .write(make_c_array(d->m_render_data));
+
+  return (W.overflowed() || W.remaining() != 0) ?
+    routine_fail :
+    routine_success;
+}
+
+enum fastuidraw::return_code
+fastuidraw::GlyphRenderDataRestrictedRays::
+deserialize(c_array<const uint8_t> src)
+{
+  GlyphRenderDataRestrictedRaysPrivate *d;
+  d = static_cast<GlyphRenderDataRestrictedRaysPrivate*>(m_d);
+
+  detail::ByteReader R(src);
+  int32_t fill_rule;
+  vecN<float, num_costs> costs;
+  c_array<const uint8_t> data;
+
+  R.read(&fill_rule)
+    .read(&costs);
+  data = R.take_remaining();
+  if (R.failed()
+      || fill_rule < 0 || fill_rule >= PainterEnums::fill_rule_data_count
+      || data.size() % sizeof(generic_data) != 0)
+    {
+      return routine_fail;
+    }
+
+  if (d->m_glyph)
+    {
+      FASTUIDRAWdelete(d->m_glyph);
+      d->m_glyph = nullptr;
+    }
+
+  d->m_fill_rule = static_cast<enum PainterEnums::fill_rule_t>(fill_rule);
+  d->m_costs = costs;
+  detail::ByteReader(data).read(data.size() / sizeof(generic_data), &d->m_render_data);
+
+  return routine_success;
+}
+
 ///////////////////////////////////////////////////////////
 // fastuidraw::GlyphRenderDataRestrictedRays::query_info methods
 void
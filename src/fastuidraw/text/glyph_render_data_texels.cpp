@@ -20,6 +20,7 @@
 #include <vector>
 #include <fastuidraw/text/glyph_render_data_texels.hpp>
 #include "../private/pack_texels.hpp"
+#include "../private/byte_stream.hpp"
 #include "../private/util_private.hpp"
 #include "../private/util_private_ostream.hpp"
 
@@ -137,6 +138,56 @@ upload_to_atlas(GlyphAtlasProxy &atlas_proxy,
       return routine_fail;
     }
   attributes[1].m_data = vecN<uint32_t, 4>(location);
+  atlas_proxy.relocatable_attribute(1, location);
+
+  return routine_success;
+}
+
+unsigned int
+fastuidraw::GlyphRenderDataTexels::
+serialized_size(void) const
+{
+  GlyphDataPrivate *d;
+  d = static_cast<GlyphDataPrivate*>(m_d);
+  return sizeof(ivec2) + d->m_texels.size();
+}
+
+enum fastuidraw::return_code
+fastuidraw::GlyphRenderDataTexels::
+serialize(c_array<uint8_t> dst) const
+{
+  GlyphDataPrivate *d;
+  d = static_cast<GlyphDataPrivate*>(m_d);
+
+  detail::ByteWriter W(dst);
+  W.write(d->m_resolution)
+    .write(make_c_array(d->m_texels));
+
+  return (W.overflowed() || W.remaining() != 0) ?
+    routine_fail :
+    routine_success;
+}
+
+enum fastuidraw::return_code
+fastuidraw::GlyphRenderDataTexels::
+deserialize(c_array<const uint8_t> src)
+{
+  GlyphDataPrivate *d;
+  d = static_cast<GlyphDataPrivate*>(m_d);
+
+  detail::ByteReader R(src);
+  ivec2 resolution;
+
+  R.read(&resolution);
+  if (R.failed() || resolution.x() < 0 || resolution.y() < 0
+      || uint64_t(src.size() - sizeof(ivec2)) != uint64_t(resolution.x()) * uint64_t(resolution.y()))
+    {
+      return routine_fail;
+    }
+
+  d->resize(resolution);
+  R.read(d->m_texels.size(), &d->m_texels);
+  FASTUIDRAWassert(R.at_end());
 
   return routine_success;
 }
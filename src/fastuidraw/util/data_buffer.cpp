@@ -19,12 +19,56 @@
 #include <vector>
 #include <fstream>
 #include <cstring>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
 #include <fastuidraw/util/data_buffer.hpp>
 #include "../private/util_private.hpp"
 
 namespace
 {
   typedef std::vector<uint8_t> DataBufferBackingStorePrivate;
+
+  class MappedFileBackingStorePrivate
+  {
+  public:
+    explicit
+    MappedFileBackingStorePrivate(fastuidraw::c_string filename):
+      m_ptr(MAP_FAILED),
+      m_size(0)
+    {
+      int fd;
+      struct stat st;
+
+      fd = ::open(filename, O_RDONLY | O_CLOEXEC);
+      if (fd < 0)
+        {
+          return;
+        }
+
+      if (::fstat(fd, &st) == 0 && st.st_size > 0)
+        {
+          m_size = st.st_size;
+          m_ptr = ::mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        }
+
+      /* the mapping stays valid after closing the file */
+      ::close(fd);
+    }
+
+    ~MappedFileBackingStorePrivate()
+    {
+      if (m_ptr != MAP_FAILED)
+        {
+          ::munmap(m_ptr, m_size);
+        }
+    }
+
+    void *m_ptr;
+    size_t m_size;
+  };
 }
 
 fastuidraw::DataBufferBackingStore::
@@ -90,3 +134,30 @@ data(void)
   d = static_cast<DataBufferBackingStorePrivate*>(m_d);
   return make_c_array(*d);
 }
+
+//////////////////////////////////////////////
+// fastuidraw::MappedFileBackingStore methods
+fastuidraw::MappedFileBackingStore::
+MappedFileBackingStore(c_string filename)
+{
+  m_d = FASTUIDRAWnew MappedFileBackingStorePrivate(filename);
+}
+
+fastuidraw::MappedFileBackingStore::
+~MappedFileBackingStore()
+{
+  MappedFileBackingStorePrivate *d;
+  d = static_cast<MappedFileBackingStorePrivate*>(m_d);
+  FASTUIDRAWdelete(d);
+}
+
+fastuidraw::c_array<const uint8_t>
+fastuidraw::MappedFileBackingStore::
+data(void) const
+{
+  MappedFileBackingStorePrivate *d;
+  d = static_cast<MappedFileBackingStorePrivate*>(m_d);
+  return (d->m_ptr != MAP_FAILED) ?
+    c_array<const uint8_t>(static_cast<const uint8_t*>(d->m_ptr), d->m_size) :
+    c_array<const uint8_t>();
+}